@@ -0,0 +1,267 @@
+#include "arena.h"
+
+#include <cerrno>         // 用于 errno
+#include <cstring>        // 用于 strerror
+#include <thread>         // 用于 yield
+#include <sys/mman.h>     // 用于 mmap/madvise
+#include <sys/syscall.h>  // 用于 SYS_mbind（不依赖 libnuma）
+#include <unistd.h>       // 用于 sysconf/syscall
+
+#ifndef MAP_HUGE_SHIFT
+#define MAP_HUGE_SHIFT 26
+#endif
+
+namespace quant {
+namespace base {
+namespace common {
+namespace arena {
+
+namespace {
+
+constexpr size_t k2MB = size_t(1) << 21;
+constexpr size_t k1GB = size_t(1) << 30;
+constexpr size_t kMaxAlignment = 4096;
+constexpr int kMpolBind = 2;                    // MPOL_BIND
+constexpr unsigned long kMaxNumaNodes = 1024;
+
+void set_error(std::string* error, const std::string& message) {
+    if (error != nullptr) {
+        *error = message;
+    }
+}
+
+size_t round_up(size_t value, size_t alignment) {
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+// hugetlb 映射：需要系统预留对应规格的大页（/sys/kernel/mm/hugepages）
+void* map_huge(size_t bytes, size_t page_bytes) {
+    int shift = page_bytes == k1GB ? 30 : 21;
+    int flags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | (shift << MAP_HUGE_SHIFT);
+    void* memory = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, flags, -1, 0);
+    return memory == MAP_FAILED ? nullptr : memory;
+}
+
+// 普通页映射：按 2MB 对齐（多映射一段再裁掉首尾），并建议内核使用透明大页
+void* map_regular(size_t bytes) {
+    size_t padded = bytes + k2MB;
+    void* raw = mmap(nullptr, padded, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (raw == MAP_FAILED) {
+        return nullptr;
+    }
+    uintptr_t start = reinterpret_cast<uintptr_t>(raw);
+    uintptr_t aligned = round_up(start, k2MB);
+    if (aligned > start) {
+        munmap(raw, aligned - start);
+    }
+    size_t tail = (start + padded) - (aligned + bytes);
+    if (tail > 0) {
+        munmap(reinterpret_cast<void*>(aligned + bytes), tail);
+    }
+#ifdef MADV_HUGEPAGE
+    madvise(reinterpret_cast<void*>(aligned), bytes, MADV_HUGEPAGE);
+#endif
+    return reinterpret_cast<void*>(aligned);
+}
+
+bool bind_numa(void* memory, size_t bytes, int node) {
+    if (node < 0 || static_cast<unsigned long>(node) >= kMaxNumaNodes) {
+        return false;
+    }
+    unsigned long mask[kMaxNumaNodes / (8 * sizeof(unsigned long))] = {};
+    mask[node / (8 * sizeof(unsigned long))] = 1UL << (node % (8 * sizeof(unsigned long)));
+    return syscall(SYS_mbind, memory, bytes, kMpolBind, mask, kMaxNumaNodes, 0) == 0;
+}
+
+class SpinGuard {
+public:
+    explicit SpinGuard(std::atomic_flag& flag) : flag_(flag) {
+        while (flag_.test_and_set(std::memory_order_acquire)) {
+            std::this_thread::yield();
+        }
+    }
+    ~SpinGuard() { flag_.clear(std::memory_order_release); }
+
+    SpinGuard(const SpinGuard&) = delete;
+    SpinGuard& operator=(const SpinGuard&) = delete;
+
+private:
+    std::atomic_flag& flag_;
+};
+
+}  // namespace
+
+std::shared_ptr<Arena> Arena::create(const ArenaOptions& options, std::string* error) {
+    if (options.bytes == 0) {
+        set_error(error, "arena size must be greater than 0");
+        return nullptr;
+    }
+
+    size_t page_bytes = options.page_size == PageSize::k1GB ? k1GB
+                        : options.page_size == PageSize::k2MB ? k2MB
+                                                              : static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    size_t capacity = round_up(options.bytes, page_bytes < k2MB ? k2MB : page_bytes);
+    void* memory = nullptr;
+    bool huge_pages = false;
+    if (options.page_size != PageSize::kDefault) {
+        memory = map_huge(capacity, page_bytes);
+        huge_pages = memory != nullptr;
+        if (memory == nullptr && options.require_huge_pages) {
+            set_error(error, "mmap " + std::to_string(capacity) + " bytes of " + std::to_string(page_bytes >> 20) +
+                                 "MB huge pages failed: " + std::strerror(errno));
+            return nullptr;
+        }
+    }
+    if (memory == nullptr) {
+        page_bytes = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        memory = map_regular(capacity);
+        if (memory == nullptr) {
+            set_error(error, "mmap " + std::to_string(capacity) + " bytes failed: " + std::strerror(errno));
+            return nullptr;
+        }
+    }
+
+    // NUMA 绑定须在首次写入（缺页）之前完成，页才会落在目标节点上
+    int numa_node = -1;
+    if (options.numa_node >= 0) {
+        if (bind_numa(memory, capacity, options.numa_node)) {
+            numa_node = options.numa_node;
+        } else if (options.require_numa) {
+            set_error(error, "mbind to NUMA node " + std::to_string(options.numa_node) +
+                                 " failed: " + std::strerror(errno));
+            munmap(memory, capacity);
+            return nullptr;
+        }
+    }
+
+    if (options.prefault) {
+        volatile char* bytes = static_cast<volatile char*>(memory);
+        for (size_t offset = 0; offset < capacity; offset += page_bytes) {
+            bytes[offset] = 0;
+        }
+    }
+
+    return std::shared_ptr<Arena>(new Arena(options, memory, capacity, page_bytes, huge_pages, numa_node));
+}
+
+Arena::Arena(const ArenaOptions& options, void* memory, size_t capacity, size_t page_bytes, bool huge_pages,
+             int numa_node)
+    : name_(options.name),
+      base_(reinterpret_cast<uintptr_t>(memory)),
+      capacity_(capacity),
+      page_bytes_(page_bytes),
+      huge_pages_(huge_pages),
+      numa_node_(numa_node),
+      heap_fallback_(options.heap_fallback) {
+    if (!name_.empty()) {
+        auto& registry = metrics::MetricsRegistry::instance();
+        used_gauge_ = registry.gauge("arena." + name_ + ".used_bytes");
+        fallback_counter_ = registry.counter("arena." + name_ + ".heap_fallbacks");
+    }
+}
+
+Arena::~Arena() {
+    munmap(reinterpret_cast<void*>(base_), capacity_);
+}
+
+size_t Arena::size_class(size_t bytes, size_t alignment) {
+    size_t size = bytes > alignment ? bytes : alignment;
+    size_t index = kMinClass;
+    while ((size_t(1) << index) < size && index < kClassCount) {
+        ++index;
+    }
+    return index;
+}
+
+void* Arena::allocate(size_t bytes, size_t alignment) {
+    if (alignment == 0 || (alignment & (alignment - 1)) != 0) {
+        return nullptr;
+    }
+    size_t index = size_class(bytes, alignment);
+    if (alignment <= kMaxAlignment && index < kClassCount) {
+        size_t block = size_t(1) << index;
+        FreeList& list = free_lists_[index];
+        FreeBlock* reused = nullptr;
+        {
+            SpinGuard guard(list.lock);
+            reused = list.head;
+            if (reused != nullptr) {
+                list.head = reused->next;
+            }
+        }
+        if (reused != nullptr) {
+            update_gauge(in_use_.fetch_add(block, std::memory_order_relaxed) + block);
+            return reused;
+        }
+
+        // 从未切分区域切出新块：块按 min(块大小, 4096) 对齐，对齐产生的空隙不再回收
+        size_t block_alignment = block < kMaxAlignment ? block : kMaxAlignment;
+        size_t current = cursor_.load(std::memory_order_relaxed);
+        for (;;) {
+            size_t start = round_up(current, block_alignment);
+            if (start + block > capacity_ || start + block < start) {
+                break;
+            }
+            if (cursor_.compare_exchange_weak(current, start + block, std::memory_order_relaxed)) {
+                update_gauge(in_use_.fetch_add(block, std::memory_order_relaxed) + block);
+                return reinterpret_cast<void*>(base_ + start);
+            }
+        }
+    }
+
+    if (!heap_fallback_) {
+        return nullptr;
+    }
+    heap_fallbacks_.fetch_add(1, std::memory_order_relaxed);
+    fallback_counter_.inc();
+    return heap_allocate(bytes, alignment);
+}
+
+void Arena::deallocate(void* pointer, size_t bytes, size_t alignment) {
+    if (pointer == nullptr) {
+        return;
+    }
+    if (!owns(pointer)) {
+        ::operator delete(pointer, std::align_val_t(alignment));
+        return;
+    }
+    size_t index = size_class(bytes, alignment);
+    size_t block = size_t(1) << index;
+    auto* freed = static_cast<FreeBlock*>(pointer);
+    FreeList& list = free_lists_[index];
+    {
+        SpinGuard guard(list.lock);
+        freed->next = list.head;
+        list.head = freed;
+    }
+    update_gauge(in_use_.fetch_sub(block, std::memory_order_relaxed) - block);
+}
+
+void* Arena::heap_allocate(size_t bytes, size_t alignment) {
+    try {
+        return ::operator new(bytes, std::align_val_t(alignment));
+    } catch (const std::bad_alloc&) {
+        return nullptr;
+    }
+}
+
+void Arena::update_gauge(size_t in_use) {
+    used_gauge_.set(static_cast<int64_t>(in_use));
+}
+
+ArenaStats Arena::stats() const {
+    ArenaStats stats;
+    stats.capacity = capacity_;
+    stats.reserved = cursor_.load(std::memory_order_relaxed);
+    stats.in_use = in_use_.load(std::memory_order_relaxed);
+    stats.page_bytes = page_bytes_;
+    stats.huge_pages = huge_pages_;
+    stats.numa_node = numa_node_;
+    stats.heap_fallbacks = heap_fallbacks_.load(std::memory_order_relaxed);
+    return stats;
+}
+
+}  // namespace arena
+}  // namespace common
+}  // namespace base
+}  // namespace quant
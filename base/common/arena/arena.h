@@ -0,0 +1,166 @@
+#ifndef BASE_COMMON_ARENA_ARENA_H_
+#define BASE_COMMON_ARENA_ARENA_H_
+
+#include <atomic>         // 用于分配游标与空闲链表锁
+#include <cstddef>        // 用于 size_t
+#include <cstdint>        // 用于 uint64_t
+#include <limits>         // 用于 numeric_limits
+#include <memory>         // 用于 shared_ptr
+#include <new>            // 用于 bad_alloc/align_val_t
+#include <string>
+#include <type_traits>    // 用于 true_type
+#include "../metrics/metrics.h"  // 用量与回退次数指标
+
+namespace quant {
+namespace base {
+namespace common {
+namespace arena {
+
+// 大页内存区：启动时一次性映射（可选 2MB/1GB 大页、绑定 NUMA 节点、预先缺页），
+// 运行期在区内按 2 的幂分级分配，归还的块进入对应级别的空闲链表供复用
+// - 适合大块、长期存在的数据结构：环形缓冲、订单池、K 线面板、队列分段
+// - 线程安全：分配游标为原子变量，每个级别的空闲链表由自旋锁保护
+// - 区内空间耗尽时可回退到全局堆（默认开启），回退次数计入 stats()/指标
+enum class PageSize {
+    kDefault,       // 普通页（配合 fallback 时会尝试透明大页）
+    k2MB,
+    k1GB,
+};
+
+struct ArenaOptions {
+    std::string name;                   // 非空时导出 arena.<name>.used_bytes / .heap_fallbacks 指标
+    size_t bytes = 64 << 20;            // 区大小（向上取整到页大小）
+    PageSize page_size = PageSize::k2MB;
+    int numa_node = -1;                 // 绑定的 NUMA 节点，-1 表示不绑定
+    bool prefault = true;               // 创建时逐页写入，把缺页开销挪到启动阶段
+    bool require_huge_pages = false;    // 大页不可用时失败（否则回退为普通页 + 透明大页）
+    bool require_numa = false;          // NUMA 绑定失败时失败（否则不绑定继续）
+    bool heap_fallback = true;          // 区内空间耗尽时回退到全局堆
+};
+
+struct ArenaStats {
+    size_t capacity = 0;                // 映射大小
+    size_t reserved = 0;                // 已切分出去的字节数（含空闲链表中的块）
+    size_t in_use = 0;                  // 当前由调用方持有的字节数
+    size_t page_bytes = 0;              // 实际使用的页大小
+    bool huge_pages = false;            // 是否为 hugetlb 大页映射
+    int numa_node = -1;                 // 实际绑定的节点，-1 表示未绑定
+    uint64_t heap_fallbacks = 0;        // 回退到全局堆的分配次数
+};
+
+class Arena {
+public:
+    ~Arena();
+
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+
+    // 创建并映射区（失败返回 nullptr 并写入 error）；使用该区的容器必须先于区析构
+    static std::shared_ptr<Arena> create(const ArenaOptions& options, std::string* error = nullptr);
+
+    // 分配/归还：bytes 向上取整为 2 的幂（至少 64 字节），对齐不超过 4096 字节
+    // 区内空间耗尽且不允许回退时返回 nullptr
+    void* allocate(size_t bytes, size_t alignment = alignof(std::max_align_t));
+    void deallocate(void* pointer, size_t bytes, size_t alignment = alignof(std::max_align_t));
+
+    bool owns(const void* pointer) const {
+        auto address = reinterpret_cast<uintptr_t>(pointer);
+        return address >= base_ && address < base_ + capacity_;
+    }
+
+    ArenaStats stats() const;
+    const std::string& name() const { return name_; }
+
+private:
+    static constexpr size_t kMinClass = 6;      // 64 字节
+    static constexpr size_t kClassCount = 48;   // 最大 2^47 字节
+
+    struct FreeBlock {
+        FreeBlock* next;
+    };
+
+    // 每个级别独占缓存行，避免不同级别的锁互相伪共享
+    struct alignas(64) FreeList {
+        std::atomic_flag lock = ATOMIC_FLAG_INIT;
+        FreeBlock* head = nullptr;
+    };
+
+    Arena(const ArenaOptions& options, void* memory, size_t capacity, size_t page_bytes, bool huge_pages,
+          int numa_node);
+
+    static size_t size_class(size_t bytes, size_t alignment);
+    void* heap_allocate(size_t bytes, size_t alignment);
+    void update_gauge(size_t in_use);
+
+    std::string name_;
+    uintptr_t base_;
+    size_t capacity_;
+    size_t page_bytes_;
+    bool huge_pages_;
+    int numa_node_;
+    bool heap_fallback_;
+    alignas(64) std::atomic<size_t> cursor_{0};     // 下一个未切分的偏移
+    std::atomic<size_t> in_use_{0};
+    std::atomic<uint64_t> heap_fallbacks_{0};
+    FreeList free_lists_[kClassCount];
+    metrics::Gauge used_gauge_;
+    metrics::Counter fallback_counter_;
+};
+
+// 标准库分配器适配：容器通过模板参数接入区（如 SafeQueue<T, ArenaAllocator<T>>）
+// 未绑定区（默认构造）时使用全局堆，因此可以作为默认模板实参
+template <typename T>
+class ArenaAllocator {
+public:
+    using value_type = T;
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+
+    ArenaAllocator() noexcept = default;
+    explicit ArenaAllocator(Arena* arena) noexcept : arena_(arena) {}
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) noexcept : arena_(other.arena()) {}
+
+    T* allocate(size_t n) {
+        if (n > std::numeric_limits<size_t>::max() / sizeof(T)) {
+            throw std::bad_alloc();
+        }
+        void* pointer = arena_ != nullptr ? arena_->allocate(n * sizeof(T), alignof(T))
+                                          : ::operator new(n * sizeof(T), std::align_val_t(alignof(T)));
+        if (pointer == nullptr) {
+            throw std::bad_alloc();
+        }
+        return static_cast<T*>(pointer);
+    }
+
+    void deallocate(T* pointer, size_t n) noexcept {
+        if (arena_ != nullptr) {
+            arena_->deallocate(pointer, n * sizeof(T), alignof(T));
+        } else {
+            ::operator delete(pointer, std::align_val_t(alignof(T)));
+        }
+    }
+
+    Arena* arena() const noexcept { return arena_; }
+
+private:
+    Arena* arena_ = nullptr;
+};
+
+template <typename T, typename U>
+bool operator==(const ArenaAllocator<T>& lhs, const ArenaAllocator<U>& rhs) noexcept {
+    return lhs.arena() == rhs.arena();
+}
+
+template <typename T, typename U>
+bool operator!=(const ArenaAllocator<T>& lhs, const ArenaAllocator<U>& rhs) noexcept {
+    return lhs.arena() != rhs.arena();
+}
+
+}  // namespace arena
+}  // namespace common
+}  // namespace base
+}  // namespace quant
+
+#endif  // BASE_COMMON_ARENA_ARENA_H_
@@ -0,0 +1,352 @@
+#include "checkpoint.h"
+
+#include <algorithm>      // 用于 max
+#include <cerrno>         // 用于 errno
+#include <cstdio>         // 用于 fprintf
+#include <fcntl.h>        // 用于 open
+#include <sys/mman.h>     // 用于 mmap/msync
+#include <sys/stat.h>     // 用于 fstat
+#include <unistd.h>       // 用于 ftruncate/close
+
+namespace quant {
+namespace base {
+namespace common {
+namespace checkpoint {
+
+namespace {
+
+// 文件布局：FileHeader（占一页）+ 槽位 0 + 槽位 1
+// 槽位布局：SlotHeader + SectionEntry[section_count] + 数据
+constexpr char kMagic[8] = {'Q', 'T', 'C', 'K', 'P', 'T', '0', '1'};
+constexpr uint32_t kLayoutVersion = 1;
+constexpr size_t kSlotCount = 2;
+constexpr size_t kFileHeaderBytes = 4096;
+
+struct FileHeader {
+    char magic[8];
+    uint32_t layout_version;
+    uint32_t slot_count;
+    uint64_t slot_bytes;
+};
+
+struct SlotHeader {
+    std::atomic<uint64_t> sequence;     // 0 表示空槽位；提交时最后写入
+    int64_t timestamp_ns;
+    uint32_t section_count;
+    uint32_t reserved;
+    uint64_t body_bytes;                // 段表 + 数据的字节数
+    uint64_t checksum;                  // 段表 + 数据的 FNV-1a 64 位校验和
+};
+
+struct SectionEntry {
+    char name[kMaxSectionName];
+    uint64_t offset;                    // 相对数据区起点
+    uint64_t size;
+};
+
+static_assert(sizeof(std::atomic<uint64_t>) == sizeof(uint64_t), "lock-free 64-bit atomics required");
+
+void set_error(std::string* error, const std::string& message) {
+    if (error != nullptr) {
+        *error = message;
+    }
+}
+
+uint64_t fnv1a(const uint8_t* data, size_t size) {
+    uint64_t hash = 1469598103934665603ULL;
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= data[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+size_t mapped_size(size_t slot_bytes) {
+    return kFileHeaderBytes + kSlotCount * slot_bytes;
+}
+
+uint8_t* slot_at(void* memory, size_t slot_bytes, size_t index) {
+    return static_cast<uint8_t*>(memory) + kFileHeaderBytes + index * slot_bytes;
+}
+
+// 校验槽位，返回其序号（无效返回 0）
+uint64_t valid_sequence(const uint8_t* slot, size_t slot_bytes) {
+    const auto* header = reinterpret_cast<const SlotHeader*>(slot);
+    uint64_t sequence = header->sequence.load(std::memory_order_acquire);
+    if (sequence == 0 || header->body_bytes > slot_bytes - sizeof(SlotHeader) ||
+        header->section_count * sizeof(SectionEntry) > header->body_bytes) {
+        return 0;
+    }
+    if (fnv1a(slot + sizeof(SlotHeader), header->body_bytes) != header->checksum) {
+        return 0;
+    }
+    return sequence;
+}
+
+int64_t wall_ns() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+}  // namespace
+
+// ==================== CheckpointImage ====================
+
+CheckpointImage::~CheckpointImage() {
+    if (memory_ != nullptr) {
+        ::munmap(memory_, mapped_bytes_);
+    }
+}
+
+std::unique_ptr<CheckpointImage> CheckpointImage::open(const std::string& path, std::string* error) {
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        set_error(error, "open " + path + " failed: " + std::strerror(errno));
+        return nullptr;
+    }
+    struct stat st;
+    FileHeader header;
+    if (::fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < kFileHeaderBytes ||
+        ::pread(fd, &header, sizeof(header), 0) != static_cast<ssize_t>(sizeof(header)) ||
+        std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0 || header.layout_version != kLayoutVersion ||
+        header.slot_count != kSlotCount || header.slot_bytes <= sizeof(SlotHeader) ||
+        static_cast<size_t>(st.st_size) != mapped_size(header.slot_bytes)) {
+        ::close(fd);
+        set_error(error, path + " is not a checkpoint file");
+        return nullptr;
+    }
+    size_t size = static_cast<size_t>(st.st_size);
+    void* memory = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (memory == MAP_FAILED) {
+        set_error(error, "mmap " + path + " failed: " + std::strerror(errno));
+        return nullptr;
+    }
+
+    std::unique_ptr<CheckpointImage> image(new CheckpointImage());
+    image->memory_ = memory;
+    image->mapped_bytes_ = size;
+    for (size_t i = 0; i < kSlotCount; ++i) {
+        const uint8_t* slot = slot_at(memory, header.slot_bytes, i);
+        uint64_t sequence = valid_sequence(slot, header.slot_bytes);
+        if (sequence > image->sequence_) {
+            image->sequence_ = sequence;
+            image->slot_ = slot;
+            image->timestamp_ns_ = reinterpret_cast<const SlotHeader*>(slot)->timestamp_ns;
+        }
+    }
+    if (image->slot_ == nullptr) {
+        set_error(error, path + " has no valid checkpoint");
+        return nullptr;
+    }
+    return image;
+}
+
+bool CheckpointImage::find(const std::string& name, const uint8_t*& data, size_t& size) const {
+    const auto* header = reinterpret_cast<const SlotHeader*>(slot_);
+    const auto* entries = reinterpret_cast<const SectionEntry*>(slot_ + sizeof(SlotHeader));
+    const uint8_t* body = slot_ + sizeof(SlotHeader) + header->section_count * sizeof(SectionEntry);
+    size_t body_data = header->body_bytes - header->section_count * sizeof(SectionEntry);
+    for (uint32_t i = 0; i < header->section_count; ++i) {
+        if (std::strncmp(entries[i].name, name.c_str(), kMaxSectionName) == 0) {
+            if (entries[i].offset > body_data || entries[i].size > body_data - entries[i].offset) {
+                return false;
+            }
+            data = body + entries[i].offset;
+            size = static_cast<size_t>(entries[i].size);
+            return true;
+        }
+    }
+    return false;
+}
+
+std::vector<std::string> CheckpointImage::sections() const {
+    const auto* header = reinterpret_cast<const SlotHeader*>(slot_);
+    const auto* entries = reinterpret_cast<const SectionEntry*>(slot_ + sizeof(SlotHeader));
+    std::vector<std::string> names;
+    for (uint32_t i = 0; i < header->section_count; ++i) {
+        names.emplace_back(entries[i].name, strnlen(entries[i].name, kMaxSectionName));
+    }
+    return names;
+}
+
+// ==================== Checkpointer ====================
+
+std::unique_ptr<Checkpointer> Checkpointer::create(const CheckpointOptions& options, std::string* error) {
+    if (options.path.empty() || options.slot_bytes <= sizeof(SlotHeader)) {
+        set_error(error, "invalid checkpoint options");
+        return nullptr;
+    }
+    int fd = ::open(options.path.c_str(), O_CREAT | O_RDWR, 0644);
+    if (fd < 0) {
+        set_error(error, "open " + options.path + " failed: " + std::strerror(errno));
+        return nullptr;
+    }
+
+    // 布局一致时保留已有槽位（重启后第一次检查点之前崩溃也不丢上一次的状态）
+    size_t size = mapped_size(options.slot_bytes);
+    struct stat st;
+    FileHeader header;
+    bool reuse = ::fstat(fd, &st) == 0 && static_cast<size_t>(st.st_size) == size &&
+                 ::pread(fd, &header, sizeof(header), 0) == static_cast<ssize_t>(sizeof(header)) &&
+                 std::memcmp(header.magic, kMagic, sizeof(kMagic)) == 0 &&
+                 header.layout_version == kLayoutVersion && header.slot_count == kSlotCount &&
+                 header.slot_bytes == options.slot_bytes;
+    if (!reuse && (::ftruncate(fd, 0) != 0 || ::ftruncate(fd, static_cast<off_t>(size)) != 0)) {
+        set_error(error, "ftruncate " + options.path + " failed: " + std::strerror(errno));
+        ::close(fd);
+        return nullptr;
+    }
+    void* memory = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (memory == MAP_FAILED) {
+        set_error(error, "mmap " + options.path + " failed: " + std::strerror(errno));
+        return nullptr;
+    }
+
+    uint64_t sequence = 0;
+    if (reuse) {
+        for (size_t i = 0; i < kSlotCount; ++i) {
+            sequence = std::max(sequence, valid_sequence(slot_at(memory, options.slot_bytes, i), options.slot_bytes));
+        }
+    } else {
+        FileHeader fresh{};
+        std::memcpy(fresh.magic, kMagic, sizeof(kMagic));
+        fresh.layout_version = kLayoutVersion;
+        fresh.slot_count = kSlotCount;
+        fresh.slot_bytes = options.slot_bytes;
+        std::memcpy(memory, &fresh, sizeof(fresh));
+    }
+    return std::unique_ptr<Checkpointer>(new Checkpointer(options, memory, size, sequence));
+}
+
+Checkpointer::Checkpointer(const CheckpointOptions& options, void* memory, size_t mapped_bytes, uint64_t sequence)
+    : options_(options), memory_(memory), mapped_bytes_(mapped_bytes), sequence_(sequence) {}
+
+Checkpointer::~Checkpointer() {
+    stop(false);
+    ::munmap(memory_, mapped_bytes_);
+}
+
+bool Checkpointer::add_section(const std::string& name, CaptureFn capture) {
+    if (name.empty() || name.size() >= kMaxSectionName || !capture) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(commit_mutex_);
+    for (const auto& section : sections_) {
+        if (section.name == name) {
+            return false;
+        }
+    }
+    sections_.push_back(Section{name, std::move(capture), std::string()});
+    return true;
+}
+
+bool Checkpointer::checkpoint_now(std::string* error) {
+    std::lock_guard<std::mutex> lock(commit_mutex_);
+    auto start = std::chrono::steady_clock::now();
+
+    // 1. 采集（失败的段沿用上一次的内容）
+    for (auto& section : sections_) {
+        scratch_.clear();
+        bool captured = false;
+        try {
+            captured = section.capture(scratch_);
+        } catch (const std::exception& e) {
+            std::fprintf(stderr, "[checkpoint] capture %s failed: %s\n", section.name.c_str(), e.what());
+        }
+        if (captured) {
+            section.data.swap(scratch_);
+        }
+    }
+
+    // 2. 写入较旧的槽位：先作废，再写段表与数据，最后写序号
+    size_t table_bytes = sections_.size() * sizeof(SectionEntry);
+    size_t body_bytes = table_bytes;
+    for (const auto& section : sections_) {
+        body_bytes += section.data.size();
+    }
+    if (body_bytes > options_.slot_bytes - sizeof(SlotHeader)) {
+        failures_.fetch_add(1, std::memory_order_relaxed);
+        set_error(error, "checkpoint of " + std::to_string(body_bytes) + " bytes exceeds slot capacity");
+        return false;
+    }
+
+    uint64_t next = sequence_.load(std::memory_order_relaxed) + 1;
+    uint8_t* slot = slot_at(memory_, options_.slot_bytes, next % kSlotCount);
+    auto* header = reinterpret_cast<SlotHeader*>(slot);
+    header->sequence.store(0, std::memory_order_release);
+
+    auto* entries = reinterpret_cast<SectionEntry*>(slot + sizeof(SlotHeader));
+    uint8_t* data = slot + sizeof(SlotHeader) + table_bytes;
+    uint64_t offset = 0;
+    for (size_t i = 0; i < sections_.size(); ++i) {
+        SectionEntry entry{};
+        std::memcpy(entry.name, sections_[i].name.data(), sections_[i].name.size());
+        entry.offset = offset;
+        entry.size = sections_[i].data.size();
+        std::memcpy(&entries[i], &entry, sizeof(entry));
+        std::memcpy(data + offset, sections_[i].data.data(), sections_[i].data.size());
+        offset += sections_[i].data.size();
+    }
+    header->timestamp_ns = wall_ns();
+    header->section_count = static_cast<uint32_t>(sections_.size());
+    header->reserved = 0;
+    header->body_bytes = body_bytes;
+    header->checksum = fnv1a(slot + sizeof(SlotHeader), body_bytes);
+    header->sequence.store(next, std::memory_order_release);
+
+    // 异步刷盘：进程崩溃时页缓存中的数据仍然保留，这里只缩短掉电丢失窗口
+    ::msync(slot, sizeof(SlotHeader) + body_bytes, MS_ASYNC);
+
+    sequence_.store(next, std::memory_order_release);
+    last_duration_ns_.store(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - start).count(), std::memory_order_relaxed);
+    return true;
+}
+
+void Checkpointer::start() {
+    std::lock_guard<std::mutex> lock(wait_mutex_);
+    if (running_) {
+        return;
+    }
+    running_ = true;
+    thread_ = std::thread(&Checkpointer::run, this);
+}
+
+void Checkpointer::stop(bool final_checkpoint) {
+    {
+        std::lock_guard<std::mutex> lock(wait_mutex_);
+        if (!running_) {
+            return;
+        }
+        running_ = false;
+    }
+    wait_cv_.notify_all();
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+    if (final_checkpoint) {
+        checkpoint_now();
+    }
+}
+
+void Checkpointer::run() {
+    std::unique_lock<std::mutex> lock(wait_mutex_);
+    while (running_) {
+        if (wait_cv_.wait_for(lock, options_.interval, [this]() { return !running_; })) {
+            break;
+        }
+        lock.unlock();
+        std::string error;
+        if (!checkpoint_now(&error) && !error.empty()) {
+            std::fprintf(stderr, "[checkpoint] %s\n", error.c_str());
+        }
+        lock.lock();
+    }
+}
+
+}  // namespace checkpoint
+}  // namespace common
+}  // namespace base
+}  // namespace quant
@@ -0,0 +1,207 @@
+#ifndef BASE_COMMON_CHECKPOINT_CHECKPOINT_H_
+#define BASE_COMMON_CHECKPOINT_CHECKPOINT_H_
+
+#include <atomic>             // 用于原子状态
+#include <chrono>             // 用于检查点周期
+#include <condition_variable> // 后台线程等待
+#include <cstddef>            // 用于 size_t
+#include <cstdint>            // 用于 uint64_t
+#include <cstring>            // 用于 memcpy
+#include <functional>         // 用于采集回调
+#include <memory>             // 用于 unique_ptr
+#include <mutex>              // 注册与提交（冷路径）加锁
+#include <string>
+#include <thread>
+#include <type_traits>        // 用于 is_trivially_copyable
+#include <vector>
+
+namespace quant {
+namespace base {
+namespace common {
+namespace checkpoint {
+
+constexpr size_t kMaxSectionName = 48;          // 段名最大长度（含结尾 '\0'）
+
+// 检查点文件：文件头 + 两个定长槽位（双缓冲）
+// - 每次检查点写入序号较旧的槽位，全部写完后最后写入序号，崩溃时至多损坏正在写的槽位
+// - 启动时选择序号最大且校验和正确的槽位，映射后按段名直接读取（零拷贝）
+struct CheckpointOptions {
+    std::string path;                                       // 检查点文件路径
+    size_t slot_bytes = 16 << 20;                           // 每个槽位的容量（段表 + 数据）
+    std::chrono::milliseconds interval{1000};               // 后台检查点周期
+};
+
+// 只读映射的检查点（取最新的有效槽位）
+class CheckpointImage {
+public:
+    ~CheckpointImage();
+
+    CheckpointImage(const CheckpointImage&) = delete;
+    CheckpointImage& operator=(const CheckpointImage&) = delete;
+
+    // 文件不存在、格式不符或没有有效槽位时返回 nullptr
+    static std::unique_ptr<CheckpointImage> open(const std::string& path, std::string* error = nullptr);
+
+    uint64_t sequence() const { return sequence_; }
+    int64_t timestamp_ns() const { return timestamp_ns_; }   // 写入时的墙钟时间
+
+    // 查找段：返回映射内存中的数据指针（在 image 生命周期内有效）
+    bool find(const std::string& name, const uint8_t*& data, size_t& size) const;
+    std::vector<std::string> sections() const;
+
+private:
+    CheckpointImage() = default;
+
+    void* memory_ = nullptr;
+    size_t mapped_bytes_ = 0;
+    const uint8_t* slot_ = nullptr;
+    uint64_t sequence_ = 0;
+    int64_t timestamp_ns_ = 0;
+};
+
+// 周期检查点：各组件注册采集回调，后台线程按周期采集并写入空闲槽位
+// 采集回调在检查点线程上执行，必须自行保证读取一致（SeqLock 快照、CheckpointCell 交接、
+// 或投递到组件自己的线程采集），不能阻塞交易线程
+class Checkpointer {
+public:
+    // 采集回调：把段内容以定长二进制布局写入 out，返回 false 时沿用该段上一次的内容
+    using CaptureFn = std::function<bool(std::string& out)>;
+
+    ~Checkpointer();
+
+    Checkpointer(const Checkpointer&) = delete;
+    Checkpointer& operator=(const Checkpointer&) = delete;
+
+    // 创建或复用检查点文件（布局一致时保留已有内容，在其序号之后继续写入）
+    static std::unique_ptr<Checkpointer> create(const CheckpointOptions& options, std::string* error = nullptr);
+
+    // 注册段（名称重复或过长时返回 false）
+    bool add_section(const std::string& name, CaptureFn capture);
+
+    // 启动/停止后台线程；stop() 默认在退出前再做一次检查点
+    void start();
+    void stop(bool final_checkpoint = true);
+
+    // 立即采集并提交一次（线程安全，与后台线程串行）
+    bool checkpoint_now(std::string* error = nullptr);
+
+    uint64_t sequence() const { return sequence_.load(std::memory_order_acquire); }
+    uint64_t failures() const { return failures_.load(std::memory_order_relaxed); }
+    int64_t last_duration_ns() const { return last_duration_ns_.load(std::memory_order_relaxed); }
+
+private:
+    struct Section {
+        std::string name;
+        CaptureFn capture;
+        std::string data;           // 最近一次成功采集的内容
+    };
+
+    Checkpointer(const CheckpointOptions& options, void* memory, size_t mapped_bytes, uint64_t sequence);
+
+    void run();
+
+    CheckpointOptions options_;
+    void* memory_;
+    size_t mapped_bytes_;
+
+    std::mutex commit_mutex_;                   // 串行化采集与提交
+    std::vector<Section> sections_;
+    std::string scratch_;                       // 采集缓冲（复用容量）
+
+    std::thread thread_;
+    std::mutex wait_mutex_;
+    std::condition_variable wait_cv_;
+    bool running_ = false;
+
+    std::atomic<uint64_t> sequence_;
+    std::atomic<uint64_t> failures_{0};
+    std::atomic<int64_t> last_duration_ns_{0};
+};
+
+// 交易线程状态的双缓冲交接：
+//   检查点线程 collect() 发出请求并等待；交易线程在自己的安全点调用 offer()，
+//   只有存在请求时才把实时状态复制进影子副本并发布，随后检查点线程从影子副本序列化，
+//   交易线程继续修改实时状态，全程不加锁、不等待 I/O。
+// T 需可拷贝赋值（如 POD 数组 std::vector<Record>，容量复用后无堆分配）
+template <typename T>
+class CheckpointCell {
+public:
+    // 交易线程（唯一写者）：存在请求时由 copy(shadow) 填写副本并发布，返回是否发布
+    template <typename Copy>
+    bool offer_with(Copy&& copy) {
+        if (state_.load(std::memory_order_acquire) != kRequested) {
+            return false;
+        }
+        copy(shadow_);
+        state_.store(kPublished, std::memory_order_release);
+        return true;
+    }
+
+    bool offer(const T& live) {
+        return offer_with([&live](T& shadow) { shadow = live; });
+    }
+
+    // 检查点线程：请求并等待副本，超时（交易线程一直未到达安全点）返回 false
+    template <typename Read>
+    bool collect(Read&& read, std::chrono::nanoseconds timeout) {
+        uint8_t expected = kIdle;
+        state_.compare_exchange_strong(expected, kRequested, std::memory_order_acq_rel);
+        auto deadline = std::chrono::steady_clock::now() + timeout;
+        while (state_.load(std::memory_order_acquire) != kPublished) {
+            if (std::chrono::steady_clock::now() >= deadline) {
+                // 撤回请求；撤回失败说明交易线程恰好发布，继续读取
+                expected = kRequested;
+                if (state_.compare_exchange_strong(expected, kIdle, std::memory_order_acq_rel)) {
+                    return false;
+                }
+                break;
+            }
+            std::this_thread::sleep_for(std::chrono::microseconds(50));
+        }
+        read(static_cast<const T&>(shadow_));
+        state_.store(kIdle, std::memory_order_release);
+        return true;
+    }
+
+    // 交易线程在热循环中廉价轮询（一次 relaxed 读取）
+    bool requested() const { return state_.load(std::memory_order_relaxed) == kRequested; }
+
+private:
+    static constexpr uint8_t kIdle = 0;
+    static constexpr uint8_t kRequested = 1;
+    static constexpr uint8_t kPublished = 2;
+
+    alignas(64) std::atomic<uint8_t> state_{kIdle};
+    T shadow_{};
+};
+
+// 定长二进制布局的读写辅助（仅用于平凡可拷贝类型）
+template <typename T>
+void append_pod(std::string& out, const T& value) {
+    static_assert(std::is_trivially_copyable<T>::value, "checkpoint records must be trivially copyable");
+    out.append(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+void append_pod_array(std::string& out, const T* values, size_t count) {
+    static_assert(std::is_trivially_copyable<T>::value, "checkpoint records must be trivially copyable");
+    out.append(reinterpret_cast<const char*>(values), sizeof(T) * count);
+}
+
+template <typename T>
+bool read_pod(const uint8_t*& p, const uint8_t* end, T& value) {
+    static_assert(std::is_trivially_copyable<T>::value, "checkpoint records must be trivially copyable");
+    if (static_cast<size_t>(end - p) < sizeof(T)) {
+        return false;
+    }
+    std::memcpy(&value, p, sizeof(T));
+    p += sizeof(T);
+    return true;
+}
+
+}  // namespace checkpoint
+}  // namespace common
+}  // namespace base
+}  // namespace quant
+
+#endif  // BASE_COMMON_CHECKPOINT_CHECKPOINT_H_
@@ -0,0 +1,401 @@
+#include "config_cache.h"
+
+#include <cerrno>         // 用于 errno
+#include <cstdio>         // 用于 rename/remove
+#include <cstring>        // 用于 memcpy/strerror
+#include <fcntl.h>        // 用于 open
+#include <sys/mman.h>     // 用于 mmap
+#include <sys/stat.h>     // 用于 fstat
+#include <unistd.h>       // 用于 write/fsync/close
+
+namespace quant {
+namespace base {
+namespace common {
+namespace config_cache {
+
+namespace {
+
+// 缓存文件布局：FileHeader + 载荷
+//   载荷 = 逐段 { str module, str section, u32 条目数, { str key, str value } * 条目数 }
+//   str = u32 长度 + 字节
+constexpr char kMagic[8] = {'Q', 'T', 'C', 'F', 'G', '0', '0', '1'};
+
+struct FileHeader {
+    char magic[8];
+    uint64_t version;
+    uint64_t section_count;
+    uint64_t payload_bytes;
+    uint64_t checksum;          // 载荷的 FNV-1a 64 位校验和
+};
+
+void set_error(std::string* error, const std::string& message) {
+    if (error != nullptr) {
+        *error = message;
+    }
+}
+
+uint64_t fnv1a(const uint8_t* data, size_t size) {
+    uint64_t hash = 1469598103934665603ULL;
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= data[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+void put_u32(std::string& out, uint32_t value) {
+    out.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void put_string(std::string& out, const std::string& value) {
+    put_u32(out, static_cast<uint32_t>(value.size()));
+    out.append(value);
+}
+
+// 带边界检查的载荷读取器
+class PayloadReader {
+public:
+    PayloadReader(const uint8_t* data, size_t size) : p_(data), end_(data + size) {}
+
+    bool read_u32(uint32_t& value) {
+        if (static_cast<size_t>(end_ - p_) < sizeof(value)) {
+            return false;
+        }
+        std::memcpy(&value, p_, sizeof(value));
+        p_ += sizeof(value);
+        return true;
+    }
+
+    bool read_string(std::string& value) {
+        uint32_t size = 0;
+        if (!read_u32(size) || static_cast<size_t>(end_ - p_) < size) {
+            return false;
+        }
+        value.assign(reinterpret_cast<const char*>(p_), size);
+        p_ += size;
+        return true;
+    }
+
+    bool done() const { return p_ == end_; }
+
+private:
+    const uint8_t* p_;
+    const uint8_t* end_;
+};
+
+bool write_all(int fd, const char* data, size_t size) {
+    while (size > 0) {
+        ssize_t written = ::write(fd, data, size);
+        if (written < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            return false;
+        }
+        data += written;
+        size -= static_cast<size_t>(written);
+    }
+    return true;
+}
+
+}  // namespace
+
+// ==================== ConfigSnapshot ====================
+
+std::string ConfigSnapshot::make_key(const std::string& module, const std::string& section) {
+    std::string key;
+    key.reserve(module.size() + section.size() + 1);
+    key.append(module);
+    key.push_back('\x1f');      // 单元分隔符，不会出现在模块名/段名中
+    key.append(section);
+    return key;
+}
+
+const ConfigSection* ConfigSnapshot::find(const std::string& module, const std::string& section) const {
+    auto it = sections_.find(make_key(module, section));
+    return it != sections_.end() ? &it->second : nullptr;
+}
+
+std::string ConfigSnapshot::get(const std::string& module, const std::string& section,
+                                const std::string& key, const std::string& default_value) const {
+    const ConfigSection* values = find(module, section);
+    if (values == nullptr) {
+        return default_value;
+    }
+    auto it = values->find(key);
+    return it != values->end() ? it->second : default_value;
+}
+
+void ConfigSnapshot::set_section(const std::string& module, const std::string& section, ConfigSection values) {
+    sections_[make_key(module, section)] = std::move(values);
+}
+
+void ConfigSnapshot::erase_section(const std::string& module, const std::string& section) {
+    sections_.erase(make_key(module, section));
+}
+
+void ConfigSnapshot::for_each(const std::function<void(const std::string&, const std::string&,
+                                                       const ConfigSection&)>& visitor) const {
+    for (const auto& entry : sections_) {
+        size_t split = entry.first.find('\x1f');
+        visitor(entry.first.substr(0, split), entry.first.substr(split + 1), entry.second);
+    }
+}
+
+// ==================== 持久化 ====================
+
+bool save_snapshot(const std::string& path, const ConfigSnapshot& snapshot, std::string* error) {
+    std::string payload;
+    snapshot.for_each([&payload](const std::string& module, const std::string& section,
+                                 const ConfigSection& values) {
+        put_string(payload, module);
+        put_string(payload, section);
+        put_u32(payload, static_cast<uint32_t>(values.size()));
+        for (const auto& kv : values) {
+            put_string(payload, kv.first);
+            put_string(payload, kv.second);
+        }
+    });
+
+    FileHeader header;
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.version = snapshot.version();
+    header.section_count = snapshot.section_count();
+    header.payload_bytes = payload.size();
+    header.checksum = fnv1a(reinterpret_cast<const uint8_t*>(payload.data()), payload.size());
+
+    std::string temp_path = path + ".tmp";
+    int fd = ::open(temp_path.c_str(), O_CREAT | O_WRONLY | O_TRUNC, 0644);
+    if (fd < 0) {
+        set_error(error, "open " + temp_path + " failed: " + std::strerror(errno));
+        return false;
+    }
+    bool ok = write_all(fd, reinterpret_cast<const char*>(&header), sizeof(header)) &&
+              write_all(fd, payload.data(), payload.size()) &&
+              ::fsync(fd) == 0;
+    int saved_errno = errno;
+    ::close(fd);
+    if (!ok) {
+        set_error(error, "write " + temp_path + " failed: " + std::strerror(saved_errno));
+        std::remove(temp_path.c_str());
+        return false;
+    }
+    if (std::rename(temp_path.c_str(), path.c_str()) != 0) {
+        set_error(error, "rename " + temp_path + " failed: " + std::strerror(errno));
+        std::remove(temp_path.c_str());
+        return false;
+    }
+    return true;
+}
+
+std::unique_ptr<ConfigSnapshot> load_snapshot(const std::string& path, std::string* error) {
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        set_error(error, "open " + path + " failed: " + std::strerror(errno));
+        return nullptr;
+    }
+    struct stat st;
+    if (::fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(FileHeader)) {
+        ::close(fd);
+        set_error(error, path + " is not a config cache file");
+        return nullptr;
+    }
+    size_t size = static_cast<size_t>(st.st_size);
+    void* memory = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (memory == MAP_FAILED) {
+        set_error(error, "mmap " + path + " failed: " + std::strerror(errno));
+        return nullptr;
+    }
+
+    std::unique_ptr<ConfigSnapshot> snapshot;
+    const auto* base = static_cast<const uint8_t*>(memory);
+    FileHeader header;
+    std::memcpy(&header, base, sizeof(header));
+    const uint8_t* payload = base + sizeof(header);
+    if (std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0) {
+        set_error(error, path + " has an unknown format");
+    } else if (header.payload_bytes != size - sizeof(header)) {
+        set_error(error, path + " is truncated");
+    } else if (fnv1a(payload, header.payload_bytes) != header.checksum) {
+        set_error(error, path + " failed checksum");
+    } else {
+        auto parsed = std::make_unique<ConfigSnapshot>(header.version);
+        PayloadReader reader(payload, header.payload_bytes);
+        bool ok = true;
+        for (uint64_t i = 0; ok && i < header.section_count; ++i) {
+            std::string module;
+            std::string section;
+            uint32_t count = 0;
+            ok = reader.read_string(module) && reader.read_string(section) && reader.read_u32(count);
+            ConfigSection values;
+            for (uint32_t j = 0; ok && j < count; ++j) {
+                std::string key;
+                std::string value;
+                ok = reader.read_string(key) && reader.read_string(value);
+                values.emplace(std::move(key), std::move(value));
+            }
+            if (ok) {
+                parsed->set_section(module, section, std::move(values));
+            }
+        }
+        if (ok && reader.done()) {
+            snapshot = std::move(parsed);
+        } else {
+            set_error(error, path + " has a malformed payload");
+        }
+    }
+    ::munmap(memory, size);
+    return snapshot;
+}
+
+// ==================== ConfigCache ====================
+
+ConfigCache::ConfigCache(std::shared_ptr<ConfigSource> source, Options options)
+    : source_(std::move(source)),
+      options_(std::move(options)),
+      current_(std::unique_ptr<Published>(new Published{std::make_shared<const ConfigSnapshot>()})) {}
+
+ConfigCache::~ConfigCache() {
+    stop();
+}
+
+bool ConfigCache::start(std::string* error) {
+    std::string load_error;
+    bool have_snapshot = false;
+    {
+        std::lock_guard<std::mutex> lock(write_mutex_);
+        // 1. 本地缓存：配置服务不可用时也能立即启动
+        if (!options_.cache_path.empty()) {
+            auto cached = load_snapshot(options_.cache_path, &load_error);
+            if (cached) {
+                store_locked(std::shared_ptr<const ConfigSnapshot>(std::move(cached)));
+                have_snapshot = true;
+            }
+        }
+
+        // 2. 全量同步一次
+        std::string fetch_error;
+        if (source_ != nullptr && resync_locked(&fetch_error)) {
+            have_snapshot = true;
+        } else if (options_.require_source || !have_snapshot) {
+            std::string message = source_ == nullptr ? "no config source" : fetch_error;
+            if (!load_error.empty()) {
+                message += "; " + load_error;
+            }
+            set_error(error, message);
+            return false;
+        }
+    }
+
+    // 3. 订阅增量（回调会获取 write_mutex_，这里不能持锁）
+    if (source_ != nullptr) {
+        std::string subscribe_error;
+        uint64_t from_version = version();
+        bool subscribed = source_->subscribe(from_version, [this](const ConfigDelta& delta) {
+            apply_delta(delta);
+        }, &subscribe_error);
+        std::lock_guard<std::mutex> lock(write_mutex_);
+        subscribed_ = subscribed;
+        if (!subscribed && options_.require_source) {
+            set_error(error, subscribe_error);
+            return false;
+        }
+    }
+    return have_snapshot;
+}
+
+void ConfigCache::stop() {
+    bool subscribed = false;
+    {
+        std::lock_guard<std::mutex> lock(write_mutex_);
+        subscribed = subscribed_;
+        subscribed_ = false;
+    }
+    if (subscribed) {
+        source_->unsubscribe();
+    }
+}
+
+ConfigSection ConfigCache::get_config(const std::string& module, const std::string& section) const {
+    auto current = snapshot();
+    const ConfigSection* values = current->find(module, section);
+    return values != nullptr ? *values : ConfigSection();
+}
+
+bool ConfigCache::apply_delta(const ConfigDelta& delta) {
+    std::lock_guard<std::mutex> lock(write_mutex_);
+    auto current = snapshot();
+    if (delta.to_version <= current->version()) {
+        return false;           // 重放或过期的增量
+    }
+    if (delta.from_version != current->version()) {
+        return resync_locked(nullptr);      // 版本断档：全量重新同步
+    }
+
+    // 复制当前快照，应用变更后整体发布（旧快照由仍持有它的读者释放）
+    auto next = std::make_shared<ConfigSnapshot>(*current);
+    next->version_ = delta.to_version;
+    for (const auto& change : delta.changes) {
+        if (change.erase) {
+            next->erase_section(change.module, change.section);
+        } else {
+            next->set_section(change.module, change.section, change.values);
+        }
+    }
+    publish_locked(std::move(next));
+    deltas_applied_.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+bool ConfigCache::resync(std::string* error) {
+    std::lock_guard<std::mutex> lock(write_mutex_);
+    return resync_locked(error);
+}
+
+bool ConfigCache::resync_locked(std::string* error) {
+    if (source_ == nullptr) {
+        set_error(error, "no config source");
+        return false;
+    }
+    auto fetched = source_->fetch_snapshot(error);
+    if (!fetched) {
+        return false;
+    }
+    resyncs_.fetch_add(1, std::memory_order_relaxed);
+    stale_.store(false, std::memory_order_release);
+    if (fetched->version() == snapshot()->version() && snapshot()->version() != 0) {
+        return true;            // 本地缓存已是最新版本，无需重新发布
+    }
+    publish_locked(std::shared_ptr<const ConfigSnapshot>(std::move(fetched)));
+    return true;
+}
+
+void ConfigCache::add_listener(Listener listener) {
+    std::lock_guard<std::mutex> lock(write_mutex_);
+    listeners_.push_back(std::move(listener));
+}
+
+void ConfigCache::store_locked(std::shared_ptr<const ConfigSnapshot> next) {
+    std::unique_ptr<Published> published(new Published{std::move(next)});
+    std::lock_guard<std::mutex> lock(snapshot_mutex_);
+    current_.publish(std::move(published));
+}
+
+void ConfigCache::publish_locked(std::shared_ptr<const ConfigSnapshot> next) {
+    store_locked(next);
+    if (!options_.cache_path.empty()) {
+        std::string error;
+        if (!save_snapshot(options_.cache_path, *next, &error)) {
+            std::fprintf(stderr, "[config_cache] %s\n", error.c_str());
+        }
+    }
+    for (const auto& listener : listeners_) {
+        listener(*next);
+    }
+}
+
+}  // namespace config_cache
+}  // namespace common
+}  // namespace base
+}  // namespace quant
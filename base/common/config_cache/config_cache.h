@@ -0,0 +1,178 @@
+#ifndef BASE_COMMON_CONFIG_CACHE_CONFIG_CACHE_H_
+#define BASE_COMMON_CONFIG_CACHE_CONFIG_CACHE_H_
+
+#include <atomic>         // 用于原子状态
+#include <cstddef>        // 用于 size_t
+#include <cstdint>        // 用于 uint64_t
+#include <functional>     // 用于回调
+#include <memory>         // 用于 shared_ptr/unique_ptr
+#include <mutex>          // 写路径（冷路径）加锁
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "../rcu/rcu.h"   // 当前快照指针的无锁发布
+
+namespace quant {
+namespace base {
+namespace common {
+namespace config_cache {
+
+// 单个配置段：key -> value（与 ConfigClient::get_config 的返回类型一致）
+using ConfigSection = std::unordered_map<std::string, std::string>;
+
+// 不可变的版本化配置快照：发布后不再修改，读者可长期持有
+class ConfigSnapshot {
+public:
+    ConfigSnapshot() = default;
+    explicit ConfigSnapshot(uint64_t version) : version_(version) {}
+
+    uint64_t version() const { return version_; }
+    size_t section_count() const { return sections_.size(); }
+
+    // 查找配置段，不存在时返回 nullptr（指针在快照生命周期内有效）
+    const ConfigSection* find(const std::string& module, const std::string& section) const;
+
+    // 读取单个配置项，不存在时返回默认值
+    std::string get(const std::string& module, const std::string& section,
+                    const std::string& key, const std::string& default_value = "") const;
+
+    // 构建阶段使用：发布前整体替换一个配置段
+    void set_section(const std::string& module, const std::string& section, ConfigSection values);
+    void erase_section(const std::string& module, const std::string& section);
+
+    // 遍历全部配置段（持久化、调试输出用）
+    void for_each(const std::function<void(const std::string& module, const std::string& section,
+                                           const ConfigSection& values)>& visitor) const;
+
+private:
+    friend class ConfigCache;
+
+    static std::string make_key(const std::string& module, const std::string& section);
+
+    uint64_t version_ = 0;
+    std::unordered_map<std::string, ConfigSection> sections_;   // "module\x1fsection" -> 配置段
+};
+
+// 增量变更：把版本 from_version 的快照推进到 to_version，按配置段整体替换或删除
+struct ConfigDelta {
+    struct Change {
+        std::string module;
+        std::string section;
+        ConfigSection values;
+        bool erase = false;             // true 时删除该配置段（忽略 values）
+    };
+
+    uint64_t from_version = 0;
+    uint64_t to_version = 0;
+    std::vector<Change> changes;
+};
+
+// 配置来源：由配置服务客户端实现（全量拉取 + 流式订阅增量）
+class ConfigSource {
+public:
+    using DeltaCallback = std::function<void(const ConfigDelta& delta)>;
+
+    virtual ~ConfigSource() = default;
+
+    // 拉取完整的版本化快照；服务不可用时返回 nullptr 并填写错误
+    virtual std::unique_ptr<ConfigSnapshot> fetch_snapshot(std::string* error) = 0;
+
+    // 订阅 from_version 之后的增量，回调可能在来源的后台线程上执行
+    virtual bool subscribe(uint64_t from_version, DeltaCallback callback, std::string* error) = 0;
+
+    // 取消订阅，返回后不再触发回调
+    virtual void unsubscribe() = 0;
+};
+
+// 持久化：先写临时文件再 rename，保证磁盘上的缓存文件始终完整
+bool save_snapshot(const std::string& path, const ConfigSnapshot& snapshot, std::string* error = nullptr);
+
+// 加载：只读映射缓存文件并校验魔数、长度与校验和，失败时返回 nullptr
+std::unique_ptr<ConfigSnapshot> load_snapshot(const std::string& path, std::string* error = nullptr);
+
+// 客户端配置缓存：
+//   启动时先加载本地缓存文件（配置服务不可用时也能立即启动），再全量拉取一次，
+//   之后通过流式订阅接收增量。在线 RCU 读者的读路径为一次原子指针读取加一次引用计数递增，返回不可变快照。
+class ConfigCache {
+public:
+    struct Options {
+        std::string cache_path;         // 本地缓存文件路径，为空时不持久化
+        bool require_source = false;    // true 时配置服务不可用即启动失败（即使存在本地缓存）
+    };
+
+    using Listener = std::function<void(const ConfigSnapshot& snapshot)>;
+
+    ConfigCache(std::shared_ptr<ConfigSource> source, Options options);
+    ~ConfigCache();
+
+    ConfigCache(const ConfigCache&) = delete;
+    ConfigCache& operator=(const ConfigCache&) = delete;
+
+    // 加载本地缓存 -> 全量同步 -> 订阅增量；没有任何可用快照时返回 false
+    bool start(std::string* error = nullptr);
+
+    // 取消订阅（幂等）
+    void stop();
+
+    // 当前快照（从不为空；启动前为版本 0 的空快照）。在线 RCU 读者线程无锁读取；
+    // 其他线程经 snapshot_mutex_ 复制（只与发布时的指针替换互斥，不等待持久化与监听者回调）
+    std::shared_ptr<const ConfigSnapshot> snapshot() const {
+        if (rcu::RcuReader::active(current_.domain())) {
+            return current_.load()->snapshot;
+        }
+        std::lock_guard<std::mutex> lock(snapshot_mutex_);
+        return current_.load()->snapshot;
+    }
+
+    uint64_t version() const { return snapshot()->version(); }
+
+    // 兼容 ConfigClient::get_config：返回配置段副本，不存在时返回空
+    ConfigSection get_config(const std::string& module, const std::string& section) const;
+
+    // 应用一条增量：版本不连续时触发全量重新同步；过期增量直接忽略
+    bool apply_delta(const ConfigDelta& delta);
+
+    // 重新全量拉取（增量断档或订阅中断后调用）
+    bool resync(std::string* error = nullptr);
+
+    // 快照变更通知（在发布线程上持锁回调，用于各模块热加载；回调内不能再调用 apply_delta/resync）
+    void add_listener(Listener listener);
+
+    // 当前快照仅来自本地缓存、尚未与配置服务同步
+    bool stale() const { return stale_.load(std::memory_order_acquire); }
+
+    uint64_t deltas_applied() const { return deltas_applied_.load(std::memory_order_relaxed); }
+    uint64_t resyncs() const { return resyncs_.load(std::memory_order_relaxed); }
+
+private:
+    // RCU 保护的发布单元：读者在静止状态前复制其中的 shared_ptr，之后可长期持有快照
+    struct Published {
+        std::shared_ptr<const ConfigSnapshot> snapshot;
+    };
+
+    // 替换当前快照（调用方持有 write_mutex_）
+    void store_locked(std::shared_ptr<const ConfigSnapshot> next);
+
+    // 发布新快照并持久化、通知监听者（调用方持有 write_mutex_）
+    void publish_locked(std::shared_ptr<const ConfigSnapshot> next);
+    bool resync_locked(std::string* error);
+
+    std::shared_ptr<ConfigSource> source_;
+    Options options_;
+    mutable std::mutex snapshot_mutex_;                 // 非 RCU 读者的读取与指针替换互斥
+    rcu::RcuCell<Published> current_;                   // 当前快照
+
+    std::mutex write_mutex_;                            // 串行化发布（增量、重新同步）
+    std::vector<Listener> listeners_;
+    bool subscribed_ = false;
+    std::atomic<bool> stale_{true};
+    std::atomic<uint64_t> deltas_applied_{0};
+    std::atomic<uint64_t> resyncs_{0};
+};
+
+}  // namespace config_cache
+}  // namespace common
+}  // namespace base
+}  // namespace quant
+
+#endif  // BASE_COMMON_CONFIG_CACHE_CONFIG_CACHE_H_
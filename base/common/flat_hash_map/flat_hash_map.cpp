@@ -0,0 +1,19 @@
+#include "flat_hash_map.h"
+#include <string>
+
+
+namespace quant {
+namespace base {
+namespace common {
+namespace flat_hash_map {
+
+    // 模板类的显式实例化声明，用于分离编译
+    // 实际使用时可根据需要添加常用类型的实例化
+    template class FlatHashMap<int, int>;
+    template class FlatHashMap<uint64_t, uint64_t>;
+    template class FlatHashMap<std::string, int>;
+
+}  // namespace flat_hash_map
+}  // namespace common
+}  // namespace base
+}  // namespace quant
@@ -0,0 +1,148 @@
+#ifndef BASE_COMMON_FLAT_HASH_MAP_FLAT_HASH_MAP_H_
+#define BASE_COMMON_FLAT_HASH_MAP_FLAT_HASH_MAP_H_
+
+#include <vector>         // 槽位存储（构造时一次性分配）
+#include <cstddef>        // 用于 size_t
+#include <cstdint>        // 用于 uint64_t
+#include <utility>        // 用于 std::move
+#include <stdexcept>      // 用于异常定义
+#include <functional>     // 用于 std::hash/std::equal_to
+
+namespace quant {
+namespace base {
+namespace common {
+namespace flat_hash_map {
+
+// 定容开放寻址哈希表（线性探测 + 后移删除，无墓碑）
+// - 构造时按最大元素数预分配，负载因子不超过 1/2，运行期不扩容、不分配内存
+// - 键值内联存储在连续数组中，命中时通常一次探测即可返回
+// - 非线程安全：由单一线程独占使用
+template <typename K, typename V, typename Hash = std::hash<K>, typename KeyEqual = std::equal_to<K>>
+class FlatHashMap {
+public:
+    // 1. 构造：max_size 为最多可容纳的元素数
+    explicit FlatHashMap(size_t max_size) : max_size_(max_size) {
+        if (max_size == 0) {
+            throw std::invalid_argument("FlatHashMap max_size must be greater than 0");
+        }
+        size_t buckets = 1;
+        while (buckets < max_size * 2) {
+            buckets <<= 1;
+        }
+        mask_ = buckets - 1;
+        slots_.resize(buckets);
+    }
+
+    FlatHashMap(const FlatHashMap&) = delete;
+    FlatHashMap& operator=(const FlatHashMap&) = delete;
+
+
+    // 2. 插入：键已存在或表已满时返回 false
+    bool insert(const K& key, const V& value) {
+        if (size_ >= max_size_) {
+            return false;
+        }
+        size_t hash = hasher_(key);
+        size_t pos = hash & mask_;
+        while (slots_[pos].occupied) {
+            if (slots_[pos].hash == hash && equal_(slots_[pos].key, key)) {
+                return false;
+            }
+            pos = (pos + 1) & mask_;
+        }
+        Slot& slot = slots_[pos];
+        slot.key = key;
+        slot.value = value;
+        slot.hash = hash;
+        slot.occupied = true;
+        ++size_;
+        return true;
+    }
+
+    // 3. 查找：未找到返回 nullptr
+    V* find(const K& key) {
+        size_t hash = hasher_(key);
+        size_t pos = hash & mask_;
+        while (slots_[pos].occupied) {
+            if (slots_[pos].hash == hash && equal_(slots_[pos].key, key)) {
+                return &slots_[pos].value;
+            }
+            pos = (pos + 1) & mask_;
+        }
+        return nullptr;
+    }
+
+    const V* find(const K& key) const {
+        return const_cast<FlatHashMap*>(this)->find(key);
+    }
+
+    bool contains(const K& key) const {
+        return find(key) != nullptr;
+    }
+
+    // 4. 删除：后移删除，保持探测链连续，不留墓碑
+    bool erase(const K& key) {
+        size_t hash = hasher_(key);
+        size_t pos = hash & mask_;
+        while (slots_[pos].occupied) {
+            if (slots_[pos].hash == hash && equal_(slots_[pos].key, key)) {
+                break;
+            }
+            pos = (pos + 1) & mask_;
+        }
+        if (!slots_[pos].occupied) {
+            return false;
+        }
+
+        size_t hole = pos;
+        size_t next = (hole + 1) & mask_;
+        while (slots_[next].occupied) {
+            size_t ideal = slots_[next].hash & mask_;
+            // ideal 不在 (hole, next] 区间内时，该元素可以前移填补空洞
+            bool stays = (hole <= next) ? (hole < ideal && ideal <= next)
+                                        : (hole < ideal || ideal <= next);
+            if (!stays) {
+                slots_[hole] = std::move(slots_[next]);
+                hole = next;
+            }
+            next = (next + 1) & mask_;
+        }
+        slots_[hole] = Slot();
+        --size_;
+        return true;
+    }
+
+    // 5. 状态查询与清空
+    size_t size() const { return size_; }
+    size_t max_size() const { return max_size_; }
+    bool empty() const { return size_ == 0; }
+
+    void clear() {
+        for (auto& slot : slots_) {
+            slot = Slot();
+        }
+        size_ = 0;
+    }
+
+private:
+    struct Slot {
+        K key{};
+        V value{};
+        size_t hash = 0;              // 缓存哈希值：先比较哈希再比较键，删除时无需重算
+        bool occupied = false;
+    };
+
+    std::vector<Slot> slots_;         // 槽位数组（容量为 2 的幂）
+    size_t mask_ = 0;                 // 槽位掩码
+    size_t size_ = 0;                 // 元素数量
+    size_t max_size_ = 0;             // 最大元素数量
+    Hash hasher_;
+    KeyEqual equal_;
+};
+
+}  // namespace flat_hash_map
+}  // namespace common
+}  // namespace base
+}  // namespace quant
+
+#endif  // BASE_COMMON_FLAT_HASH_MAP_FLAT_HASH_MAP_H_
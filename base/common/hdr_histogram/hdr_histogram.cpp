@@ -0,0 +1,97 @@
+#include "hdr_histogram.h"
+
+#include <algorithm>
+#include <cmath>
+
+
+namespace quant {
+namespace base {
+namespace common {
+namespace hdr_histogram {
+
+HdrHistogram::HdrHistogram() : total_(0), max_(0) {
+    for (auto& counter : counts_) {
+        counter.store(0, std::memory_order_relaxed);
+    }
+}
+
+void HdrHistogram::merge(const HdrHistogram& other) {
+    for (size_t i = 0; i < kBucketCount; ++i) {
+        uint64_t n = other.counts_[i].load(std::memory_order_relaxed);
+        if (n != 0) {
+            counts_[i].store(counts_[i].load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+            total_.store(total_.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+        }
+    }
+    uint64_t other_max = other.max();
+    if (other_max > max_.load(std::memory_order_relaxed)) {
+        max_.store(other_max, std::memory_order_relaxed);
+    }
+}
+
+void HdrHistogram::reset() {
+    for (auto& counter : counts_) {
+        counter.store(0, std::memory_order_relaxed);
+    }
+    total_.store(0, std::memory_order_relaxed);
+    max_.store(0, std::memory_order_relaxed);
+}
+
+uint64_t HdrHistogram::percentile(double p) const {
+    // 以各桶计数之和为准（与 total_ 分开读取，并发写入时两者可能短暂不一致）
+    uint64_t total = 0;
+    for (const auto& counter : counts_) {
+        total += counter.load(std::memory_order_relaxed);
+    }
+    if (total == 0) {
+        return 0;
+    }
+    p = std::min(std::max(p, 0.0), 100.0);
+    uint64_t target = static_cast<uint64_t>(std::ceil(p / 100.0 * static_cast<double>(total)));
+    target = std::max<uint64_t>(target, 1);
+
+    uint64_t seen = 0;
+    for (size_t i = 0; i < kBucketCount; ++i) {
+        seen += counts_[i].load(std::memory_order_relaxed);
+        if (seen >= target) {
+            return std::min(bucket_upper(i), max());
+        }
+    }
+    return max();
+}
+
+double HdrHistogram::mean() const {
+    double sum = 0.0;
+    uint64_t total = 0;
+    for (size_t i = 0; i < kBucketCount; ++i) {
+        uint64_t n = counts_[i].load(std::memory_order_relaxed);
+        if (n != 0) {
+            double mid = (static_cast<double>(bucket_lower(i)) + static_cast<double>(bucket_upper(i))) / 2.0;
+            sum += mid * static_cast<double>(n);
+            total += n;
+        }
+    }
+    return total == 0 ? 0.0 : sum / static_cast<double>(total);
+}
+
+uint64_t HdrHistogram::bucket_lower(size_t bucket) {
+    if (bucket < kSubBucketCount) {
+        return bucket;
+    }
+    unsigned shift = static_cast<unsigned>(bucket >> kSubBucketBits) - 1;
+    uint64_t sub = bucket & (kSubBucketCount - 1);
+    return (kSubBucketCount + sub) << shift;
+}
+
+uint64_t HdrHistogram::bucket_upper(size_t bucket) {
+    if (bucket < kSubBucketCount) {
+        return bucket;
+    }
+    unsigned shift = static_cast<unsigned>(bucket >> kSubBucketBits) - 1;
+    return bucket_lower(bucket) + ((uint64_t(1) << shift) - 1);
+}
+
+}  // namespace hdr_histogram
+}  // namespace common
+}  // namespace base
+}  // namespace quant
@@ -0,0 +1,85 @@
+#ifndef BASE_COMMON_HDR_HISTOGRAM_HDR_HISTOGRAM_H_
+#define BASE_COMMON_HDR_HISTOGRAM_HDR_HISTOGRAM_H_
+
+#include <atomic>         // 用于计数器
+#include <cstddef>        // 用于 size_t
+#include <cstdint>        // 用于 uint64_t
+
+namespace quant {
+namespace base {
+namespace common {
+namespace hdr_histogram {
+
+// 高动态范围（HDR）直方图：覆盖 0 ~ 2^64-1 的整数取值，相对误差不超过 1/32（约 3%）
+// - 对数-线性分桶：[0, 32) 每个值一个桶；此后每个 2 的幂区间再均分为 32 个子桶，共 1920 个计数器
+// - 单写者：record() 只做 relaxed 读+写（无锁前缀指令），适合每线程一个实例的热路径统计
+// - 多读者：其他线程可随时读取 count()/percentile()/max()，结果为近似一致的快照
+// - 汇总多个线程的数据时，由读者线程把各实例 merge() 到一个本地实例后再查询
+class HdrHistogram {
+public:
+    static constexpr unsigned kSubBucketBits = 5;
+    static constexpr size_t kSubBucketCount = size_t(1) << kSubBucketBits;
+    static constexpr size_t kBucketCount = (64 - kSubBucketBits + 1) * kSubBucketCount;
+
+    HdrHistogram();
+
+    // 禁止拷贝和移动（计数器为原子量，且通常被其他线程引用）
+    HdrHistogram(const HdrHistogram&) = delete;
+    HdrHistogram& operator=(const HdrHistogram&) = delete;
+
+
+    // 1. 写者：记录一个样本（同一实例只允许一个写者线程）
+    void record(uint64_t value) {
+        std::atomic<uint64_t>& counter = counts_[bucket_of(value)];
+        counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        total_.store(total_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        if (value > max_.load(std::memory_order_relaxed)) {
+            max_.store(value, std::memory_order_relaxed);
+        }
+    }
+
+    // 合并另一个直方图的计数（调用方须是本实例的唯一写者）
+    void merge(const HdrHistogram& other);
+
+    // 清零（调用方须是本实例的唯一写者，或写者已停止）
+    void reset();
+
+
+    // 2. 读者：查询
+    uint64_t count() const { return total_.load(std::memory_order_relaxed); }
+    uint64_t max() const { return max_.load(std::memory_order_relaxed); }
+
+    // 百分位数（0 < p <= 100），返回所在桶的上界（不超过实际最大值）；无样本时返回 0
+    uint64_t percentile(double p) const;
+
+    // 平均值（按桶中点估算）
+    double mean() const;
+
+
+    // 3. 分桶映射（公开便于测试）
+    static size_t bucket_of(uint64_t value) {
+        if (value < kSubBucketCount) {
+            return static_cast<size_t>(value);
+        }
+        unsigned msb = 63u - static_cast<unsigned>(__builtin_clzll(value));
+        unsigned shift = msb - kSubBucketBits;
+        return ((msb - kSubBucketBits + 1) << kSubBucketBits) |
+               static_cast<size_t>((value >> shift) & (kSubBucketCount - 1));
+    }
+
+    // 桶内最小值 / 最大值
+    static uint64_t bucket_lower(size_t bucket);
+    static uint64_t bucket_upper(size_t bucket);
+
+private:
+    std::atomic<uint64_t> counts_[kBucketCount];
+    std::atomic<uint64_t> total_;
+    std::atomic<uint64_t> max_;
+};
+
+}  // namespace hdr_histogram
+}  // namespace common
+}  // namespace base
+}  // namespace quant
+
+#endif  // BASE_COMMON_HDR_HISTOGRAM_HDR_HISTOGRAM_H_
@@ -0,0 +1,546 @@
+#include "metrics.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <sstream>
+#include <fcntl.h>        // O_* 常量
+#include <sys/mman.h>     // shm_open/mmap
+#include <sys/stat.h>     // fstat
+#include <unistd.h>       // ftruncate/close/getpid
+
+
+namespace quant {
+namespace base {
+namespace common {
+namespace metrics {
+
+namespace {
+
+constexpr uint64_t kMagic = 0x434952544d5451ULL;      // "QTMETRIC"
+constexpr uint32_t kVersion = 1;
+constexpr size_t kCacheLine = 64;
+constexpr size_t kHistogramStride = kHistogramBuckets + 1;   // 各桶计数 + 样本和
+constexpr uint32_t kInvalidSlot = UINT32_MAX;
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free, "metrics need address-free 64-bit atomics");
+static_assert(std::atomic<uint32_t>::is_always_lock_free, "metrics need address-free 32-bit atomics");
+
+// 段头（共享内存偏移 0）；magic 最后写入，读者据此判断段已初始化完成
+struct SegmentHeader {
+    std::atomic<uint64_t> magic;
+    uint32_t version;
+    int32_t pid;
+    uint64_t total_size;
+    uint32_t max_counters;
+    uint32_t max_gauges;
+    uint32_t max_histograms;
+    uint32_t max_shards;
+    uint64_t descriptor_offset;
+    uint64_t gauge_offset;
+    uint64_t shard_offset;
+    uint64_t shard_stride;
+    std::atomic<uint32_t> metric_count;         // 已发布的指标描述数（release 发布）
+    std::atomic<uint32_t> shard_high_water;     // 曾被使用过的分片数上界（读者只需汇总这些分片）
+};
+
+struct MetricDescriptor {
+    char name[kMaxMetricName];
+    uint32_t type;
+    uint32_t slot;                              // 在对应类型数组中的下标
+};
+
+struct alignas(kCacheLine) GaugeSlot {
+    std::atomic<int64_t> value;
+};
+
+// 分片头独占一个缓存行，后接计数器数组与直方图数组
+struct alignas(kCacheLine) ShardHeader {
+    std::atomic<uint32_t> owned;                // 0 空闲，1 被某个线程独占
+};
+
+size_t align_up(size_t n) {
+    return (n + kCacheLine - 1) / kCacheLine * kCacheLine;
+}
+
+// 段内各区域的位置（写者与读者共用）
+struct Layout {
+    const SegmentHeader* header;
+    uint8_t* base;
+
+    const MetricDescriptor* descriptors() const {
+        return reinterpret_cast<const MetricDescriptor*>(base + header->descriptor_offset);
+    }
+    GaugeSlot* gauges() const {
+        return reinterpret_cast<GaugeSlot*>(base + header->gauge_offset);
+    }
+    ShardHeader* shard(size_t index) const {
+        return reinterpret_cast<ShardHeader*>(base + header->shard_offset + index * header->shard_stride);
+    }
+    std::atomic<uint64_t>* counters(size_t index) const {
+        return reinterpret_cast<std::atomic<uint64_t>*>(reinterpret_cast<uint8_t*>(shard(index)) + sizeof(ShardHeader));
+    }
+    std::atomic<uint64_t>* histograms(size_t index) const {
+        return counters(index) + header->max_counters;
+    }
+};
+
+std::vector<MetricValue> read_metrics(const Layout& layout) {
+    const SegmentHeader* header = layout.header;
+    uint32_t count = header->metric_count.load(std::memory_order_acquire);
+    uint32_t shards = std::min(header->shard_high_water.load(std::memory_order_acquire), header->max_shards);
+
+    std::vector<MetricValue> result;
+    result.reserve(count);
+    for (uint32_t i = 0; i < count; ++i) {
+        const MetricDescriptor& descriptor = layout.descriptors()[i];
+        MetricValue metric;
+        metric.name.assign(descriptor.name, strnlen(descriptor.name, kMaxMetricName));
+        metric.type = static_cast<MetricType>(descriptor.type);
+        switch (metric.type) {
+        case MetricType::kCounter: {
+            uint64_t total = 0;
+            for (uint32_t s = 0; s < shards; ++s) {
+                total += layout.counters(s)[descriptor.slot].load(std::memory_order_relaxed);
+            }
+            metric.value = static_cast<int64_t>(total);
+            break;
+        }
+        case MetricType::kGauge:
+            metric.value = layout.gauges()[descriptor.slot].value.load(std::memory_order_relaxed);
+            break;
+        case MetricType::kHistogram: {
+            metric.buckets.assign(kHistogramBuckets, 0);
+            uint64_t samples = 0;
+            for (uint32_t s = 0; s < shards; ++s) {
+                const std::atomic<uint64_t>* cells = layout.histograms(s) + descriptor.slot * kHistogramStride;
+                for (size_t b = 0; b < kHistogramBuckets; ++b) {
+                    uint64_t n = cells[b].load(std::memory_order_relaxed);
+                    metric.buckets[b] += n;
+                    samples += n;
+                }
+                metric.sum += cells[kHistogramBuckets].load(std::memory_order_relaxed);
+            }
+            metric.value = static_cast<int64_t>(samples);
+            break;
+        }
+        default:
+            continue;
+        }
+        result.push_back(std::move(metric));
+    }
+    return result;
+}
+
+void set_error(std::string* error, const std::string& message) {
+    if (error != nullptr) {
+        *error = message;
+    }
+}
+
+std::atomic<uint64_t> g_next_registry_id{1};
+
+// 默认注册表导出的共享内存名（进程退出时删除）
+char g_default_shm_name[256] = {0};
+
+void unlink_default_segment() {
+    if (g_default_shm_name[0] != '\0') {
+        shm_unlink(g_default_shm_name);
+    }
+}
+
+}  // namespace
+
+const char* to_string(MetricType type) {
+    switch (type) {
+    case MetricType::kCounter:
+        return "counter";
+    case MetricType::kGauge:
+        return "gauge";
+    case MetricType::kHistogram:
+        return "histogram";
+    }
+    return "unknown";
+}
+
+// 映射的共享内存段；由注册表与各线程的分片租约（weak_ptr）共同观察
+struct MetricsRegistry::Segment {
+    uint8_t* base = nullptr;
+    size_t size = 0;
+    std::string shm_name;                       // 非空时析构删除共享内存段
+    Layout layout{nullptr, nullptr};
+
+    ~Segment() {
+        if (base != nullptr) {
+            munmap(base, size);
+        }
+        if (!shm_name.empty()) {
+            shm_unlink(shm_name.c_str());
+        }
+    }
+
+    SegmentHeader* header() const { return reinterpret_cast<SegmentHeader*>(base); }
+
+    void release(uint32_t shard) {
+        layout.shard(shard)->owned.store(0, std::memory_order_release);
+    }
+};
+
+// 线程在某个注册表中独占（或共享）的分片；线程退出时归还
+struct MetricsRegistry::ShardLease {
+    uint64_t registry_id = 0;
+    std::weak_ptr<Segment> segment;
+    std::atomic<uint64_t>* counters = nullptr;
+    std::atomic<uint64_t>* histograms = nullptr;
+    uint32_t index = 0;
+    bool shared = false;                        // 分片 0：与其他线程共享，需原子加
+
+    ~ShardLease() {
+        if (!shared) {
+            if (auto alive = segment.lock()) {
+                alive->release(index);
+            }
+        }
+    }
+};
+
+std::unique_ptr<MetricsRegistry> MetricsRegistry::create(const MetricsOptions& options, std::string* error) {
+    if (options.max_shards == 0 || options.max_counters > UINT32_MAX / 2 ||
+        options.max_gauges > UINT32_MAX / 2 || options.max_histograms > UINT32_MAX / 2 ||
+        options.max_shards > UINT32_MAX / 2) {
+        set_error(error, "invalid metrics capacity");
+        return nullptr;
+    }
+
+    // 1. 计算布局
+    size_t metric_capacity = options.max_counters + options.max_gauges + options.max_histograms;
+    size_t descriptor_offset = align_up(sizeof(SegmentHeader));
+    size_t gauge_offset = align_up(descriptor_offset + metric_capacity * sizeof(MetricDescriptor));
+    size_t shard_offset = align_up(gauge_offset + options.max_gauges * sizeof(GaugeSlot));
+    size_t shard_stride = align_up(sizeof(ShardHeader) +
+        (options.max_counters + options.max_histograms * kHistogramStride) * sizeof(uint64_t));
+    size_t total_size = shard_offset + options.max_shards * shard_stride;
+
+    // 2. 映射内存（新建的共享内存段与匿名内存均已清零）
+    void* memory = MAP_FAILED;
+    if (options.shm_name.empty()) {
+        memory = mmap(nullptr, total_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+        if (memory == MAP_FAILED) {
+            set_error(error, std::string("mmap failed: ") + std::strerror(errno));
+            return nullptr;
+        }
+    } else {
+        int fd = shm_open(options.shm_name.c_str(), O_CREAT | O_RDWR | O_TRUNC, 0644);
+        if (fd < 0) {
+            set_error(error, "shm_open " + options.shm_name + " failed: " + std::strerror(errno));
+            return nullptr;
+        }
+        if (ftruncate(fd, static_cast<off_t>(total_size)) != 0) {
+            set_error(error, "ftruncate " + options.shm_name + " failed: " + std::strerror(errno));
+            close(fd);
+            shm_unlink(options.shm_name.c_str());
+            return nullptr;
+        }
+        memory = mmap(nullptr, total_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        close(fd);
+        if (memory == MAP_FAILED) {
+            set_error(error, "mmap " + options.shm_name + " failed: " + std::strerror(errno));
+            shm_unlink(options.shm_name.c_str());
+            return nullptr;
+        }
+    }
+
+    auto segment = std::make_shared<Segment>();
+    segment->base = static_cast<uint8_t*>(memory);
+    segment->size = total_size;
+    segment->shm_name = options.shm_name;
+
+    // 3. 初始化段头，最后发布 magic
+    SegmentHeader* header = new (memory) SegmentHeader();
+    header->version = kVersion;
+    header->pid = static_cast<int32_t>(getpid());
+    header->total_size = total_size;
+    header->max_counters = static_cast<uint32_t>(options.max_counters);
+    header->max_gauges = static_cast<uint32_t>(options.max_gauges);
+    header->max_histograms = static_cast<uint32_t>(options.max_histograms);
+    header->max_shards = static_cast<uint32_t>(options.max_shards);
+    header->descriptor_offset = descriptor_offset;
+    header->gauge_offset = gauge_offset;
+    header->shard_offset = shard_offset;
+    header->shard_stride = shard_stride;
+    header->metric_count.store(0, std::memory_order_relaxed);
+    header->shard_high_water.store(1, std::memory_order_relaxed);   // 分片 0 始终参与汇总
+    header->magic.store(kMagic, std::memory_order_release);
+    segment->layout = Layout{header, segment->base};
+
+    std::unique_ptr<MetricsRegistry> registry(new MetricsRegistry());
+    registry->segment_ = std::move(segment);
+    registry->id_ = g_next_registry_id.fetch_add(1, std::memory_order_relaxed);
+    registry->shm_name_ = options.shm_name;
+    return registry;
+}
+
+MetricsRegistry& MetricsRegistry::instance() {
+    // 有意不析构：句柄可能存放在静态对象或线程私有对象中，在进程退出的任意时刻仍会被使用
+    static MetricsRegistry* registry = []() {
+        MetricsOptions options;
+        const char* name = std::getenv("QT_METRICS_SHM");
+        if (name != nullptr && name[0] != '\0') {
+            options.shm_name = name;
+            std::string error;
+            auto shared = create(options, &error);
+            if (shared) {
+                shared->segment_->shm_name.clear();   // 不随析构删除，改为进程退出时删除
+                std::snprintf(g_default_shm_name, sizeof(g_default_shm_name), "%s", name);
+                std::atexit(unlink_default_segment);
+                return shared.release();
+            }
+            std::fprintf(stderr, "[metrics] %s, falling back to private memory\n", error.c_str());
+            options.shm_name.clear();
+        }
+        return create(options).release();
+    }();
+    return *registry;
+}
+
+MetricsRegistry::~MetricsRegistry() = default;
+
+uint32_t MetricsRegistry::register_metric(const std::string& name, MetricType type,
+                                          uint32_t capacity, uint32_t& next_slot) {
+    if (name.empty() || name.size() >= kMaxMetricName) {
+        return kInvalidSlot;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    SegmentHeader* header = segment_->header();
+    auto* descriptors = const_cast<MetricDescriptor*>(segment_->layout.descriptors());
+    uint32_t count = header->metric_count.load(std::memory_order_relaxed);
+    for (uint32_t i = 0; i < count; ++i) {
+        if (std::strncmp(descriptors[i].name, name.c_str(), kMaxMetricName) == 0) {
+            return descriptors[i].type == static_cast<uint32_t>(type) ? descriptors[i].slot : kInvalidSlot;
+        }
+    }
+    if (next_slot >= capacity) {
+        return kInvalidSlot;
+    }
+
+    // 先写描述，再以 release 发布数量，读者看到数量时描述已完整
+    MetricDescriptor& descriptor = descriptors[count];
+    std::memset(descriptor.name, 0, sizeof(descriptor.name));
+    std::memcpy(descriptor.name, name.data(), name.size());
+    descriptor.type = static_cast<uint32_t>(type);
+    descriptor.slot = next_slot++;
+    header->metric_count.store(count + 1, std::memory_order_release);
+    return descriptor.slot;
+}
+
+Counter MetricsRegistry::counter(const std::string& name) {
+    uint32_t slot = register_metric(name, MetricType::kCounter, segment_->header()->max_counters, next_counter_);
+    return slot == kInvalidSlot ? Counter() : Counter(this, slot);
+}
+
+Gauge MetricsRegistry::gauge(const std::string& name) {
+    uint32_t slot = register_metric(name, MetricType::kGauge, segment_->header()->max_gauges, next_gauge_);
+    return slot == kInvalidSlot ? Gauge() : Gauge(&segment_->layout.gauges()[slot].value);
+}
+
+Histogram MetricsRegistry::histogram(const std::string& name) {
+    uint32_t slot = register_metric(name, MetricType::kHistogram, segment_->header()->max_histograms, next_histogram_);
+    return slot == kInvalidSlot ? Histogram() : Histogram(this, slot);
+}
+
+const MetricsRegistry::ShardLease& MetricsRegistry::local_shard() {
+    // 最近使用的注册表走快速路径；其余租约按注册表保存，线程退出时析构并归还分片
+    thread_local std::vector<std::unique_ptr<ShardLease>> leases;
+    thread_local ShardLease* cached = nullptr;
+    if (cached != nullptr && cached->registry_id == id_) {
+        return *cached;
+    }
+    for (auto& lease : leases) {
+        if (lease->registry_id == id_) {
+            cached = lease.get();
+            return *cached;
+        }
+    }
+
+    // 清理已销毁注册表的租约，然后申请一个空闲分片
+    leases.erase(std::remove_if(leases.begin(), leases.end(),
+                                [](const std::unique_ptr<ShardLease>& lease) { return lease->segment.expired(); }),
+                 leases.end());
+    const Layout& layout = segment_->layout;
+    SegmentHeader* header = segment_->header();
+    auto lease = std::make_unique<ShardLease>();
+    lease->registry_id = id_;
+    lease->segment = segment_;
+    lease->shared = true;
+    for (uint32_t i = 1; i < header->max_shards; ++i) {
+        uint32_t expected = 0;
+        if (layout.shard(i)->owned.compare_exchange_strong(expected, 1, std::memory_order_acq_rel)) {
+            lease->index = i;
+            lease->shared = false;
+            uint32_t high = header->shard_high_water.load(std::memory_order_relaxed);
+            while (high < i + 1 && !header->shard_high_water.compare_exchange_weak(
+                       high, i + 1, std::memory_order_release, std::memory_order_relaxed)) {
+            }
+            break;
+        }
+    }
+    lease->counters = layout.counters(lease->index);
+    lease->histograms = layout.histograms(lease->index);
+    leases.push_back(std::move(lease));
+    cached = leases.back().get();
+    return *cached;
+}
+
+std::vector<MetricValue> MetricsRegistry::snapshot() const {
+    return read_metrics(segment_->layout);
+}
+
+size_t MetricsRegistry::metric_count() const {
+    return segment_->header()->metric_count.load(std::memory_order_acquire);
+}
+
+size_t MetricsRegistry::shards_in_use() const {
+    const Layout& layout = segment_->layout;
+    size_t used = 0;
+    for (uint32_t i = 1; i < segment_->header()->max_shards; ++i) {
+        used += layout.shard(i)->owned.load(std::memory_order_relaxed);
+    }
+    return used;
+}
+
+void Counter::add(uint64_t n) const {
+    if (registry_ == nullptr) {
+        return;
+    }
+    const MetricsRegistry::ShardLease& lease = registry_->local_shard();
+    std::atomic<uint64_t>& cell = lease.counters[slot_];
+    if (lease.shared) {
+        cell.fetch_add(n, std::memory_order_relaxed);
+    } else {
+        cell.store(cell.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+    }
+}
+
+uint64_t Counter::value() const {
+    if (registry_ == nullptr) {
+        return 0;
+    }
+    const Layout& layout = registry_->segment_->layout;
+    uint32_t shards = layout.header->shard_high_water.load(std::memory_order_acquire);
+    uint64_t total = 0;
+    for (uint32_t s = 0; s < shards; ++s) {
+        total += layout.counters(s)[slot_].load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+void Histogram::record(uint64_t value) const {
+    if (registry_ == nullptr) {
+        return;
+    }
+    const MetricsRegistry::ShardLease& lease = registry_->local_shard();
+    std::atomic<uint64_t>* cells = lease.histograms + slot_ * kHistogramStride;
+    std::atomic<uint64_t>& bucket = cells[bucket_of(value)];
+    std::atomic<uint64_t>& sum = cells[kHistogramBuckets];
+    if (lease.shared) {
+        bucket.fetch_add(1, std::memory_order_relaxed);
+        sum.fetch_add(value, std::memory_order_relaxed);
+    } else {
+        bucket.store(bucket.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        sum.store(sum.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+    }
+}
+
+uint64_t MetricValue::percentile(double p) const {
+    if (type != MetricType::kHistogram || value <= 0 || buckets.size() != kHistogramBuckets) {
+        return 0;
+    }
+    p = std::min(std::max(p, 0.0), 100.0);
+    uint64_t target = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(p / 100.0 * static_cast<double>(value))));
+    uint64_t seen = 0;
+    for (size_t b = 0; b < kHistogramBuckets; ++b) {
+        seen += buckets[b];
+        if (seen >= target) {
+            return b == 0 ? 0 : (b == 64 ? UINT64_MAX : (uint64_t(1) << b) - 1);
+        }
+    }
+    return UINT64_MAX;
+}
+
+std::unique_ptr<MetricsReader> MetricsReader::open(const std::string& shm_name, std::string* error) {
+    int fd = shm_open(shm_name.c_str(), O_RDONLY, 0);
+    if (fd < 0) {
+        set_error(error, "shm_open " + shm_name + " failed: " + std::strerror(errno));
+        return nullptr;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(SegmentHeader)) {
+        set_error(error, shm_name + " is not a metrics segment");
+        close(fd);
+        return nullptr;
+    }
+    size_t size = static_cast<size_t>(st.st_size);
+    void* memory = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (memory == MAP_FAILED) {
+        set_error(error, "mmap " + shm_name + " failed: " + std::strerror(errno));
+        return nullptr;
+    }
+
+    const auto* header = static_cast<const SegmentHeader*>(memory);
+    if (header->magic.load(std::memory_order_acquire) != kMagic || header->version != kVersion ||
+        header->total_size > size) {
+        set_error(error, shm_name + " has an unknown layout");
+        munmap(memory, size);
+        return nullptr;
+    }
+    std::unique_ptr<MetricsReader> reader(new MetricsReader());
+    reader->base_ = static_cast<const uint8_t*>(memory);
+    reader->size_ = size;
+    return reader;
+}
+
+MetricsReader::~MetricsReader() {
+    if (base_ != nullptr) {
+        munmap(const_cast<uint8_t*>(base_), size_);
+    }
+}
+
+std::vector<MetricValue> MetricsReader::snapshot() const {
+    // 只读映射：Layout 的非 const 指针只用于 load
+    Layout layout{reinterpret_cast<const SegmentHeader*>(base_), const_cast<uint8_t*>(base_)};
+    return read_metrics(layout);
+}
+
+int32_t MetricsReader::writer_pid() const {
+    return reinterpret_cast<const SegmentHeader*>(base_)->pid;
+}
+
+std::string format_metrics(const std::vector<MetricValue>& metrics) {
+    std::ostringstream out;
+    char line[256];
+    for (const auto& metric : metrics) {
+        if (metric.type == MetricType::kHistogram) {
+            double mean = metric.value > 0 ? static_cast<double>(metric.sum) / static_cast<double>(metric.value) : 0.0;
+            std::snprintf(line, sizeof(line), "%-48s %-9s count=%lld mean=%.1f p50<=%llu p99<=%llu p99.9<=%llu\n",
+                          metric.name.c_str(), to_string(metric.type), static_cast<long long>(metric.value), mean,
+                          static_cast<unsigned long long>(metric.percentile(50.0)),
+                          static_cast<unsigned long long>(metric.percentile(99.0)),
+                          static_cast<unsigned long long>(metric.percentile(99.9)));
+        } else {
+            std::snprintf(line, sizeof(line), "%-48s %-9s %lld\n",
+                          metric.name.c_str(), to_string(metric.type), static_cast<long long>(metric.value));
+        }
+        out << line;
+    }
+    return out.str();
+}
+
+}  // namespace metrics
+}  // namespace common
+}  // namespace base
+}  // namespace quant
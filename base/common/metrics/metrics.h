@@ -0,0 +1,209 @@
+#ifndef BASE_COMMON_METRICS_METRICS_H_
+#define BASE_COMMON_METRICS_METRICS_H_
+
+#include <atomic>         // 用于原子计数
+#include <cstddef>        // 用于 size_t
+#include <cstdint>        // 用于 uint64_t/int64_t
+#include <memory>         // 用于 unique_ptr/shared_ptr
+#include <mutex>          // 注册路径（冷路径）加锁
+#include <string>
+#include <vector>
+
+namespace quant {
+namespace base {
+namespace common {
+namespace metrics {
+
+enum class MetricType : uint8_t {
+    kCounter = 1,       // 单调递增计数（各分片求和）
+    kGauge = 2,         // 瞬时值（最后一次写入为准）
+    kHistogram = 3,     // 按 2 的幂分桶的分布
+};
+
+const char* to_string(MetricType type);
+
+constexpr size_t kMaxMetricName = 64;           // 指标名最大长度（含结尾 '\0'）
+constexpr size_t kHistogramBuckets = 65;        // 桶 0 为数值 0，桶 b（1~64）为 [2^(b-1), 2^b)
+
+// 注册表容量（创建时确定，之后不可扩展）
+struct MetricsOptions {
+    std::string shm_name;                       // POSIX 共享内存名（如 "/quant_metrics"），为空时使用匿名内存
+    size_t max_counters = 256;
+    size_t max_gauges = 256;
+    size_t max_histograms = 32;
+    size_t max_shards = 64;                     // 分片 0 为共享溢出分片，其余每个写线程独占一个
+};
+
+class MetricsRegistry;
+
+// 计数器句柄：add() 只写当前线程独占的分片（relaxed load + store，无锁、无原子读改写）
+// 默认构造的句柄无效，所有操作为空操作
+class Counter {
+public:
+    Counter() = default;
+
+    void add(uint64_t n) const;
+    void inc() const { add(1); }
+
+    // 各分片求和（冷路径）
+    uint64_t value() const;
+    bool valid() const { return registry_ != nullptr; }
+
+private:
+    friend class MetricsRegistry;
+    Counter(MetricsRegistry* registry, uint32_t slot) : registry_(registry), slot_(slot) {}
+
+    MetricsRegistry* registry_ = nullptr;
+    uint32_t slot_ = 0;
+};
+
+// 仪表句柄：直接指向共享内存中独占缓存行的槽位，set() 为一次 relaxed store
+class Gauge {
+public:
+    Gauge() = default;
+
+    void set(int64_t value) const {
+        if (value_ != nullptr) {
+            value_->store(value, std::memory_order_relaxed);
+        }
+    }
+
+    // 多个线程同时增减同一仪表时使用（原子加）
+    void add(int64_t delta) const {
+        if (value_ != nullptr) {
+            value_->fetch_add(delta, std::memory_order_relaxed);
+        }
+    }
+
+    int64_t value() const { return value_ != nullptr ? value_->load(std::memory_order_relaxed) : 0; }
+    bool valid() const { return value_ != nullptr; }
+
+private:
+    friend class MetricsRegistry;
+    explicit Gauge(std::atomic<int64_t>* value) : value_(value) {}
+
+    std::atomic<int64_t>* value_ = nullptr;
+};
+
+// 直方图句柄：与计数器相同，按线程分片写入
+class Histogram {
+public:
+    Histogram() = default;
+
+    void record(uint64_t value) const;
+    bool valid() const { return registry_ != nullptr; }
+
+    // 数值所在的桶
+    static size_t bucket_of(uint64_t value) {
+        return value == 0 ? 0 : static_cast<size_t>(64 - __builtin_clzll(value));
+    }
+
+private:
+    friend class MetricsRegistry;
+    Histogram(MetricsRegistry* registry, uint32_t slot) : registry_(registry), slot_(slot) {}
+
+    MetricsRegistry* registry_ = nullptr;
+    uint32_t slot_ = 0;
+};
+
+// 一个指标的读取结果
+struct MetricValue {
+    std::string name;
+    MetricType type = MetricType::kCounter;
+    int64_t value = 0;                          // 计数器/仪表的值；直方图为样本数
+    uint64_t sum = 0;                           // 直方图：样本和
+    std::vector<uint64_t> buckets;              // 直方图：各桶计数（kHistogramBuckets 个）
+
+    // 直方图分位数（返回所在桶的上界，p 取 0~100）
+    uint64_t percentile(double p) const;
+};
+
+// 进程内指标注册表，整体布局在一段（可选命名的）共享内存中：
+//   [段头][指标描述表][仪表槽位（每个独占缓存行）][分片 0][分片 1]...[分片 N-1]
+// - 计数器与直方图按线程分片：每个写线程首次写入时独占一个分片，之后只做 relaxed load + store，
+//   没有锁、没有原子读改写，也没有跨线程的缓存行争用；线程退出时分片归还，数值保留并由后续线程续写
+// - 分片用尽时退化为写共享的分片 0（fetch_add），结果仍然正确
+// - 读者（本进程 snapshot() 或其他进程的 MetricsReader）只读共享内存，对交易线程没有任何影响；
+//   各分片求和得到的计数是近似瞬时值（读取期间仍在写入）
+// - 指标注册（counter()/gauge()/histogram()）加锁，属于冷路径，应在启动时完成并缓存句柄
+class MetricsRegistry {
+public:
+    // 创建注册表；shm_name 非空时创建（覆盖）同名 POSIX 共享内存段，析构时删除。
+    // 失败返回 nullptr，错误信息写入 error
+    static std::unique_ptr<MetricsRegistry> create(const MetricsOptions& options, std::string* error = nullptr);
+
+    // 进程级默认注册表：环境变量 QT_METRICS_SHM 指定共享内存名时导出到该段（进程退出时删除），
+    // 否则使用匿名内存（仅本进程可读）
+    static MetricsRegistry& instance();
+
+    ~MetricsRegistry();
+
+    // 禁止拷贝和移动（句柄持有注册表指针）
+    MetricsRegistry(const MetricsRegistry&) = delete;
+    MetricsRegistry& operator=(const MetricsRegistry&) = delete;
+
+    // 注册或查找指标：同名同类型返回同一个指标；类型不符、名称过长或容量已满时返回无效句柄
+    Counter counter(const std::string& name);
+    Gauge gauge(const std::string& name);
+    Histogram histogram(const std::string& name);
+
+    // 读取全部指标（冷路径）
+    std::vector<MetricValue> snapshot() const;
+
+    const std::string& shm_name() const { return shm_name_; }
+    size_t metric_count() const;
+    size_t shards_in_use() const;
+
+private:
+    friend class Counter;
+    friend class Histogram;
+    struct Segment;
+    struct ShardLease;
+
+    MetricsRegistry() = default;
+
+    // 当前线程在本注册表中的分片（首次调用时分配）
+    const ShardLease& local_shard();
+    uint32_t register_metric(const std::string& name, MetricType type, uint32_t capacity, uint32_t& next_slot);
+
+    std::shared_ptr<Segment> segment_;          // 线程私有的分片租约通过 weak_ptr 观察注册表是否仍然存在
+    uint64_t id_ = 0;                           // 进程内唯一编号，用于线程私有缓存的匹配
+    std::string shm_name_;
+    std::mutex mutex_;                          // 保护指标注册（冷路径）
+    uint32_t next_counter_ = 0;
+    uint32_t next_gauge_ = 0;
+    uint32_t next_histogram_ = 0;
+};
+
+// 跨进程只读访问：打开其他进程导出的指标共享内存段（监控服务 / 命令行工具使用）
+class MetricsReader {
+public:
+    // 打开失败（不存在、格式或版本不符）返回 nullptr，错误信息写入 error
+    static std::unique_ptr<MetricsReader> open(const std::string& shm_name, std::string* error = nullptr);
+
+    ~MetricsReader();
+
+    MetricsReader(const MetricsReader&) = delete;
+    MetricsReader& operator=(const MetricsReader&) = delete;
+
+    std::vector<MetricValue> snapshot() const;
+
+    // 写入方进程号
+    int32_t writer_pid() const;
+
+private:
+    MetricsReader() = default;
+
+    const uint8_t* base_ = nullptr;
+    size_t size_ = 0;
+};
+
+// 格式化指标（每行一个：计数器/仪表输出数值，直方图输出样本数、均值与 p50/p99/p99.9 所在桶上界）
+std::string format_metrics(const std::vector<MetricValue>& metrics);
+
+}  // namespace metrics
+}  // namespace common
+}  // namespace base
+}  // namespace quant
+
+#endif  // BASE_COMMON_METRICS_METRICS_H_
@@ -0,0 +1,19 @@
+#include "object_pool.h"
+#include <string>
+
+
+namespace quant {
+namespace base {
+namespace common {
+namespace object_pool {
+
+    // 模板类的显式实例化声明，用于分离编译
+    // 实际使用时可根据需要添加常用类型的实例化
+    template class ObjectPool<int>;
+    template class ObjectPool<long>;
+    template class ObjectPool<std::string>;
+
+}  // namespace object_pool
+}  // namespace common
+}  // namespace base
+}  // namespace quant
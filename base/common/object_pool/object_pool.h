@@ -0,0 +1,139 @@
+#ifndef BASE_COMMON_OBJECT_POOL_OBJECT_POOL_H_
+#define BASE_COMMON_OBJECT_POOL_OBJECT_POOL_H_
+
+#include <vector>         // 槽位存储（构造时一次性分配）
+#include <memory>         // 用于 std::allocator/allocator_traits
+#include <cstddef>        // 用于 size_t
+#include <cstdint>        // 用于 uint32_t/uint64_t
+#include <stdexcept>      // 用于异常定义
+
+namespace quant {
+namespace base {
+namespace common {
+namespace object_pool {
+
+// 定长对象池：构造时预分配全部槽位，运行期通过空闲链表分配/归还，不再申请内存
+// - 句柄 = (代数 << 32) | 槽位下标，槽位被归还后代数递增，旧句柄随即失效（防止悬挂访问）
+// - 非线程安全：由单一线程（如订单管理线程）独占使用
+// - Allocator 决定槽位数组的来源（如 arena::ArenaAllocator<T>，使整个池落在大页区内）
+template <typename T, typename Allocator = std::allocator<T>>
+class ObjectPool {
+public:
+    using Handle = uint64_t;
+    static constexpr Handle kInvalidHandle = 0;
+
+    // 1. 构造/析构：容量必须在 (0, kNoFreeSlot) 内（下标与空闲链表结束标记共用 32 位），禁止拷贝/移动
+    explicit ObjectPool(size_t capacity, const Allocator& allocator = Allocator())
+        : slots_(checked_capacity(capacity), SlotAllocator(allocator)) {
+        for (size_t i = 0; i + 1 < capacity; ++i) {
+            slots_[i].next_free = static_cast<uint32_t>(i + 1);
+        }
+        slots_[capacity - 1].next_free = kNoFreeSlot;
+        free_head_ = 0;
+    }
+    ~ObjectPool() = default;
+
+    ObjectPool(const ObjectPool&) = delete;
+    ObjectPool& operator=(const ObjectPool&) = delete;
+    ObjectPool(ObjectPool&&) = delete;
+    ObjectPool& operator=(ObjectPool&&) = delete;
+
+
+    // 2. 分配：返回句柄，池耗尽时返回 kInvalidHandle；对象为默认构造状态
+    Handle acquire() {
+        if (free_head_ == kNoFreeSlot) {
+            return kInvalidHandle;
+        }
+        uint32_t index = free_head_;
+        Slot& slot = slots_[index];
+        free_head_ = slot.next_free;
+        slot.in_use = true;
+        ++size_;
+        return make_handle(slot.generation, index);
+    }
+
+    // 3. 访问：句柄无效（越界/已归还）时返回 nullptr
+    T* get(Handle handle) {
+        Slot* slot = lookup(handle);
+        return slot != nullptr ? &slot->value : nullptr;
+    }
+
+    const T* get(Handle handle) const {
+        const Slot* slot = const_cast<ObjectPool*>(this)->lookup(handle);
+        return slot != nullptr ? &slot->value : nullptr;
+    }
+
+    // 4. 归还：对象重置为默认状态，槽位代数递增使旧句柄失效
+    bool release(Handle handle) {
+        Slot* slot = lookup(handle);
+        if (slot == nullptr) {
+            return false;
+        }
+        uint32_t index = static_cast<uint32_t>(handle & 0xFFFFFFFFu);
+        slot->value = T();
+        slot->in_use = false;
+        slot->generation = slot->generation == UINT32_MAX ? 1 : slot->generation + 1;
+        slot->next_free = free_head_;
+        free_head_ = index;
+        --size_;
+        return true;
+    }
+
+    // 由句柄取槽位下标（可用作稠密数组的下标）
+    static uint32_t index_of(Handle handle) {
+        return static_cast<uint32_t>(handle & 0xFFFFFFFFu);
+    }
+
+    // 5. 状态查询
+    size_t size() const { return size_; }
+    size_t capacity() const { return slots_.size(); }
+    size_t available() const { return slots_.size() - size_; }
+
+private:
+    struct Slot {
+        T value{};
+        uint32_t generation = 1;        // 从 1 开始，保证有效句柄不为 0
+        uint32_t next_free = 0;
+        bool in_use = false;
+    };
+
+    using SlotAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Slot>;
+
+    static constexpr uint32_t kNoFreeSlot = UINT32_MAX;     // 空闲链表结束标记（不是合法下标）
+
+    // 在分配槽位数组之前校验容量
+    static size_t checked_capacity(size_t capacity) {
+        if (capacity == 0 || capacity >= kNoFreeSlot) {
+            throw std::invalid_argument("ObjectPool capacity must be in (0, 2^32 - 1)");
+        }
+        return capacity;
+    }
+
+    static Handle make_handle(uint32_t generation, uint32_t index) {
+        return (static_cast<Handle>(generation) << 32) | index;
+    }
+
+    Slot* lookup(Handle handle) {
+        uint32_t index = static_cast<uint32_t>(handle & 0xFFFFFFFFu);
+        uint32_t generation = static_cast<uint32_t>(handle >> 32);
+        if (index >= slots_.size()) {
+            return nullptr;
+        }
+        Slot& slot = slots_[index];
+        if (!slot.in_use || slot.generation != generation) {
+            return nullptr;
+        }
+        return &slot;
+    }
+
+    std::vector<Slot, SlotAllocator> slots_;    // 槽位数组
+    uint32_t free_head_ = 0;            // 空闲链表头（kNoFreeSlot 表示已耗尽）
+    size_t size_ = 0;                   // 已分配数量
+};
+
+}  // namespace object_pool
+}  // namespace common
+}  // namespace base
+}  // namespace quant
+
+#endif  // BASE_COMMON_OBJECT_POOL_OBJECT_POOL_H_
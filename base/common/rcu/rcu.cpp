@@ -0,0 +1,141 @@
+#include "rcu.h"
+#include <thread>
+#include "utils/async_logger/async_logger.h"   // 读者槽位用尽告警
+
+namespace quant {
+namespace base {
+namespace common {
+namespace rcu {
+
+namespace {
+
+// 当前线程最近注册的读者（按 previous_ 串成线程内的读者链）
+thread_local RcuReader* tls_reader = nullptr;
+
+}  // namespace
+
+RcuReader::RcuReader(RcuDomain& domain)
+    : domain_(domain), id_(domain.register_reader()), previous_(tls_reader) {
+    tls_reader = this;
+}
+
+RcuReader::~RcuReader() {
+    if (tls_reader == this) {
+        tls_reader = previous_;
+    }
+    if (id_ >= 0) {
+        domain_.unregister_reader(id_);
+    }
+}
+
+bool RcuReader::active(const RcuDomain& domain) {
+    for (const RcuReader* reader = tls_reader; reader != nullptr; reader = reader->previous_) {
+        if (&reader->domain_ == &domain) {
+            return reader->id_ >= 0 && reader->online_;
+        }
+    }
+    return false;
+}
+
+RcuDomain& RcuDomain::instance() {
+    static RcuDomain domain;
+    return domain;
+}
+
+RcuDomain::RcuDomain() : global_epoch_(1) {}
+
+RcuDomain::~RcuDomain() {
+    // 域销毁时不再有读者，直接回收全部对象
+    std::lock_guard<std::mutex> lock(retire_mutex_);
+    for (auto& item : retired_) {
+        item.second();
+    }
+    retired_.clear();
+}
+
+int RcuDomain::register_reader() {
+    for (size_t i = 0; i < kMaxReaders; ++i) {
+        uint64_t expected = kUnused;
+        uint64_t epoch = global_epoch_.load(std::memory_order_seq_cst);
+        if (slots_[i].epoch.compare_exchange_strong(expected, epoch, std::memory_order_seq_cst)) {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            return static_cast<int>(i);
+        }
+    }
+    QT_LOG_ERROR("[Rcu] All {} reader slots are in use, reader registration failed", kMaxReaders);
+    return -1;
+}
+
+void RcuDomain::unregister_reader(int reader) {
+    if (reader < 0 || static_cast<size_t>(reader) >= kMaxReaders) {
+        return;
+    }
+    slots_[reader].epoch.store(kUnused, std::memory_order_release);
+}
+
+void RcuDomain::retire(std::function<void()> deleter) {
+    {
+        std::lock_guard<std::mutex> lock(retire_mutex_);
+        // 递增后的纪元：读者报告的纪元不小于它时，说明已越过本次替换
+        uint64_t epoch = global_epoch_.fetch_add(1, std::memory_order_seq_cst) + 1;
+        retired_.emplace_back(epoch, std::move(deleter));
+    }
+    reclaim();
+}
+
+uint64_t RcuDomain::min_reader_epoch() const {
+    uint64_t min_epoch = kOffline;
+    for (size_t i = 0; i < kMaxReaders; ++i) {
+        uint64_t epoch = slots_[i].epoch.load(std::memory_order_seq_cst);
+        if (epoch != kUnused && epoch < min_epoch) {
+            min_epoch = epoch;
+        }
+    }
+    return min_epoch;
+}
+
+size_t RcuDomain::reclaim() {
+    std::vector<std::function<void()>> ready;
+    {
+        std::lock_guard<std::mutex> lock(retire_mutex_);
+        if (retired_.empty()) {
+            return 0;
+        }
+        uint64_t safe_epoch = min_reader_epoch();
+        auto it = retired_.begin();
+        while (it != retired_.end()) {
+            if (it->first <= safe_epoch) {
+                ready.push_back(std::move(it->second));
+                it = retired_.erase(it);
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    // 在锁外执行回收，避免析构函数中再次 retire 导致死锁
+    for (auto& deleter : ready) {
+        deleter();
+    }
+    return ready.size();
+}
+
+void RcuDomain::synchronize() {
+    while (true) {
+        reclaim();
+        if (pending() == 0) {
+            return;
+        }
+        std::this_thread::yield();
+    }
+}
+
+size_t RcuDomain::pending() const {
+    std::lock_guard<std::mutex> lock(retire_mutex_);
+    return retired_.size();
+}
+
+}  // namespace rcu
+}  // namespace common
+}  // namespace base
+}  // namespace quant
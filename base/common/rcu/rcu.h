@@ -0,0 +1,166 @@
+#ifndef BASE_COMMON_RCU_RCU_H_
+#define BASE_COMMON_RCU_RCU_H_
+
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <functional>
+
+namespace quant {
+namespace base {
+namespace common {
+namespace rcu {
+
+// 基于静止状态（QSBR）的 RCU 域
+// - 读者：只做普通的原子 acquire 读取，读路径无锁、无写共享内存；
+//         读者线程需注册，并在不持有任何 RCU 指针的安全点调用 quiescent()（如事件循环每处理完一个事件），
+//         空闲阻塞前调用 offline()，恢复处理前调用 online()
+// - 写者：发布新对象后将旧对象 retire()，待所有在线读者都经过一次静止状态后再回收
+class RcuDomain {
+public:
+    static constexpr size_t kMaxReaders = 128;   // 最大读者线程数
+
+    // 全局默认域
+    static RcuDomain& instance();
+
+    RcuDomain();
+    ~RcuDomain();
+
+    // 禁止拷贝和移动
+    RcuDomain(const RcuDomain&) = delete;
+    RcuDomain& operator=(const RcuDomain&) = delete;
+    RcuDomain(RcuDomain&&) = delete;
+    RcuDomain& operator=(RcuDomain&&) = delete;
+
+    // 注册读者，返回读者编号；槽位用尽时返回 -1 并记录错误日志（注册后处于在线状态）
+    int register_reader();
+
+    // 注销读者
+    void unregister_reader(int reader);
+
+    // 报告静止状态：调用前读到的所有 RCU 指针此后不再使用
+    void quiescent(int reader) {
+        slots_[reader].epoch.store(global_epoch_.load(std::memory_order_acquire), std::memory_order_release);
+    }
+
+    // 进入离线（长时间静止，如阻塞等待前），离线读者不会阻塞回收
+    void offline(int reader) {
+        slots_[reader].epoch.store(kOffline, std::memory_order_release);
+    }
+
+    // 恢复在线（离线后再次读取 RCU 指针之前调用）
+    void online(int reader) {
+        slots_[reader].epoch.store(global_epoch_.load(std::memory_order_seq_cst), std::memory_order_seq_cst);
+        // 与写者的 publish/扫描形成全序：写者若未看到本次上线，则此后的读取一定能看到新指针
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+    }
+
+    // 写者：延迟回收旧对象（deleter 在安全时执行）
+    void retire(std::function<void()> deleter);
+
+    // 回收所有已安全的对象，返回本次回收数量
+    size_t reclaim();
+
+    // 阻塞直到当前所有已 retire 的对象均被回收（冷路径，用于停机/测试）
+    void synchronize();
+
+    // 等待回收的对象数量
+    size_t pending() const;
+
+private:
+    static constexpr uint64_t kUnused = 0;
+    static constexpr uint64_t kOffline = UINT64_MAX;
+
+    // 每个读者独占缓存行，避免读者之间的伪共享
+    struct alignas(64) ReaderSlot {
+        std::atomic<uint64_t> epoch{kUnused};
+    };
+
+    // 所有在线读者都已越过的最小纪元
+    uint64_t min_reader_epoch() const;
+
+    std::atomic<uint64_t> global_epoch_;                               // 全局纪元（每次 retire 递增）
+    ReaderSlot slots_[kMaxReaders];                                    // 读者槽位
+    mutable std::mutex retire_mutex_;                                  // 保护待回收列表（仅写者路径）
+    std::vector<std::pair<uint64_t, std::function<void()>>> retired_;  // (retire 纪元, 回收函数)
+};
+
+// 读者注册的 RAII 封装：在读者线程上构造，线程退出前析构（同一线程上按构造的逆序析构）
+// 槽位用尽时 valid() 为 false 并记录错误日志，此时该线程不得直接读取 RCU 指针
+class RcuReader {
+public:
+    explicit RcuReader(RcuDomain& domain = RcuDomain::instance());
+    ~RcuReader();
+
+    RcuReader(const RcuReader&) = delete;
+    RcuReader& operator=(const RcuReader&) = delete;
+
+    bool valid() const { return id_ >= 0; }
+    void quiescent() { if (id_ >= 0) domain_.quiescent(id_); }
+    void offline() {
+        if (id_ >= 0) {
+            domain_.offline(id_);
+            online_ = false;
+        }
+    }
+    void online() {
+        if (id_ >= 0) {
+            domain_.online(id_);
+            online_ = true;
+        }
+    }
+
+    // 当前线程是否为 domain 的在线读者：是则读到的 RCU 指针在本线程下一次 quiescent() 之前有效
+    static bool active(const RcuDomain& domain);
+
+private:
+    RcuDomain& domain_;
+    int id_;
+    bool online_ = true;
+    RcuReader* previous_;       // 本线程上先注册的读者（线程内读者链）
+};
+
+// RCU 保护的不可变对象指针：读者 load() 为一次 acquire 读取，写者 publish() 原子替换
+template <typename T>
+class RcuCell {
+public:
+    explicit RcuCell(std::unique_ptr<T> initial, RcuDomain& domain = RcuDomain::instance())
+        : domain_(domain), current_(initial.release()) {}
+
+    ~RcuCell() {
+        delete current_.load(std::memory_order_acquire);
+    }
+
+    RcuCell(const RcuCell&) = delete;
+    RcuCell& operator=(const RcuCell&) = delete;
+
+    // 读取当前对象（在下一次 quiescent() 之前有效；调用线程须为在线读者，见 RcuReader::active()）
+    const T* load() const {
+        return current_.load(std::memory_order_acquire);
+    }
+
+    // 发布新对象，旧对象交给 RCU 域延迟回收
+    void publish(std::unique_ptr<T> next) {
+        T* previous = current_.exchange(next.release(), std::memory_order_seq_cst);
+        if (previous != nullptr) {
+            domain_.retire([previous]() { delete previous; });
+        }
+    }
+
+    RcuDomain& domain() const { return domain_; }
+
+private:
+    RcuDomain& domain_;
+    std::atomic<T*> current_;
+};
+
+}  // namespace rcu
+}  // namespace common
+}  // namespace base
+}  // namespace quant
+
+#endif  // BASE_COMMON_RCU_RCU_H_
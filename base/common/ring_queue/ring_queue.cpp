@@ -0,0 +1,19 @@
+#include "ring_queue.h"
+#include <string>
+
+
+namespace quant {
+namespace base {
+namespace common {
+namespace ring_queue {
+
+    // 模板类的显式实例化声明，用于分离编译
+    // 实际使用时可根据需要添加常用类型的实例化
+    template class RingQueue<int>;
+    template class RingQueue<long>;
+    template class RingQueue<std::string>;
+
+}  // namespace ring_queue
+}  // namespace common
+}  // namespace base
+}  // namespace quant
@@ -0,0 +1,163 @@
+#ifndef BASE_COMMON_RING_QUEUE_RING_QUEUE_H_
+#define BASE_COMMON_RING_QUEUE_RING_QUEUE_H_
+
+#include <atomic>         // 序号/读写位置的原子操作
+#include <memory>         // 用于 std::allocator/allocator_traits（槽位数组）
+#include <new>            // 用于定位 new 与 std::launder（槽位存储上原地构造元素）
+#include <utility>        // 用于 std::forward/move（移动语义）
+#include <cstddef>        // 用于 size_t
+#include <cstdint>        // 用于 intptr_t
+#include <stdexcept>      // 用于异常定义
+
+namespace quant {
+namespace base {
+namespace common {
+namespace ring_queue {
+
+// 有界无锁环形队列（多生产者-多消费者，Vyukov 序号槽算法）
+// - 容量在构造时固定（向上取整为 2 的幂），运行期不再分配内存
+// - push/pop 均为非阻塞：队满 push 返回 false，队空 pop 返回 false
+// - 适用于热路径上的事件投递（如策略执行通道的入站事件环）
+// - Allocator 决定槽位数组的来源（如 arena::ArenaAllocator<T>，使整个环落在大页区内）
+template <typename T, typename Allocator = std::allocator<T>>
+class RingQueue {
+public:
+    // 1. 构造/析构：容量必须大于 0，禁止拷贝/移动（槽位中含原子变量）
+    explicit RingQueue(size_t capacity, const Allocator& allocator = Allocator()) : allocator_(allocator) {
+        if (capacity == 0) {
+            throw std::invalid_argument("RingQueue capacity must be greater than 0");
+        }
+        size_t rounded = 1;
+        while (rounded < capacity) {
+            rounded <<= 1;
+        }
+        mask_ = rounded - 1;
+        cells_ = CellTraits::allocate(allocator_, rounded);
+        for (size_t i = 0; i < rounded; ++i) {
+            ::new (static_cast<void*>(&cells_[i])) Cell();
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+        enqueue_pos_.store(0, std::memory_order_relaxed);
+        dequeue_pos_.store(0, std::memory_order_relaxed);
+    }
+    ~RingQueue() {
+        // 析构时没有并发访问：读写位置之间的槽位都已发布，元素尚未取走
+        size_t tail = enqueue_pos_.load(std::memory_order_relaxed);
+        for (size_t pos = dequeue_pos_.load(std::memory_order_relaxed); pos != tail; ++pos) {
+            cells_[pos & mask_].value()->~T();
+        }
+        for (size_t i = 0; i <= mask_; ++i) {
+            cells_[i].~Cell();
+        }
+        CellTraits::deallocate(allocator_, cells_, mask_ + 1);
+    }
+
+    RingQueue(const RingQueue&) = delete;
+    RingQueue& operator=(const RingQueue&) = delete;
+    RingQueue(RingQueue&&) = delete;
+    RingQueue& operator=(RingQueue&&) = delete;
+
+
+    // 2. 入队操作：队满时返回 false（由调用方决定丢弃、重试还是退避）
+    bool push(const T& value) {
+        return emplace(value);
+    }
+
+    bool push(T&& value) {
+        return emplace(std::move(value));
+    }
+
+    // 原地构造入队：元素直接在槽位存储上构造（push 为一次拷贝/移动构造），不经过临时对象
+    template <typename... Args>
+    bool emplace(Args&&... args) {
+        Cell* cell = nullptr;
+        size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &cells_[pos & mask_];
+            size_t seq = cell->sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+            if (diff == 0) {
+                // 槽位空闲：抢占该位置
+                if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;  // 队满
+            } else {
+                pos = enqueue_pos_.load(std::memory_order_relaxed);  // 被其他生产者抢先，重新读取
+            }
+        }
+        ::new (static_cast<void*>(cell->storage)) T(std::forward<Args>(args)...);
+        cell->sequence.store(pos + 1, std::memory_order_release);  // 发布给消费者
+        return true;
+    }
+
+
+    // 3. 出队操作：非阻塞，队空时返回 false；成功返回 true 并赋值 value
+    bool pop(T& value) {
+        Cell* cell = nullptr;
+        size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &cells_[pos & mask_];
+            size_t seq = cell->sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+            if (diff == 0) {
+                if (dequeue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                return false;  // 队空
+            } else {
+                pos = dequeue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+        T* data = cell->value();
+        value = std::move(*data);
+        data->~T();
+        cell->sequence.store(pos + mask_ + 1, std::memory_order_release);  // 归还槽位给生产者
+        return true;
+    }
+
+
+    // 4. 队列状态查询（瞬时近似值，高并发下可能有微小偏差）
+    size_t size() const {
+        size_t head = dequeue_pos_.load(std::memory_order_acquire);
+        size_t tail = enqueue_pos_.load(std::memory_order_acquire);
+        return tail > head ? tail - head : 0;
+    }
+
+    bool empty() const {
+        return size() == 0;
+    }
+
+    size_t capacity() const {
+        return mask_ + 1;
+    }
+
+private:
+    static constexpr size_t kCacheLineSize = 64;
+
+    // 每个槽位独占缓存行，避免相邻槽位的伪共享；元素只在入队到出队之间存活于 storage 中
+    struct alignas(kCacheLineSize) Cell {
+        std::atomic<size_t> sequence;
+        alignas(T) unsigned char storage[sizeof(T)];
+
+        T* value() { return std::launder(reinterpret_cast<T*>(storage)); }
+    };
+
+    using CellAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Cell>;
+    using CellTraits = std::allocator_traits<CellAllocator>;
+
+    CellAllocator allocator_;
+    Cell* cells_ = nullptr;                                          // 槽位数组（构造时一次性分配）
+    size_t mask_ = 0;                                                // 容量掩码（容量 - 1）
+    alignas(kCacheLineSize) std::atomic<size_t> enqueue_pos_;        // 生产者写位置
+    alignas(kCacheLineSize) std::atomic<size_t> dequeue_pos_;        // 消费者读位置
+};
+
+}  // namespace ring_queue
+}  // namespace common
+}  // namespace base
+}  // namespace quant
+
+#endif  // BASE_COMMON_RING_QUEUE_RING_QUEUE_H_
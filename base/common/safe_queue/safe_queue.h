@@ -2,11 +2,13 @@
 #define BASE_COMMON_SAFE_QUEUE_H_
 
 #include <deque>          // 底层存储（高效头尾操作）
+#include <memory>         // 用于 std::allocator
 #include <mutex>          // 互斥锁（保护临界区）
 #include <utility>        // 用于 std::forward/move（移动语义）
 #include <cstddef>        // 用于 size_t
 #include <stdexcept>      // 用于异常定义
 #include <condition_variable>  // 条件变量（空队列阻塞等待）
+#include "../metrics/metrics.h"  // 队列深度指标
 
 namespace quant {
 namespace base {
@@ -14,11 +16,13 @@ namespace common {
 namespace safe_queue {
 
 // 线程安全的有锁队列（多生产者-多消费者支持）
-template <typename T>
+// Allocator 用于底层 deque 的分段存储（如 arena::ArenaAllocator<T>，使分段落在大页区内）
+template <typename T, typename Allocator = std::allocator<T>>
 class SafeQueue {
 public:
     // 1. 构造/析构：默认构造，禁止拷贝/移动（避免并发场景下的浅拷贝问题）
     SafeQueue() = default;
+    explicit SafeQueue(const Allocator& allocator) : data_(allocator) {}
     ~SafeQueue() = default;
 
     // 禁止拷贝和移动（如需支持，需手动实现并加锁保护）
@@ -33,6 +37,7 @@ public:
     void push(const T& value) {
         std::lock_guard<std::mutex> lock(mutex_);  // RAII 锁：自动加锁/释放
         data_.push_back(value);                    // 底层容器入队
+        depth_gauge_.set(static_cast<int64_t>(data_.size()));
         cv_.notify_one();                          // 唤醒一个等待出队的线程（避免空队列阻塞）
     }
 
@@ -40,6 +45,7 @@ public:
     void push(T&& value) {
         std::lock_guard<std::mutex> lock(mutex_);
         data_.push_back(std::move(value));  // 移动而非拷贝，适合临时对象
+        depth_gauge_.set(static_cast<int64_t>(data_.size()));
         cv_.notify_one();
     }
 
@@ -55,6 +61,7 @@ public:
         // 弹出队头数据
         value = std::move(data_.front());
         data_.pop_front();
+        depth_gauge_.set(static_cast<int64_t>(data_.size()));
         return true;
     }
 
@@ -71,6 +78,7 @@ public:
         // 移动获取数据（减少拷贝），弹出队头
         value = std::move(data_.front());
         data_.pop_front();
+        depth_gauge_.set(static_cast<int64_t>(data_.size()));
         return true;
     }
 
@@ -93,6 +101,7 @@ public:
     void clear() {
         std::lock_guard<std::mutex> lock(mutex_);
         data_.clear();  // 清空底层容器
+        depth_gauge_.set(0);
         // 无需 notify：清空后队列仍为空，等待的线程会继续阻塞直到新数据入队
     }
 
@@ -102,15 +111,26 @@ public:
     void push_bulk(InputIt first, InputIt last) {
         std::lock_guard<std::mutex> lock(mutex_);
         data_.insert(data_.end(), first, last);  // 批量插入
+        depth_gauge_.set(static_cast<int64_t>(data_.size()));
         if (data_.size() >= 1) {
             cv_.notify_all();  // 批量入队，唤醒所有等待线程
         }
     }
 
+
+    // 7. 监控：把队列深度导出到指标仪表（在锁内随每次入队/出队更新，一次 relaxed store）
+    // 应在队列投入使用前绑定；未绑定时为空操作
+    void bind_depth_gauge(metrics::Gauge gauge) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        depth_gauge_ = gauge;
+        depth_gauge_.set(static_cast<int64_t>(data_.size()));
+    }
+
 private:
     mutable std::mutex mutex_;                // 保护所有临界区（mutable 允许 const 函数加锁）
     std::condition_variable cv_;              // 用于「空队列阻塞等待」
-    std::deque<T> data_;                      // 底层存储容器（头尾操作 O(1)）
+    std::deque<T, Allocator> data_;           // 底层存储容器（头尾操作 O(1)）
+    metrics::Gauge depth_gauge_;              // 队列深度指标（可选）
 };
 
 }  // namespace safe_queue
@@ -0,0 +1,18 @@
+#include "seqlock.h"
+#include <cstdint>
+
+
+namespace quant {
+namespace base {
+namespace common {
+namespace seqlock {
+
+    // 模板类的显式实例化声明，用于分离编译
+    // 实际使用时可根据需要添加常用类型的实例化
+    template class SeqLock<int64_t>;
+    template class SeqLock<double>;
+
+}  // namespace seqlock
+}  // namespace common
+}  // namespace base
+}  // namespace quant
@@ -0,0 +1,106 @@
+#ifndef BASE_COMMON_SEQLOCK_SEQLOCK_H_
+#define BASE_COMMON_SEQLOCK_SEQLOCK_H_
+
+#include <atomic>         // 用于序号与数据字
+#include <cstddef>        // 用于 size_t
+#include <cstdint>        // 用于 uint64_t
+#include <cstring>        // 用于 std::memcpy
+#include <type_traits>    // 用于 std::is_trivially_copyable
+
+namespace quant {
+namespace base {
+namespace common {
+namespace seqlock {
+
+// 顺序锁：单写者发布、多读者无阻塞读取的小型值（如持仓/资金快照）
+// - 写者：序号置为奇数 -> 写数据 -> 序号置为偶数，从不等待读者
+// - 读者：读取前后序号一致且为偶数即得到一致的副本，否则重试；读者不写共享内存
+// - 数据以原子字形式存储（relaxed 读写），避免并发读写普通内存导致的数据竞争
+// - 同一实例只允许一个写者线程；T 须可平凡拷贝
+template <typename T>
+class SeqLock {
+    static_assert(std::is_trivially_copyable<T>::value, "SeqLock requires a trivially copyable type");
+
+public:
+    SeqLock() : SeqLock(T{}) {}
+
+    explicit SeqLock(const T& value) : sequence_(0) {
+        store_words(value);
+    }
+
+    // 禁止拷贝和移动
+    SeqLock(const SeqLock&) = delete;
+    SeqLock& operator=(const SeqLock&) = delete;
+
+
+    // 1. 写者：发布新值
+    void store(const T& value) {
+        uint64_t seq = sequence_.load(std::memory_order_relaxed);
+        sequence_.store(seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        store_words(value);
+        sequence_.store(seq + 2, std::memory_order_release);
+    }
+
+    // 写者：基于当前值修改后发布（写者独占，读取当前值无需重试）
+    template <typename F>
+    void update(F&& modify) {
+        T value = load_words();
+        modify(value);
+        store(value);
+    }
+
+
+    // 2. 读者：一次尝试，读到写入中的数据时返回 false
+    bool try_load(T& out) const {
+        uint64_t before = sequence_.load(std::memory_order_acquire);
+        if (before & 1) {
+            return false;
+        }
+        out = load_words();
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return sequence_.load(std::memory_order_relaxed) == before;
+    }
+
+    // 读者：重试直到读到一致的副本
+    T load() const {
+        T value;
+        while (!try_load(value)) {
+        }
+        return value;
+    }
+
+    // 版本号：每次发布加 2，可用于判断快照是否变化
+    uint64_t version() const { return sequence_.load(std::memory_order_acquire) >> 1; }
+
+private:
+    static constexpr size_t kWords = (sizeof(T) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+    void store_words(const T& value) {
+        uint64_t buffer[kWords] = {};
+        std::memcpy(buffer, &value, sizeof(T));
+        for (size_t i = 0; i < kWords; ++i) {
+            words_[i].store(buffer[i], std::memory_order_relaxed);
+        }
+    }
+
+    T load_words() const {
+        uint64_t buffer[kWords];
+        for (size_t i = 0; i < kWords; ++i) {
+            buffer[i] = words_[i].load(std::memory_order_relaxed);
+        }
+        T value;
+        std::memcpy(&value, buffer, sizeof(T));
+        return value;
+    }
+
+    alignas(64) std::atomic<uint64_t> sequence_;    // 偶数：稳定；奇数：写入中
+    std::atomic<uint64_t> words_[kWords];           // 数据（按 8 字节拆分）
+};
+
+}  // namespace seqlock
+}  // namespace common
+}  // namespace base
+}  // namespace quant
+
+#endif  // BASE_COMMON_SEQLOCK_SEQLOCK_H_
@@ -0,0 +1,166 @@
+#include "shm_ring.h"
+
+#include <cerrno>         // 用于 errno
+#include <chrono>         // 用于创建时间
+#include <fcntl.h>        // 用于 O_* 常量
+#include <sys/mman.h>     // 用于 shm_open/mmap
+#include <sys/stat.h>     // 用于 fstat
+#include <unistd.h>       // 用于 ftruncate/close/getpid
+
+namespace quant {
+namespace base {
+namespace common {
+namespace shm_ring {
+
+namespace {
+
+void set_error(std::string* error, const std::string& message) {
+    if (error != nullptr) {
+        *error = message;
+    }
+}
+
+size_t round_up_pow2(size_t value) {
+    size_t result = 1;
+    while (result < value) {
+        result <<= 1;
+    }
+    return result;
+}
+
+size_t slot_stride(size_t slot_bytes) {
+    return (sizeof(detail::SlotHeader) + slot_bytes + 63) & ~static_cast<size_t>(63);
+}
+
+}  // namespace
+
+// ==================== ShmRingWriter ====================
+
+std::unique_ptr<ShmRingWriter> ShmRingWriter::create(const ShmRingOptions& options, std::string* error) {
+    if (options.name.empty() || options.slot_bytes == 0 || options.slot_bytes > UINT32_MAX || options.capacity < 2) {
+        set_error(error, "invalid shm ring options");
+        return nullptr;
+    }
+    size_t capacity = round_up_pow2(options.capacity);
+    size_t stride = slot_stride(options.slot_bytes);
+    size_t total = sizeof(detail::RingHeader) + capacity * stride;
+
+    int fd = shm_open(options.name.c_str(), O_CREAT | O_RDWR | O_TRUNC, 0644);
+    if (fd < 0) {
+        set_error(error, "shm_open " + options.name + " failed: " + std::strerror(errno));
+        return nullptr;
+    }
+    if (ftruncate(fd, static_cast<off_t>(total)) != 0) {
+        set_error(error, "ftruncate " + options.name + " failed: " + std::strerror(errno));
+        close(fd);
+        shm_unlink(options.name.c_str());
+        return nullptr;
+    }
+    void* memory = mmap(nullptr, total, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (memory == MAP_FAILED) {
+        set_error(error, "mmap " + options.name + " failed: " + std::strerror(errno));
+        shm_unlink(options.name.c_str());
+        return nullptr;
+    }
+
+    // 新段全零（所有槽位序号为 0 = 未写入）；魔数最后写入，读者据此判断段已就绪
+    auto* header = static_cast<detail::RingHeader*>(memory);
+    header->slot_bytes = options.slot_bytes;
+    header->slot_stride = stride;
+    header->capacity = capacity;
+    header->writer_pid = getpid();
+    header->created_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    header->head.store(0, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    header->magic = detail::kMagic;
+
+    return std::unique_ptr<ShmRingWriter>(new ShmRingWriter(options.name, memory, total));
+}
+
+ShmRingWriter::ShmRingWriter(const std::string& name, void* memory, size_t mapped_bytes)
+    : name_(name),
+      memory_(memory),
+      mapped_bytes_(mapped_bytes),
+      header_(static_cast<detail::RingHeader*>(memory)),
+      slots_(static_cast<uint8_t*>(memory) + sizeof(detail::RingHeader)),
+      mask_(header_->capacity - 1),
+      stride_(header_->slot_stride),
+      slot_bytes_(header_->slot_bytes) {}
+
+ShmRingWriter::~ShmRingWriter() {
+    munmap(memory_, mapped_bytes_);
+    shm_unlink(name_.c_str());
+}
+
+// ==================== ShmRingReader ====================
+
+std::unique_ptr<ShmRingReader> ShmRingReader::open(const std::string& name, Start start, std::string* error) {
+    int fd = shm_open(name.c_str(), O_RDONLY, 0);
+    if (fd < 0) {
+        set_error(error, "shm_open " + name + " failed: " + std::strerror(errno));
+        return nullptr;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(detail::RingHeader)) {
+        close(fd);
+        set_error(error, name + " is not a shm ring");
+        return nullptr;
+    }
+    size_t size = static_cast<size_t>(st.st_size);
+    void* memory = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (memory == MAP_FAILED) {
+        set_error(error, "mmap " + name + " failed: " + std::strerror(errno));
+        return nullptr;
+    }
+
+    const auto* header = static_cast<const detail::RingHeader*>(memory);
+    bool valid = header->magic == detail::kMagic && header->capacity >= 2 &&
+                 (header->capacity & (header->capacity - 1)) == 0 &&
+                 header->slot_stride == slot_stride(header->slot_bytes) &&
+                 sizeof(detail::RingHeader) + header->capacity * header->slot_stride == size;
+    if (!valid) {
+        munmap(memory, size);
+        set_error(error, name + " has an unknown layout");
+        return nullptr;
+    }
+
+    std::unique_ptr<ShmRingReader> reader(new ShmRingReader(memory, size));
+    uint64_t head = header->head.load(std::memory_order_acquire);
+    if (start == Start::kOldest && head > reader->capacity()) {
+        reader->cursor_ = head - reader->capacity() / 2;
+    } else if (start == Start::kLatest) {
+        reader->cursor_ = head;
+    }
+    return reader;
+}
+
+ShmRingReader::ShmRingReader(void* memory, size_t mapped_bytes)
+    : memory_(memory),
+      mapped_bytes_(mapped_bytes),
+      header_(static_cast<const detail::RingHeader*>(memory)),
+      slots_(static_cast<const uint8_t*>(memory) + sizeof(detail::RingHeader)),
+      mask_(header_->capacity - 1),
+      stride_(header_->slot_stride),
+      slot_bytes_(header_->slot_bytes) {}
+
+ShmRingReader::~ShmRingReader() {
+    munmap(memory_, mapped_bytes_);
+}
+
+void ShmRingReader::skip_overrun() {
+    uint64_t head = header_->head.load(std::memory_order_acquire);
+    uint64_t next = head > capacity() / 2 ? head - capacity() / 2 : 0;
+    if (next <= cursor_) {
+        next = cursor_ + 1;
+    }
+    lost_ += next - cursor_;
+    cursor_ = next;
+}
+
+}  // namespace shm_ring
+}  // namespace common
+}  // namespace base
+}  // namespace quant
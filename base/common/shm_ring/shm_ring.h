@@ -0,0 +1,202 @@
+#ifndef BASE_COMMON_SHM_RING_SHM_RING_H_
+#define BASE_COMMON_SHM_RING_SHM_RING_H_
+
+#include <atomic>         // 用于槽位序号
+#include <cstddef>        // 用于 size_t
+#include <cstdint>        // 用于 uint64_t
+#include <cstring>        // 用于 memcpy
+#include <memory>         // 用于 unique_ptr
+#include <string>
+
+namespace quant {
+namespace base {
+namespace common {
+namespace shm_ring {
+
+// 共享内存广播环：一个写进程、任意多个只读进程，每个读者独立游标
+// - 写者从不等待读者：环满后直接覆盖最旧的槽位
+// - 每个槽位带序号（奇数表示写入中），读者读取前后各比较一次，被覆盖时检测为超车（overrun），
+//   计入 lost() 并跳到较新的位置继续，不会读到撕裂的数据
+// - 读者只读映射（PROT_READ），不向共享内存写任何东西，读者进程崩溃不影响写者与其他读者
+// - 单写者：每个段只有一个 ShmRingWriter，且同一时刻只有一个线程 publish()。
+//   槽位不做逐槽 CAS，多个写者并发时后写者可能在前写者写完之前覆盖同一槽位（回绕一圈后），
+//   因此 publish() 用一个写入标志强制单写：并发调用的一方直接返回 false 并计入 contended()
+struct ShmRingOptions {
+    std::string name;               // POSIX 共享内存名（如 "/quant_ticks"）
+    size_t slot_bytes = 256;        // 单条消息的最大字节数
+    size_t capacity = 65536;        // 槽位数（向上取整为 2 的幂）
+};
+
+namespace detail {
+
+constexpr uint64_t kMagic = 0x3130474e49524d53ULL;     // "SMRING01"
+
+struct alignas(64) RingHeader {
+    uint64_t magic;
+    uint64_t slot_bytes;            // 消息区容量
+    uint64_t slot_stride;           // 槽位间距（含槽位头，按缓存行对齐）
+    uint64_t capacity;              // 槽位数（2 的幂）
+    int64_t writer_pid;
+    int64_t created_ns;             // 写者创建时间（墙钟），读者据此识别写者重启
+    alignas(64) std::atomic<uint64_t> head;    // 已开始写入的消息数（下一条消息的序号）
+};
+
+struct SlotHeader {
+    std::atomic<uint64_t> sequence;    // 2 * (seq + 1) 表示 seq 已写完；奇数表示写入中
+    uint32_t size;
+    uint32_t reserved;
+};
+
+}  // namespace detail
+
+class ShmRingWriter {
+public:
+    ~ShmRingWriter();
+
+    ShmRingWriter(const ShmRingWriter&) = delete;
+    ShmRingWriter& operator=(const ShmRingWriter&) = delete;
+
+    // 创建（或重建）共享内存段，失败返回 nullptr；析构时删除该段
+    static std::unique_ptr<ShmRingWriter> create(const ShmRingOptions& options, std::string* error = nullptr);
+
+    // 发布一条消息（超过 slot_bytes 或与另一线程并发调用时返回 false），返回前消息已对读者可见
+    bool publish(const void* data, size_t size) {
+        if (size > slot_bytes_) {
+            return false;
+        }
+        if (writing_.exchange(true, std::memory_order_acquire)) {
+            contended_.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        uint64_t seq = next_;
+        next_ = seq + 1;
+        header_->head.store(seq + 1, std::memory_order_relaxed);
+        uint8_t* slot = slots_ + (seq & mask_) * stride_;
+        auto* slot_header = reinterpret_cast<detail::SlotHeader*>(slot);
+        slot_header->sequence.store(2 * seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        slot_header->size = static_cast<uint32_t>(size);
+        std::memcpy(slot + sizeof(detail::SlotHeader), data, size);
+        slot_header->sequence.store(2 * seq + 2, std::memory_order_release);
+        writing_.store(false, std::memory_order_release);
+        return true;
+    }
+
+    template <typename T>
+    bool publish(const T& record) {
+        return publish(&record, sizeof(T));
+    }
+
+    uint64_t published() const { return header_->head.load(std::memory_order_relaxed); }
+    // 因并发写入被拒绝的发布次数（非 0 说明有多个线程在写同一个环）
+    uint64_t contended() const { return contended_.load(std::memory_order_relaxed); }
+    size_t capacity() const { return static_cast<size_t>(mask_ + 1); }
+    const std::string& name() const { return name_; }
+
+private:
+    ShmRingWriter(const std::string& name, void* memory, size_t mapped_bytes);
+
+    std::string name_;
+    void* memory_;
+    size_t mapped_bytes_;
+    detail::RingHeader* header_;
+    uint8_t* slots_;
+    uint64_t mask_;
+    size_t stride_;
+    size_t slot_bytes_;
+    uint64_t next_ = 0;                     // 下一条消息的序号（仅写线程访问）
+    std::atomic<bool> writing_{false};      // 单写者守卫
+    std::atomic<uint64_t> contended_{0};
+};
+
+class ShmRingReader {
+public:
+    enum class Start {
+        kLatest,        // 只读打开之后发布的消息
+        kOldest,        // 从环中仍保留的较早消息开始（环已回绕时留出半个环的余量）
+    };
+
+    ~ShmRingReader();
+
+    ShmRingReader(const ShmRingReader&) = delete;
+    ShmRingReader& operator=(const ShmRingReader&) = delete;
+
+    // 只读映射写者创建的段；段不存在或格式不符返回 nullptr
+    static std::unique_ptr<ShmRingReader> open(const std::string& name, Start start = Start::kLatest,
+                                               std::string* error = nullptr);
+
+    // 零拷贝读取下一条消息：visit(const uint8_t* data, size_t size) 直接作用于共享内存，
+    // 返回 true 表示 visit 看到的数据完整；返回 false 表示暂无新消息或读取期间被超车
+    // （被超车时 visit 的结果必须丢弃）。visit 应只做拷贝/解析，尽快返回
+    template <typename Visit>
+    bool poll(Visit&& visit) {
+        const uint8_t* slot = slots_ + (cursor_ & mask_) * stride_;
+        const auto* slot_header = reinterpret_cast<const detail::SlotHeader*>(slot);
+        uint64_t expected = 2 * cursor_ + 2;
+        uint64_t before = slot_header->sequence.load(std::memory_order_acquire);
+        if (before != expected) {
+            if (before > expected) {
+                skip_overrun();
+            }
+            return false;
+        }
+        uint32_t size = slot_header->size;
+        if (size > slot_bytes_) {
+            skip_overrun();
+            return false;
+        }
+        visit(slot + sizeof(detail::SlotHeader), static_cast<size_t>(size));
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot_header->sequence.load(std::memory_order_relaxed) != expected) {
+            skip_overrun();
+            return false;
+        }
+        ++cursor_;
+        return true;
+    }
+
+    // 拷贝读取定长记录（消息长度与 T 不符时跳过该消息并返回 false）
+    template <typename T>
+    bool next(T& out) {
+        size_t size = 0;
+        bool ok = poll([&out, &size](const uint8_t* data, size_t length) {
+            size = length;
+            if (length == sizeof(T)) {
+                std::memcpy(&out, data, sizeof(T));
+            }
+        });
+        return ok && size == sizeof(T);
+    }
+
+    // 被超车丢失的消息数
+    uint64_t lost() const { return lost_; }
+    // 下一条要读取的序号与写者已领取的序号（两者之差即积压）
+    uint64_t cursor() const { return cursor_; }
+    uint64_t head() const { return header_->head.load(std::memory_order_acquire); }
+    int64_t writer_pid() const { return header_->writer_pid; }
+    int64_t created_ns() const { return header_->created_ns; }
+    size_t capacity() const { return static_cast<size_t>(mask_ + 1); }
+
+private:
+    ShmRingReader(void* memory, size_t mapped_bytes);
+
+    // 被超车：跳到最新的半个环（留出余量，避免紧贴写者反复被超车）
+    void skip_overrun();
+
+    void* memory_;
+    size_t mapped_bytes_;
+    const detail::RingHeader* header_;
+    const uint8_t* slots_;
+    uint64_t mask_;
+    size_t stride_;
+    size_t slot_bytes_;
+    uint64_t cursor_ = 0;
+    uint64_t lost_ = 0;
+};
+
+}  // namespace shm_ring
+}  // namespace common
+}  // namespace base
+}  // namespace quant
+
+#endif  // BASE_COMMON_SHM_RING_SHM_RING_H_
@@ -2,8 +2,12 @@
 #define BASE_COMMON_THREAD_POOL_THREAD_POOL_H_
 
 #include <mutex>
+#include <array>
+#include <deque>
+#include <chrono>
 #include <vector>
 #include <thread>
+#include <string>
 #include <atomic>
 #include <memory>
 #include <future>
@@ -13,70 +17,171 @@
 #include <functional>
 #include <type_traits>
 #include <condition_variable>
-#include "../safe_queue/safe_queue.h"  // 引入无锁队列
+#include "../metrics/metrics.h"        // 队列深度与任务计数指标
+#include "../hdr_histogram/hdr_histogram.h"  // 各优先级的排队延迟分布
+#include "utils/async_logger/async_logger.h"      // 异步日志（工作线程不因写日志阻塞）
 
 namespace quant {
 namespace base {
 namespace common {
 namespace thread_pool {
 
-// 线程池：基于无锁队列，支持任务提交与等待
-class ThreadPool : public std::enable_shared_from_this<ThreadPool> {
+// 任务优先级（数值越小越优先）：高优先级通道有任务时总是先执行，低优先级任务排队超过
+// 老化阈值后提前执行一次，避免被持续的高优先级任务饿死
+enum class TaskPriority : uint8_t {
+    kCritical = 0,      // 风控重算、订单超时等延迟敏感任务
+    kHigh = 1,
+    kNormal = 2,        // submit() 的默认优先级
+    kBackground = 3,    // 历史数据加载、快照写入等批量任务
+};
+
+constexpr size_t kPriorityCount = 4;
+
+inline const char* to_string(TaskPriority priority) {
+    switch (priority) {
+        case TaskPriority::kCritical:
+            return "critical";
+        case TaskPriority::kHigh:
+            return "high";
+        case TaskPriority::kNormal:
+            return "normal";
+        case TaskPriority::kBackground:
+            return "background";
+    }
+    return "unknown";
+}
+
+// 提交选项
+struct TaskOptions {
+    TaskPriority priority = TaskPriority::kNormal;
+    // 最晚开始时刻：出队时已过期的任务不再执行，其 future 抛出 DeadlineExpired
+    std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::time_point::max();
+};
+
+// 任务在截止时刻前未能开始执行
+class DeadlineExpired : public std::runtime_error {
+public:
+    DeadlineExpired() : std::runtime_error("task deadline expired before it started") {}
+};
+
+// 单个优先级通道的统计（排队延迟 = 提交到开始执行，按 HDR 直方图估算）
+struct LaneStats {
+    uint64_t submitted = 0;
+    uint64_t started = 0;
+    uint64_t expired = 0;       // 过期未执行
+    uint64_t promoted = 0;      // 因老化提前执行
+    size_t queued = 0;
+    uint64_t wait_p50_ns = 0;
+    uint64_t wait_p99_ns = 0;
+    uint64_t wait_max_ns = 0;
+};
+
+// 线程池：按优先级分通道排队，支持任务提交与等待
+// - 同一通道内先进先出；默认取最高优先级通道，每个老化周期内至多让一个超过老化阈值的低优先级队首先执行
+// - 各通道的排队延迟、过期与老化次数可通过 lane_stats() 查询；命名的线程池同时导出到指标注册表
+// Allocator 用于任务队列的分段存储与任务共享状态（如 arena::ArenaAllocator，使其落在大页区内）；
+// 常用的默认实例为 ThreadPool
+template <typename Allocator = std::allocator<std::function<void()>>>
+class BasicThreadPool : public std::enable_shared_from_this<BasicThreadPool<Allocator>> {
 public:
     // 禁止拷贝/赋值
-    ThreadPool(const ThreadPool&) = delete;
-    ThreadPool& operator=(const ThreadPool&) = delete;
+    BasicThreadPool(const BasicThreadPool&) = delete;
+    BasicThreadPool& operator=(const BasicThreadPool&) = delete;
 
     // 工厂方法：强制通过 shared_ptr 创建，避免栈上对象析构风险
-    static std::shared_ptr<ThreadPool> create(size_t thread_count = std::thread::hardware_concurrency()) {
+    // name 非空时向默认指标注册表导出 thread_pool.<name>.queue_depth / .tasks_completed，
+    // 以及各通道的 thread_pool.<name>.<优先级>.wait_ns / .expired
+    static std::shared_ptr<BasicThreadPool> create(size_t thread_count = std::thread::hardware_concurrency(),
+                                                   const std::string& name = "",
+                                                   const Allocator& allocator = Allocator()) {
         if (thread_count == 0) {
             throw std::invalid_argument("Thread count must be greater than 0");
         }
-        return std::shared_ptr<ThreadPool>(new ThreadPool(thread_count));
+        return std::shared_ptr<BasicThreadPool>(new BasicThreadPool(thread_count, name, allocator));
     }
 
     // 析构：自动停止线程池，确保任务完成
-    ~ThreadPool() {
+    ~BasicThreadPool() {
         stop(true);
     }
 
-    // 提交任务：支持任意参数的函数，返回 future 用于获取结果
+    // 提交任务：支持任意参数的函数，返回 future 用于获取结果（普通优先级、无截止时刻）
     template<typename F, typename... Args>
-    auto submit(F&& f, Args&&... args) -> std::future<typename std::result_of<F(Args...)>::type> {
+    auto submit(F&& f, Args&&... args) -> std::future<std::invoke_result_t<F, Args...>> {
+        return submit_with(TaskOptions{}, std::forward<F>(f), std::forward<Args>(args)...);
+    }
+
+    // 按指定优先级 / 截止时刻提交
+    template<typename F, typename... Args>
+    auto submit_with(const TaskOptions& options, F&& f, Args&&... args)
+        -> std::future<std::invoke_result_t<F, Args...>> {
         if (!is_running_.load(std::memory_order_acquire)) {
             throw std::runtime_error("ThreadPool is stopped");
         }
 
-        using ReturnType = typename std::result_of<F(Args...)>::type;
-        auto task = std::make_shared<std::packaged_task<ReturnType()>>(
-            std::bind(std::forward<F>(f), std::forward<Args>(args)...)
-        );
-        std::future<ReturnType> result = task->get_future();
+        using ReturnType = std::invoke_result_t<F, Args...>;
+        auto bound = std::bind(std::forward<F>(f), std::forward<Args>(args)...);
+        using State = TaskState<ReturnType, decltype(bound)>;
+        using StateAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<State>;
+        auto state = std::allocate_shared<State>(StateAllocator(allocator_), std::move(bound));
+        std::future<ReturnType> result = state->promise.get_future();
 
         task_count_.fetch_add(1, std::memory_order_acq_rel);
-        auto self = shared_from_this();
-
-        // 关键：捕获 task 的副本，避免嵌套引用导致的生命周期混乱
-        task_queue_.push([task, self]() {
-            try {
-                if (task) {  // 仅需判断 shared_ptr 是否有效
-                    (*task)();
-                }
-            } catch (const std::exception& e) {
-                std::cerr << "Task error: " << e.what() << std::endl;
-            }
 
-            // 递减任务计数
-            size_t remaining = self->task_count_.fetch_sub(1, std::memory_order_acq_rel);
-            if (remaining == 1) {
-                std::lock_guard<std::mutex> lock(self->wait_mutex_);
-                self->wait_cv_.notify_all();
-            }
-        });
+        // 关键：捕获 state 的副本，避免嵌套引用导致的生命周期混乱
+        // 注意：工作线程只持有 this 而非 shared_from_this()，否则工作线程可能成为最后一个持有者，
+        // 在自身线程内析构线程池并 join 自己（std::system_error: Resource deadlock avoided）。
+        // 析构函数会先 stop() 并 join 所有工作线程，因此任务执行期间 this 始终有效。
+        Entry entry;
+        entry.run = [state](bool expired) { state->run(expired); };
+        entry.deadline_ns = options.deadline == std::chrono::steady_clock::time_point::max()
+                                ? INT64_MAX
+                                : std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                      options.deadline.time_since_epoch()).count();
 
+        size_t lane = static_cast<size_t>(options.priority);
+        {
+            std::lock_guard<std::mutex> lock(queue_mutex_);
+            entry.enqueue_ns = now_ns();
+            lanes_[lane].entries.push_back(std::move(entry));
+            ++lanes_[lane].submitted;
+            ++queued_;
+            depth_gauge_.set(static_cast<int64_t>(queued_));
+        }
+        queue_cv_.notify_one();
         return result;
     }
 
+    // 老化阈值：低优先级任务排队超过该时长后可先于高优先级任务执行，且每个阈值周期内至多提前一个，
+    // 既保证低优先级通道持续推进，又不让积压的老化任务挡住高优先级任务
+    void set_aging_threshold(std::chrono::nanoseconds threshold) {
+        std::lock_guard<std::mutex> lock(queue_mutex_);
+        aging_threshold_ns_ = threshold.count();
+    }
+
+    // 替换时钟（默认 steady_clock）：返回与 steady_clock 同一纪元的纳秒数，排队延迟、老化与截止时刻均按它计算；
+    // 测试据此注入手动时钟，不依赖真实耗时
+    void set_clock(std::function<int64_t()> clock) {
+        std::lock_guard<std::mutex> lock(queue_mutex_);
+        clock_ = std::move(clock);
+    }
+
+    // 单个通道的统计快照
+    LaneStats lane_stats(TaskPriority priority) const {
+        std::lock_guard<std::mutex> lock(queue_mutex_);
+        const Lane& lane = lanes_[static_cast<size_t>(priority)];
+        LaneStats stats;
+        stats.submitted = lane.submitted;
+        stats.started = lane.started;
+        stats.expired = lane.expired;
+        stats.promoted = lane.promoted;
+        stats.queued = lane.entries.size();
+        stats.wait_p50_ns = lane.wait_ns->percentile(50.0);
+        stats.wait_p99_ns = lane.wait_ns->percentile(99.0);
+        stats.wait_max_ns = lane.wait_ns->max();
+        return stats;
+    }
+
     // 等待所有任务完成（阻塞直到 task_count_ 为 0）
     void wait_all() {
         std::unique_lock<std::mutex> lock(wait_mutex_);
@@ -102,11 +207,17 @@ public:
             return;
         }
 
-        // 如果不等待完成，清空任务队列
+        // 如果不等待完成，清空任务队列（被丢弃任务的 future 抛出 broken_promise）
         if (!wait_for_completion) {
             clear_queue();
         }
 
+        // 唤醒空闲的工作线程：队列排空后退出
+        {
+            std::lock_guard<std::mutex> lock(queue_mutex_);
+        }
+        queue_cv_.notify_all();
+
         // 等待所有任务完成（可选）
         if (wait_for_completion) {
             wait_all();
@@ -127,74 +238,210 @@ public:
     }
 
 private:
+    // 任务共享状态：promise 与绑定好参数的可调用对象
+    template <typename R, typename Callable>
+    struct TaskState {
+        explicit TaskState(Callable&& bound) : callable(std::move(bound)) {}
+
+        void run(bool expired) {
+            if (expired) {
+                promise.set_exception(std::make_exception_ptr(DeadlineExpired()));
+                return;
+            }
+            try {
+                if constexpr (std::is_void<R>::value) {
+                    callable();
+                    promise.set_value();
+                } else {
+                    promise.set_value(callable());
+                }
+            } catch (...) {
+                promise.set_exception(std::current_exception());
+            }
+        }
+
+        std::promise<R> promise;
+        Callable callable;
+    };
+
+    struct Entry {
+        std::function<void(bool expired)> run;
+        int64_t enqueue_ns = 0;
+        int64_t deadline_ns = INT64_MAX;
+    };
+
+    using EntryAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Entry>;
+
+    struct Lane {
+        explicit Lane(const Allocator& allocator)
+            : entries(EntryAllocator(allocator)), wait_ns(new hdr_histogram::HdrHistogram()) {}
+
+        std::deque<Entry, EntryAllocator> entries;
+        uint64_t submitted = 0;
+        uint64_t started = 0;
+        uint64_t expired = 0;
+        uint64_t promoted = 0;
+        // 在 queue_mutex_ 内记录，满足直方图的单写者要求
+        std::unique_ptr<hdr_histogram::HdrHistogram> wait_ns;
+        metrics::Histogram wait_metric;
+        metrics::Counter expired_metric;
+    };
+
+    static int64_t steady_now_ns() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    // 当前时刻（调用方持有 queue_mutex_）
+    int64_t now_ns() const {
+        return clock_();
+    }
+
     // 私有构造：仅允许通过 create() 工厂方法创建
-    explicit ThreadPool(size_t thread_count) 
-        : is_running_(true), task_count_(0), wait_for_completion_(true) {
+    BasicThreadPool(size_t thread_count, const std::string& name, const Allocator& allocator)
+        : allocator_(allocator), is_running_(true), task_count_(0),
+          lanes_{{Lane(allocator), Lane(allocator), Lane(allocator), Lane(allocator)}} {
+        // 指标须在工作线程启动前绑定
+        if (!name.empty()) {
+            auto& registry = metrics::MetricsRegistry::instance();
+            depth_gauge_ = registry.gauge("thread_pool." + name + ".queue_depth");
+            tasks_completed_ = registry.counter("thread_pool." + name + ".tasks_completed");
+            for (size_t i = 0; i < kPriorityCount; ++i) {
+                std::string prefix = "thread_pool." + name + "." + to_string(static_cast<TaskPriority>(i));
+                lanes_[i].wait_metric = registry.histogram(prefix + ".wait_ns");
+                lanes_[i].expired_metric = registry.counter(prefix + ".expired");
+            }
+        }
+
         // 创建工作线程
         threads_.reserve(thread_count);
         for (size_t i = 0; i < thread_count; ++i) {
-            threads_.emplace_back(&ThreadPool::worker_thread, this);
+            threads_.emplace_back(&BasicThreadPool::worker_thread, this);
         }
     }
 
     // 清空任务队列
     void clear_queue() {
-        std::function<void()> dummy;
-        while (task_queue_.pop(dummy)) {
-            // 递减任务计数，因为我们正在丢弃这些任务
-            task_count_.fetch_sub(1, std::memory_order_acq_rel);
+        size_t dropped = 0;
+        {
+            std::lock_guard<std::mutex> lock(queue_mutex_);
+            for (auto& lane : lanes_) {
+                dropped += lane.entries.size();
+                lane.entries.clear();
+            }
+            queued_ = 0;
+            depth_gauge_.set(0);
         }
+        // 递减任务计数，因为我们正在丢弃这些任务
+        task_count_.fetch_sub(dropped, std::memory_order_acq_rel);
         // 通知可能在等待的线程
         std::lock_guard<std::mutex> lock(wait_mutex_);
         wait_cv_.notify_all();
     }
 
-    // 工作线程逻辑：循环从队列取任务执行
-    void worker_thread() {
-        while (is_running_.load(std::memory_order_acquire)) {
-            std::function<void()> task;
-            // 从无锁队列取任务（队列为空时 yield，避免忙等）
-            if (task_queue_.pop(task)) {
-                try {
-                    // 执行任务前检查有效性
-                    if (task) {
-                        task();
-                    }
-                } catch (const std::exception& e) {
-                    std::cerr << "[WorkerThread] Task execution error: " << e.what() << std::endl;
-                } catch (...) {
-                    std::cerr << "[WorkerThread] Unknown task error" << std::endl;
-                }
-            } else {
-                std::this_thread::yield();
+    // 取下一个任务（调用方持有 queue_mutex_，且 queued_ > 0）：
+    // 默认取最高优先级通道的队首；每个老化周期内至多提前执行一个等待超过阈值的低优先级队首
+    // （只在低于 top 的通道中比较，等待最久者优先；top 本身的队首无论新旧都不妨碍低优先级任务老化），
+    // 积压的老化任务不会整体越过高优先级通道，只是按周期获得一次执行机会
+    size_t select_lane(int64_t now) {
+        size_t top = 0;
+        while (lanes_[top].entries.empty()) {
+            ++top;
+        }
+        if (now - last_promotion_ns_ < aging_threshold_ns_) {
+            return top;
+        }
+        size_t selected = kPriorityCount;
+        int64_t oldest = INT64_MAX;
+        for (size_t i = top + 1; i < kPriorityCount; ++i) {
+            const auto& entries = lanes_[i].entries;
+            if (!entries.empty() && now - entries.front().enqueue_ns >= aging_threshold_ns_ &&
+                entries.front().enqueue_ns < oldest) {
+                oldest = entries.front().enqueue_ns;
+                selected = i;
             }
         }
+        if (selected != kPriorityCount) {
+            ++lanes_[selected].promoted;
+            last_promotion_ns_ = now;
+            return selected;
+        }
+        return top;
+    }
 
-        // 只有当需要等待完成时，才处理队列中剩余的任务
-        if (wait_for_completion_) {
-            std::function<void()> remaining_task;
-            while (task_queue_.pop(remaining_task)) {
-                try {
-                    if (remaining_task) {
-                        remaining_task();
-                    }
-                } catch (...) {
-                    // 停止后忽略异常
+    // 工作线程逻辑：循环按优先级取任务执行，停止后排空队列再退出
+    void worker_thread() {
+        for (;;) {
+            Entry entry;
+            bool expired = false;
+            {
+                std::unique_lock<std::mutex> lock(queue_mutex_);
+                queue_cv_.wait(lock, [this]() {
+                    return queued_ > 0 || !is_running_.load(std::memory_order_acquire);
+                });
+                if (queued_ == 0) {
+                    break;
+                }
+                int64_t now = now_ns();
+                Lane& lane = lanes_[select_lane(now)];
+                entry = std::move(lane.entries.front());
+                lane.entries.pop_front();
+                --queued_;
+                depth_gauge_.set(static_cast<int64_t>(queued_));
+                expired = now > entry.deadline_ns;
+                if (expired) {
+                    ++lane.expired;
+                    lane.expired_metric.inc();
+                } else {
+                    uint64_t waited = static_cast<uint64_t>(now - entry.enqueue_ns);
+                    ++lane.started;
+                    lane.wait_ns->record(waited);
+                    lane.wait_metric.record(waited);
                 }
             }
+
+            try {
+                entry.run(expired);
+            } catch (const std::exception& e) {
+                QT_LOG_ERROR("[WorkerThread] Task execution error: {}", e.what());
+            } catch (...) {
+                QT_LOG_ERROR("[WorkerThread] Unknown task error");
+            }
+            entry.run = nullptr;        // 在计数归零之前释放任务状态
+
+            tasks_completed_.inc();
+
+            // 递减任务计数
+            size_t remaining = task_count_.fetch_sub(1, std::memory_order_acq_rel);
+            if (remaining == 1) {
+                std::lock_guard<std::mutex> lock(wait_mutex_);
+                wait_cv_.notify_all();
+            }
         }
     }
 
 private:
-    bool wait_for_completion_;                                  // 是否等待任务完成的标志
+    static constexpr int64_t kDefaultAgingNs = 50000000;       // 50ms
+
+    Allocator allocator_;                                       // 任务队列与任务共享状态的分配器
     std::atomic<bool> is_running_;                              // 线程池运行状态
     std::atomic<size_t> task_count_;                            // 未完成任务计数
     std::mutex wait_mutex_;                                     // wait_all() 同步锁
     std::condition_variable wait_cv_;                           // wait_all() 条件变量
     std::vector<std::thread> threads_;                          // 工作线程列表
-    safe_queue::SafeQueue<std::function<void()>> task_queue_;   // 任务队列（无锁）
+    mutable std::mutex queue_mutex_;                            // 保护各通道队列与统计
+    std::condition_variable queue_cv_;                          // 空闲工作线程等待新任务
+    std::array<Lane, kPriorityCount> lanes_;                    // 各优先级通道
+    size_t queued_ = 0;                                         // 各通道排队任务总数
+    int64_t aging_threshold_ns_ = kDefaultAgingNs;              // 老化阈值（同时是提前执行的最小间隔）
+    int64_t last_promotion_ns_ = INT64_MIN / 2;                 // 上一次提前执行的时刻
+    std::function<int64_t()> clock_ = &steady_now_ns;           // 时钟（纳秒，受 queue_mutex_ 保护）
+    metrics::Gauge depth_gauge_;                                // 队列深度指标（可选）
+    metrics::Counter tasks_completed_;                          // 已完成任务数指标（可选）
 };
 
+using ThreadPool = BasicThreadPool<>;
+
 }  // namespace thread_pool
 }  // namespace common
 }  // namespace base
@@ -0,0 +1,375 @@
+#include "timer_wheel.h"
+
+#include <exception>      // 用于回调异常
+#include "utils/async_logger/async_logger.h"          // 回调异常日志
+#include "utils/thread_affinity/thread_affinity.h"    // 驱动线程绑核与命名
+
+namespace quant {
+namespace base {
+namespace common {
+namespace timer_wheel {
+
+namespace {
+
+constexpr uint64_t kIndexMask = 0xFFFFFFFFull;
+
+}  // namespace
+
+TimerWheel::TimerWheel(const TimerWheelOptions& options)
+    : resolution_(options.resolution > std::chrono::nanoseconds::zero() ? options.resolution
+                                                                         : std::chrono::milliseconds(1)),
+      origin_(Clock::now()),
+      name_(options.name) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    while (capacity_ < options.initial_capacity) {
+        grow();
+    }
+    if (!name_.empty()) {
+        auto& registry = metrics::MetricsRegistry::instance();
+        pending_gauge_ = registry.gauge("timer_wheel." + name_ + ".pending");
+        fired_counter_ = registry.counter("timer_wheel." + name_ + ".fired");
+        lateness_histogram_ = registry.histogram("timer_wheel." + name_ + ".lateness_ns");
+    }
+}
+
+TimerWheel::~TimerWheel() {
+    stop();
+}
+
+uint64_t TimerWheel::ticks_until(Clock::time_point when) const {
+    if (when <= origin_) {
+        return 0;
+    }
+    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(when - origin_).count();
+    return static_cast<uint64_t>((ns + resolution_.count() - 1) / resolution_.count());
+}
+
+uint64_t TimerWheel::ticks_at(Clock::time_point now) const {
+    if (now <= origin_) {
+        return 0;
+    }
+    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(now - origin_).count();
+    return static_cast<uint64_t>(ns / resolution_.count());
+}
+
+TimerId TimerWheel::schedule_after(std::chrono::nanoseconds delay, Callback callback) {
+    return schedule_at(Clock::now() + delay, std::move(callback));
+}
+
+TimerId TimerWheel::schedule_at(Clock::time_point when, Callback callback) {
+    return add(ticks_until(when), 0, std::move(callback));
+}
+
+TimerId TimerWheel::schedule_every(std::chrono::nanoseconds interval, Callback callback) {
+    return schedule_every(interval, Clock::now() + interval, std::move(callback));
+}
+
+TimerId TimerWheel::schedule_every(std::chrono::nanoseconds interval, Clock::time_point first, Callback callback) {
+    uint64_t period = static_cast<uint64_t>((interval.count() + resolution_.count() - 1) / resolution_.count());
+    return add(ticks_until(first), period > 0 ? period : 1, std::move(callback));
+}
+
+TimerId TimerWheel::add(uint64_t expires, uint64_t period, Callback&& callback) {
+    if (!callback) {
+        return kInvalidTimer;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    Node* node = allocate_node();
+    node->expires = expires > current_tick_ ? expires : current_tick_ + 1;
+    node->period = period;
+    node->state = NodeState::kPending;
+    node->callback = std::move(callback);
+    link(node);
+    ++pending_;
+    ++scheduled_;
+    pending_gauge_.set(static_cast<int64_t>(pending_));
+    return (static_cast<uint64_t>(node->generation) << 32) | (static_cast<uint64_t>(node->index) + 1);
+}
+
+bool TimerWheel::cancel(TimerId id) {
+    Callback released;      // 在锁外析构回调（捕获对象的析构可能较重）
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        Node* node = find(id);
+        if (node == nullptr) {
+            return false;
+        }
+        if (node->state == NodeState::kFiring) {
+            // 回调执行中：单次定时器视为已触发；周期定时器不再重新挂入，由推进线程回收
+            if (node->period == 0) {
+                return false;
+            }
+            node->state = NodeState::kCancelled;
+            ++cancelled_;
+            return true;
+        }
+        if (node->state != NodeState::kPending) {
+            return false;
+        }
+        unlink(node);
+        released = std::move(node->callback);
+        release_node(node);
+        ++cancelled_;
+        pending_gauge_.set(static_cast<int64_t>(pending_));
+    }
+    return true;
+}
+
+size_t TimerWheel::advance(Clock::time_point now) {
+    std::lock_guard<std::mutex> advance_lock(advance_mutex_);
+    uint64_t target = ticks_at(now);
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        while (current_tick_ < target) {
+            // 低 k 层全空时，下一个可能有事发生的刻度是 256^k 的整数倍（第 k 层下沉），直接跳过中间的刻度
+            size_t empty_levels = 0;
+            while (empty_levels < kLevels && level_count_[empty_levels] == 0) {
+                ++empty_levels;
+            }
+            if (empty_levels == kLevels) {
+                current_tick_ = target;
+                break;
+            }
+            if (empty_levels > 0) {
+                uint64_t last_quiet = current_tick_ | ((uint64_t(1) << (kSlotBits * empty_levels)) - 1);
+                if (last_quiet >= target) {
+                    current_tick_ = target;
+                    break;
+                }
+                current_tick_ = last_quiet;
+            }
+            ++current_tick_;
+            // 高层先下沉：上层落到本刻度所在低层槽的节点，紧接着随低层一起处理
+            for (size_t level = kLevels - 1; level > 0; --level) {
+                if ((current_tick_ & ((uint64_t(1) << (kSlotBits * level)) - 1)) == 0) {
+                    cascade(level);
+                }
+            }
+            Node*& head = slots_[0][current_tick_ & (kSlots - 1)];
+            while (head != nullptr) {
+                Node* node = head;
+                unlink(node);
+                node->state = NodeState::kFiring;
+                expired_.push_back(node);
+            }
+        }
+    }
+    if (expired_.empty()) {
+        return 0;
+    }
+
+    // 回调在锁外执行：节点处于 kFiring 状态，其他线程不会回收或重新挂入
+    auto fire_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - origin_).count();
+    uint64_t batch_lateness = 0;
+    for (Node* node : expired_) {
+        int64_t due_ns = static_cast<int64_t>(node->expires) * resolution_.count();
+        uint64_t lateness = fire_ns > due_ns ? static_cast<uint64_t>(fire_ns - due_ns) : 0;
+        if (lateness > batch_lateness) {
+            batch_lateness = lateness;
+        }
+        lateness_histogram_.record(lateness);
+        try {
+            node->callback();
+        } catch (const std::exception& e) {
+            QT_LOG_ERROR("[TimerWheel] Timer callback error: {}", e.what());
+        } catch (...) {
+            QT_LOG_ERROR("[TimerWheel] Unknown timer callback error");
+        }
+        if (node->period == 0) {
+            node->callback = nullptr;
+        }
+    }
+
+    size_t fired = expired_.size();
+    std::vector<Callback> released;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (Node* node : expired_) {
+            if (node->period != 0 && node->state == NodeState::kFiring) {
+                // 固定频率：跳过驱动滞后期间错过的周期
+                node->expires += node->period;
+                if (node->expires <= current_tick_) {
+                    node->expires += ((current_tick_ - node->expires) / node->period + 1) * node->period;
+                }
+                node->state = NodeState::kPending;
+                link(node);
+                continue;
+            }
+            if (node->callback) {
+                released.push_back(std::move(node->callback));
+            }
+            release_node(node);
+        }
+        fired_ += fired;
+        if (batch_lateness > max_lateness_ns_) {
+            max_lateness_ns_ = batch_lateness;
+        }
+        pending_gauge_.set(static_cast<int64_t>(pending_));
+    }
+    fired_counter_.add(fired);
+    expired_.clear();
+    return fired;
+}
+
+bool TimerWheel::start(int cpu_core) {
+    if (running_.exchange(true, std::memory_order_acq_rel)) {
+        return false;
+    }
+    thread_ = std::thread(&TimerWheel::run, this);
+    std::string thread_name = name_.empty() ? "timer_wheel" : "timer." + name_;
+    utils::thread_affinity::set_thread_name(thread_.native_handle(), thread_name);
+    if (cpu_core >= 0 && !utils::thread_affinity::pin_thread(thread_.native_handle(), cpu_core)) {
+        QT_LOG_WARN("[TimerWheel] Failed to pin {} to core {}", thread_name, cpu_core);
+    }
+    return true;
+}
+
+void TimerWheel::stop() {
+    if (!running_.exchange(false, std::memory_order_acq_rel)) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(stop_mutex_);
+    }
+    stop_cv_.notify_all();
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+}
+
+void TimerWheel::run() {
+    while (running_.load(std::memory_order_acquire)) {
+        Clock::time_point now = Clock::now();
+        advance(now);
+        // 睡到下一个刻度的起点
+        Clock::time_point next = origin_ + resolution_ * static_cast<int64_t>(ticks_at(now) + 1);
+        std::unique_lock<std::mutex> lock(stop_mutex_);
+        stop_cv_.wait_until(lock, next, [this]() { return !running_.load(std::memory_order_acquire); });
+    }
+}
+
+TimerWheelStats TimerWheel::stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    TimerWheelStats stats;
+    stats.scheduled = scheduled_;
+    stats.fired = fired_;
+    stats.cancelled = cancelled_;
+    stats.pending = pending_;
+    stats.capacity = capacity_;
+    stats.max_lateness_ns = max_lateness_ns_;
+    return stats;
+}
+
+void TimerWheel::grow() {
+    std::unique_ptr<Node[]> chunk(new Node[kChunkSize]);
+    uint32_t base_index = static_cast<uint32_t>(capacity_);
+    // 倒序挂入空闲链表，使低下标先被取用
+    for (size_t i = kChunkSize; i-- > 0;) {
+        chunk[i].index = base_index + static_cast<uint32_t>(i);
+        chunk[i].next = free_list_;
+        free_list_ = &chunk[i];
+    }
+    chunks_.push_back(std::move(chunk));
+    capacity_ += kChunkSize;
+}
+
+TimerWheel::Node* TimerWheel::allocate_node() {
+    if (free_list_ == nullptr) {
+        grow();
+    }
+    Node* node = free_list_;
+    free_list_ = node->next;
+    node->prev = nullptr;
+    node->next = nullptr;
+    return node;
+}
+
+void TimerWheel::release_node(Node* node) {
+    ++node->generation;         // 使旧句柄失效
+    node->state = NodeState::kFree;
+    node->prev = nullptr;
+    node->next = free_list_;
+    free_list_ = node;
+    --pending_;
+}
+
+TimerWheel::Node* TimerWheel::find(TimerId id) const {
+    uint64_t index = (id & kIndexMask);
+    if (index == 0 || index > capacity_) {
+        return nullptr;
+    }
+    --index;
+    Node* node = &chunks_[index / kChunkSize][index % kChunkSize];
+    if (node->generation != static_cast<uint32_t>(id >> 32) || node->state == NodeState::kFree) {
+        return nullptr;
+    }
+    return node;
+}
+
+// 按距当前刻度的远近选层：第 n 层容纳 256^n ~ 256^(n+1) 个刻度之内到期的节点；
+// 超出最高层范围的节点挂在最高层最后下沉的槽上，下沉时再重新选层
+void TimerWheel::link(Node* node) {
+    uint64_t delta = node->expires - current_tick_;
+    size_t level = 0;
+    while (level < kLevels - 1 && delta >= (uint64_t(1) << (kSlotBits * (level + 1)))) {
+        ++level;
+    }
+    uint64_t slot_tick = node->expires;
+    if (delta >= (uint64_t(1) << (kSlotBits * kLevels))) {
+        slot_tick = current_tick_ + ((kSlots - 1) << (kSlotBits * level));
+    }
+    size_t slot = (slot_tick >> (kSlotBits * level)) & (kSlots - 1);
+
+    Node*& head = slots_[level][slot];
+    ++level_count_[level];
+    node->level = static_cast<uint8_t>(level);
+    node->slot = static_cast<uint8_t>(slot);
+    node->prev = nullptr;
+    node->next = head;
+    if (head != nullptr) {
+        head->prev = node;
+    }
+    head = node;
+}
+
+void TimerWheel::unlink(Node* node) {
+    --level_count_[node->level];
+    if (node->prev != nullptr) {
+        node->prev->next = node->next;
+    } else {
+        slots_[node->level][node->slot] = node->next;
+    }
+    if (node->next != nullptr) {
+        node->next->prev = node->prev;
+    }
+    node->prev = nullptr;
+    node->next = nullptr;
+}
+
+void TimerWheel::cascade(size_t level) {
+    size_t slot = (current_tick_ >> (kSlotBits * level)) & (kSlots - 1);
+    Node* node = slots_[level][slot];
+    slots_[level][slot] = nullptr;
+    while (node != nullptr) {
+        Node* next = node->next;
+        --level_count_[level];
+        link(node);
+        node = next;
+    }
+}
+
+TimerWheel::Clock::time_point next_boundary(std::chrono::nanoseconds period,
+                                            std::chrono::system_clock::time_point now) {
+    auto steady_now = TimerWheel::Clock::now();
+    if (period <= std::chrono::nanoseconds::zero()) {
+        return steady_now;
+    }
+    auto since_epoch = std::chrono::duration_cast<std::chrono::nanoseconds>(now.time_since_epoch());
+    auto next = (since_epoch / period + 1) * period;
+    return steady_now + (next - since_epoch);
+}
+
+}  // namespace timer_wheel
+}  // namespace common
+}  // namespace base
+}  // namespace quant
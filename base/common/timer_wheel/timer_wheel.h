@@ -0,0 +1,186 @@
+#ifndef BASE_COMMON_TIMER_WHEEL_TIMER_WHEEL_H_
+#define BASE_COMMON_TIMER_WHEEL_TIMER_WHEEL_H_
+
+#include <atomic>             // 用于驱动线程状态
+#include <chrono>             // 用于时间刻度
+#include <condition_variable> // 驱动线程等待（可被 stop 提前唤醒）
+#include <cstddef>            // 用于 size_t
+#include <cstdint>            // 用于 uint64_t
+#include <functional>         // 用于到期回调
+#include <memory>             // 用于 unique_ptr/weak_ptr
+#include <mutex>              // 保护轮结构
+#include <string>
+#include <thread>             // 驱动线程
+#include <vector>
+#include "../metrics/metrics.h"              // 挂起数、触发数与触发延迟指标
+#include "../thread_pool/thread_pool.h"      // 到期回调投递到线程池通道
+
+namespace quant {
+namespace base {
+namespace common {
+namespace timer_wheel {
+
+// 定时器句柄：0 表示无效；节点复用后旧句柄因代数不同而失效，cancel() 返回 false
+using TimerId = uint64_t;
+constexpr TimerId kInvalidTimer = 0;
+
+struct TimerWheelOptions {
+    std::string name;                                           // 非空时导出 timer_wheel.<name>.* 指标
+    std::chrono::nanoseconds resolution = std::chrono::milliseconds(1);   // 刻度（触发精度）
+    size_t initial_capacity = 4096;                             // 预分配的定时器节点数
+};
+
+struct TimerWheelStats {
+    uint64_t scheduled = 0;
+    uint64_t fired = 0;
+    uint64_t cancelled = 0;
+    size_t pending = 0;                 // 尚未触发（含周期定时器）
+    size_t capacity = 0;                // 已分配的节点数
+    uint64_t max_lateness_ns = 0;       // 实际触发时刻相对到期时刻的最大延迟
+};
+
+// 分层时间轮：4 层 x 256 槽，第 n 层每槽覆盖 256^n 个刻度（1ms 刻度时约 49 天），
+// 更远的定时器停在最高层，逐轮下沉；推进时跳过低层全空的刻度区间，空闲期不逐刻度空转
+// - schedule/cancel 为 O(1)：节点在槽内双向链表上摘挂；节点分块分配、空闲链表复用，地址稳定
+// - 到期时刻向上取整到刻度，回调不会早于到期时刻触发
+// - 驱动方式二选一：start() 启动一个（可绑核）驱动线程，或由所属事件循环周期性调用 advance()
+// - 回调在驱动线程上执行，且不持有内部锁（回调内可以 schedule/cancel）；
+//   业务逻辑应通过 on_pool() / StrategyEngine::on_strategy_lane() 投递到执行线程，驱动线程只做分发
+class TimerWheel {
+public:
+    using Clock = std::chrono::steady_clock;
+    using Callback = std::function<void()>;
+
+    explicit TimerWheel(const TimerWheelOptions& options = TimerWheelOptions());
+    ~TimerWheel();
+
+    TimerWheel(const TimerWheel&) = delete;
+    TimerWheel& operator=(const TimerWheel&) = delete;
+
+    // 单次定时器
+    TimerId schedule_after(std::chrono::nanoseconds delay, Callback callback);
+    TimerId schedule_at(Clock::time_point when, Callback callback);
+
+    // 周期定时器（固定频率，不累积漂移）：首次在 first 触发，此后每 interval 触发一次，直到 cancel()；
+    // 驱动滞后超过一个周期时跳过错过的周期
+    TimerId schedule_every(std::chrono::nanoseconds interval, Callback callback);
+    TimerId schedule_every(std::chrono::nanoseconds interval, Clock::time_point first, Callback callback);
+
+    // 取消：定时器已触发（单次）或句柄失效时返回 false；正在执行的回调不会被打断
+    bool cancel(TimerId id);
+
+    // 推进到 now 并触发所有到期的定时器，返回触发个数（同一时刻只有一个线程在推进）
+    size_t advance(Clock::time_point now = Clock::now());
+
+    // 启动/停止驱动线程：每个刻度醒来推进一次；cpu_core >= 0 时绑核
+    bool start(int cpu_core = -1);
+    void stop();
+
+    TimerWheelStats stats() const;
+    std::chrono::nanoseconds resolution() const { return resolution_; }
+
+private:
+    static constexpr size_t kLevels = 4;
+    static constexpr size_t kSlotBits = 8;
+    static constexpr size_t kSlots = size_t(1) << kSlotBits;
+    static constexpr size_t kChunkSize = 4096;
+
+    enum class NodeState : uint8_t {
+        kFree,
+        kPending,       // 挂在某个槽上
+        kFiring,        // 已摘下，回调执行中
+        kCancelled,     // 回调执行中被取消（周期定时器不再重新挂入）
+    };
+
+    struct Node {
+        Node* prev = nullptr;
+        Node* next = nullptr;
+        uint64_t expires = 0;           // 到期刻度
+        uint64_t period = 0;            // 周期（刻度），0 表示单次
+        uint32_t index = 0;             // 在节点表中的下标
+        uint32_t generation = 1;
+        uint8_t level = 0;
+        uint8_t slot = 0;
+        NodeState state = NodeState::kFree;
+        Callback callback;
+    };
+
+    uint64_t ticks_until(Clock::time_point when) const;     // 向上取整
+    uint64_t ticks_at(Clock::time_point now) const;         // 向下取整
+    TimerId add(uint64_t expires, uint64_t period, Callback&& callback);
+    void grow();
+    Node* allocate_node();
+    void release_node(Node* node);
+    Node* find(TimerId id) const;
+    void link(Node* node);
+    void unlink(Node* node);
+    void cascade(size_t level);
+    void run();
+
+    const std::chrono::nanoseconds resolution_;
+    const Clock::time_point origin_;                    // 刻度 0 对应的时刻
+    const std::string name_;
+
+    mutable std::mutex mutex_;                          // 保护以下轮结构与统计
+    uint64_t current_tick_ = 0;                         // 已处理到的刻度
+    Node* slots_[kLevels][kSlots] = {};
+    size_t level_count_[kLevels] = {};                  // 各层挂着的节点数（推进时跳过空刻度）
+    std::vector<std::unique_ptr<Node[]>> chunks_;
+    Node* free_list_ = nullptr;
+    size_t capacity_ = 0;
+    size_t pending_ = 0;
+    uint64_t scheduled_ = 0;
+    uint64_t fired_ = 0;
+    uint64_t cancelled_ = 0;
+    uint64_t max_lateness_ns_ = 0;
+
+    std::mutex advance_mutex_;                          // 串行化 advance()
+    std::vector<Node*> expired_;                        // 本轮到期节点（仅推进线程访问）
+
+    std::atomic<bool> running_{false};
+    std::thread thread_;
+    std::mutex stop_mutex_;
+    std::condition_variable stop_cv_;
+
+    metrics::Gauge pending_gauge_;
+    metrics::Counter fired_counter_;
+    metrics::Histogram lateness_histogram_;
+};
+
+// 到期时把 callback 投递到线程池的指定优先级通道（驱动线程不执行业务逻辑）
+// 线程池已析构或已停止时丢弃；deadline 非零时任务须在到期后该时长内开始执行，否则被线程池丢弃
+template <typename Allocator>
+TimerWheel::Callback on_pool(const std::shared_ptr<thread_pool::BasicThreadPool<Allocator>>& pool,
+                             thread_pool::TaskPriority priority, std::function<void()> callback,
+                             std::chrono::nanoseconds deadline = std::chrono::nanoseconds::zero()) {
+    std::weak_ptr<thread_pool::BasicThreadPool<Allocator>> weak = pool;
+    return [weak, priority, deadline, callback = std::move(callback)]() {
+        auto target = weak.lock();
+        if (!target || !target->is_running()) {
+            return;
+        }
+        thread_pool::TaskOptions options;
+        options.priority = priority;
+        if (deadline > std::chrono::nanoseconds::zero()) {
+            options.deadline = std::chrono::steady_clock::now() + deadline;
+        }
+        try {
+            target->submit_with(options, callback);
+        } catch (const std::runtime_error&) {
+            // 检查之后线程池恰好停止
+        }
+    };
+}
+
+// 墙钟周期边界：晚于 now 的下一个 period 整数倍时刻（按 UTC 纪元对齐，如 1 分钟 K 线的收盘时刻），
+// 换算为单调时钟；配合 schedule_every(period, next_boundary(period), ...) 在每根 K 线收盘时触发
+TimerWheel::Clock::time_point next_boundary(std::chrono::nanoseconds period,
+                                            std::chrono::system_clock::time_point now =
+                                                std::chrono::system_clock::now());
+
+}  // namespace timer_wheel
+}  // namespace common
+}  // namespace base
+}  // namespace quant
+
+#endif  // BASE_COMMON_TIMER_WHEEL_TIMER_WHEEL_H_
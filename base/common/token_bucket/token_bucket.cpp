@@ -0,0 +1,70 @@
+#include "token_bucket.h"
+#include <chrono>
+#include <cmath>
+#include <algorithm>
+
+
+namespace quant {
+namespace base {
+namespace common {
+namespace token_bucket {
+
+TokenBucket::TokenBucket() : tat_(0), interval_ns_(0), capacity_ns_(0) {}
+
+TokenBucket::TokenBucket(double rate_per_second, double burst) : TokenBucket() {
+    configure(rate_per_second, burst);
+}
+
+void TokenBucket::configure(double rate_per_second, double burst) {
+    if (rate_per_second <= 0.0) {
+        interval_ns_.store(0, std::memory_order_relaxed);
+        capacity_ns_.store(0, std::memory_order_relaxed);
+        return;
+    }
+    int64_t interval = std::max<int64_t>(1, std::llround(1e9 / rate_per_second));
+    interval_ns_.store(interval, std::memory_order_relaxed);
+    capacity_ns_.store(std::llround(std::max(burst, 1.0) * static_cast<double>(interval)),
+                       std::memory_order_relaxed);
+    tat_.store(0, std::memory_order_relaxed);
+}
+
+bool TokenBucket::try_acquire(int64_t now_ns, uint32_t tokens) {
+    int64_t interval = interval_ns_.load(std::memory_order_relaxed);
+    if (interval == 0) {
+        return true;
+    }
+    int64_t capacity = capacity_ns_.load(std::memory_order_relaxed);
+    int64_t cost = interval * static_cast<int64_t>(tokens);
+
+    int64_t tat = tat_.load(std::memory_order_relaxed);
+    for (;;) {
+        // 桶满时理论到达时间不早于当前时刻；消耗令牌即把它向后推 cost
+        int64_t next = std::max(tat, now_ns) + cost;
+        if (next - now_ns > capacity) {
+            return false;
+        }
+        if (tat_.compare_exchange_weak(tat, next, std::memory_order_relaxed)) {
+            return true;
+        }
+    }
+}
+
+double TokenBucket::available(int64_t now_ns) const {
+    int64_t interval = interval_ns_.load(std::memory_order_relaxed);
+    if (interval == 0) {
+        return HUGE_VAL;
+    }
+    int64_t used = std::max<int64_t>(0, tat_.load(std::memory_order_relaxed) - now_ns);
+    return static_cast<double>(capacity_ns_.load(std::memory_order_relaxed) - used) /
+           static_cast<double>(interval);
+}
+
+int64_t TokenBucket::now_ns() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+}  // namespace token_bucket
+}  // namespace common
+}  // namespace base
+}  // namespace quant
@@ -0,0 +1,54 @@
+#ifndef BASE_COMMON_TOKEN_BUCKET_TOKEN_BUCKET_H_
+#define BASE_COMMON_TOKEN_BUCKET_TOKEN_BUCKET_H_
+
+#include <atomic>         // 用于原子状态
+#include <cstdint>        // 用于 int64_t/uint32_t
+
+namespace quant {
+namespace base {
+namespace common {
+namespace token_bucket {
+
+// 无锁令牌桶限流器
+// 采用 GCRA（通用信元速率算法）实现，与令牌桶等价：整个状态只有一个“理论到达时间”，
+// 每次申请只需一次 CAS，无锁、无分配，可被任意多个线程同时调用
+class TokenBucket {
+public:
+    // 默认不限流
+    TokenBucket();
+
+    // rate_per_second：令牌生成速率；burst：桶容量（允许的瞬时突发数）
+    TokenBucket(double rate_per_second, double burst);
+
+    // 禁止拷贝和移动
+    TokenBucket(const TokenBucket&) = delete;
+    TokenBucket& operator=(const TokenBucket&) = delete;
+
+    // 重新设置速率与容量（rate_per_second <= 0 表示不限流），桶内令牌重置为满
+    void configure(double rate_per_second, double burst);
+
+    // 申请令牌：成功返回 true；令牌不足时返回 false，不消耗令牌
+    // now_ns 为单调时钟纳秒数，调用方已取时间时传入可省去一次时钟读取
+    bool try_acquire(int64_t now_ns, uint32_t tokens = 1);
+    bool try_acquire_now(uint32_t tokens = 1) { return try_acquire(now_ns(), tokens); }
+
+    // 当前可用令牌数（近似值，仅用于监控）
+    double available(int64_t now_ns) const;
+
+    bool unlimited() const { return interval_ns_.load(std::memory_order_relaxed) == 0; }
+
+    // 单调时钟（steady_clock）纳秒数
+    static int64_t now_ns();
+
+private:
+    std::atomic<int64_t> tat_;              // 理论到达时间：桶被填满的时刻
+    std::atomic<int64_t> interval_ns_;      // 生成一个令牌的间隔，0 表示不限流
+    std::atomic<int64_t> capacity_ns_;      // 桶容量折算的时间（burst * interval）
+};
+
+}  // namespace token_bucket
+}  // namespace common
+}  // namespace base
+}  // namespace quant
+
+#endif  // BASE_COMMON_TOKEN_BUCKET_TOKEN_BUCKET_H_
@@ -11,7 +11,7 @@ namespace data_types {
 // 标准化Tick数据结构
 struct TickData {
     std::string instrument;          // 合约代码
-    std::chrono::system_clock::time_point timestamp;  // 时间戳
+    std::chrono::system_clock::time_point timestamp;  // 时间戳（热路径用 TscClock::now() 填写）
     double last_price;               // 最新价
     int64_t volume;                  // 成交量
     double open_interest;            // 持仓量
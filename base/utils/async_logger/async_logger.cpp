@@ -0,0 +1,651 @@
+#include "async_logger.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdlib>
+#include <ctime>
+#include <unordered_map>
+#include <sys/syscall.h>  // SYS_gettid
+#include <unistd.h>       // syscall
+#include "utils/tsc_clock/tsc_clock.h"
+
+
+namespace quant {
+namespace base {
+namespace utils {
+namespace async_logger {
+
+namespace {
+
+constexpr size_t kMaxSites = 1 << 16;
+
+// 调用点表：登记后只读，按编号无锁查找
+std::atomic<const LogSite*> g_sites[kMaxSites];
+std::atomic<uint32_t> g_site_count{0};
+
+std::atomic<uint64_t> g_next_logger_id{1};
+
+size_t round_up_pow2(size_t n) {
+    size_t rounded = 64;
+    while (rounded < n) {
+        rounded <<= 1;
+    }
+    return rounded;
+}
+
+// 按序读取编码参数（越界时返回 false）
+class ArgReader {
+public:
+    ArgReader(const uint8_t* data, size_t size) : p_(data), end_(data + size) {}
+
+    bool next(std::string& out) {
+        if (p_ >= end_) {
+            return false;
+        }
+        auto type = static_cast<ArgType>(*p_++);
+        char buffer[64];
+        switch (type) {
+        case ArgType::kInt: {
+            int64_t v;
+            if (!take(&v, sizeof(v))) return false;
+            std::snprintf(buffer, sizeof(buffer), "%" PRId64, v);
+            break;
+        }
+        case ArgType::kUint: {
+            uint64_t v;
+            if (!take(&v, sizeof(v))) return false;
+            std::snprintf(buffer, sizeof(buffer), "%" PRIu64, v);
+            break;
+        }
+        case ArgType::kDouble: {
+            double v;
+            if (!take(&v, sizeof(v))) return false;
+            std::snprintf(buffer, sizeof(buffer), "%.10g", v);
+            break;
+        }
+        case ArgType::kBool: {
+            uint8_t v;
+            if (!take(&v, sizeof(v))) return false;
+            out.append(v != 0 ? "true" : "false");
+            return true;
+        }
+        case ArgType::kChar: {
+            char v;
+            if (!take(&v, sizeof(v))) return false;
+            out.push_back(v);
+            return true;
+        }
+        case ArgType::kString: {
+            uint32_t len;
+            if (!take(&len, sizeof(len)) || static_cast<size_t>(end_ - p_) < len) return false;
+            out.append(reinterpret_cast<const char*>(p_), len);
+            p_ += len;
+            return true;
+        }
+        case ArgType::kPointer: {
+            uint64_t v;
+            if (!take(&v, sizeof(v))) return false;
+            std::snprintf(buffer, sizeof(buffer), "0x%" PRIx64, v);
+            break;
+        }
+        default:
+            p_ = end_;
+            return false;
+        }
+        out.append(buffer);
+        return true;
+    }
+
+private:
+    bool take(void* dst, size_t n) {
+        if (static_cast<size_t>(end_ - p_) < n) {
+            p_ = end_;
+            return false;
+        }
+        std::memcpy(dst, p_, n);
+        p_ += n;
+        return true;
+    }
+
+    const uint8_t* p_;
+    const uint8_t* end_;
+};
+
+template <typename T>
+void write_pod(FILE* file, const T& value) {
+    std::fwrite(&value, sizeof(value), 1, file);
+}
+
+void write_string16(FILE* file, const char* s) {
+    size_t n = s != nullptr ? std::strlen(s) : 0;
+    uint16_t len = static_cast<uint16_t>(std::min<size_t>(n, UINT16_MAX));
+    write_pod(file, len);
+    std::fwrite(s, 1, len, file);
+}
+
+}  // namespace
+
+const char* to_string(LogLevel level) {
+    switch (level) {
+    case LogLevel::kTrace:
+        return "TRACE";
+    case LogLevel::kDebug:
+        return "DEBUG";
+    case LogLevel::kInfo:
+        return "INFO";
+    case LogLevel::kWarn:
+        return "WARN";
+    case LogLevel::kError:
+        return "ERROR";
+    case LogLevel::kOff:
+        return "OFF";
+    }
+    return "UNKNOWN";
+}
+
+uint32_t register_site(const LogSite* site) {
+    uint32_t id = g_site_count.fetch_add(1, std::memory_order_relaxed);
+    if (id >= kMaxSites) {
+        return kPaddingSite;    // 调用点过多：记录照常写入，输出时显示为未知调用点
+    }
+    g_sites[id].store(site, std::memory_order_release);
+    return id;
+}
+
+const LogSite* find_site(uint32_t id) {
+    return id < kMaxSites ? g_sites[id].load(std::memory_order_acquire) : nullptr;
+}
+
+std::string format_message(const char* format, const uint8_t* args, size_t size) {
+    std::string out;
+    if (format == nullptr) {
+        return out;
+    }
+    ArgReader reader(args, size);
+    for (const char* p = format; *p != '\0'; ++p) {
+        if (p[0] == '{' && p[1] == '}') {
+            if (!reader.next(out)) {
+                out.append("{}");
+            }
+            ++p;
+        } else if ((p[0] == '{' && p[1] == '{') || (p[0] == '}' && p[1] == '}')) {
+            out.push_back(*p);
+            ++p;
+        } else {
+            out.push_back(*p);
+        }
+    }
+    return out;
+}
+
+std::string format_entry(const LogEntry& entry) {
+    char prefix[96];
+    time_t seconds = static_cast<time_t>(entry.timestamp_ns / 1000000000);
+    long nanos = static_cast<long>(entry.timestamp_ns % 1000000000);
+    struct tm tm_time;
+    localtime_r(&seconds, &tm_time);
+    size_t n = std::strftime(prefix, sizeof(prefix), "%Y-%m-%d %H:%M:%S", &tm_time);
+    std::snprintf(prefix + n, sizeof(prefix) - n, ".%09ld", nanos);
+
+    std::string line(prefix);
+    if (entry.site == nullptr) {
+        line += " [WARN] [" + std::to_string(entry.thread_id) + "] unknown log site " + std::to_string(entry.site_id);
+        return line;
+    }
+    const char* file = entry.site->file != nullptr ? entry.site->file : "";
+    const char* slash = std::strrchr(file, '/');
+    line += " [";
+    line += to_string(entry.site->level);
+    line += "] [" + std::to_string(entry.thread_id) + "] ";
+    line += slash != nullptr ? slash + 1 : file;
+    line += ":" + std::to_string(entry.site->line) + " ";
+    line += format_message(entry.site->format, entry.payload, entry.payload_size);
+    return line;
+}
+
+
+// ==================== 输出端 ====================
+
+TextLogSink::TextLogSink(const std::string& path) {
+    if (path.empty()) {
+        file_ = stderr;
+    } else {
+        file_ = std::fopen(path.c_str(), "a");
+        owned_ = true;
+    }
+}
+
+TextLogSink::~TextLogSink() {
+    if (owned_ && file_ != nullptr) {
+        std::fclose(file_);
+    }
+}
+
+void TextLogSink::write(const LogEntry& entry) {
+    if (file_ != nullptr) {
+        std::string line = format_entry(entry);
+        line.push_back('\n');
+        std::fwrite(line.data(), 1, line.size(), file_);
+    }
+}
+
+void TextLogSink::dropped(uint32_t thread_id, uint64_t count) {
+    if (file_ != nullptr) {
+        std::fprintf(file_, "[WARN] [%u] %" PRIu64 " log messages dropped (ring full)\n", thread_id, count);
+    }
+}
+
+void TextLogSink::flush() {
+    if (file_ != nullptr) {
+        std::fflush(file_);
+    }
+}
+
+constexpr char BinaryLogSink::kMagic[9];
+
+BinaryLogSink::BinaryLogSink(const std::string& path) {
+    file_ = std::fopen(path.c_str(), "wb");
+    if (file_ != nullptr) {
+        std::fwrite(kMagic, 1, 8, file_);
+    }
+}
+
+BinaryLogSink::~BinaryLogSink() {
+    if (file_ != nullptr) {
+        std::fclose(file_);
+    }
+}
+
+void BinaryLogSink::write(const LogEntry& entry) {
+    if (file_ == nullptr) {
+        return;
+    }
+    if (entry.site != nullptr) {
+        if (entry.site_id >= sites_written_.size()) {
+            sites_written_.resize(entry.site_id + 1, false);
+        }
+        if (!sites_written_[entry.site_id]) {
+            sites_written_[entry.site_id] = true;
+            std::fputc('S', file_);
+            write_pod(file_, entry.site_id);
+            write_pod(file_, static_cast<uint8_t>(entry.site->level));
+            write_pod(file_, entry.site->line);
+            write_string16(file_, entry.site->file);
+            write_string16(file_, entry.site->format);
+        }
+    }
+    std::fputc('R', file_);
+    write_pod(file_, entry.site_id);
+    write_pod(file_, entry.thread_id);
+    write_pod(file_, entry.timestamp_ns);
+    write_pod(file_, entry.payload_size);
+    std::fwrite(entry.payload, 1, entry.payload_size, file_);
+}
+
+void BinaryLogSink::dropped(uint32_t thread_id, uint64_t count) {
+    if (file_ != nullptr) {
+        std::fputc('D', file_);
+        write_pod(file_, thread_id);
+        write_pod(file_, count);
+    }
+}
+
+void BinaryLogSink::flush() {
+    if (file_ != nullptr) {
+        std::fflush(file_);
+    }
+}
+
+bool decode_binary_log(const std::string& path, const std::function<void(const LogEntry&)>& callback,
+                       std::string* error) {
+    auto fail = [error](const std::string& message) {
+        if (error != nullptr) {
+            *error = message;
+        }
+        return false;
+    };
+    FILE* file = std::fopen(path.c_str(), "rb");
+    if (file == nullptr) {
+        return fail("cannot open " + path);
+    }
+    std::vector<uint8_t> data;
+    uint8_t chunk[65536];
+    size_t n = 0;
+    while ((n = std::fread(chunk, 1, sizeof(chunk), file)) > 0) {
+        data.insert(data.end(), chunk, chunk + n);
+    }
+    std::fclose(file);
+    if (data.size() < 8 || std::memcmp(data.data(), BinaryLogSink::kMagic, 8) != 0) {
+        return fail(path + " is not a binary log");
+    }
+
+    // 文件中的调用点定义（节点地址稳定，LogEntry 可直接引用）
+    struct DecodedSite {
+        std::string file;
+        std::string format;
+        LogSite site;
+    };
+    std::unordered_map<uint32_t, DecodedSite> sites;
+
+    size_t pos = 8;
+    auto take = [&](void* dst, size_t len) {
+        if (data.size() - pos < len) {
+            return false;
+        }
+        std::memcpy(dst, data.data() + pos, len);
+        pos += len;
+        return true;
+    };
+    auto take_string16 = [&](std::string& out) {
+        uint16_t len = 0;
+        if (!take(&len, sizeof(len)) || data.size() - pos < len) {
+            return false;
+        }
+        out.assign(reinterpret_cast<const char*>(data.data() + pos), len);
+        pos += len;
+        return true;
+    };
+
+    while (pos < data.size()) {
+        char tag = static_cast<char>(data[pos++]);
+        if (tag == 'S') {
+            uint32_t id = 0;
+            uint8_t level = 0;
+            uint32_t line = 0;
+            DecodedSite decoded;
+            if (!take(&id, sizeof(id)) || !take(&level, sizeof(level)) || !take(&line, sizeof(line)) ||
+                !take_string16(decoded.file) || !take_string16(decoded.format)) {
+                return fail("truncated site definition at offset " + std::to_string(pos));
+            }
+            DecodedSite& stored = sites[id];
+            stored.file = std::move(decoded.file);
+            stored.format = std::move(decoded.format);
+            stored.site = LogSite{static_cast<LogLevel>(level), stored.file.c_str(), line, stored.format.c_str()};
+        } else if (tag == 'R') {
+            LogEntry entry;
+            if (!take(&entry.site_id, sizeof(entry.site_id)) || !take(&entry.thread_id, sizeof(entry.thread_id)) ||
+                !take(&entry.timestamp_ns, sizeof(entry.timestamp_ns)) ||
+                !take(&entry.payload_size, sizeof(entry.payload_size)) || data.size() - pos < entry.payload_size) {
+                return fail("truncated record at offset " + std::to_string(pos));
+            }
+            entry.payload = data.data() + pos;
+            pos += entry.payload_size;
+            auto it = sites.find(entry.site_id);
+            entry.site = it != sites.end() ? &it->second.site : nullptr;
+            callback(entry);
+        } else if (tag == 'D') {
+            LogEntry entry;
+            uint64_t count = 0;
+            if (!take(&entry.thread_id, sizeof(entry.thread_id)) || !take(&count, sizeof(count))) {
+                return fail("truncated drop notice at offset " + std::to_string(pos));
+            }
+            entry.site_id = kPaddingSite;
+            entry.payload_size = static_cast<uint32_t>(std::min<uint64_t>(count, UINT32_MAX));
+            callback(entry);
+        } else {
+            return fail("unknown block '" + std::string(1, tag) + "' at offset " + std::to_string(pos - 1));
+        }
+    }
+    return true;
+}
+
+
+// ==================== AsyncLogger ====================
+
+// 线程私有的单生产者-单消费者字节环
+struct AsyncLogger::ThreadRing {
+    explicit ThreadRing(size_t bytes)
+        : capacity(round_up_pow2(bytes)), mask(capacity - 1), buffer(new uint8_t[capacity]),
+          thread_id(static_cast<uint32_t>(syscall(SYS_gettid))) {}
+
+    const size_t capacity;
+    const size_t mask;
+    std::unique_ptr<uint8_t[]> buffer;
+    const uint32_t thread_id;
+
+    // 生产者
+    alignas(64) std::atomic<uint64_t> head{0};      // 已发布的写位置
+    uint64_t pending = 0;                           // 正在写入的记录结束位置
+    uint64_t cached_tail = 0;                       // 生产者缓存的读位置（减少对消费者缓存行的访问）
+    std::atomic<uint64_t> dropped{0};               // 环满丢弃数（单写者）
+    // 消费者
+    alignas(64) std::atomic<uint64_t> tail{0};
+    uint64_t dropped_reported = 0;
+    std::atomic<bool> retired{false};               // 写线程已退出
+};
+
+namespace {
+
+// 线程退出时把环标记为已退出，由后台线程读空后回收
+struct RingHolder {
+    uint64_t logger_id;
+    std::shared_ptr<void> ring;
+    std::atomic<bool>* retired;
+
+    ~RingHolder() { retired->store(true, std::memory_order_release); }
+};
+
+}  // namespace
+
+AsyncLogger& AsyncLogger::instance() {
+    // 有意不析构：进程退出过程中（静态对象析构、其他线程）仍可能写日志；退出时先输出剩余日志
+    static AsyncLogger* logger = []() {
+        auto* created = new AsyncLogger();
+        std::atexit([]() { AsyncLogger::instance().stop(); });
+        return created;
+    }();
+    return *logger;
+}
+
+AsyncLogger::AsyncLogger() : AsyncLogger(Options()) {}
+
+AsyncLogger::AsyncLogger(const Options& options)
+    : options_(options), id_(g_next_logger_id.fetch_add(1, std::memory_order_relaxed)),
+      sink_(new TextLogSink()) {
+    running_.store(true, std::memory_order_release);
+    thread_ = std::thread(&AsyncLogger::run, this);
+}
+
+AsyncLogger::~AsyncLogger() {
+    stop();
+}
+
+AsyncLogger::ThreadRing& AsyncLogger::local_ring() {
+    thread_local std::vector<std::unique_ptr<RingHolder>> holders;
+    thread_local uint64_t cached_id = 0;
+    thread_local ThreadRing* cached = nullptr;
+    if (cached_id == id_) {
+        return *cached;
+    }
+    for (const auto& holder : holders) {
+        if (holder->logger_id == id_) {
+            cached_id = id_;
+            cached = static_cast<ThreadRing*>(holder->ring.get());
+            return *cached;
+        }
+    }
+
+    auto ring = std::make_shared<ThreadRing>(options_.ring_bytes);
+    {
+        std::lock_guard<std::mutex> lock(rings_mutex_);
+        rings_.push_back(ring);
+        rings_changed_.store(true, std::memory_order_release);
+    }
+    holders.push_back(std::unique_ptr<RingHolder>(new RingHolder{id_, ring, &ring->retired}));
+    cached_id = id_;
+    cached = ring.get();
+    return *cached;
+}
+
+uint8_t* AsyncLogger::reserve(size_t size, uint32_t site, ThreadRing*& out) {
+    ThreadRing& ring = local_ring();
+    size = (size + 7) & ~size_t(7);
+    uint64_t head = ring.head.load(std::memory_order_relaxed);
+    size_t offset = static_cast<size_t>(head & ring.mask);
+    size_t contiguous = ring.capacity - offset;
+    size_t needed = size <= contiguous ? size : contiguous + size;
+    if (size > ring.capacity / 2 || head + needed - ring.cached_tail > ring.capacity) {
+        ring.cached_tail = ring.tail.load(std::memory_order_acquire);
+        if (size > ring.capacity / 2 || head + needed - ring.cached_tail > ring.capacity) {
+            ring.dropped.store(ring.dropped.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            return nullptr;
+        }
+    }
+    if (size > contiguous) {
+        // 环尾放不下：写填充记录，从环首开始
+        auto* padding = reinterpret_cast<RecordHeader*>(ring.buffer.get() + offset);
+        padding->size = static_cast<uint32_t>(contiguous);
+        padding->site = kPaddingSite;
+        head += contiguous;
+        offset = 0;
+    }
+    auto* header = reinterpret_cast<RecordHeader*>(ring.buffer.get() + offset);
+    header->size = static_cast<uint32_t>(size);
+    header->site = site;
+    header->tsc = tsc_clock::TscClock::rdtsc();
+    ring.pending = head + size;
+    out = &ring;
+    return reinterpret_cast<uint8_t*>(header + 1);
+}
+
+void AsyncLogger::commit(ThreadRing& ring) {
+    ring.head.store(ring.pending, std::memory_order_release);
+}
+
+bool AsyncLogger::drain(ThreadRing& ring) {
+    uint64_t tail = ring.tail.load(std::memory_order_relaxed);
+    uint64_t head = ring.head.load(std::memory_order_acquire);
+
+    uint64_t dropped = ring.dropped.load(std::memory_order_relaxed);
+    if (dropped != ring.dropped_reported && sink_) {
+        sink_->dropped(ring.thread_id, dropped - ring.dropped_reported);
+    }
+    ring.dropped_reported = dropped;
+
+    if (tail == head) {
+        return false;
+    }
+    tsc_clock::TscCalibration calibration = tsc_clock::TscClock::calibration();
+    int64_t fallback_ns = calibration.mult == 0 ? tsc_clock::TscClock::realtime_ns() : 0;
+    while (tail < head) {
+        const auto* header = reinterpret_cast<const RecordHeader*>(ring.buffer.get() + (tail & ring.mask));
+        if (header->site != kPaddingSite && sink_) {
+            LogEntry entry;
+            entry.site_id = header->site;
+            entry.site = find_site(header->site);
+            entry.timestamp_ns = calibration.mult != 0 ? tsc_clock::TscClock::to_ns(calibration, header->tsc)
+                                                       : fallback_ns;
+            entry.thread_id = ring.thread_id;
+            entry.payload = reinterpret_cast<const uint8_t*>(header + 1);
+            entry.payload_size = header->size - static_cast<uint32_t>(sizeof(RecordHeader));
+            sink_->write(entry);
+        }
+        tail += header->size;
+    }
+    ring.tail.store(tail, std::memory_order_release);
+    return true;
+}
+
+void AsyncLogger::run() {
+    // TSC 换算参数在首次输出前标定（写线程只记录原始计数器值）
+    if (tsc_clock::TscClock::calibration().mult == 0) {
+        tsc_clock::TscClock::calibrate();
+    }
+    std::vector<std::shared_ptr<ThreadRing>> rings;
+    bool unflushed = false;
+    while (running_.load(std::memory_order_acquire)) {
+        if (rings_changed_.exchange(false, std::memory_order_acq_rel)) {
+            std::lock_guard<std::mutex> lock(rings_mutex_);
+            rings = rings_;
+        }
+
+        bool wrote = false;
+        bool reap = false;
+        {
+            std::lock_guard<std::mutex> lock(sink_mutex_);
+            for (const auto& ring : rings) {
+                bool retired = ring->retired.load(std::memory_order_acquire);
+                wrote = drain(*ring) || wrote;
+                reap = reap || retired;
+            }
+            if (!wrote && unflushed && sink_) {
+                sink_->flush();
+            }
+        }
+        unflushed = wrote || (unflushed && !sink_);
+
+        // 回收已退出且读空的写线程的环
+        if (reap) {
+            std::lock_guard<std::mutex> lock(rings_mutex_);
+            rings_.erase(std::remove_if(rings_.begin(), rings_.end(), [](const std::shared_ptr<ThreadRing>& ring) {
+                return ring->retired.load(std::memory_order_acquire) &&
+                       ring->tail.load(std::memory_order_relaxed) == ring->head.load(std::memory_order_acquire);
+            }), rings_.end());
+            rings = rings_;
+        }
+        if (!wrote) {
+            std::this_thread::sleep_for(options_.idle_sleep);
+        }
+    }
+}
+
+void AsyncLogger::flush() {
+    std::vector<std::pair<std::shared_ptr<ThreadRing>, uint64_t>> targets;
+    {
+        std::lock_guard<std::mutex> lock(rings_mutex_);
+        for (const auto& ring : rings_) {
+            targets.emplace_back(ring, ring->head.load(std::memory_order_acquire));
+        }
+    }
+    if (!running_.load(std::memory_order_acquire)) {
+        return;
+    }
+    for (const auto& target : targets) {
+        while (target.first->tail.load(std::memory_order_acquire) < target.second &&
+               running_.load(std::memory_order_acquire)) {
+            std::this_thread::sleep_for(std::chrono::microseconds(50));
+        }
+    }
+    std::lock_guard<std::mutex> lock(sink_mutex_);
+    if (sink_) {
+        sink_->flush();
+    }
+}
+
+void AsyncLogger::set_sink(std::unique_ptr<LogSink> sink) {
+    flush();
+    std::lock_guard<std::mutex> lock(sink_mutex_);
+    sink_ = std::move(sink);
+}
+
+void AsyncLogger::stop() {
+    if (!running_.exchange(false, std::memory_order_acq_rel)) {
+        return;
+    }
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+    // 输出剩余日志（后台线程已退出，此处是唯一的消费者）
+    std::lock_guard<std::mutex> rings_lock(rings_mutex_);
+    std::lock_guard<std::mutex> sink_lock(sink_mutex_);
+    for (const auto& ring : rings_) {
+        drain(*ring);
+    }
+    if (sink_) {
+        sink_->flush();
+    }
+}
+
+uint64_t AsyncLogger::dropped() const {
+    std::lock_guard<std::mutex> lock(rings_mutex_);
+    uint64_t total = 0;
+    for (const auto& ring : rings_) {
+        total += ring->dropped.load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+}  // namespace async_logger
+}  // namespace utils
+}  // namespace base
+}  // namespace quant
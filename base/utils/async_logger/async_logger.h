@@ -0,0 +1,309 @@
+#ifndef BASE_UTILS_ASYNC_LOGGER_ASYNC_LOGGER_H_
+#define BASE_UTILS_ASYNC_LOGGER_ASYNC_LOGGER_H_
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace quant {
+namespace base {
+namespace utils {
+namespace async_logger {
+
+enum class LogLevel : uint8_t { kTrace, kDebug, kInfo, kWarn, kError, kOff };
+
+const char* to_string(LogLevel level);
+
+// 日志调用点（由 QT_LOG_* 宏生成静态对象）：格式串只在调用点登记一次，记录中只保存其编号
+// 格式串使用 "{}" 占位符（"{{" / "}}" 输出花括号）
+struct LogSite {
+    LogLevel level;
+    const char* file;
+    uint32_t line;
+    const char* format;
+};
+
+// 登记调用点，返回进程内唯一编号（调用点对象必须为静态存储期）
+uint32_t register_site(const LogSite* site);
+
+// 按编号查找调用点，不存在返回 nullptr
+const LogSite* find_site(uint32_t id);
+
+
+// 1. 参数编码：每个参数为 1 字节类型标记 + 原始数据，格式化推迟到后台线程
+enum class ArgType : uint8_t { kInt = 1, kUint, kDouble, kBool, kChar, kString, kPointer };
+
+constexpr size_t kMaxStringArg = 1024;      // 字符串参数最多保存的字节数（超出截断）
+
+namespace detail {
+
+inline size_t encoded_size(bool) { return 2; }
+inline size_t encoded_size(char) { return 2; }
+inline size_t encoded_size(double) { return 1 + sizeof(double); }
+inline size_t encoded_size(float) { return 1 + sizeof(double); }
+inline size_t encoded_size(const char* s) {
+    size_t n = s != nullptr ? strnlen(s, kMaxStringArg) : 0;
+    return 1 + sizeof(uint32_t) + n;
+}
+inline size_t encoded_size(const std::string& s) {
+    return 1 + sizeof(uint32_t) + (s.size() < kMaxStringArg ? s.size() : kMaxStringArg);
+}
+template <typename T>
+typename std::enable_if<std::is_integral<T>::value || std::is_enum<T>::value, size_t>::type
+encoded_size(T) { return 1 + sizeof(uint64_t); }
+template <typename T>
+size_t encoded_size(const T*) { return 1 + sizeof(uint64_t); }
+
+inline void put(uint8_t*& p, const void* data, size_t n) {
+    std::memcpy(p, data, n);
+    p += n;
+}
+
+inline void encode(uint8_t*& p, bool v) {
+    *p++ = static_cast<uint8_t>(ArgType::kBool);
+    *p++ = v ? 1 : 0;
+}
+inline void encode(uint8_t*& p, char v) {
+    *p++ = static_cast<uint8_t>(ArgType::kChar);
+    *p++ = static_cast<uint8_t>(v);
+}
+inline void encode(uint8_t*& p, double v) {
+    *p++ = static_cast<uint8_t>(ArgType::kDouble);
+    put(p, &v, sizeof(v));
+}
+inline void encode(uint8_t*& p, float v) { encode(p, static_cast<double>(v)); }
+inline void encode_string(uint8_t*& p, const char* s, size_t n) {
+    uint32_t len = static_cast<uint32_t>(n < kMaxStringArg ? n : kMaxStringArg);
+    *p++ = static_cast<uint8_t>(ArgType::kString);
+    put(p, &len, sizeof(len));
+    if (len != 0) {
+        put(p, s, len);
+    }
+}
+inline void encode(uint8_t*& p, const char* s) {
+    encode_string(p, s, s != nullptr ? strnlen(s, kMaxStringArg) : 0);
+}
+inline void encode(uint8_t*& p, const std::string& s) { encode_string(p, s.data(), s.size()); }
+template <typename T>
+typename std::enable_if<std::is_integral<T>::value || std::is_enum<T>::value>::type
+encode(uint8_t*& p, T v) {
+    using Raw = typename std::conditional<std::is_enum<T>::value, std::underlying_type<T>, std::common_type<T>>::type::type;
+    if (std::is_signed<Raw>::value) {
+        int64_t value = static_cast<int64_t>(v);
+        *p++ = static_cast<uint8_t>(ArgType::kInt);
+        put(p, &value, sizeof(value));
+    } else {
+        uint64_t value = static_cast<uint64_t>(v);
+        *p++ = static_cast<uint8_t>(ArgType::kUint);
+        put(p, &value, sizeof(value));
+    }
+}
+template <typename T>
+void encode(uint8_t*& p, const T* ptr) {
+    uint64_t value = reinterpret_cast<uintptr_t>(ptr);
+    *p++ = static_cast<uint8_t>(ArgType::kPointer);
+    put(p, &value, sizeof(value));
+}
+
+}  // namespace detail
+
+// 按调用点格式串与编码后的参数生成消息文本
+std::string format_message(const char* format, const uint8_t* args, size_t size);
+
+
+// 2. 记录与输出
+// 环形缓冲区中的记录头（记录总长按 8 字节对齐）
+struct RecordHeader {
+    uint32_t size;                  // 含记录头的总字节数
+    uint32_t site;                  // 调用点编号；kPaddingSite 表示环尾的填充
+    uint64_t tsc;                   // 采集时刻的原始计数器值
+};
+
+constexpr uint32_t kPaddingSite = UINT32_MAX;
+
+// 交给输出端的一条日志（payload 指向编码后的参数，仅在 write() 调用期间有效）
+struct LogEntry {
+    uint32_t site_id = 0;
+    const LogSite* site = nullptr;
+    int64_t timestamp_ns = 0;       // Unix 纪元起的纳秒数
+    uint32_t thread_id = 0;         // 写入线程的内核线程号
+    const uint8_t* payload = nullptr;
+    uint32_t payload_size = 0;
+};
+
+// 输出端（只在后台线程上调用）
+class LogSink {
+public:
+    virtual ~LogSink() = default;
+    virtual void write(const LogEntry& entry) = 0;
+    // 某线程的缓冲区满导致丢弃了 count 条日志
+    virtual void dropped(uint32_t thread_id, uint64_t count) = 0;
+    virtual void flush() {}
+};
+
+// 生成一行文本："2024-01-02 09:30:00.123456789 [INFO] [tid] file:line message"
+std::string format_entry(const LogEntry& entry);
+
+// 文本输出：path 为空时写 stderr
+class TextLogSink : public LogSink {
+public:
+    explicit TextLogSink(const std::string& path = "");
+    ~TextLogSink() override;
+
+    bool ok() const { return file_ != nullptr; }
+    void write(const LogEntry& entry) override;
+    void dropped(uint32_t thread_id, uint64_t count) override;
+    void flush() override;
+
+private:
+    FILE* file_ = nullptr;
+    bool owned_ = false;
+};
+
+// 二进制输出：不做格式化，调用点首次出现时写入其定义，之后每条记录只写编号与原始参数，
+// 由 qt_log_decode 工具（services/logging_service）离线还原为文本
+// 文件格式（小端）：文件头 "QTBLOG01"，之后为按类型标记区分的块：
+//   'S' 调用点：u32 编号, u8 级别, u32 行号, u16 文件名长度, 文件名, u16 格式串长度, 格式串
+//   'R' 记录：  u32 调用点, u32 线程号, i64 时间戳(ns), u32 参数长度, 参数
+//   'D' 丢弃：  u32 线程号, u64 条数
+class BinaryLogSink : public LogSink {
+public:
+    static constexpr char kMagic[9] = "QTBLOG01";
+
+    explicit BinaryLogSink(const std::string& path);
+    ~BinaryLogSink() override;
+
+    bool ok() const { return file_ != nullptr; }
+    void write(const LogEntry& entry) override;
+    void dropped(uint32_t thread_id, uint64_t count) override;
+    void flush() override;
+
+private:
+    FILE* file_ = nullptr;
+    std::vector<bool> sites_written_;
+};
+
+// 解码二进制日志文件，每条记录回调一次（丢弃通知以 site == nullptr、payload_size 为条数表示）
+// 文件不存在或格式错误返回 false，错误信息写入 error
+bool decode_binary_log(const std::string& path, const std::function<void(const LogEntry&)>& callback,
+                       std::string* error = nullptr);
+
+
+// 3. 异步日志器
+// - 每个写线程首次写日志时分配一个线程私有的单生产者-单消费者字节环，记录为 [头 | 编码参数]，
+//   热路径只做：级别判断 + 一次 rdtsc + 参数 memcpy + 一次 release store，无锁、无分配、无格式化、无 I/O
+// - 环满时丢弃并计数（不阻塞交易线程），后台线程输出丢弃通知
+// - 后台线程轮询所有环，把计数器值换算为墙钟时间后交给输出端（文本或二进制）
+// - 写线程退出后其环在读空后回收
+class AsyncLogger {
+public:
+    struct Options {
+        size_t ring_bytes = 1 << 20;                    // 每个写线程的环大小（向上取整为 2 的幂）
+        std::chrono::microseconds idle_sleep{200};      // 后台线程无数据时的休眠间隔
+    };
+
+    // 进程级日志器：首次使用时启动后台线程，默认输出文本到 stderr；进程退出时自动输出剩余日志
+    static AsyncLogger& instance();
+
+    AsyncLogger();
+    explicit AsyncLogger(const Options& options);
+    ~AsyncLogger();
+
+    AsyncLogger(const AsyncLogger&) = delete;
+    AsyncLogger& operator=(const AsyncLogger&) = delete;
+
+    // 替换输出端（先输出已缓冲的日志）；sink 为空时丢弃输出
+    void set_sink(std::unique_ptr<LogSink> sink);
+
+    void set_level(LogLevel level) { level_.store(static_cast<uint8_t>(level), std::memory_order_relaxed); }
+    LogLevel level() const { return static_cast<LogLevel>(level_.load(std::memory_order_relaxed)); }
+    bool enabled(LogLevel level) const {
+        return static_cast<uint8_t>(level) >= level_.load(std::memory_order_relaxed);
+    }
+
+    // 热路径：编码参数写入当前线程的环（格式串已通过调用点编号登记，此处忽略）
+    template <typename... Args>
+    void log(uint32_t site, const char* /*format*/, const Args&... args) {
+        size_t payload = 0;
+        using expand = int[];
+        (void)expand{0, (payload += detail::encoded_size(args), 0)...};
+        ThreadRing* ring = nullptr;
+        uint8_t* p = reserve(sizeof(RecordHeader) + payload, site, ring);
+        if (p == nullptr) {
+            return;
+        }
+        (void)expand{0, (detail::encode(p, args), 0)...};
+        commit(*ring);
+    }
+
+    // 阻塞直到调用前写入的日志全部交给输出端并刷新
+    void flush();
+
+    // 停止后台线程（先输出剩余日志）；之后的日志只缓冲不输出
+    void stop();
+
+    // 各线程因环满丢弃的日志总数
+    uint64_t dropped() const;
+
+private:
+    struct ThreadRing;
+
+    ThreadRing& local_ring();
+    uint8_t* reserve(size_t size, uint32_t site, ThreadRing*& ring);
+    static void commit(ThreadRing& ring);
+    void run();
+    bool drain(ThreadRing& ring);     // 调用方持有 sink_mutex_
+
+    Options options_;
+    uint64_t id_;
+    std::atomic<uint8_t> level_{static_cast<uint8_t>(LogLevel::kInfo)};
+
+    mutable std::mutex rings_mutex_;                    // 保护环列表（线程首次写日志时注册）
+    std::vector<std::shared_ptr<ThreadRing>> rings_;
+    std::atomic<bool> rings_changed_{false};
+
+    std::mutex sink_mutex_;                             // 后台线程输出与 set_sink/flush 互斥
+    std::unique_ptr<LogSink> sink_;
+
+    std::atomic<bool> running_{false};
+    std::thread thread_;
+};
+
+}  // namespace async_logger
+}  // namespace utils
+}  // namespace base
+}  // namespace quant
+
+// 日志宏：级别未开启时不求值参数；格式串使用 "{}" 占位
+//   QT_LOG_INFO("order {} rejected: {}", order_id, reason);
+// 从 __VA_ARGS__ 中取出格式串（只在预处理阶段展开，不求值其余参数）
+#define QT_LOG_FORMAT_(format, ...) format
+#define QT_LOG(level, ...)                                                                              \
+    do {                                                                                                \
+        auto& qt_logger_ = ::quant::base::utils::async_logger::AsyncLogger::instance();                 \
+        if (qt_logger_.enabled(level)) {                                                                \
+            static const ::quant::base::utils::async_logger::LogSite qt_log_site_{                      \
+                level, __FILE__, __LINE__, QT_LOG_FORMAT_(__VA_ARGS__, 0)};                             \
+            static const uint32_t qt_log_site_id_ =                                                     \
+                ::quant::base::utils::async_logger::register_site(&qt_log_site_);                       \
+            qt_logger_.log(qt_log_site_id_, __VA_ARGS__);                                               \
+        }                                                                                               \
+    } while (0)
+
+#define QT_LOG_TRACE(...) QT_LOG(::quant::base::utils::async_logger::LogLevel::kTrace, __VA_ARGS__)
+#define QT_LOG_DEBUG(...) QT_LOG(::quant::base::utils::async_logger::LogLevel::kDebug, __VA_ARGS__)
+#define QT_LOG_INFO(...) QT_LOG(::quant::base::utils::async_logger::LogLevel::kInfo, __VA_ARGS__)
+#define QT_LOG_WARN(...) QT_LOG(::quant::base::utils::async_logger::LogLevel::kWarn, __VA_ARGS__)
+#define QT_LOG_ERROR(...) QT_LOG(::quant::base::utils::async_logger::LogLevel::kError, __VA_ARGS__)
+
+#endif  // BASE_UTILS_ASYNC_LOGGER_ASYNC_LOGGER_H_
@@ -0,0 +1,162 @@
+#include "latency_trace.h"
+
+#include <cstdio>
+#include <iostream>
+#include <sstream>
+
+
+namespace quant {
+namespace base {
+namespace utils {
+namespace latency_trace {
+
+TraceRegistry& TraceRegistry::instance() {
+    static TraceRegistry registry;
+    return registry;
+}
+
+TraceRegistry::TraceRegistry() {
+    for (size_t i = 0; i < kMaxTraceStages; ++i) {
+        stage_names_[i] = "stage" + std::to_string(i);
+    }
+}
+
+TraceRegistry::~TraceRegistry() {
+    stop_periodic_dump();
+}
+
+void TraceRegistry::set_stage_name(size_t stage, const std::string& name) {
+    if (stage >= kMaxTraceStages) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    stage_names_[stage] = name;
+}
+
+TraceRegistry::ThreadRecorder& TraceRegistry::local_recorder() {
+    // 线程私有指针；直方图由注册表持有，线程退出后仍可被汇总
+    thread_local ThreadRecorder* recorder = nullptr;
+    if (recorder == nullptr) {
+        auto created = std::make_shared<ThreadRecorder>();
+        std::lock_guard<std::mutex> lock(mutex_);
+        recorders_.push_back(created);
+        recorder = created.get();
+    }
+    return *recorder;
+}
+
+void TraceRegistry::record(const TraceStamps& stamps) {
+    ThreadRecorder& recorder = local_recorder();
+    uint32_t mask = stamps.mask;
+    if (mask == 0) {
+        return;
+    }
+    // 阶段按编号顺序排列，每个阶段记录相对上一个已打点阶段的增量
+    size_t first = static_cast<size_t>(__builtin_ctz(mask));
+    uint64_t previous = stamps.tsc[first];
+    uint64_t last = previous;
+    mask &= mask - 1;
+    while (mask != 0) {
+        size_t stage = static_cast<size_t>(__builtin_ctz(mask));
+        uint64_t now = stamps.tsc[stage];
+        recorder.stages[stage].record(now >= previous ? now - previous : 0);
+        previous = now;
+        last = now;
+        mask &= mask - 1;
+    }
+    recorder.end_to_end.record(last - stamps.tsc[first]);
+}
+
+std::vector<StageLatency> TraceRegistry::report() const {
+    std::vector<std::shared_ptr<ThreadRecorder>> recorders;
+    std::vector<std::string> names(kMaxTraceStages);
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        recorders = recorders_;
+        for (size_t i = 0; i < kMaxTraceStages; ++i) {
+            names[i] = stage_names_[i];
+        }
+    }
+
+    double scale = 1.0 / tsc_clock::TscClock::ticks_per_ns();
+    auto summarize = [scale](const std::string& name, const common::hdr_histogram::HdrHistogram& histogram) {
+        StageLatency latency;
+        latency.name = name;
+        latency.count = histogram.count();
+        latency.p50_ns = static_cast<double>(histogram.percentile(50.0)) * scale;
+        latency.p99_ns = static_cast<double>(histogram.percentile(99.0)) * scale;
+        latency.p999_ns = static_cast<double>(histogram.percentile(99.9)) * scale;
+        latency.max_ns = static_cast<double>(histogram.max()) * scale;
+        return latency;
+    };
+
+    std::vector<StageLatency> result;
+    auto merged = std::make_unique<common::hdr_histogram::HdrHistogram>();
+    for (size_t stage = 0; stage < kMaxTraceStages; ++stage) {
+        merged->reset();
+        for (const auto& recorder : recorders) {
+            merged->merge(recorder->stages[stage]);
+        }
+        if (merged->count() != 0) {
+            result.push_back(summarize(names[stage], *merged));
+        }
+    }
+    merged->reset();
+    for (const auto& recorder : recorders) {
+        merged->merge(recorder->end_to_end);
+    }
+    result.push_back(summarize("end_to_end", *merged));
+    return result;
+}
+
+std::string TraceRegistry::format_report() const {
+    std::ostringstream out;
+    char line[160];
+    std::snprintf(line, sizeof(line), "%-24s %12s %10s %10s %10s %10s\n",
+                  "stage", "count", "p50(ns)", "p99(ns)", "p99.9(ns)", "max(ns)");
+    out << line;
+    for (const auto& stage : report()) {
+        std::snprintf(line, sizeof(line), "%-24s %12llu %10.0f %10.0f %10.0f %10.0f\n",
+                      stage.name.c_str(), static_cast<unsigned long long>(stage.count),
+                      stage.p50_ns, stage.p99_ns, stage.p999_ns, stage.max_ns);
+        out << line;
+    }
+    return out.str();
+}
+
+void TraceRegistry::start_periodic_dump(std::chrono::milliseconds interval,
+                                        std::function<void(const std::string&)> sink) {
+    stop_periodic_dump();
+    if (!sink) {
+        sink = [](const std::string& text) { std::cout << text << std::flush; };
+    }
+    std::lock_guard<std::mutex> lock(dump_mutex_);
+    dump_running_ = true;
+    dump_thread_ = std::thread([this, interval, sink]() {
+        std::unique_lock<std::mutex> lock(dump_mutex_);
+        while (dump_running_) {
+            if (dump_cv_.wait_for(lock, interval, [this] { return !dump_running_; })) {
+                break;
+            }
+            lock.unlock();
+            sink(format_report());
+            lock.lock();
+        }
+    });
+}
+
+void TraceRegistry::stop_periodic_dump() {
+    {
+        std::lock_guard<std::mutex> lock(dump_mutex_);
+        dump_running_ = false;
+    }
+    dump_cv_.notify_all();
+    if (dump_thread_.joinable()) {
+        dump_thread_.join();
+    }
+}
+
+}  // namespace latency_trace
+}  // namespace utils
+}  // namespace base
+}  // namespace quant
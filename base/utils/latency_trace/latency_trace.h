@@ -0,0 +1,170 @@
+#ifndef BASE_UTILS_LATENCY_TRACE_LATENCY_TRACE_H_
+#define BASE_UTILS_LATENCY_TRACE_LATENCY_TRACE_H_
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "common/hdr_histogram/hdr_histogram.h"
+#include "utils/tsc_clock/tsc_clock.h"
+
+namespace quant {
+namespace base {
+namespace utils {
+namespace latency_trace {
+
+// 最多支持的阶段数（阶段编号 0 ~ kMaxTraceStages-1，由使用方定义枚举）
+constexpr size_t kMaxTraceStages = 16;
+
+// 随事件传递的各阶段时间戳（原始计数器值），mask 标记已打点的阶段
+struct TraceStamps {
+    uint64_t tsc[kMaxTraceStages];
+    uint32_t mask = 0;
+
+    void stamp(size_t stage) {
+        tsc[stage] = tsc_clock::TscClock::rdtsc();
+        mask |= uint32_t(1) << stage;
+    }
+
+    void clear() { mask = 0; }
+    bool active() const { return mask != 0; }
+    bool has(size_t stage) const { return (mask >> stage) & 1u; }
+};
+
+// 当前线程正在跟踪的事件（同步调用链上的各阶段直接对其打点，无需修改事件结构）
+inline TraceStamps& current_trace() {
+    thread_local TraceStamps stamps;
+    return stamps;
+}
+
+// 单个阶段的延迟统计（纳秒）
+struct StageLatency {
+    std::string name;
+    uint64_t count = 0;
+    double p50_ns = 0.0;
+    double p99_ns = 0.0;
+    double p999_ns = 0.0;
+    double max_ns = 0.0;
+};
+
+// 延迟跟踪注册表（进程级单例）
+// - 每个记录线程首次 record() 时注册一组线程私有的直方图：各阶段一个（相对上一个已打点阶段的增量），
+//   外加端到端（首个阶段到最后一个阶段）一个；记录路径只写本线程的直方图，无锁、无共享写
+// - 直方图以计数器周期为单位记录，报告时按 TscClock 标定的频率统一换算为纳秒
+// - 线程退出后其直方图仍保留在注册表中，统计为进程启动以来的累计值
+class TraceRegistry {
+public:
+    static TraceRegistry& instance();
+
+    // 禁止拷贝和移动
+    TraceRegistry(const TraceRegistry&) = delete;
+    TraceRegistry& operator=(const TraceRegistry&) = delete;
+
+    ~TraceRegistry();
+
+    // 设置阶段名称（报告中使用，未设置时为 "stage<N>"）
+    void set_stage_name(size_t stage, const std::string& name);
+
+    // 记录一次完整跟踪（热路径：只写当前线程的直方图）
+    void record(const TraceStamps& stamps);
+
+    // 汇总所有线程的统计：按阶段编号排列（跳过无样本的阶段），最后一项为端到端 "end_to_end"
+    std::vector<StageLatency> report() const;
+
+    // 格式化报告（每行一个阶段：count / p50 / p99 / p99.9 / max）
+    std::string format_report() const;
+
+    // 周期性输出报告；sink 为空时输出到 std::cout
+    void start_periodic_dump(std::chrono::milliseconds interval,
+                             std::function<void(const std::string&)> sink = nullptr);
+    void stop_periodic_dump();
+
+private:
+    struct ThreadRecorder {
+        common::hdr_histogram::HdrHistogram stages[kMaxTraceStages];
+        common::hdr_histogram::HdrHistogram end_to_end;
+    };
+
+    TraceRegistry();
+    ThreadRecorder& local_recorder();
+
+    mutable std::mutex mutex_;                                  // 保护线程列表与阶段名称（冷路径）
+    std::vector<std::shared_ptr<ThreadRecorder>> recorders_;
+    std::string stage_names_[kMaxTraceStages];
+
+    std::mutex dump_mutex_;
+    std::condition_variable dump_cv_;
+    std::thread dump_thread_;
+    bool dump_running_ = false;
+};
+
+// 宏接口的实现函数（仅在启用跟踪时由宏调用）
+// 开始跟踪：清空当前线程的时间戳并对第一个阶段打点
+inline void trace_begin(size_t stage) {
+    TraceStamps& stamps = current_trace();
+    stamps.clear();
+    stamps.stamp(stage);
+}
+
+// 中间阶段打点：当前线程没有活动跟踪时直接返回（如非行情触发的下单）
+inline void trace_stage(size_t stage) {
+    TraceStamps& stamps = current_trace();
+    if (stamps.active()) {
+        stamps.stamp(stage);
+    }
+}
+
+// 结束跟踪并记录到直方图
+inline void trace_record() {
+    TraceStamps& stamps = current_trace();
+    if (stamps.active()) {
+        TraceRegistry::instance().record(stamps);
+        stamps.clear();
+    }
+}
+
+// 结束跟踪但不记录（事件已交给其他线程继续跟踪）
+inline void trace_end() {
+    current_trace().clear();
+}
+
+}  // namespace latency_trace
+}  // namespace utils
+}  // namespace base
+}  // namespace quant
+
+// 跟踪宏：定义 QT_ENABLE_LATENCY_TRACE 时生效，否则完全编译为空
+// - QT_TRACE_BEGIN(stage)      事件入口（如数据源回调）开始跟踪
+// - QT_TRACE_STAGE(stage)      同步调用链上的中间阶段打点
+// - QT_TRACE_CAPTURE(stamps)   事件跨线程投递时，把当前时间戳拷贝到事件携带的 TraceStamps
+// - QT_TRACE_RESUME(stamps)    接收线程取出事件后，以事件携带的时间戳继续跟踪
+// - QT_TRACE_RECORD()          事件处理完毕，记录各阶段与端到端延迟
+// - QT_TRACE_END()             放弃当前线程上的跟踪（不记录）
+#ifdef QT_ENABLE_LATENCY_TRACE
+#define QT_TRACE_BEGIN(stage) \
+    ::quant::base::utils::latency_trace::trace_begin(static_cast<size_t>(stage))
+#define QT_TRACE_STAGE(stage) \
+    ::quant::base::utils::latency_trace::trace_stage(static_cast<size_t>(stage))
+#define QT_TRACE_CAPTURE(stamps) \
+    ((stamps) = ::quant::base::utils::latency_trace::current_trace())
+#define QT_TRACE_RESUME(stamps) \
+    (::quant::base::utils::latency_trace::current_trace() = (stamps))
+#define QT_TRACE_RECORD() ::quant::base::utils::latency_trace::trace_record()
+#define QT_TRACE_END() ::quant::base::utils::latency_trace::trace_end()
+#else
+#define QT_TRACE_BEGIN(stage) ((void)0)
+#define QT_TRACE_STAGE(stage) ((void)0)
+#define QT_TRACE_CAPTURE(stamps) ((void)0)
+#define QT_TRACE_RESUME(stamps) ((void)0)
+#define QT_TRACE_RECORD() ((void)0)
+#define QT_TRACE_END() ((void)0)
+#endif
+
+#endif  // BASE_UTILS_LATENCY_TRACE_LATENCY_TRACE_H_
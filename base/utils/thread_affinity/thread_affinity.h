@@ -0,0 +1,44 @@
+#ifndef BASE_UTILS_THREAD_AFFINITY_THREAD_AFFINITY_H_
+#define BASE_UTILS_THREAD_AFFINITY_THREAD_AFFINITY_H_
+
+#include <string>
+#include <thread>
+#include <pthread.h>      // pthread_setaffinity_np / pthread_setname_np
+#include <sched.h>        // cpu_set_t
+
+namespace quant {
+namespace base {
+namespace utils {
+namespace thread_affinity {
+
+// 将指定线程绑定到单个 CPU 核心；core < 0 表示不绑定（直接返回 true）
+inline bool pin_thread(std::thread::native_handle_type handle, int core) {
+    if (core < 0) {
+        return true;
+    }
+    if (core >= CPU_SETSIZE) {
+        return false;
+    }
+    cpu_set_t cpuset;
+    CPU_ZERO(&cpuset);
+    CPU_SET(core, &cpuset);
+    return pthread_setaffinity_np(handle, sizeof(cpu_set_t), &cpuset) == 0;
+}
+
+// 将当前线程绑定到单个 CPU 核心（在线程函数入口处调用）
+inline bool pin_current_thread(int core) {
+    return pin_thread(pthread_self(), core);
+}
+
+// 设置线程名（便于 top -H / perf 中识别），Linux 限制 15 个字符，超出部分截断
+inline bool set_thread_name(std::thread::native_handle_type handle, const std::string& name) {
+    std::string truncated = name.substr(0, 15);
+    return pthread_setname_np(handle, truncated.c_str()) == 0;
+}
+
+}  // namespace thread_affinity
+}  // namespace utils
+}  // namespace base
+}  // namespace quant
+
+#endif  // BASE_UTILS_THREAD_AFFINITY_THREAD_AFFINITY_H_
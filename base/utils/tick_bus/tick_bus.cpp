@@ -0,0 +1,83 @@
+#include "tick_bus.h"
+
+#include <algorithm>      // 用于 min
+#include <chrono>         // 用于时间换算
+#include <cstring>        // 用于 memcpy/strnlen
+#include <time.h>         // 用于 clock_gettime
+
+namespace quant {
+namespace base {
+namespace utils {
+namespace tick_bus {
+
+void to_bus_tick(const data_types::TickData& tick, BusTick& out) {
+    out.version = kBusTickVersion;
+    out.reserved = 0;
+    size_t length = std::min(tick.instrument.size(), kMaxInstrument - 1);
+    std::memcpy(out.instrument, tick.instrument.data(), length);
+    std::memset(out.instrument + length, 0, kMaxInstrument - length);
+    out.timestamp_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        tick.timestamp.time_since_epoch()).count();
+    out.publish_ns = 0;
+    out.last_price = tick.last_price;
+    out.volume = tick.volume;
+    out.open_interest = tick.open_interest;
+    std::memcpy(out.bid_price, tick.bid_price, sizeof(out.bid_price));
+    std::memcpy(out.bid_volume, tick.bid_volume, sizeof(out.bid_volume));
+    std::memcpy(out.ask_price, tick.ask_price, sizeof(out.ask_price));
+    std::memcpy(out.ask_volume, tick.ask_volume, sizeof(out.ask_volume));
+    out.open_price = tick.open_price;
+    out.high_price = tick.high_price;
+    out.low_price = tick.low_price;
+    out.pre_close_price = tick.pre_close_price;
+}
+
+void from_bus_tick(const BusTick& record, data_types::TickData& out) {
+    out.instrument.assign(record.instrument, strnlen(record.instrument, kMaxInstrument));
+    out.timestamp = std::chrono::system_clock::time_point(
+        std::chrono::duration_cast<std::chrono::system_clock::duration>(
+            std::chrono::nanoseconds(record.timestamp_ns)));
+    out.last_price = record.last_price;
+    out.volume = record.volume;
+    out.open_interest = record.open_interest;
+    std::memcpy(out.bid_price, record.bid_price, sizeof(out.bid_price));
+    std::memcpy(out.bid_volume, record.bid_volume, sizeof(out.bid_volume));
+    std::memcpy(out.ask_price, record.ask_price, sizeof(out.ask_price));
+    std::memcpy(out.ask_volume, record.ask_volume, sizeof(out.ask_volume));
+    out.open_price = record.open_price;
+    out.high_price = record.high_price;
+    out.low_price = record.low_price;
+    out.pre_close_price = record.pre_close_price;
+}
+
+int64_t monotonic_ns() {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<int64_t>(ts.tv_sec) * 1000000000LL + ts.tv_nsec;
+}
+
+std::unique_ptr<TickBusPublisher> TickBusPublisher::create(const std::string& name, size_t capacity,
+                                                           std::string* error) {
+    common::shm_ring::ShmRingOptions options;
+    options.name = name;
+    options.slot_bytes = sizeof(BusTick);
+    options.capacity = capacity;
+    auto ring = common::shm_ring::ShmRingWriter::create(options, error);
+    if (!ring) {
+        return nullptr;
+    }
+    return std::unique_ptr<TickBusPublisher>(new TickBusPublisher(std::move(ring)));
+}
+
+std::unique_ptr<TickBusReader> TickBusReader::open(const std::string& name, Start start, std::string* error) {
+    auto ring = common::shm_ring::ShmRingReader::open(name, start, error);
+    if (!ring) {
+        return nullptr;
+    }
+    return std::unique_ptr<TickBusReader>(new TickBusReader(std::move(ring)));
+}
+
+}  // namespace tick_bus
+}  // namespace utils
+}  // namespace base
+}  // namespace quant
@@ -0,0 +1,128 @@
+#ifndef BASE_UTILS_TICK_BUS_TICK_BUS_H_
+#define BASE_UTILS_TICK_BUS_TICK_BUS_H_
+
+#include <cstddef>        // 用于 size_t
+#include <cstdint>        // 用于 int64_t
+#include <memory>         // 用于 unique_ptr
+#include <string>
+#include "common/shm_ring/shm_ring.h"
+#include "data_types/tick_data.h"
+
+namespace quant {
+namespace base {
+namespace utils {
+namespace tick_bus {
+
+constexpr char kDefaultBusName[] = "/quant_ticks";
+constexpr size_t kMaxInstrument = 32;           // 合约代码最大长度（含结尾 '\0'）
+constexpr uint32_t kBusTickVersion = 1;
+
+// 共享内存行情总线上的定长行情记录（跨进程布局，字段只增不改，变更时递增 kBusTickVersion）
+struct BusTick {
+    uint32_t version;
+    uint32_t reserved;
+    char instrument[kMaxInstrument];
+    int64_t timestamp_ns;           // 行情时间（Unix 纪元纳秒）
+    int64_t publish_ns;             // 写入总线的时刻（CLOCK_MONOTONIC，跨进程可比，用于测量延迟）
+    double last_price;
+    int64_t volume;
+    double open_interest;
+    double bid_price[5];
+    int32_t bid_volume[5];
+    double ask_price[5];
+    int32_t ask_volume[5];
+    double open_price;
+    double high_price;
+    double low_price;
+    double pre_close_price;
+};
+
+// TickData 与定长记录互转（合约代码超长时截断）
+void to_bus_tick(const data_types::TickData& tick, BusTick& out);
+void from_bus_tick(const BusTick& record, data_types::TickData& out);
+
+// 跨进程可比的单调时钟（纳秒）
+int64_t monotonic_ns();
+
+// 写端：由行情标准化线程在标准化之后写入一次，所有本机读者共享（单写线程，见 ShmRingWriter）
+class TickBusPublisher {
+public:
+    static std::unique_ptr<TickBusPublisher> create(const std::string& name = kDefaultBusName,
+                                                    size_t capacity = 65536, std::string* error = nullptr);
+
+    bool publish(const data_types::TickData& tick) {
+        to_bus_tick(tick, scratch_);
+        scratch_.publish_ns = monotonic_ns();
+        return ring_->publish(scratch_);
+    }
+
+    // 已在调用方填好的记录直接写入（publish_ns 为 0 时补填）
+    bool publish(BusTick& record) {
+        if (record.publish_ns == 0) {
+            record.publish_ns = monotonic_ns();
+        }
+        return ring_->publish(record);
+    }
+
+    uint64_t published() const { return ring_->published(); }
+    uint64_t contended() const { return ring_->contended(); }
+    const std::string& name() const { return ring_->name(); }
+
+private:
+    explicit TickBusPublisher(std::unique_ptr<common::shm_ring::ShmRingWriter> ring) : ring_(std::move(ring)) {}
+
+    std::unique_ptr<common::shm_ring::ShmRingWriter> ring_;
+    BusTick scratch_{};             // 仅写线程使用
+};
+
+// 读端库：回测、监控、研究工具等进程外消费者使用，每个读者独立游标
+class TickBusReader {
+public:
+    using Start = common::shm_ring::ShmRingReader::Start;
+
+    static std::unique_ptr<TickBusReader> open(const std::string& name = kDefaultBusName,
+                                               Start start = Start::kLatest, std::string* error = nullptr);
+
+    // 读取下一条行情，暂无新行情返回 false
+    bool next(BusTick& out) {
+        for (;;) {
+            uint64_t cursor = ring_->cursor();
+            if (ring_->next(out)) {
+                if (out.version == kBusTickVersion) {
+                    return true;
+                }
+                continue;
+            }
+            if (ring_->cursor() == cursor) {
+                return false;       // 暂无新行情（或写者尚未写完该条）
+            }
+            // 被超车：游标已跳到较新的位置，继续读取
+        }
+    }
+
+    // 零拷贝读取：visit(const BusTick&) 直接作用于共享内存，返回 false 时（被超车）结果须丢弃
+    template <typename Visit>
+    bool poll(Visit&& visit) {
+        return ring_->poll([&visit](const uint8_t* data, size_t size) {
+            if (size == sizeof(BusTick)) {
+                visit(*reinterpret_cast<const BusTick*>(data));
+            }
+        });
+    }
+
+    uint64_t lost() const { return ring_->lost(); }
+    uint64_t backlog() const { return ring_->head() - ring_->cursor(); }
+    int64_t writer_pid() const { return ring_->writer_pid(); }
+
+private:
+    explicit TickBusReader(std::unique_ptr<common::shm_ring::ShmRingReader> ring) : ring_(std::move(ring)) {}
+
+    std::unique_ptr<common::shm_ring::ShmRingReader> ring_;
+};
+
+}  // namespace tick_bus
+}  // namespace utils
+}  // namespace base
+}  // namespace quant
+
+#endif  // BASE_UTILS_TICK_BUS_TICK_BUS_H_
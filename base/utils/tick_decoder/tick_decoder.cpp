@@ -0,0 +1,668 @@
+#include "tick_decoder.h"
+
+#include <cfloat>         // 用于 DBL_MAX
+#include <chrono>
+#include <cmath>          // 用于 isfinite
+#include <cstdlib>        // 用于 strtod
+#include <cstring>        // 用于 memcpy/strnlen
+#include <limits>         // 用于 numeric_limits
+
+#if defined(__SSE2__)
+#include <emmintrin.h>    // SSE2：16 字节并行比较
+#endif
+
+namespace quant {
+namespace base {
+namespace utils {
+namespace tick_decoder {
+
+namespace {
+
+constexpr uint64_t kMaxExactMantissa = 1ULL << 53;
+constexpr uint64_t kMantissaLimit = 100000000000000000ULL;   // 1e17，超过后不再累加，改走 strtod
+
+const double kPow10[] = {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+};
+
+inline bool is_digit(char c) {
+    return c >= '0' && c <= '9';
+}
+
+inline const char* skip_ws(const char* p, const char* end) {
+    while (p < end && (*p == ' ' || *p == '\n' || *p == '\r' || *p == '\t')) {
+        ++p;
+    }
+    return p;
+}
+
+// p 指向开引号之后，返回闭引号位置；转义字符整体跳过，未闭合返回 nullptr
+const char* find_string_end(const char* p, const char* end) {
+#if defined(__SSE2__)
+    const __m128i quote = _mm_set1_epi8('"');
+    const __m128i backslash = _mm_set1_epi8('\\');
+    while (end - p >= 16) {
+        __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        int mask = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(chunk, quote), _mm_cmpeq_epi8(chunk, backslash)));
+        if (mask == 0) {
+            p += 16;
+            continue;
+        }
+        p += __builtin_ctz(static_cast<unsigned>(mask));
+        if (*p == '"') {
+            return p;
+        }
+        p += 2;
+        if (p > end) {
+            return nullptr;
+        }
+    }
+#endif
+    while (p < end) {
+        if (*p == '"') {
+            return p;
+        }
+        p += (*p == '\\') ? 2 : 1;
+    }
+    return nullptr;
+}
+
+// p 指向 '{' 或 '['，返回与之配对的括号之后的位置（只匹配深度，不校验内部语法）
+const char* skip_container(const char* p, const char* end) {
+    int depth = 0;
+    while (p < end) {
+#if defined(__SSE2__)
+        // 定位下一个结构字符：引号或任意括号
+        const __m128i quote = _mm_set1_epi8('"');
+        const __m128i open_brace = _mm_set1_epi8('{');
+        const __m128i close_brace = _mm_set1_epi8('}');
+        const __m128i open_bracket = _mm_set1_epi8('[');
+        const __m128i close_bracket = _mm_set1_epi8(']');
+        while (end - p >= 16) {
+            __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+            __m128i hits = _mm_or_si128(
+                _mm_or_si128(_mm_cmpeq_epi8(chunk, quote), _mm_cmpeq_epi8(chunk, open_brace)),
+                _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chunk, close_brace), _mm_cmpeq_epi8(chunk, open_bracket)),
+                             _mm_cmpeq_epi8(chunk, close_bracket)));
+            int mask = _mm_movemask_epi8(hits);
+            if (mask != 0) {
+                p += __builtin_ctz(static_cast<unsigned>(mask));
+                break;
+            }
+            p += 16;
+        }
+#endif
+        while (p < end && *p != '"' && *p != '{' && *p != '}' && *p != '[' && *p != ']') {
+            ++p;
+        }
+        if (p >= end) {
+            return nullptr;
+        }
+        char c = *p;
+        if (c == '"') {
+            p = find_string_end(p + 1, end);
+            if (p == nullptr) {
+                return nullptr;
+            }
+            ++p;
+            continue;
+        }
+        ++p;
+        if (c == '{' || c == '[') {
+            ++depth;
+        } else if (--depth == 0) {
+            return p;
+        }
+    }
+    return nullptr;
+}
+
+// 跳过任意值：字符串、容器或字面量（数字/true/false/null）
+const char* skip_value(const char* p, const char* end) {
+    if (p >= end) {
+        return nullptr;
+    }
+    if (*p == '"') {
+        const char* close = find_string_end(p + 1, end);
+        return close == nullptr ? nullptr : close + 1;
+    }
+    if (*p == '{' || *p == '[') {
+        return skip_container(p, end);
+    }
+    const char* start = p;
+    while (p < end && *p != ',' && *p != '}' && *p != ']' && *p != ' ' && *p != '\n' && *p != '\r' && *p != '\t') {
+        ++p;
+    }
+    return p == start ? nullptr : p;
+}
+
+// 数值转整数：超出范围时饱和，NaN 视为 0（截断小数部分）
+template <typename Int>
+Int saturate(double value) {
+    if (!(value == value)) {
+        return 0;
+    }
+    if (value <= static_cast<double>(std::numeric_limits<Int>::min())) {
+        return std::numeric_limits<Int>::min();
+    }
+    if (value >= static_cast<double>(std::numeric_limits<Int>::max())) {
+        return std::numeric_limits<Int>::max();
+    }
+    return static_cast<Int>(value);
+}
+
+// Unix 纪元毫秒转时间点（限制在 system_clock 纳秒精度可表示的范围内）
+std::chrono::system_clock::time_point time_from_ms(double ms) {
+    constexpr int64_t kLimitMs = 9000000000000LL;    // 约 ±285 年
+    int64_t value = saturate<int64_t>(ms);
+    value = value > kLimitMs ? kLimitMs : (value < -kLimitMs ? -kLimitMs : value);
+    return std::chrono::system_clock::time_point(
+        std::chrono::duration_cast<std::chrono::system_clock::duration>(std::chrono::milliseconds(value)));
+}
+
+// 数值字段：JSON number 或带引号的数字字符串；null 表示缺省（out 不变）
+const char* parse_number_value(const char* p, const char* end, double& out, bool& present) {
+    present = false;
+    if (p >= end) {
+        return nullptr;
+    }
+    if (*p == '"') {
+        const char* next = parse_decimal(p + 1, end, out);
+        if (next == nullptr || next >= end || *next != '"') {
+            return nullptr;
+        }
+        present = true;
+        return next + 1;
+    }
+    if (*p == 'n') {
+        if (end - p >= 4 && std::memcmp(p, "null", 4) == 0) {
+            return p + 4;
+        }
+        return nullptr;
+    }
+    const char* next = parse_decimal(p, end, out);
+    present = next != nullptr;
+    return next;
+}
+
+// [[价, 量], ...]：最多取五档，其余档位清零
+const char* parse_levels(const char* p, const char* end, double* prices, int32_t* volumes) {
+    if (p >= end || *p != '[') {
+        return nullptr;
+    }
+    p = skip_ws(p + 1, end);
+    int level = 0;
+    if (p < end && *p == ']') {
+        ++p;
+    } else {
+        for (;;) {
+            if (p >= end) {
+                return nullptr;
+            }
+            if (level >= 5) {
+                p = skip_value(p, end);
+            } else {
+                if (*p != '[') {
+                    return nullptr;
+                }
+                double price = 0.0;
+                double volume = 0.0;
+                bool present = false;
+                p = parse_number_value(skip_ws(p + 1, end), end, price, present);
+                if (p == nullptr) {
+                    return nullptr;
+                }
+                p = skip_ws(p, end);
+                if (p >= end || *p != ',') {
+                    return nullptr;
+                }
+                p = parse_number_value(skip_ws(p + 1, end), end, volume, present);
+                if (p == nullptr) {
+                    return nullptr;
+                }
+                // 档位数组中多余的元素（部分交易所附带订单数）跳过
+                p = skip_ws(p, end);
+                while (p < end && *p == ',') {
+                    p = skip_value(skip_ws(p + 1, end), end);
+                    if (p == nullptr) {
+                        return nullptr;
+                    }
+                    p = skip_ws(p, end);
+                }
+                if (p >= end || *p != ']') {
+                    return nullptr;
+                }
+                ++p;
+                prices[level] = price;
+                volumes[level] = saturate<int32_t>(volume);
+                ++level;
+            }
+            if (p == nullptr) {
+                return nullptr;
+            }
+            p = skip_ws(p, end);
+            if (p < end && *p == ',') {
+                p = skip_ws(p + 1, end);
+                continue;
+            }
+            if (p < end && *p == ']') {
+                ++p;
+                break;
+            }
+            return nullptr;
+        }
+    }
+    for (int i = level; i < 5; ++i) {
+        prices[i] = 0.0;
+        volumes[i] = 0;
+    }
+    return p;
+}
+
+uint64_t key_prefix(const char* key, size_t length) {
+    uint64_t prefix = 0;
+    std::memcpy(&prefix, key, length < sizeof(prefix) ? length : sizeof(prefix));
+    return prefix;
+}
+
+// CTP 用 DBL_MAX 表示无效价格
+inline double ctp_price(double value) {
+    return (value == DBL_MAX || !std::isfinite(value)) ? 0.0 : value;
+}
+
+bool parse_digits(const char* p, int count, int& out) {
+    int value = 0;
+    for (int i = 0; i < count; ++i) {
+        if (!is_digit(p[i])) {
+            return false;
+        }
+        value = value * 10 + (p[i] - '0');
+    }
+    out = value;
+    return true;
+}
+
+// 公历日期到 Unix 纪元天数（Howard Hinnant 的 days_from_civil）
+int64_t days_from_civil(int year, int month, int day) {
+    year -= month <= 2 ? 1 : 0;
+    const int era = (year >= 0 ? year : year - 399) / 400;
+    const int yoe = year - era * 400;
+    const int doy = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+    const int doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return static_cast<int64_t>(era) * 146097 + doe - 719468;
+}
+
+}  // namespace
+
+const char* to_string(DecodeStatus status) {
+    switch (status) {
+        case DecodeStatus::kOk:
+            return "ok";
+        case DecodeStatus::kMalformed:
+            return "malformed";
+        case DecodeStatus::kMissingField:
+            return "missing field";
+        case DecodeStatus::kBadSize:
+            return "bad size";
+    }
+    return "unknown";
+}
+
+const char* parse_decimal(const char* begin, const char* end, double& out) {
+    const char* p = begin;
+    bool negative = false;
+    if (p < end && *p == '-') {
+        negative = true;
+        ++p;
+    }
+    uint64_t mantissa = 0;
+    int exponent = 0;
+    bool exact = true;
+
+    const char* digits = p;
+    while (p < end && is_digit(*p)) {
+        if (mantissa < kMantissaLimit) {
+            mantissa = mantissa * 10 + static_cast<uint64_t>(*p - '0');
+        } else {
+            exact = false;
+        }
+        ++p;
+    }
+    if (p == digits) {
+        return nullptr;
+    }
+    if (p < end && *p == '.') {
+        ++p;
+        const char* fraction = p;
+        while (p < end && is_digit(*p)) {
+            if (mantissa < kMantissaLimit) {
+                mantissa = mantissa * 10 + static_cast<uint64_t>(*p - '0');
+                --exponent;
+            } else {
+                exact = false;
+            }
+            ++p;
+        }
+        if (p == fraction) {
+            return nullptr;
+        }
+    }
+    if (p < end && (*p == 'e' || *p == 'E')) {
+        ++p;
+        bool negative_exponent = false;
+        if (p < end && (*p == '+' || *p == '-')) {
+            negative_exponent = *p == '-';
+            ++p;
+        }
+        const char* exponent_digits = p;
+        int value = 0;
+        while (p < end && is_digit(*p)) {
+            if (value < 100000) {
+                value = value * 10 + (*p - '0');
+            }
+            ++p;
+        }
+        if (p == exponent_digits) {
+            return nullptr;
+        }
+        exponent += negative_exponent ? -value : value;
+    }
+
+    // 快速路径：尾数与 10 的幂都能精确表示为 double，一次乘/除即正确舍入
+    if (exact && mantissa <= kMaxExactMantissa && exponent >= -22 && exponent <= 22) {
+        double value = static_cast<double>(mantissa);
+        value = exponent < 0 ? value / kPow10[-exponent] : value * kPow10[exponent];
+        out = negative ? -value : value;
+        return p;
+    }
+
+    char buffer[128];
+    size_t length = static_cast<size_t>(p - begin);
+    if (length < sizeof(buffer)) {
+        std::memcpy(buffer, begin, length);
+        buffer[length] = '\0';
+        out = std::strtod(buffer, nullptr);
+    } else {
+        out = std::strtod(std::string(begin, length).c_str(), nullptr);
+    }
+    return p;
+}
+
+// ==================== JsonTickSchema ====================
+
+JsonTickSchema JsonTickSchema::binance_ticker() {
+    JsonTickSchema schema;
+    schema.bind("s", TickField::kInstrument)
+        .bind("E", TickField::kEventTimeMs)
+        .bind("c", TickField::kLastPrice)
+        .bind("v", TickField::kVolume)
+        .bind("o", TickField::kOpenPrice)
+        .bind("h", TickField::kHighPrice)
+        .bind("l", TickField::kLowPrice)
+        .bind("x", TickField::kPreClosePrice)
+        .bind("b", TickField::kBidPrice1)
+        .bind("B", TickField::kBidVolume1)
+        .bind("a", TickField::kAskPrice1)
+        .bind("A", TickField::kAskVolume1);
+    return schema;
+}
+
+JsonTickSchema JsonTickSchema::binance_book_ticker() {
+    JsonTickSchema schema;
+    schema.bind("s", TickField::kInstrument)
+        .bind("E", TickField::kEventTimeMs)
+        .bind("b", TickField::kBidPrice1)
+        .bind("B", TickField::kBidVolume1)
+        .bind("a", TickField::kAskPrice1)
+        .bind("A", TickField::kAskVolume1);
+    return schema;
+}
+
+JsonTickSchema JsonTickSchema::binance_depth() {
+    JsonTickSchema schema;
+    schema.bind("s", TickField::kInstrument)
+        .bind("E", TickField::kEventTimeMs)
+        .bind("b", TickField::kBidLevels)
+        .bind("a", TickField::kAskLevels)
+        .bind("bids", TickField::kBidLevels)
+        .bind("asks", TickField::kAskLevels);
+    return schema;
+}
+
+// ==================== JsonTickDecoder ====================
+
+JsonTickDecoder::JsonTickDecoder(const JsonTickSchema& schema) : envelope_(schema.envelope) {
+    for (auto& field : single_) {
+        field = TickField::kIgnore;
+    }
+    for (const auto& binding : schema.fields) {
+        if (binding.first.size() == 1) {
+            single_[static_cast<uint8_t>(binding.first[0])] = binding.second;
+            continue;
+        }
+        Key key;
+        key.prefix = key_prefix(binding.first.data(), binding.first.size());
+        key.length = static_cast<uint32_t>(binding.first.size());
+        key.field = binding.second;
+        key.text = binding.first;
+        keys_.push_back(std::move(key));
+    }
+}
+
+TickField JsonTickDecoder::lookup(const char* key, size_t length) const {
+    if (length == 1) {
+        return single_[static_cast<uint8_t>(key[0])];
+    }
+    uint64_t prefix = key_prefix(key, length);
+    for (const auto& candidate : keys_) {
+        if (candidate.length == length && candidate.prefix == prefix &&
+            (length <= sizeof(prefix) || std::memcmp(candidate.text.data(), key, length) == 0)) {
+            return candidate.field;
+        }
+    }
+    return TickField::kIgnore;
+}
+
+DecodeStatus JsonTickDecoder::decode(const char* data, size_t size, data_types::TickData& out) const {
+    const char* end = data + size;
+    bool has_instrument = false;
+    const char* p = decode_object(skip_ws(data, end), end, true, has_instrument, out);
+    if (p == nullptr || skip_ws(p, end) != end) {
+        return DecodeStatus::kMalformed;
+    }
+    return has_instrument ? DecodeStatus::kOk : DecodeStatus::kMissingField;
+}
+
+const char* JsonTickDecoder::decode_object(const char* p, const char* end, bool top, bool& has_instrument,
+                                           data_types::TickData& out) const {
+    if (p >= end || *p != '{') {
+        return nullptr;
+    }
+    p = skip_ws(p + 1, end);
+    if (p < end && *p == '}') {
+        return p + 1;
+    }
+    for (;;) {
+        if (p >= end || *p != '"') {
+            return nullptr;
+        }
+        const char* key = p + 1;
+        const char* key_end = find_string_end(key, end);
+        if (key_end == nullptr) {
+            return nullptr;
+        }
+        size_t key_length = static_cast<size_t>(key_end - key);
+        p = skip_ws(key_end + 1, end);
+        if (p >= end || *p != ':') {
+            return nullptr;
+        }
+        p = skip_ws(p + 1, end);
+
+        if (top && !envelope_.empty() && key_length == envelope_.size() &&
+            std::memcmp(key, envelope_.data(), key_length) == 0) {
+            p = decode_object(p, end, false, has_instrument, out);
+        } else {
+            TickField field = (top && !envelope_.empty()) ? TickField::kIgnore : lookup(key, key_length);
+            double number = 0.0;
+            bool present = false;
+            switch (field) {
+                case TickField::kIgnore:
+                    p = skip_value(p, end);
+                    break;
+                case TickField::kInstrument: {
+                    if (p >= end || *p != '"') {
+                        return nullptr;
+                    }
+                    const char* close = find_string_end(p + 1, end);
+                    if (close == nullptr) {
+                        return nullptr;
+                    }
+                    out.instrument.assign(p + 1, static_cast<size_t>(close - p - 1));
+                    has_instrument = true;
+                    p = close + 1;
+                    break;
+                }
+                case TickField::kBidLevels:
+                    p = parse_levels(p, end, out.bid_price, out.bid_volume);
+                    break;
+                case TickField::kAskLevels:
+                    p = parse_levels(p, end, out.ask_price, out.ask_volume);
+                    break;
+                default:
+                    p = parse_number_value(p, end, number, present);
+                    if (p == nullptr || !present) {
+                        break;
+                    }
+                    switch (field) {
+                        case TickField::kEventTimeMs:
+                            out.timestamp = time_from_ms(number);
+                            break;
+                        case TickField::kLastPrice:
+                            out.last_price = number;
+                            break;
+                        case TickField::kVolume:
+                            out.volume = saturate<int64_t>(number);
+                            break;
+                        case TickField::kOpenInterest:
+                            out.open_interest = number;
+                            break;
+                        case TickField::kOpenPrice:
+                            out.open_price = number;
+                            break;
+                        case TickField::kHighPrice:
+                            out.high_price = number;
+                            break;
+                        case TickField::kLowPrice:
+                            out.low_price = number;
+                            break;
+                        case TickField::kPreClosePrice:
+                            out.pre_close_price = number;
+                            break;
+                        case TickField::kBidPrice1:
+                            out.bid_price[0] = number;
+                            break;
+                        case TickField::kBidVolume1:
+                            out.bid_volume[0] = saturate<int32_t>(number);
+                            break;
+                        case TickField::kAskPrice1:
+                            out.ask_price[0] = number;
+                            break;
+                        case TickField::kAskVolume1:
+                            out.ask_volume[0] = saturate<int32_t>(number);
+                            break;
+                        default:
+                            break;
+                    }
+                    break;
+            }
+        }
+        if (p == nullptr) {
+            return nullptr;
+        }
+        p = skip_ws(p, end);
+        if (p < end && *p == ',') {
+            p = skip_ws(p + 1, end);
+            continue;
+        }
+        if (p < end && *p == '}') {
+            return p + 1;
+        }
+        return nullptr;
+    }
+}
+
+// ==================== CtpTickDecoder ====================
+
+DecodeStatus CtpTickDecoder::decode(const char* data, size_t size, data_types::TickData& out) const {
+    if (size != sizeof(CtpDepthMarketData)) {
+        return DecodeStatus::kBadSize;
+    }
+    CtpDepthMarketData field;
+    std::memcpy(&field, data, sizeof(field));      // raw_data 不保证对齐
+    return decode(field, out);
+}
+
+DecodeStatus CtpTickDecoder::decode(const CtpDepthMarketData& field, data_types::TickData& out) const {
+    size_t instrument_length = strnlen(field.InstrumentID, sizeof(field.InstrumentID));
+    if (instrument_length == 0) {
+        return DecodeStatus::kMissingField;
+    }
+
+    // 行情时间 = ActionDay（夜盘为自然日；为空时退回 TradingDay）+ UpdateTime + UpdateMillisec
+    const char* day = field.ActionDay[0] != '\0' ? field.ActionDay : field.TradingDay;
+    int year = 0;
+    int month = 0;
+    int mday = 0;
+    int hour = 0;
+    int minute = 0;
+    int second = 0;
+    const char* time = field.UpdateTime;
+    if (!parse_digits(day, 4, year) || !parse_digits(day + 4, 2, month) || !parse_digits(day + 6, 2, mday) ||
+        !parse_digits(time, 2, hour) || time[2] != ':' || !parse_digits(time + 3, 2, minute) || time[5] != ':' ||
+        !parse_digits(time + 6, 2, second) || month < 1 || month > 12 || mday < 1 || mday > 31 || hour > 23 ||
+        minute > 59 || second > 60 || field.UpdateMillisec < 0 || field.UpdateMillisec > 999) {
+        return DecodeStatus::kMalformed;
+    }
+    int64_t epoch_seconds = days_from_civil(year, month, mday) * 86400 + hour * 3600 + minute * 60 + second -
+                            options_.utc_offset_seconds;
+    out.timestamp = std::chrono::system_clock::time_point(
+        std::chrono::duration_cast<std::chrono::system_clock::duration>(
+            std::chrono::milliseconds(epoch_seconds * 1000 + field.UpdateMillisec)));
+
+    out.instrument.assign(field.InstrumentID, instrument_length);
+    out.last_price = ctp_price(field.LastPrice);
+    out.volume = field.Volume;
+    out.open_interest = ctp_price(field.OpenInterest);
+    out.open_price = ctp_price(field.OpenPrice);
+    out.high_price = ctp_price(field.HighestPrice);
+    out.low_price = ctp_price(field.LowestPrice);
+    out.pre_close_price = ctp_price(field.PreClosePrice);
+
+    out.bid_price[0] = ctp_price(field.BidPrice1);
+    out.bid_price[1] = ctp_price(field.BidPrice2);
+    out.bid_price[2] = ctp_price(field.BidPrice3);
+    out.bid_price[3] = ctp_price(field.BidPrice4);
+    out.bid_price[4] = ctp_price(field.BidPrice5);
+    out.bid_volume[0] = field.BidVolume1;
+    out.bid_volume[1] = field.BidVolume2;
+    out.bid_volume[2] = field.BidVolume3;
+    out.bid_volume[3] = field.BidVolume4;
+    out.bid_volume[4] = field.BidVolume5;
+    out.ask_price[0] = ctp_price(field.AskPrice1);
+    out.ask_price[1] = ctp_price(field.AskPrice2);
+    out.ask_price[2] = ctp_price(field.AskPrice3);
+    out.ask_price[3] = ctp_price(field.AskPrice4);
+    out.ask_price[4] = ctp_price(field.AskPrice5);
+    out.ask_volume[0] = field.AskVolume1;
+    out.ask_volume[1] = field.AskVolume2;
+    out.ask_volume[2] = field.AskVolume3;
+    out.ask_volume[3] = field.AskVolume4;
+    out.ask_volume[4] = field.AskVolume5;
+    return DecodeStatus::kOk;
+}
+
+}  // namespace tick_decoder
+}  // namespace utils
+}  // namespace base
+}  // namespace quant
@@ -0,0 +1,179 @@
+#ifndef BASE_UTILS_TICK_DECODER_TICK_DECODER_H_
+#define BASE_UTILS_TICK_DECODER_TICK_DECODER_H_
+
+#include <cstddef>        // 用于 size_t
+#include <cstdint>        // 用于 uint64_t
+#include <string>
+#include <type_traits>    // 用于 is_trivially_copyable
+#include <utility>        // 用于 std::pair
+#include <vector>
+#include "data_types/tick_data.h"
+
+namespace quant {
+namespace base {
+namespace utils {
+namespace tick_decoder {
+
+// 数据源插件的行情解码层：把 RawTickData::raw_data 直接解码进 TickData，不构建中间 DOM
+// - JSON：按模式只解析关心的字段，其余值借助 SIMD 扫描（SSE2）跳过
+// - 二进制：CTP 风格的定长结构体，校验长度后逐字段映射
+// - 解码器构造后只读，多个线程可共享同一个解码器
+enum class DecodeStatus {
+    kOk,
+    kMalformed,         // 帧不完整或语法错误
+    kMissingField,      // 缺少必需字段（合约代码）
+    kBadSize,           // 二进制帧长度与结构体不符
+};
+
+const char* to_string(DecodeStatus status);
+
+// 解析十进制数（JSON number 语法，前导零宽松处理），成功返回数字之后的位置，失败返回 nullptr
+// 尾数不超过 2^53 且十进制指数在 ±22 以内时直接计算（结果与 strtod 一致），否则回退到 strtod
+const char* parse_decimal(const char* begin, const char* end, double& out);
+
+// ==================== JSON ====================
+
+// 模式中可绑定的 TickData 字段
+enum class TickField : uint8_t {
+    kIgnore,
+    kInstrument,        // 字符串
+    kEventTimeMs,       // Unix 纪元毫秒
+    kLastPrice,
+    kVolume,            // 小数部分截断
+    kOpenInterest,
+    kOpenPrice,
+    kHighPrice,
+    kLowPrice,
+    kPreClosePrice,
+    kBidPrice1,
+    kBidVolume1,
+    kAskPrice1,
+    kAskVolume1,
+    kBidLevels,         // [[价, 量], ...]，最多取五档，不足五档的其余档位清零
+    kAskLevels,
+};
+
+// 行情 JSON 模式：键到字段的绑定。数值既可以是 JSON number，也可以是带引号的数字字符串
+struct JsonTickSchema {
+    std::string envelope;       // 组合流外层对象中行情所在的键（如 "data"），为空表示帧本身即行情对象
+    std::vector<std::pair<std::string, TickField>> fields;
+
+    JsonTickSchema& bind(const std::string& key, TickField field) {
+        fields.emplace_back(key, field);
+        return *this;
+    }
+
+    // Binance 预置模式
+    static JsonTickSchema binance_ticker();        // 24hrTicker
+    static JsonTickSchema binance_book_ticker();   // bookTicker（最优买卖一档）
+    static JsonTickSchema binance_depth();         // depthUpdate / 有限档深度
+};
+
+class JsonTickDecoder {
+public:
+    explicit JsonTickDecoder(const JsonTickSchema& schema);
+
+    // 解码一帧：只覆盖模式中出现的字段，其余字段保持不变（便于把增量叠加到上一笔快照上）
+    DecodeStatus decode(const char* data, size_t size, data_types::TickData& out) const;
+    DecodeStatus decode(const std::string& frame, data_types::TickData& out) const {
+        return decode(frame.data(), frame.size(), out);
+    }
+
+private:
+    struct Key {
+        uint64_t prefix;        // 键的前 8 字节（不足补零），短键一次比较即可
+        uint32_t length;
+        TickField field;
+        std::string text;
+    };
+
+    TickField lookup(const char* key, size_t length) const;
+    const char* decode_object(const char* p, const char* end, bool top, bool& has_instrument,
+                              data_types::TickData& out) const;
+
+    std::string envelope_;
+    TickField single_[256];         // 单字符键直接查表（交易所推送多用单字符键）
+    std::vector<Key> keys_;         // 其余键
+};
+
+// ==================== CTP 二进制 ====================
+
+// 与 CTP 行情回报 CThostFtdcDepthMarketDataField（6.3.x 布局，自然对齐）一致，
+// 数据源插件可直接把回调中的结构体按字节放进 RawTickData::raw_data；字段名沿用 CTP
+struct CtpDepthMarketData {
+    char TradingDay[9];
+    char InstrumentID[31];
+    char ExchangeID[9];
+    char ExchangeInstID[31];
+    double LastPrice;
+    double PreSettlementPrice;
+    double PreClosePrice;
+    double PreOpenInterest;
+    double OpenPrice;
+    double HighestPrice;
+    double LowestPrice;
+    int32_t Volume;
+    double Turnover;
+    double OpenInterest;
+    double ClosePrice;
+    double SettlementPrice;
+    double UpperLimitPrice;
+    double LowerLimitPrice;
+    double PreDelta;
+    double CurrDelta;
+    char UpdateTime[9];
+    int32_t UpdateMillisec;
+    double BidPrice1;
+    int32_t BidVolume1;
+    double AskPrice1;
+    int32_t AskVolume1;
+    double BidPrice2;
+    int32_t BidVolume2;
+    double AskPrice2;
+    int32_t AskVolume2;
+    double BidPrice3;
+    int32_t BidVolume3;
+    double AskPrice3;
+    int32_t AskVolume3;
+    double BidPrice4;
+    int32_t BidVolume4;
+    double AskPrice4;
+    int32_t AskVolume4;
+    double BidPrice5;
+    int32_t BidVolume5;
+    double AskPrice5;
+    int32_t AskVolume5;
+    double AveragePrice;
+    char ActionDay[9];
+};
+
+static_assert(std::is_trivially_copyable<CtpDepthMarketData>::value, "CTP frame must be trivially copyable");
+
+class CtpTickDecoder {
+public:
+    struct Options {
+        int32_t utc_offset_seconds = 8 * 3600;     // 交易所本地时间相对 UTC 的偏移（国内期货为东八区）
+    };
+
+    CtpTickDecoder() : CtpTickDecoder(Options{}) {}
+    explicit CtpTickDecoder(const Options& options) : options_(options) {}
+
+    // 解码一帧：长度必须等于 sizeof(CtpDepthMarketData)；CTP 用 DBL_MAX 表示的无效价格置为 0
+    DecodeStatus decode(const char* data, size_t size, data_types::TickData& out) const;
+    DecodeStatus decode(const std::string& frame, data_types::TickData& out) const {
+        return decode(frame.data(), frame.size(), out);
+    }
+
+    // 直接解码结构体（插件在回调线程内就地解码时使用）
+    DecodeStatus decode(const CtpDepthMarketData& field, data_types::TickData& out) const;
+
+private:
+    Options options_;
+};
+
+}  // namespace tick_decoder
+}  // namespace utils
+}  // namespace base
+}  // namespace quant
+
+#endif  // BASE_UTILS_TICK_DECODER_TICK_DECODER_H_
@@ -0,0 +1,241 @@
+#include "tsc_clock.h"
+
+#include <algorithm>
+#include <cmath>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>        // __get_cpuid
+#endif
+
+
+namespace quant {
+namespace base {
+namespace utils {
+namespace tsc_clock {
+
+namespace {
+
+constexpr double kMaxRateDrift = 1e-3;          // 两次频率估计的最大相对偏差，超出视为 TSC 不稳定
+constexpr double kMaxSlew = 5e-4;               // 平滑对齐时频率的最大调整幅度（500ppm）
+constexpr int64_t kMaxSlewOffsetNs = 1000000;   // 偏差超过 1ms 时直接对齐，不做平滑
+constexpr int kSampleAttempts = 8;
+
+// 一组同时刻的 (TSC, CLOCK_REALTIME) 读数
+struct ClockSample {
+    uint64_t tsc;
+    int64_t ns;
+};
+
+// 标定状态（仅由持有 mutex 的写者访问）
+struct CalibrationState {
+    std::mutex mutex;
+    bool calibrated = false;
+    ClockSample anchor{0, 0};           // 初次标定的起点，作为长基线频率估计的基准
+    ClockSample last{0, 0};             // 上次对齐时刻
+
+    std::mutex thread_mutex;
+    std::condition_variable thread_cv;
+    std::thread thread;
+    bool thread_running = false;
+
+    ~CalibrationState() {
+        {
+            std::lock_guard<std::mutex> lock(thread_mutex);
+            thread_running = false;
+        }
+        thread_cv.notify_all();
+        if (thread.joinable()) {
+            thread.join();
+        }
+    }
+};
+
+CalibrationState& calibration_state() {
+    static CalibrationState state;
+    return state;
+}
+
+// 取夹在两次 rdtsc 之间耗时最短的一次 clock_gettime，TSC 取两端的中点
+ClockSample take_sample() {
+    ClockSample best{0, 0};
+    uint64_t best_window = UINT64_MAX;
+    for (int i = 0; i < kSampleAttempts; ++i) {
+        uint64_t before = TscClock::rdtsc();
+        int64_t ns = TscClock::realtime_ns();
+        uint64_t after = TscClock::rdtsc();
+        if (after >= before && after - before < best_window) {
+            best_window = after - before;
+            best.tsc = before + (after - before) / 2;
+            best.ns = ns;
+        }
+    }
+    return best;
+}
+
+double rate_between(const ClockSample& from, const ClockSample& to) {
+    if (to.ns <= from.ns || to.tsc <= from.tsc) {
+        return 0.0;
+    }
+    return static_cast<double>(to.tsc - from.tsc) / static_cast<double>(to.ns - from.ns);
+}
+
+uint64_t mult_for(double ns_per_tick) {
+    return static_cast<uint64_t>(std::llround(ns_per_tick * static_cast<double>(uint64_t(1) << TscCalibration::kShift)));
+}
+
+TscCalibration make_calibration(const ClockSample& base, double ticks_per_ns, double ns_per_tick, bool enabled) {
+    TscCalibration calibration;
+    calibration.tsc_base = base.tsc;
+    calibration.ns_base = base.ns;
+    calibration.mult = mult_for(ns_per_tick);
+    calibration.ticks_per_ns = ticks_per_ns;
+    calibration.enabled = enabled ? 1 : 0;
+    return calibration;
+}
+
+}  // namespace
+
+bool TscClock::invariant_tsc() {
+#if defined(__x86_64__) || defined(__i386__)
+    unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+    if (__get_cpuid(0x80000000, &eax, &ebx, &ecx, &edx) == 0 || eax < 0x80000007) {
+        return false;
+    }
+    if (__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx) == 0) {
+        return false;
+    }
+    return (edx & (1u << 8)) != 0;
+#else
+    return false;
+#endif
+}
+
+bool TscClock::calibrate(std::chrono::milliseconds window) {
+    CalibrationState& cs = calibration_state();
+    std::lock_guard<std::mutex> lock(cs.mutex);
+
+    // 分两段测量频率，两段结果不一致说明 TSC 不稳定（如频率随功耗状态变化）
+    auto half = std::max(window / 2, std::chrono::milliseconds(1));
+    ClockSample start = take_sample();
+    std::this_thread::sleep_for(half);
+    ClockSample middle = take_sample();
+    std::this_thread::sleep_for(half);
+    ClockSample end = take_sample();
+
+    double first = rate_between(start, middle);
+    double second = rate_between(middle, end);
+    double rate = rate_between(start, end);
+    bool stable = first > 0.0 && second > 0.0 && rate > 0.0 &&
+                  std::fabs(first - second) / rate <= kMaxRateDrift;
+#if defined(__x86_64__) || defined(__i386__)
+    bool enabled = stable && invariant_tsc();
+#else
+    bool enabled = false;   // 非 x86 平台计数器即 steady_clock，直接使用 clock_gettime
+#endif
+
+    if (rate <= 0.0) {
+        rate = 1.0;
+    }
+    state().store(make_calibration(end, rate, 1.0 / rate, enabled));
+    cs.calibrated = true;
+    cs.anchor = start;
+    cs.last = end;
+    return enabled;
+}
+
+bool TscClock::recalibrate() {
+    CalibrationState& cs = calibration_state();
+    {
+        std::lock_guard<std::mutex> lock(cs.mutex);
+        if (cs.calibrated) {
+            TscCalibration current = state().load();
+            if (current.enabled == 0) {
+                return false;
+            }
+            ClockSample sample = take_sample();
+
+            // 长基线频率：起点到现在，随运行时间增长越来越精确
+            double rate = rate_between(cs.anchor, sample);
+            if (rate <= 0.0 || std::fabs(rate - current.ticks_per_ns) / rate > kMaxRateDrift) {
+                TscCalibration disabled = current;
+                disabled.enabled = 0;
+                state().store(disabled);
+                return false;
+            }
+
+            int64_t predicted = to_ns(current, sample.tsc);
+            int64_t offset = sample.ns - predicted;
+            int64_t interval = sample.ns - cs.last.ns;
+            if (offset > kMaxSlewOffsetNs || offset < -kMaxSlewOffsetNs || interval <= 0) {
+                // 偏差过大：直接对齐到 CLOCK_REALTIME
+                state().store(make_calibration(sample, rate, 1.0 / rate, true));
+            } else {
+                // 平滑对齐：从预测值连续衔接，并在下一个同等长度的周期内吸收偏差
+                double slew = static_cast<double>(offset) / static_cast<double>(interval);
+                slew = std::min(std::max(slew, -kMaxSlew), kMaxSlew);
+                ClockSample base{sample.tsc, predicted};
+                state().store(make_calibration(base, rate, (1.0 + slew) / rate, true));
+            }
+            cs.last = sample;
+            return true;
+        }
+    }
+    return calibrate();
+}
+
+void TscClock::start_recalibration(std::chrono::milliseconds interval) {
+    stop_recalibration();
+    CalibrationState& cs = calibration_state();
+    std::lock_guard<std::mutex> lock(cs.thread_mutex);
+    cs.thread_running = true;
+    cs.thread = std::thread([&cs, interval]() {
+        std::unique_lock<std::mutex> lock(cs.thread_mutex);
+        while (cs.thread_running) {
+            if (cs.thread_cv.wait_for(lock, interval, [&cs] { return !cs.thread_running; })) {
+                break;
+            }
+            lock.unlock();
+            TscClock::recalibrate();
+            lock.lock();
+        }
+    });
+}
+
+void TscClock::stop_recalibration() {
+    CalibrationState& cs = calibration_state();
+    {
+        std::lock_guard<std::mutex> lock(cs.thread_mutex);
+        cs.thread_running = false;
+    }
+    cs.thread_cv.notify_all();
+    if (cs.thread.joinable()) {
+        cs.thread.join();
+    }
+}
+
+void TscClock::disable() {
+    CalibrationState& cs = calibration_state();
+    std::lock_guard<std::mutex> lock(cs.mutex);
+    TscCalibration current = state().load();
+    current.enabled = 0;
+    state().store(current);
+}
+
+double TscClock::ticks_per_ns() {
+    {
+        std::lock_guard<std::mutex> lock(calibration_state().mutex);
+        if (calibration_state().calibrated) {
+            return state().load().ticks_per_ns;
+        }
+    }
+    calibrate();
+    return state().load().ticks_per_ns;
+}
+
+}  // namespace tsc_clock
+}  // namespace utils
+}  // namespace base
+}  // namespace quant
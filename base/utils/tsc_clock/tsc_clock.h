@@ -0,0 +1,120 @@
+#ifndef BASE_UTILS_TSC_CLOCK_TSC_CLOCK_H_
+#define BASE_UTILS_TSC_CLOCK_TSC_CLOCK_H_
+
+#include <chrono>
+#include <cstdint>
+#include <ctime>          // clock_gettime
+#include "common/seqlock/seqlock.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>    // __rdtsc
+#endif
+
+namespace quant {
+namespace base {
+namespace utils {
+namespace tsc_clock {
+
+// TSC 到 CLOCK_REALTIME 的换算参数：ns = ns_base + ((tsc - tsc_base) * mult) >> kShift
+struct TscCalibration {
+    static constexpr unsigned kShift = 32;
+
+    uint64_t tsc_base = 0;
+    int64_t ns_base = 0;
+    uint64_t mult = 0;              // 每个计数周期的纳秒数（32 位定点小数）
+    double ticks_per_ns = 0.0;      // 标定得到的计数频率（GHz）
+    uint32_t enabled = 0;           // 0 表示未标定或 TSC 不可靠，now_ns() 退化为 clock_gettime
+};
+
+// 基于不变 TSC（invariant TSC）的快速墙钟
+// - now_ns()：一次 rdtsc + 一次乘法/移位，结果为 Unix 纪元起的纳秒数，与 CLOCK_REALTIME 对齐
+// - 启动时调用 calibrate() 标定；此后 recalibrate()（或 start_recalibration() 后台线程）定期对齐：
+//   小偏差通过微调频率在下一个周期内平滑吸收（时间不回退），偏差过大（如 NTP 跳变）时直接对齐
+// - CPU 不支持不变 TSC，或标定发现频率不稳定时自动停用 TSC，now_ns() 退化为 clock_gettime
+// - 满足标准库 Clock 要求，time_point 即 std::chrono::system_clock::time_point，
+//   可直接用于 TickData/订单的 system_clock 时间戳
+class TscClock {
+public:
+    using duration = std::chrono::nanoseconds;
+    using rep = duration::rep;
+    using period = duration::period;
+    using time_point = std::chrono::time_point<std::chrono::system_clock, duration>;
+    static constexpr bool is_steady = false;
+
+    static time_point now() noexcept { return time_point(duration(now_ns())); }
+
+    // Unix 纪元起的纳秒数（热路径）
+    static int64_t now_ns() noexcept {
+        TscCalibration calibration = state().load();
+        if (calibration.enabled == 0) {
+            return realtime_ns();
+        }
+        return to_ns(calibration, rdtsc());
+    }
+
+    // 原始计数器（x86 为 rdtsc，其他平台为 steady_clock 纳秒）
+    static uint64_t rdtsc() noexcept {
+#if defined(__x86_64__) || defined(__i386__)
+        return __rdtsc();
+#else
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+    }
+
+    // CLOCK_REALTIME（回退路径与标定基准）
+    static int64_t realtime_ns() noexcept {
+        timespec ts;
+        clock_gettime(CLOCK_REALTIME, &ts);
+        return static_cast<int64_t>(ts.tv_sec) * 1000000000LL + ts.tv_nsec;
+    }
+
+    // 按给定参数把计数器值换算为纳秒
+    static int64_t to_ns(const TscCalibration& calibration, uint64_t tsc) noexcept {
+        __extension__ typedef __int128 int128_t;
+        int128_t delta = static_cast<int128_t>(tsc) - static_cast<int128_t>(calibration.tsc_base);
+        return calibration.ns_base +
+               static_cast<int64_t>((delta * static_cast<int128_t>(calibration.mult)) >> TscCalibration::kShift);
+    }
+
+
+    // 1. 标定（冷路径）
+    // 初次标定：在 window 时长内测量 TSC 频率并对齐 CLOCK_REALTIME；返回是否启用 TSC
+    static bool calibrate(std::chrono::milliseconds window = std::chrono::milliseconds(20));
+
+    // 周期性对齐：以初次标定为起点的长基线重新估计频率，并把当前偏差分摊到下一个周期；
+    // 尚未标定时等同于 calibrate()。频率变化超出容限时停用 TSC，返回 false
+    static bool recalibrate();
+
+    // 后台线程按 interval 周期调用 recalibrate()
+    static void start_recalibration(std::chrono::milliseconds interval = std::chrono::seconds(1));
+    static void stop_recalibration();
+
+    // 强制停用 TSC（回退到 clock_gettime），直到下次 calibrate()
+    static void disable();
+
+
+    // 2. 查询
+    static bool enabled() { return state().load().enabled != 0; }
+    static TscCalibration calibration() { return state().load(); }
+
+    // 标定得到的计数频率（每纳秒计数周期数）；尚未标定时先执行一次 calibrate()
+    static double ticks_per_ns();
+
+    // CPU 是否声明不变 TSC（CPUID 0x80000007 EDX bit 8）
+    static bool invariant_tsc();
+
+private:
+    // 换算参数以顺序锁发布：单写者（标定）更新，热路径读者无锁读取一致的快照
+    static common::seqlock::SeqLock<TscCalibration>& state() {
+        static common::seqlock::SeqLock<TscCalibration> calibration;
+        return calibration;
+    }
+};
+
+}  // namespace tsc_clock
+}  // namespace utils
+}  // namespace base
+}  // namespace quant
+
+#endif  // BASE_UTILS_TSC_CLOCK_TSC_CLOCK_H_
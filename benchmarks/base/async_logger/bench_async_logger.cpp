@@ -0,0 +1,91 @@
+#include <benchmark/benchmark.h>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <string>
+#include "utils/async_logger/async_logger.h"
+
+using namespace quant::base::utils::async_logger;
+
+namespace {
+
+const LogSite kIntSite{LogLevel::kInfo, __FILE__, __LINE__, "tick seq {}"};
+const LogSite kMixedSite{LogLevel::kInfo, __FILE__, __LINE__, "order {} {} px={} qty={} buy={} tag={}"};
+
+// 输出端丢弃结果：只衡量写线程上的采集开销（后台线程仍照常读空环）
+AsyncLogger& bench_logger() {
+    static AsyncLogger* logger = []() {
+        AsyncLogger::Options options;
+        options.ring_bytes = 16 << 20;
+        auto* created = new AsyncLogger(options);
+        created->set_sink(nullptr);
+        return created;
+    }();
+    return *logger;
+}
+
+} // namespace
+
+// 热路径：单个整数参数
+static void BM_AsyncLogInt(benchmark::State& state) {
+    AsyncLogger& logger = bench_logger();
+    static const uint32_t site = register_site(&kIntSite);
+    uint64_t dropped_before = logger.dropped();
+    int64_t seq = 0;
+    for (auto _ : state) {
+        logger.log(site, kIntSite.format, seq++);
+    }
+    state.counters["dropped"] = static_cast<double>(logger.dropped() - dropped_before);
+}
+BENCHMARK(BM_AsyncLogInt);
+
+// 热路径：典型下单日志（字符串 + 浮点 + 整数 + 布尔）
+static void BM_AsyncLogMixed(benchmark::State& state) {
+    AsyncLogger& logger = bench_logger();
+    static const uint32_t site = register_site(&kMixedSite);
+    std::string instrument = "rb2410";
+    uint64_t dropped_before = logger.dropped();
+    int64_t seq = 0;
+    for (auto _ : state) {
+        logger.log(site, kMixedSite.format, seq++, instrument, 3500.5, 10, true, "ioc");
+    }
+    state.counters["dropped"] = static_cast<double>(logger.dropped() - dropped_before);
+}
+BENCHMARK(BM_AsyncLogMixed);
+
+// 级别未开启：宏只做一次级别判断
+static void BM_AsyncLogFiltered(benchmark::State& state) {
+    AsyncLogger::instance().set_level(LogLevel::kWarn);
+    int64_t seq = 0;
+    for (auto _ : state) {
+        QT_LOG_DEBUG("tick seq {}", seq++);
+    }
+    AsyncLogger::instance().set_level(LogLevel::kInfo);
+}
+BENCHMARK(BM_AsyncLogFiltered);
+
+// 对照：在写线程上直接格式化（同样的参数，不含 I/O）
+static void BM_SnprintfFormat(benchmark::State& state) {
+    std::string instrument = "rb2410";
+    char buffer[256];
+    int64_t seq = 0;
+    for (auto _ : state) {
+        int n = std::snprintf(buffer, sizeof(buffer), "order %lld %s px=%.10g qty=%d buy=%s tag=%s",
+                              static_cast<long long>(seq++), instrument.c_str(), 3500.5, 10, "true", "ioc");
+        benchmark::DoNotOptimize(n);
+        benchmark::DoNotOptimize(buffer);
+    }
+}
+BENCHMARK(BM_SnprintfFormat);
+
+// 对照：现有写法 std::cerr << ... << std::endl（输出到 /dev/null，含格式化与每行刷新）
+static void BM_OstreamLog(benchmark::State& state) {
+    std::ofstream out("/dev/null");
+    std::string instrument = "rb2410";
+    int64_t seq = 0;
+    for (auto _ : state) {
+        out << "order " << seq++ << ' ' << instrument << " px=" << 3500.5 << " qty=" << 10
+            << " buy=" << true << " tag=ioc" << std::endl;
+    }
+}
+BENCHMARK(BM_OstreamLog);
@@ -0,0 +1,89 @@
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "data_types/tick_data.h"
+
+using namespace quant::base::data_types;
+
+namespace {
+
+TickData make_tick(const std::string& instrument, double price) {
+    TickData tick{};
+    tick.instrument = instrument;
+    tick.timestamp = std::chrono::system_clock::now();
+    tick.last_price = price;
+    tick.volume = 1000;
+    for (int i = 0; i < 5; ++i) {
+        tick.bid_price[i] = price - i - 1;
+        tick.ask_price[i] = price + i + 1;
+        tick.bid_volume[i] = 10 * (i + 1);
+        tick.ask_volume[i] = 10 * (i + 1);
+    }
+    return tick;
+}
+
+std::vector<std::string> make_instruments(int count) {
+    std::vector<std::string> instruments;
+    instruments.reserve(count);
+    for (int i = 0; i < count; ++i) {
+        // 期货合约代码通常不超过 15 个字符，落在短字符串优化范围内
+        instruments.push_back("rb" + std::to_string(2401 + i));
+    }
+    return instruments;
+}
+
+} // namespace
+
+// TickData 拷贝（EventBus 发布、通道投递、last_ticks_ 更新都会发生）
+static void BM_TickCopy(benchmark::State& state) {
+    TickData source = make_tick("rb2410", 3500.0);
+    TickData target{};
+    for (auto _ : state) {
+        target = source;
+        benchmark::DoNotOptimize(target);
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(sizeof(TickData)));
+}
+BENCHMARK(BM_TickCopy);
+
+// 拷贝构造新对象（投递到队列/事件中）；长合约代码超出短字符串优化，每次拷贝都需要堆分配
+static void BM_TickCopyConstruct(benchmark::State& state) {
+    TickData source = make_tick(state.range(0) == 0 ? "rb2410" : "SHFE.rb2410.continuous.main", 3500.0);
+    for (auto _ : state) {
+        TickData copy(source);
+        benchmark::DoNotOptimize(copy);
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(sizeof(TickData)));
+}
+BENCHMARK(BM_TickCopyConstruct)->ArgName("long_instrument")->Arg(0)->Arg(1);
+
+// MarketDataProcessor::last_ticks_ 的更新路径：数据源 -> 合约 -> 最新行情，两级 unordered_map 按字符串查找后整体赋值
+// range(0) 为合约数量
+static void BM_LastTicksUpdate(benchmark::State& state) {
+    const int count = static_cast<int>(state.range(0));
+    auto instruments = make_instruments(count);
+    std::vector<TickData> ticks;
+    ticks.reserve(count);
+    for (int i = 0; i < count; ++i) {
+        ticks.push_back(make_tick(instruments[i], 3500.0 + i));
+    }
+
+    const std::string data_source = "ctp";
+    std::unordered_map<std::string, std::unordered_map<std::string, TickData>> last_ticks;
+    for (const auto& tick : ticks) {
+        last_ticks[data_source][tick.instrument] = tick;
+    }
+
+    size_t n = 0;
+    for (auto _ : state) {
+        const TickData& tick = ticks[n++ % ticks.size()];
+        last_ticks[data_source][tick.instrument] = tick;
+    }
+    benchmark::DoNotOptimize(last_ticks);
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_LastTicksUpdate)->ArgName("instruments")->Arg(1)->Arg(100)->Arg(2000);
@@ -0,0 +1,97 @@
+#include <benchmark/benchmark.h>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+#include "common/safe_queue/safe_queue.h"
+
+using namespace quant::base::common::safe_queue;
+
+namespace {
+
+// 每轮迭代在生产者与消费者之间传递的元素总数
+constexpr int64_t kItemsPerIteration = 100000;
+
+} // namespace
+
+// 单线程无竞争：一次 push + 一次 pop 的基础开销
+static void BM_SafeQueuePushPop(benchmark::State& state) {
+    SafeQueue<int64_t> queue;
+    int64_t value = 0;
+    for (auto _ : state) {
+        queue.push(value);
+        queue.pop(value);
+        benchmark::DoNotOptimize(value);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SafeQueuePushPop);
+
+// 预填充后批量出队：观察队列积压时 pop 的开销
+static void BM_SafeQueueDrain(benchmark::State& state) {
+    const int64_t depth = state.range(0);
+    SafeQueue<int64_t> queue;
+    int64_t value = 0;
+    for (auto _ : state) {
+        state.PauseTiming();
+        for (int64_t i = 0; i < depth; ++i) {
+            queue.push(i);
+        }
+        state.ResumeTiming();
+        while (queue.pop(value)) {
+            benchmark::DoNotOptimize(value);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * depth);
+}
+BENCHMARK(BM_SafeQueueDrain)->Arg(1024)->Arg(65536);
+
+// 多生产者/多消费者：range(0) 个生产者、range(1) 个消费者共同传递 kItemsPerIteration 个元素
+// 消费者使用非阻塞 pop（与线程池工作线程一致），队列空时让出 CPU
+static void BM_SafeQueueProducersConsumers(benchmark::State& state) {
+    const int producers = static_cast<int>(state.range(0));
+    const int consumers = static_cast<int>(state.range(1));
+    const int64_t per_producer = kItemsPerIteration / producers;
+    const int64_t total = per_producer * producers;
+
+    for (auto _ : state) {
+        SafeQueue<int64_t> queue;
+        std::atomic<int64_t> consumed(0);
+        std::vector<std::thread> threads;
+        threads.reserve(producers + consumers);
+
+        for (int c = 0; c < consumers; ++c) {
+            threads.emplace_back([&]() {
+                int64_t value = 0;
+                while (consumed.load(std::memory_order_relaxed) < total) {
+                    if (queue.pop(value)) {
+                        consumed.fetch_add(1, std::memory_order_relaxed);
+                    } else {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+        for (int p = 0; p < producers; ++p) {
+            threads.emplace_back([&, p]() {
+                for (int64_t i = 0; i < per_producer; ++i) {
+                    queue.push(p * per_producer + i);
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * total);
+}
+BENCHMARK(BM_SafeQueueProducersConsumers)
+    ->ArgNames({"producers", "consumers"})
+    ->Args({1, 1})
+    ->Args({2, 2})
+    ->Args({4, 4})
+    ->Args({1, 4})
+    ->Args({4, 1})
+    ->Args({8, 8})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
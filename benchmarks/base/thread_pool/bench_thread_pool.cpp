@@ -0,0 +1,96 @@
+#include <benchmark/benchmark.h>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <future>
+#include <vector>
+#include "common/thread_pool/thread_pool.h"
+
+using namespace quant::base::common::thread_pool;
+
+namespace {
+
+// 每轮迭代提交的任务数
+constexpr int kTasksPerIteration = 10000;
+
+} // namespace
+
+// 提交吞吐：连续提交 kTasksPerIteration 个空任务并等待全部完成；range(0) 为工作线程数
+static void BM_ThreadPoolSubmitThroughput(benchmark::State& state) {
+    auto pool = ThreadPool::create(static_cast<size_t>(state.range(0)));
+    std::atomic<int64_t> executed(0);
+    for (auto _ : state) {
+        for (int i = 0; i < kTasksPerIteration; ++i) {
+            pool->submit([&executed]() { executed.fetch_add(1, std::memory_order_relaxed); });
+        }
+        pool->wait_all();
+    }
+    benchmark::DoNotOptimize(executed.load());
+    state.SetItemsProcessed(state.iterations() * kTasksPerIteration);
+}
+BENCHMARK(BM_ThreadPoolSubmitThroughput)
+    ->ArgName("threads")
+    ->Arg(1)->Arg(2)->Arg(4)->Arg(8)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+// 只计提交方开销：submit() 本身（打包任务 + 分配 + 入队）的耗时，不等待执行
+static void BM_ThreadPoolSubmitCost(benchmark::State& state) {
+    auto pool = ThreadPool::create(1);
+    for (auto _ : state) {
+        auto result = pool->submit([]() { return 1; });
+        benchmark::DoNotOptimize(result);
+    }
+    pool->wait_all();
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ThreadPoolSubmitCost);
+
+// 往返延迟：提交一个任务并等待其 future 就绪（提交 -> 工作线程取出 -> 执行 -> 通知）
+static void BM_ThreadPoolRoundTripLatency(benchmark::State& state) {
+    auto pool = ThreadPool::create(static_cast<size_t>(state.range(0)));
+    int64_t sum = 0;
+    for (auto _ : state) {
+        sum += pool->submit([]() { return int64_t(1); }).get();
+    }
+    benchmark::DoNotOptimize(sum);
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ThreadPoolRoundTripLatency)
+    ->ArgName("threads")
+    ->Arg(1)->Arg(4)
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+
+// 混合负载下关键通道的往返延迟：后台通道持续积压（range(0) 个排队任务），测量关键任务提交到完成的耗时
+static void BM_ThreadPoolCriticalLaneUnderLoad(benchmark::State& state) {
+    auto pool = ThreadPool::create(2);
+    TaskOptions background;
+    background.priority = TaskPriority::kBackground;
+    TaskOptions critical;
+    critical.priority = TaskPriority::kCritical;
+    const int64_t backlog = state.range(0);
+    int64_t sum = 0;
+    for (auto _ : state) {
+        state.PauseTiming();
+        for (int64_t i = 0; i < backlog; ++i) {
+            pool->submit_with(background, []() {
+                volatile int spin = 0;
+                for (int k = 0; k < 200; ++k) {
+                    spin = spin + k;
+                }
+            });
+        }
+        state.ResumeTiming();
+        sum += pool->submit_with(critical, []() { return int64_t(1); }).get();
+    }
+    pool->wait_all();
+    benchmark::DoNotOptimize(sum);
+    state.SetItemsProcessed(state.iterations());
+    // 排队延迟（提交到开始执行）：与往返延迟的差值为唤醒提交线程的调度开销
+    state.counters["critical_wait_p99_ns"] = static_cast<double>(pool->lane_stats(TaskPriority::kCritical).wait_p99_ns);
+}
+BENCHMARK(BM_ThreadPoolCriticalLaneUnderLoad)
+    ->ArgName("backlog")
+    ->Arg(0)->Arg(100)->Arg(1000)
+    ->UseRealTime();
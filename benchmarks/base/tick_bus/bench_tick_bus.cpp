@@ -0,0 +1,144 @@
+#include <benchmark/benchmark.h>
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <memory>
+#include <string>
+#include <thread>
+#include "utils/tick_bus/tick_bus.h"
+
+using namespace quant::base::utils::tick_bus;
+
+namespace {
+
+std::string bench_bus_name(const char* tag) {
+    return std::string("/qt_bench_tick_bus_") + tag + "_" + std::to_string(getpid());
+}
+
+quant::base::data_types::TickData make_tick() {
+    quant::base::data_types::TickData tick{};
+    tick.instrument = "rb2410";
+    tick.last_price = 3500.0;
+    for (int i = 0; i < 5; ++i) {
+        tick.bid_price[i] = 3500.0 - i;
+        tick.ask_price[i] = 3501.0 + i;
+        tick.bid_volume[i] = 10 + i;
+        tick.ask_volume[i] = 20 + i;
+    }
+    return tick;
+}
+
+// 等待下一条行情：单核机器上让出 CPU，避免与对端进程互相饿死
+bool wait_next(TickBusReader& reader, BusTick& out) {
+    for (int spin = 0; spin < (1 << 26); ++spin) {
+        if (reader.next(out)) {
+            return true;
+        }
+        if ((spin & 63) == 63) {
+            std::this_thread::yield();
+        }
+    }
+    return false;
+}
+
+} // namespace
+
+// 写端开销：标准化行情转为定长记录并写入共享内存（无读者）
+static void BM_TickBusPublish(benchmark::State& state) {
+    auto publisher = TickBusPublisher::create(bench_bus_name("publish"), 1 << 16);
+    if (!publisher) {
+        state.SkipWithError("create tick bus failed");
+        return;
+    }
+    auto tick = make_tick();
+    int64_t volume = 0;
+    for (auto _ : state) {
+        tick.volume = volume++;
+        benchmark::DoNotOptimize(publisher->publish(tick));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_TickBusPublish);
+
+// 同进程读端开销：拷贝读取一条已发布的行情
+static void BM_TickBusRead(benchmark::State& state) {
+    auto publisher = TickBusPublisher::create(bench_bus_name("read"), 1 << 16);
+    auto reader = publisher ? TickBusReader::open(publisher->name()) : nullptr;
+    if (!reader) {
+        state.SkipWithError("open tick bus failed");
+        return;
+    }
+    auto tick = make_tick();
+    BusTick record;
+    for (auto _ : state) {
+        publisher->publish(tick);
+        benchmark::DoNotOptimize(reader->next(record));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_TickBusRead);
+
+// 跨进程延迟：父进程在 ping 总线上发布，子进程读到后在 pong 总线上回写，
+// 单次往返时间的一半即一跳的发布到读取延迟
+static void BM_TickBusCrossProcessRoundTrip(benchmark::State& state) {
+    auto ping = TickBusPublisher::create(bench_bus_name("ping"), 1024);
+    auto pong = TickBusPublisher::create(bench_bus_name("pong"), 1024);
+    if (!ping || !pong) {
+        state.SkipWithError("create tick bus failed");
+        return;
+    }
+    auto pong_reader = TickBusReader::open(pong->name(), TickBusReader::Start::kLatest);
+    if (!pong_reader) {
+        state.SkipWithError("open pong bus failed");
+        return;
+    }
+
+    pid_t child = fork();
+    if (child < 0) {
+        state.SkipWithError("fork failed");
+        return;
+    }
+    if (child == 0) {
+        // 子进程：只读打开 ping，经 fork 继承的 pong 写端映射原样回写（保留父进程的 publish_ns）
+        auto ping_reader = TickBusReader::open(ping->name(), TickBusReader::Start::kOldest);
+        if (!ping_reader) {
+            _exit(1);
+        }
+        BusTick record;
+        for (;;) {
+            if (!wait_next(*ping_reader, record)) {
+                _exit(0);
+            }
+            if (record.volume < 0) {
+                _exit(0);
+            }
+            pong->publish(record);
+        }
+    }
+
+    auto tick = make_tick();
+    BusTick echo;
+    int64_t seq = 0;
+    int64_t round_trip_ns = 0;
+    for (auto _ : state) {
+        tick.volume = seq++;
+        ping->publish(tick);
+        if (!wait_next(*pong_reader, echo) || echo.volume != tick.volume) {
+            state.SkipWithError("echo lost");
+            break;
+        }
+        round_trip_ns += monotonic_ns() - echo.publish_ns;
+    }
+    tick.volume = -1;
+    ping->publish(tick);
+    int status = 0;
+    if (waitpid(child, &status, 0) != child) {
+        kill(child, SIGKILL);
+    }
+    if (state.iterations() > 0) {
+        double rtt = static_cast<double>(round_trip_ns) / static_cast<double>(state.iterations());
+        state.counters["rtt_ns"] = rtt;
+        state.counters["one_way_ns"] = rtt / 2.0;
+    }
+}
+BENCHMARK(BM_TickBusCrossProcessRoundTrip)->UseRealTime();
@@ -0,0 +1,98 @@
+#include <benchmark/benchmark.h>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include "utils/tick_decoder/tick_decoder.h"
+
+using namespace quant::base::utils::tick_decoder;
+using quant::base::data_types::TickData;
+
+namespace {
+
+const std::string kTickerFrame =
+    R"({"e":"24hrTicker","E":1700000000123,"s":"BTCUSDT","p":"-94.99999800","P":"-95.960","w":"0.0029",)"
+    R"("x":"99.00000000","c":"4.00000200","Q":"10.5","b":"4.00000000","B":"7","a":"4.00000200","A":"11",)"
+    R"("o":"99.00000000","h":"100.00000000","l":"0.10000000","v":"8913.30000000","q":"15.30000000",)"
+    R"("O":0,"C":86400000,"F":0,"L":18150,"n":18151})";
+
+const std::string kDepthFrame =
+    R"({"stream":"btcusdt@depth@100ms","data":{"e":"depthUpdate","E":1700000000000,"T":1700000000001,)"
+    R"("s":"BTCUSDT","U":157,"u":160,"pu":149,)"
+    R"("b":[["37000.10","1.250"],["37000.00","0.500"],["36999.90","3.000"],["36999.80","0.010"],)"
+    R"(["36999.70","7.700"],["36999.60","2.000"],["36999.50","0.300"]],)"
+    R"("a":[["37000.20","0.800"],["37000.30","1.100"],["37000.40","4.000"],["37000.50","0.020"],)"
+    R"(["37000.60","9.900"],["37000.70","0.100"],["37000.80","5.500"]]}})";
+
+std::string make_ctp_frame() {
+    CtpDepthMarketData field;
+    std::memset(&field, 0, sizeof(field));
+    std::strcpy(field.TradingDay, "20240102");
+    std::strcpy(field.ActionDay, "20240102");
+    std::strcpy(field.InstrumentID, "rb2405");
+    std::strcpy(field.UpdateTime, "09:30:01");
+    field.UpdateMillisec = 500;
+    field.LastPrice = 3950.0;
+    field.BidPrice1 = 3949.0;
+    field.AskPrice1 = 3951.0;
+    return std::string(reinterpret_cast<const char*>(&field), sizeof(field));
+}
+
+} // namespace
+
+// Binance 24hrTicker：12 个绑定字段 + 9 个跳过字段
+static void BM_JsonTickerDecode(benchmark::State& state) {
+    JsonTickDecoder decoder(JsonTickSchema::binance_ticker());
+    TickData tick{};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(decoder.decode(kTickerFrame, tick));
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(kTickerFrame.size()));
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_JsonTickerDecode);
+
+// 组合流深度更新：外层对象 + 两侧各七档（取前五档）
+static void BM_JsonDepthDecode(benchmark::State& state) {
+    JsonTickSchema schema = JsonTickSchema::binance_depth();
+    schema.envelope = "data";
+    JsonTickDecoder decoder(schema);
+    TickData tick{};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(decoder.decode(kDepthFrame, tick));
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(kDepthFrame.size()));
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_JsonDepthDecode);
+
+// CTP 定长结构体
+static void BM_CtpDecode(benchmark::State& state) {
+    CtpTickDecoder decoder;
+    std::string frame = make_ctp_frame();
+    TickData tick{};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(decoder.decode(frame, tick));
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(frame.size()));
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_CtpDecode);
+
+// 价格字段解析：快速路径对比 strtod
+static void BM_ParseDecimal(benchmark::State& state) {
+    const std::string text = "37000.10";
+    double value = 0.0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(parse_decimal(text.data(), text.data() + text.size(), value));
+        benchmark::DoNotOptimize(value);
+    }
+}
+BENCHMARK(BM_ParseDecimal);
+
+static void BM_Strtod(benchmark::State& state) {
+    const std::string text = "37000.10";
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(std::strtod(text.c_str(), nullptr));
+    }
+}
+BENCHMARK(BM_Strtod);
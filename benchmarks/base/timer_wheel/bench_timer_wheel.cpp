@@ -0,0 +1,74 @@
+#include <benchmark/benchmark.h>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <vector>
+#include "common/timer_wheel/timer_wheel.h"
+
+using namespace quant::base::common::timer_wheel;
+
+namespace {
+
+using Clock = TimerWheel::Clock;
+
+// 预先挂上 count 个分布在未来 10 分钟内的定时器，模拟大量挂起的撤单超时 / 心跳
+void fill(TimerWheel& wheel, Clock::time_point start, int64_t count) {
+    for (int64_t i = 0; i < count; ++i) {
+        wheel.schedule_at(start + std::chrono::milliseconds(1000 + (i * 7919) % 600000), []() {});
+    }
+}
+
+} // namespace
+
+// schedule + cancel：range(0) 为已挂起的定时器数，O(1) 时开销不随挂起数增长
+static void BM_TimerWheelScheduleCancel(benchmark::State& state) {
+    TimerWheelOptions options;
+    options.initial_capacity = static_cast<size_t>(state.range(0)) + 4096;
+    TimerWheel wheel(options);
+    Clock::time_point start = Clock::now();
+    fill(wheel, start, state.range(0));
+    int64_t i = 0;
+    for (auto _ : state) {
+        TimerId id = wheel.schedule_at(start + std::chrono::milliseconds(500 + (++i % 100000)), []() {});
+        benchmark::DoNotOptimize(wheel.cancel(id));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_TimerWheelScheduleCancel)
+    ->ArgName("outstanding")
+    ->Arg(0)->Arg(10000)->Arg(1000000);
+
+// 对照：有序容器（std::multimap）实现的定时器集合，插入/删除为 O(log n)
+static void BM_MultimapScheduleCancel(benchmark::State& state) {
+    std::multimap<int64_t, std::function<void()>> timers;
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        timers.emplace(1000 + (i * 7919) % 600000, []() {});
+    }
+    int64_t i = 0;
+    for (auto _ : state) {
+        auto it = timers.emplace(500 + (++i % 100000), []() {});
+        timers.erase(it);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_MultimapScheduleCancel)
+    ->ArgName("outstanding")
+    ->Arg(0)->Arg(10000)->Arg(1000000);
+
+// 推进 + 触发：每轮挂上 10000 个 1~1000ms 内到期的定时器，一次推进全部触发
+static void BM_TimerWheelAdvanceFire(benchmark::State& state) {
+    constexpr int kTimers = 10000;
+    TimerWheel wheel;
+    Clock::time_point now = Clock::now();
+    uint64_t fired = 0;
+    for (auto _ : state) {
+        for (int i = 0; i < kTimers; ++i) {
+            wheel.schedule_at(now + std::chrono::milliseconds(1 + i % 1000), [&fired]() { ++fired; });
+        }
+        now += std::chrono::milliseconds(1001);
+        wheel.advance(now);
+    }
+    benchmark::DoNotOptimize(fired);
+    state.SetItemsProcessed(state.iterations() * kTimers);
+}
+BENCHMARK(BM_TimerWheelAdvanceFire)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,49 @@
+#include <benchmark/benchmark.h>
+#include <atomic>
+#include <cstdint>
+#include "core/event_bus/event_bus.h"
+#include "data_types/tick_data.h"
+
+using namespace quant::core::event_bus;
+
+namespace {
+
+// 基准专用事件类型（不与引擎中的订阅者冲突）
+struct BenchTickEvent : public Event {
+    quant::base::data_types::TickData tick{};
+};
+
+std::atomic<int64_t> g_handled(0);
+int g_subscribed = 0;
+
+// EventBus 为单例且不支持退订：各参数按升序注册，只补齐到所需的订阅者数量
+void ensure_handlers(EventBus& bus, int count) {
+    while (g_subscribed < count) {
+        bus.subscribe<BenchTickEvent>([](const BenchTickEvent& event) {
+            g_handled.fetch_add(static_cast<int64_t>(event.tick.volume), std::memory_order_relaxed);
+        });
+        ++g_subscribed;
+    }
+}
+
+} // namespace
+
+// EventBus::publish：一次发布扇出到 range(0) 个订阅者（加锁 + 哈希查找 + 逐个 std::function 调用）
+static void BM_EventBusPublish(benchmark::State& state) {
+    const int handlers = static_cast<int>(state.range(0));
+    EventBus& bus = EventBus::instance();
+    ensure_handlers(bus, handlers);
+
+    BenchTickEvent event;
+    event.tick.instrument = "rb2410";
+    event.tick.volume = 1;
+    for (auto _ : state) {
+        bus.publish(event);
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.counters["handlers"] = handlers;
+    state.counters["time_per_handler"] = benchmark::Counter(
+        static_cast<double>(state.iterations()) * handlers,
+        benchmark::Counter::kIsRate | benchmark::Counter::kInvert);
+}
+BENCHMARK(BM_EventBusPublish)->ArgName("handlers")->Arg(1)->Arg(10)->Arg(100)->Arg(1000);
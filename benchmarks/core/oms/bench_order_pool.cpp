@@ -0,0 +1,99 @@
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include "core/oms/order_pool.h"
+
+using namespace quant::core::oms;
+
+namespace {
+
+// 目标吞吐：10 万笔订单/秒，即每笔订单的完整生命周期预算为 10 微秒
+constexpr double kTargetOrdersPerSecond = 100000.0;
+
+// 预生成交易所订单号（避免把字符串构造计入订单路径）
+std::vector<std::string> make_exchange_ids(size_t count) {
+    std::vector<std::string> ids;
+    ids.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        ids.push_back("EX" + std::to_string(100000000 + i));
+    }
+    return ids;
+}
+
+void report_budget(benchmark::State& state) {
+    state.SetItemsProcessed(state.iterations());
+    // 每笔订单耗时占 10 万笔/秒预算的比例（<1 表示满足目标）
+    state.counters["budget_ratio"] = benchmark::Counter(
+        static_cast<double>(state.iterations()) / kTargetOrdersPerSecond,
+        benchmark::Counter::kIsRate | benchmark::Counter::kInvert);
+}
+
+} // namespace
+
+// 订单池路径：创建 -> 绑定交易所订单号 -> 委托回报查找 -> 成交回报查找 -> 释放
+// range(0) 为池中常驻的在途订单数，用于观察高占用下的探测长度
+static void BM_PooledOrderLifecycle(benchmark::State& state) {
+    const size_t live = static_cast<size_t>(state.range(0));
+    const size_t ring = 4096;
+    OrderPool pool(live + ring);
+    auto ids = make_exchange_ids(live + ring);
+
+    for (size_t i = 0; i < live; ++i) {
+        InternalOrderId id = kInvalidOrderId;
+        pool.create(id)->instrument = "rb2410";
+        pool.bind_exchange_id(id, ids[i]);
+    }
+
+    std::vector<InternalOrderId> inflight(ring, kInvalidOrderId);
+    size_t n = 0;
+    for (auto _ : state) {
+        size_t k = n++ % ring;
+        if (inflight[k] != kInvalidOrderId) {
+            pool.release(inflight[k]);
+        }
+        const std::string& exchange_id = ids[live + k];
+        Order* order = pool.create(inflight[k]);
+        order->instrument = "rb2410";
+        order->volume = 1;
+        pool.bind_exchange_id(inflight[k], exchange_id);
+        benchmark::DoNotOptimize(pool.find_by_exchange_id(exchange_id));
+        benchmark::DoNotOptimize(pool.find_by_exchange_id(exchange_id));
+    }
+    report_budget(state);
+}
+BENCHMARK(BM_PooledOrderLifecycle)->Arg(1000)->Arg(100000);
+
+// 对照组：每笔订单 make_shared，按交易所订单号存入 std::unordered_map<std::string, ...>
+static void BM_HeapOrderLifecycle(benchmark::State& state) {
+    const size_t live = static_cast<size_t>(state.range(0));
+    const size_t ring = 4096;
+    std::unordered_map<std::string, std::shared_ptr<Order>> orders;
+    auto ids = make_exchange_ids(live + ring);
+
+    for (size_t i = 0; i < live; ++i) {
+        auto order = std::make_shared<Order>();
+        order->instrument = "rb2410";
+        orders[ids[i]] = order;
+    }
+
+    std::vector<bool> inflight(ring, false);
+    size_t n = 0;
+    for (auto _ : state) {
+        size_t k = n++ % ring;
+        const std::string& exchange_id = ids[live + k];
+        if (inflight[k]) {
+            orders.erase(exchange_id);
+        }
+        auto order = std::make_shared<Order>();
+        order->instrument = "rb2410";
+        order->volume = 1;
+        orders[exchange_id] = order;
+        inflight[k] = true;
+        benchmark::DoNotOptimize(orders.find(exchange_id));
+        benchmark::DoNotOptimize(orders.find(exchange_id));
+    }
+    report_budget(state);
+}
+BENCHMARK(BM_HeapOrderLifecycle)->Arg(1000)->Arg(100000);
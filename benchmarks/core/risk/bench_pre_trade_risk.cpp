@@ -0,0 +1,77 @@
+#include <benchmark/benchmark.h>
+#include <memory>
+#include "core/risk/pre_trade_risk.h"
+
+using namespace quant::core::risk;
+
+namespace {
+
+constexpr uint32_t kAccounts = 16;
+constexpr uint32_t kInstruments = 256;
+
+// 全部规则启用的引擎（多线程基准共享同一实例）
+PreTradeRiskEngine& shared_engine() {
+    static std::unique_ptr<PreTradeRiskEngine> engine = []() {
+        auto created = std::make_unique<PreTradeRiskEngine>(kAccounts, kInstruments);
+        InstrumentRule instrument;
+        instrument.multiplier = 10.0;
+        instrument.tick_size = 1.0;
+        instrument.max_order_volume = 100;
+        instrument.max_order_notional = 1e9;
+        AccountRule account;
+        account.max_outstanding_notional = 1e12;
+        account.orders_per_second = 1e9;
+        account.order_burst = 1e6;
+        for (uint32_t i = 0; i < kInstruments; ++i) {
+            created->set_instrument_rule(i, instrument);
+        }
+        for (uint32_t a = 0; a < kAccounts; ++a) {
+            created->set_account_rule(a, account);
+            for (uint32_t i = 0; i < kInstruments; ++i) {
+                created->set_position_limit(a, i, 1000000, 1000000);
+            }
+        }
+        return created;
+    }();
+    return *engine;
+}
+
+} // namespace
+
+// 完整事前检查 + 撤单释放（一个报单周期），每个线程使用独立的账户
+static void BM_PreTradeCheck(benchmark::State& state) {
+    PreTradeRiskEngine& engine = shared_engine();
+    RiskOrder order;
+    order.account = static_cast<uint32_t>(state.thread_index()) % kAccounts;
+    order.price = 100.0;
+    order.volume = 1;
+    uint32_t n = 0;
+    for (auto _ : state) {
+        order.instrument = n++ % kInstruments;
+        order.is_buy = (n & 1) != 0;
+        order.price = order.is_buy ? 100.0 : 101.0;
+        RiskDecision decision = engine.check(order, n);
+        benchmark::DoNotOptimize(decision);
+        engine.on_order_closed(order, order.volume);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_PreTradeCheck)->Threads(1)->Threads(4)->Threads(8);
+
+// 所有线程争用同一账户同一合约（最坏情况：同一缓存行上的原子操作）
+static void BM_PreTradeCheckContended(benchmark::State& state) {
+    PreTradeRiskEngine& engine = shared_engine();
+    RiskOrder order;
+    order.account = 0;
+    order.instrument = 0;
+    order.price = 100.0;
+    order.volume = 1;
+    int64_t n = 0;
+    for (auto _ : state) {
+        RiskDecision decision = engine.check(order, ++n);
+        benchmark::DoNotOptimize(decision);
+        engine.on_order_closed(order, order.volume);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_PreTradeCheckContended)->Threads(1)->Threads(4)->Threads(8);
@@ -0,0 +1,114 @@
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <vector>
+#include <functional>
+#include "core/strategy/strategy_base.h"
+#include "core/strategy/static_strategy.h"
+
+using namespace quant::core;
+using namespace quant::core::strategy;
+
+namespace {
+
+// 两条路径共用的策略逻辑：指数移动平均 + 简单穿越判断
+struct EmaState {
+    double ema = 0.0;
+    int crosses = 0;
+
+    void update(double price) {
+        double prev = ema;
+        ema = ema * 0.9 + price * 0.1;
+        if ((prev < price) != (ema < price)) {
+            ++crosses;
+        }
+    }
+};
+
+// 虚函数路径：继承 StrategyBase 的插件式策略
+class VirtualEmaStrategy : public StrategyBase {
+public:
+    explicit VirtualEmaStrategy(const StrategyConfig& config) : StrategyBase(config) {}
+    void on_tick(const market_data::TickData& tick) override { state_.update(tick.last_price); }
+    double value() const { return state_.ema; }
+
+private:
+    EmaState state_;
+};
+
+// 静态分发路径：CRTP 策略，模板参数仅用于生成互不相同的类型
+template <int N>
+class StaticEmaStrategy : public StaticStrategy<StaticEmaStrategy<N>> {
+public:
+    void on_tick(const market_data::TickData& tick) { state_.update(tick.last_price); }
+    double value() const { return state_.ema; }
+
+private:
+    EmaState state_;
+};
+
+using StaticEmaList = TypeList<StaticEmaStrategy<0>, StaticEmaStrategy<1>,
+                               StaticEmaStrategy<2>, StaticEmaStrategy<3>>;
+constexpr int kStrategyCount = static_cast<int>(StaticEmaList::size);
+
+market_data::TickData make_tick() {
+    market_data::TickData tick{};
+    tick.instrument = "rb2410";
+    tick.last_price = 3500.0;
+    return tick;
+}
+
+} // namespace
+
+// 现有路径：EventBus 中每个订阅者是一个 std::function，内部再调用虚函数 on_tick
+static void BM_VirtualDispatch(benchmark::State& state) {
+    std::vector<std::shared_ptr<VirtualEmaStrategy>> strategies;
+    std::vector<std::function<void(const market_data::TickData&)>> handlers;
+    for (int i = 0; i < kStrategyCount; ++i) {
+        auto strategy = std::make_shared<VirtualEmaStrategy>(StrategyConfig{});
+        StrategyBase* base = strategy.get();
+        handlers.push_back([base](const market_data::TickData& tick) { base->on_tick(tick); });
+        strategies.push_back(strategy);
+    }
+
+    auto tick = make_tick();
+    for (auto _ : state) {
+        tick.last_price += 0.5;
+        for (const auto& handler : handlers) {
+            handler(tick);
+        }
+    }
+    benchmark::DoNotOptimize(strategies.front()->value());
+    state.SetItemsProcessed(state.iterations() * kStrategyCount);
+}
+BENCHMARK(BM_VirtualDispatch);
+
+// 静态路径：编译期类型列表直接分发，全部可内联
+static void BM_StaticDispatch(benchmark::State& state) {
+    StaticStrategySet<StaticEmaList> strategies;
+
+    auto tick = make_tick();
+    for (auto _ : state) {
+        tick.last_price += 0.5;
+        strategies.on_tick(tick);
+    }
+    benchmark::DoNotOptimize(strategies.get<StaticEmaStrategy<0>>().value());
+    state.SetItemsProcessed(state.iterations() * kStrategyCount);
+}
+BENCHMARK(BM_StaticDispatch);
+
+// 混合路径：静态策略集合通过适配器挂在现有引擎上，仅一次 std::function + 虚调用
+static void BM_AdapterDispatch(benchmark::State& state) {
+    auto adapter = std::make_shared<StaticStrategyAdapter<StaticEmaList>>(StrategyConfig{});
+    StrategyBase* base = adapter.get();
+    std::function<void(const market_data::TickData&)> handler =
+        [base](const market_data::TickData& tick) { base->on_tick(tick); };
+
+    auto tick = make_tick();
+    for (auto _ : state) {
+        tick.last_price += 0.5;
+        handler(tick);
+    }
+    benchmark::DoNotOptimize(adapter->strategies().get<StaticEmaStrategy<0>>().value());
+    state.SetItemsProcessed(state.iterations() * kStrategyCount);
+}
+BENCHMARK(BM_AdapterDispatch);
@@ -0,0 +1,668 @@
+// 全链路录制回放性能回归工具
+// 录制的原始行情经回放数据源（IDataSource 替身）推入：解析 -> EventBus -> 策略执行通道 -> 策略 ->
+// 事前风控 -> 模拟交易所，统计吞吐与行情到下单（tick-to-order）延迟分位数，并与基线对比。
+//
+// 用法：
+//   qt_replay_harness --capture <file> [--speed max|<倍数>] [--loops N] [--lanes N] [--hosts N]
+//                     [--out result.json] [--baseline baseline.json] [--threshold 0.10] [--update-baseline]
+//   qt_replay_harness --generate <ticks> --capture <file> [--instruments N] [--rate <ticks/s>]
+//
+// 录制文件格式见 ReplayDataSource；raw_data 为 "instrument,last,volume,bid1,bid_volume1,ask1,ask_volume1"。
+// 与基线相比吞吐下降、延迟分位数上升超过阈值，或风控拒单率（拒单 / 信号）比基线高出阈值以上
+// （按绝对值比较）时以退出码 1 结束；回放结束后风控在途与交易所挂单对不上账时同样以 1 结束。
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "common/hdr_histogram/hdr_histogram.h"
+#include "utils/tsc_clock/tsc_clock.h"
+#include "core/event_bus/event_bus.h"
+#include "core/risk/pre_trade_risk.h"
+#include "core/strategy/static_strategy.h"
+#include "core/strategy/strategy_lane.h"
+#include "core/trace/tick_trace.h"
+#include "plugins/data_sources/replay/replay_data_source.h"
+#include "plugins/execution_adapters/sim_exchange/sim_exchange_adapter.h"
+
+using quant::base::common::hdr_histogram::HdrHistogram;
+using quant::base::utils::tsc_clock::TscClock;
+using namespace quant::core;
+using namespace quant::plugins;
+
+namespace {
+
+struct Options {
+    std::string capture;
+    std::string speed = "max";
+    size_t loops = 1;
+    size_t lanes = 1;
+    size_t hosts = 2;                   // 策略宿主数（每个宿主含一个动量策略与一个报价策略）
+    std::string out;
+    std::string baseline;
+    double threshold = 0.10;
+    bool update_baseline = false;
+    size_t generate = 0;                // >0 时只生成录制文件
+    size_t instruments = 8;
+    double rate = 20000.0;              // 生成录制文件的行情速率（条/秒）
+};
+
+bool parse_options(int argc, char* argv[], Options& options) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        auto value = [&](const char* name) -> const char* {
+            if (i + 1 >= argc) {
+                std::cerr << "Missing value for " << name << std::endl;
+                return nullptr;
+            }
+            return argv[++i];
+        };
+        const char* v = nullptr;
+        if (arg == "--update-baseline") {
+            options.update_baseline = true;
+            continue;
+        }
+        if ((v = value(arg.c_str())) == nullptr) {
+            return false;
+        }
+        if (arg == "--capture") {
+            options.capture = v;
+        } else if (arg == "--speed") {
+            options.speed = v;
+        } else if (arg == "--loops") {
+            options.loops = std::max<size_t>(1, std::strtoull(v, nullptr, 10));
+        } else if (arg == "--lanes") {
+            options.lanes = std::max<size_t>(1, std::strtoull(v, nullptr, 10));
+        } else if (arg == "--hosts") {
+            options.hosts = std::max<size_t>(1, std::strtoull(v, nullptr, 10));
+        } else if (arg == "--out") {
+            options.out = v;
+        } else if (arg == "--baseline") {
+            options.baseline = v;
+        } else if (arg == "--threshold") {
+            options.threshold = std::strtod(v, nullptr);
+        } else if (arg == "--generate") {
+            options.generate = std::strtoull(v, nullptr, 10);
+        } else if (arg == "--instruments") {
+            options.instruments = std::max<size_t>(1, std::strtoull(v, nullptr, 10));
+        } else if (arg == "--rate") {
+            options.rate = std::strtod(v, nullptr);
+        } else {
+            std::cerr << "Unknown option " << arg << std::endl;
+            return false;
+        }
+    }
+    return !options.capture.empty();
+}
+
+std::string instrument_name(size_t index) {
+    return "rb" + std::to_string(2401 + index);
+}
+
+// 生成合成录制文件：各合约独立随机游走，泊松到达
+bool generate_capture(const Options& options) {
+    data_sources::replay::CaptureWriter writer;
+    if (!writer.open(options.capture)) {
+        std::cerr << "Failed to open " << options.capture << std::endl;
+        return false;
+    }
+    std::mt19937_64 rng(7);
+    std::exponential_distribution<double> gap(options.rate);
+    std::normal_distribution<double> step(0.0, 1.0);
+    std::vector<double> prices(options.instruments, 3500.0);
+    int64_t ns = TscClock::realtime_ns();
+    market_data::RawTickData raw;
+    raw.data_source = "REPLAY";
+    for (size_t i = 0; i < options.generate; ++i) {
+        size_t k = rng() % options.instruments;
+        prices[k] = std::max(100.0, prices[k] + std::round(step(rng)));
+        std::ostringstream line;
+        line << instrument_name(k) << ',' << prices[k] << ',' << (i + 1) << ','
+             << prices[k] - 1 << ',' << 10 + rng() % 50 << ',' << prices[k] + 1 << ',' << 10 + rng() % 50;
+        raw.raw_data = line.str();
+        ns += static_cast<int64_t>(gap(rng) * 1e9);
+        writer.write(raw, ns);
+    }
+    writer.close();
+    std::cout << "Wrote " << writer.written() << " ticks to " << options.capture << std::endl;
+    return true;
+}
+
+// 原始报文解析（MarketDataProcessor::process_raw_tick 的替身），接收时刻记入 timestamp
+bool parse_tick(const market_data::RawTickData& raw, market_data::TickData& tick) {
+    tick.timestamp = TscClock::now();
+    const char* p = raw.raw_data.c_str();
+    const char* comma = std::strchr(p, ',');
+    if (comma == nullptr) {
+        return false;
+    }
+    tick.instrument.assign(p, comma - p);
+    char* end = nullptr;
+    tick.last_price = std::strtod(comma + 1, &end);
+    tick.volume = std::strtoll(end + 1, &end, 10);
+    tick.bid_price[0] = std::strtod(end + 1, &end);
+    tick.bid_volume[0] = static_cast<int32_t>(std::strtol(end + 1, &end, 10));
+    tick.ask_price[0] = std::strtod(end + 1, &end);
+    tick.ask_volume[0] = static_cast<int32_t>(std::strtol(end + 1, &end, 10));
+    return *end == '\0';
+}
+
+// 下单出口：事前风控 + 模拟交易所，并跟踪订单生命周期以释放风控预占。
+// 挂单不会一直留在簿上（否则自成交检查的最优挂价停留在历史高/低位，后续反向报单几乎都被拒绝）：
+// 即时成交单发出后立即撤掉未成交部分；挂单在同一账户同一合约的新单发出后撤掉（撤单重挂）
+class OrderGateway {
+public:
+    OrderGateway(size_t accounts, const std::vector<std::string>& instruments,
+                 std::shared_ptr<execution_adapters::sim_exchange::SimExchangeAdapter> exchange)
+        : risk_(accounts, instruments.size()), exchange_(std::move(exchange)) {
+        for (size_t i = 0; i < instruments.size(); ++i) {
+            instrument_index_[instruments[i]] = static_cast<uint32_t>(i);
+            risk::InstrumentRule rule;
+            rule.tick_size = 1.0;
+            rule.max_order_volume = 100;
+            risk_.set_instrument_rule(static_cast<uint32_t>(i), rule);
+        }
+        exchange_->set_order_callback([this](const oms::Order& order) { on_order(order); });
+        exchange_->set_trade_callback([this](const oms::Trade& trade) { on_trade(trade); });
+    }
+
+    // 返回是否已发出；immediate_or_cancel 为 true 时未立即成交的部分随即撤销
+    bool submit(uint32_t account, const std::string& instrument, double price, int volume, bool is_buy,
+                bool immediate_or_cancel) {
+        auto it = instrument_index_.find(instrument);
+        if (it == instrument_index_.end()) {
+            return false;
+        }
+        risk::RiskOrder risk_order{account, it->second, is_buy, price, volume};
+        if (risk_.check(risk_order) != risk::RiskDecision::kAccepted) {
+            return false;
+        }
+
+        oms::Order order;
+        order.instrument = instrument;
+        order.price = price;
+        order.volume = volume;
+        order.is_buy = is_buy;
+        QT_TRACE_STAGE(trace::TickStage::kSendOrder);
+        ems::ExecutionResult result = exchange_->send_order(order);
+        if (!result.success) {
+            risk_.on_order_closed(risk_order, volume);
+            return false;
+        }
+        requests_sent_.fetch_add(1, std::memory_order_relaxed);
+        track(result.order_id, risk_order);
+        if (immediate_or_cancel) {
+            cancel(result.order_id);   // 同一入站队列保序：撮合后再撤，已全部成交则撤单失败
+        } else {
+            replace_working(risk_order, result.order_id);
+        }
+        return true;
+    }
+
+    const risk::PreTradeRiskEngine& risk() const { return risk_; }
+
+    // 已送入交易所入站队列的请求数（报单 + 撤单）
+    uint64_t requests_sent() const { return requests_sent_.load(std::memory_order_relaxed); }
+
+    // 对账：仍在途的订单数（已登记、未收到终态）与未登记就残留的条目数（回报无法对应到订单）
+    void reconcile(size_t& open, size_t& orphaned) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        open = 0;
+        orphaned = 0;
+        for (const auto& entry : orders_) {
+            ++(entry.second.known ? open : orphaned);
+        }
+    }
+
+private:
+    struct Tracked {
+        risk::RiskOrder order;
+        int64_t remaining = 0;
+        bool known = false;          // 已登记（回报可能先于登记到达）
+        int64_t early_fills = 0;     // 登记前到达的成交量
+        bool early_closed = false;   // 登记前已收到终态
+    };
+
+    // 记录新的在途订单，并撤掉该账户在该合约上的上一笔（已结束则不必撤）
+    void replace_working(const risk::RiskOrder& order, const std::string& order_id) {
+        std::string previous;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            uint64_t key = (static_cast<uint64_t>(order.account) << 32) | order.instrument;
+            std::string& working = working_[key];
+            auto it = orders_.find(working);
+            if (it != orders_.end() && it->second.known) {
+                previous = working;
+            }
+            working = order_id;
+        }
+        if (!previous.empty()) {
+            cancel(previous);   // 撤单确认（volume 0）经 on_order 释放预占
+        }
+    }
+
+    void cancel(const std::string& order_id) {
+        if (exchange_->cancel_order(order_id).success) {
+            requests_sent_.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    void track(const std::string& order_id, const risk::RiskOrder& order) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        Tracked& tracked = orders_[order_id];
+        tracked.order = order;
+        tracked.known = true;
+        tracked.remaining = order.volume - tracked.early_fills;
+        if (tracked.early_fills > 0) {
+            risk_.on_fill(order, tracked.early_fills);
+        }
+        if (tracked.early_closed || tracked.remaining <= 0) {
+            risk_.on_order_closed(order, std::max<int64_t>(tracked.remaining, 0));
+            orders_.erase(order_id);
+        }
+    }
+
+    // 回调在撮合线程上执行，均以交易所订单号（send_order 返回的 "SIM..."）为键；
+    // 交易所先回调成交再回调终态，订单结束后不会再有成交到达
+    void on_trade(const oms::Trade& trade) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        Tracked& tracked = orders_[trade.order_id];
+        if (!tracked.known) {
+            tracked.early_fills += trade.volume;
+            return;
+        }
+        risk_.on_fill(tracked.order, trade.volume);
+        tracked.remaining -= trade.volume;
+    }
+
+    void on_order(const oms::Order& order) {
+        if (order.volume > 0) {
+            return;   // 仍有剩余：挂单继续有效（0 为已结束，负值为拒单）
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = orders_.find(order.order_id);
+        if (it == orders_.end() || !it->second.known) {
+            orders_[order.order_id].early_closed = true;
+            return;
+        }
+        risk_.on_order_closed(it->second.order, std::max<int64_t>(it->second.remaining, 0));
+        orders_.erase(it);
+    }
+
+    risk::PreTradeRiskEngine risk_;
+    std::shared_ptr<execution_adapters::sim_exchange::SimExchangeAdapter> exchange_;
+    std::unordered_map<std::string, uint32_t> instrument_index_;   // 启动后只读
+    std::mutex mutex_;                                             // 保护订单跟踪表（回报路径）
+    std::unordered_map<std::string, Tracked> orders_;              // 交易所订单号 -> 跟踪状态
+    std::unordered_map<uint64_t, std::string> working_;            // (账户, 合约) -> 最近一笔订单
+    std::atomic<uint64_t> requests_sent_{0};
+};
+
+// 动量策略：快慢均线交叉时以对手价下单
+class MomentumStrategy : public strategy::StaticStrategy<MomentumStrategy> {
+public:
+    void on_tick(const market_data::TickData& tick) {
+        State& s = states_[tick.instrument];
+        if (s.fast == 0.0) {
+            s.fast = s.slow = tick.last_price;
+            return;
+        }
+        s.fast = s.fast * 0.7 + tick.last_price * 0.3;
+        s.slow = s.slow * 0.95 + tick.last_price * 0.05;
+        bool above = s.fast > s.slow;
+        if (above != s.above) {
+            s.above = above;
+            send_signal(tick.instrument, above ? tick.ask_price[0] : tick.bid_price[0], 1, above, true);
+        }
+    }
+
+private:
+    struct State {
+        double fast = 0.0;
+        double slow = 0.0;
+        bool above = false;
+    };
+    std::unordered_map<std::string, State> states_;
+};
+
+// 报价策略：每隔固定行情数在买一/卖一交替挂单
+class QuoteStrategy : public strategy::StaticStrategy<QuoteStrategy> {
+public:
+    void on_tick(const market_data::TickData& tick) {
+        if (++ticks_ % kInterval != 0) {
+            return;
+        }
+        buy_ = !buy_;
+        send_signal(tick.instrument, buy_ ? tick.bid_price[0] : tick.ask_price[0], 1, buy_, true);
+    }
+
+private:
+    static constexpr uint64_t kInterval = 4;
+    uint64_t ticks_ = 0;
+    bool buy_ = false;
+};
+
+using HarnessStrategies = strategy::TypeList<MomentumStrategy, QuoteStrategy>;
+
+// 策略宿主：以插件式 StrategyBase 运行在执行通道上，内部静态分发到两个策略，
+// 信号直接进入下单出口并记录 tick-to-order 延迟（只在通道线程上写，单写者直方图）
+class ReplayStrategyHost : public strategy::StrategyBase {
+public:
+    ReplayStrategyHost(uint32_t first_account, OrderGateway& gateway)
+        : StrategyBase(strategy::StrategyConfig{}),
+          gateway_(gateway),
+          momentum_{this, first_account, true},
+          quote_{this, first_account + 1, false},
+          latency_(std::make_unique<HdrHistogram>()) {
+        strategies_.get<MomentumStrategy>().bind_signal_sink(&ReplayStrategyHost::on_signal, &momentum_);
+        strategies_.get<QuoteStrategy>().bind_signal_sink(&ReplayStrategyHost::on_signal, &quote_);
+    }
+
+    void on_tick(const market_data::TickData& tick) override {
+        tick_ns_ = std::chrono::duration_cast<std::chrono::nanoseconds>(tick.timestamp.time_since_epoch()).count();
+        ticks_.fetch_add(1, std::memory_order_relaxed);
+        strategies_.on_tick(tick);
+    }
+
+    const HdrHistogram& latency() const { return *latency_; }
+    uint64_t ticks() const { return ticks_.load(std::memory_order_relaxed); }
+    uint64_t signals() const { return signals_.load(std::memory_order_relaxed); }
+    uint64_t orders() const { return orders_.load(std::memory_order_relaxed); }
+
+private:
+    struct SinkContext {
+        ReplayStrategyHost* host;
+        uint32_t account;
+        bool immediate_or_cancel;   // 动量策略以对手价即时成交，报价策略挂单
+    };
+
+    static void on_signal(void* context, const std::string& instrument, double price, int volume,
+                          bool is_buy, bool /*is_open*/) {
+        auto* sink = static_cast<SinkContext*>(context);
+        ReplayStrategyHost* host = sink->host;
+        host->signals_.fetch_add(1, std::memory_order_relaxed);
+        if (host->gateway_.submit(sink->account, instrument, price, volume, is_buy, sink->immediate_or_cancel)) {
+            host->latency_->record(static_cast<uint64_t>(std::max<int64_t>(TscClock::now_ns() - host->tick_ns_, 0)));
+            host->orders_.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    OrderGateway& gateway_;
+    strategy::StaticStrategySet<HarnessStrategies> strategies_;
+    SinkContext momentum_;
+    SinkContext quote_;
+    std::unique_ptr<HdrHistogram> latency_;
+    int64_t tick_ns_ = 0;
+    std::atomic<uint64_t> ticks_{0};
+    std::atomic<uint64_t> signals_{0};
+    std::atomic<uint64_t> orders_{0};
+};
+
+// 一次回放的结果指标
+struct Metrics {
+    uint64_t ticks = 0;
+    uint64_t signals = 0;
+    uint64_t orders = 0;
+    uint64_t risk_rejects = 0;
+    double risk_reject_ratio = 0.0;     // 风控拒单 / 信号
+    uint64_t ticks_dropped = 0;
+    double elapsed_s = 0.0;
+    double ticks_per_second = 0.0;
+    double p50_ns = 0.0;
+    double p99_ns = 0.0;
+    double p999_ns = 0.0;
+    double max_ns = 0.0;
+};
+
+std::string to_json(const Metrics& m) {
+    std::ostringstream out;
+    out.precision(12);
+    out << "{\n"
+        << "  \"ticks\": " << m.ticks << ",\n"
+        << "  \"signals\": " << m.signals << ",\n"
+        << "  \"orders\": " << m.orders << ",\n"
+        << "  \"risk_rejects\": " << m.risk_rejects << ",\n"
+        << "  \"risk_reject_ratio\": " << m.risk_reject_ratio << ",\n"
+        << "  \"ticks_dropped\": " << m.ticks_dropped << ",\n"
+        << "  \"elapsed_s\": " << m.elapsed_s << ",\n"
+        << "  \"ticks_per_second\": " << m.ticks_per_second << ",\n"
+        << "  \"tick_to_order_p50_ns\": " << m.p50_ns << ",\n"
+        << "  \"tick_to_order_p99_ns\": " << m.p99_ns << ",\n"
+        << "  \"tick_to_order_p999_ns\": " << m.p999_ns << ",\n"
+        << "  \"tick_to_order_max_ns\": " << m.max_ns << "\n"
+        << "}\n";
+    return out.str();
+}
+
+// 从扁平 JSON 中读取数值字段
+bool json_number(const std::string& json, const std::string& key, double& value) {
+    size_t pos = json.find("\"" + key + "\"");
+    if (pos == std::string::npos) {
+        return false;
+    }
+    pos = json.find(':', pos);
+    if (pos == std::string::npos) {
+        return false;
+    }
+    char* end = nullptr;
+    value = std::strtod(json.c_str() + pos + 1, &end);
+    return end != json.c_str() + pos + 1;
+}
+
+// 与基线对比，返回是否出现回退
+bool compare_with_baseline(const Metrics& current, const std::string& baseline_json, double threshold) {
+    struct Check {
+        const char* key;
+        double value;
+        bool higher_is_better;
+    };
+    const Check checks[] = {
+        {"ticks_per_second", current.ticks_per_second, true},
+        {"tick_to_order_p50_ns", current.p50_ns, false},
+        {"tick_to_order_p99_ns", current.p99_ns, false},
+        {"tick_to_order_p999_ns", current.p999_ns, false},
+    };
+    bool regressed = false;
+    for (const auto& check : checks) {
+        double base = 0.0;
+        if (!json_number(baseline_json, check.key, base) || base <= 0.0) {
+            std::cout << "  " << check.key << ": no baseline" << std::endl;
+            continue;
+        }
+        double change = (check.value - base) / base;
+        bool bad = check.higher_is_better ? change < -threshold : change > threshold;
+        regressed = regressed || bad;
+        std::cout << "  " << check.key << ": baseline " << base << ", current " << check.value
+                  << " (" << (change >= 0 ? "+" : "") << change * 100.0 << "%)"
+                  << (bad ? "  REGRESSION" : "") << std::endl;
+    }
+    // 拒单率可能为 0，按绝对差比较
+    double base_ratio = 0.0;
+    if (json_number(baseline_json, "risk_reject_ratio", base_ratio)) {
+        bool bad = current.risk_reject_ratio > base_ratio + threshold;
+        regressed = regressed || bad;
+        std::cout << "  risk_reject_ratio: baseline " << base_ratio << ", current " << current.risk_reject_ratio
+                  << (bad ? "  REGRESSION" : "") << std::endl;
+    } else {
+        std::cout << "  risk_reject_ratio: no baseline" << std::endl;
+    }
+    return regressed;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    Options options;
+    if (!parse_options(argc, argv, options)) {
+        std::cerr << "Usage: " << argv[0] << " --capture <file> [--speed max|<factor>] [--loops N] [--lanes N]"
+                  << " [--hosts N] [--out file] [--baseline file] [--threshold 0.10] [--update-baseline]\n"
+                  << "       " << argv[0] << " --generate <ticks> --capture <file> [--instruments N] [--rate N]"
+                  << std::endl;
+        return 2;
+    }
+    TscClock::calibrate();
+    if (options.generate > 0) {
+        return generate_capture(options) ? 0 : 1;
+    }
+    trace::register_tick_stages();
+
+    // 1. 录制文件中的合约（风控规则按合约预编译）
+    std::vector<data_sources::replay::CaptureRecord> records;
+    std::string error;
+    if (!data_sources::replay::load_capture(options.capture, records, nullptr, &error)) {
+        std::cerr << error << std::endl;
+        return 1;
+    }
+    std::vector<std::string> instruments;
+    {
+        std::unordered_map<std::string, bool> seen;
+        market_data::TickData tick{};
+        for (const auto& record : records) {
+            if (parse_tick(record.tick, tick) && !seen[tick.instrument]) {
+                seen[tick.instrument] = true;
+                instruments.push_back(tick.instrument);
+            }
+        }
+    }
+
+    // 2. 执行路径：模拟交易所 + 事前风控（价格阶梯按合约预分配，上限取 100 万跳，避免首次建簿拖慢撮合线程）
+    auto exchange = std::make_shared<execution_adapters::sim_exchange::SimExchangeAdapter>(
+        std::unordered_map<std::string, std::string>{
+            {"tick_size", "1"}, {"max_price", "1000000"}, {"max_orders", "65536"}});
+    if (!exchange->connect()) {
+        std::cerr << "Failed to start simulated exchange" << std::endl;
+        return 1;
+    }
+    OrderGateway gateway(options.hosts * 2, instruments, exchange);
+
+    // 3. 策略：宿主按轮转分配到执行通道
+    auto lanes = std::make_shared<strategy::LaneDispatcher>();
+    for (size_t i = 0; i < options.lanes; ++i) {
+        strategy::LaneConfig config;
+        config.name = "replay_lane_" + std::to_string(i);
+        lanes->add_lane(config);
+    }
+    std::vector<std::shared_ptr<ReplayStrategyHost>> hosts;
+    for (size_t i = 0; i < options.hosts; ++i) {
+        hosts.push_back(std::make_shared<ReplayStrategyHost>(static_cast<uint32_t>(i * 2), gateway));
+        lanes->assign(hosts.back(), i % options.lanes);
+    }
+
+    // 4. 行情路径：回放数据源 -> 解析 -> EventBus -> 执行通道（与 StrategyEngine 相同的总线订阅）
+    auto& bus = event_bus::EventBus::instance();
+    strategy::subscribe_lanes(bus, lanes);
+
+    data_sources::replay::ReplayDataSource source;
+    if (!source.initialize({{"file", options.capture}, {"speed", options.speed},
+                            {"loops", std::to_string(options.loops)}})) {
+        std::cerr << "Failed to load capture " << options.capture << std::endl;
+        return 1;
+    }
+    event_bus::TickEvent event;
+    source.set_tick_callback([&bus, &event](const market_data::RawTickData& raw) {
+        if (parse_tick(raw, event.tick)) {
+            QT_TRACE_STAGE(trace::TickStage::kProcessRawTick);
+            bus.publish(event);
+        }
+    });
+
+    auto start = std::chrono::steady_clock::now();
+    source.connect();
+    source.wait_finished();
+    // 等待各通道处理完积压的行情
+    for (;;) {
+        size_t depth = 0;
+        for (const auto& stats : lanes->stats()) {
+            depth += stats.queue_depth;
+        }
+        if (depth == 0) {
+            break;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    lanes->stop_all();
+    // 对账：交易所处理完网关发出的全部请求后，网关跟踪的在途订单应与交易所挂单一一对应
+    // （首次建簿要预分配价格阶梯，撮合线程可能明显落后于回放，超时放宽到 30 秒）
+    size_t open_orders = 0;
+    size_t orphaned = 0;
+    size_t resting = 0;
+    auto reconcile_deadline = std::chrono::steady_clock::now() + std::chrono::seconds(30);
+    for (;;) {
+        execution_adapters::sim_exchange::SimExchangeStats stats = exchange->stats();
+        gateway.reconcile(open_orders, orphaned);
+        resting = stats.resting_orders;
+        bool drained = stats.requests >= gateway.requests_sent();
+        if ((drained && open_orders == resting && orphaned == 0) ||
+            std::chrono::steady_clock::now() > reconcile_deadline) {
+            break;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    exchange->disconnect();
+
+    // 5. 汇总
+    Metrics metrics;
+    auto merged = std::make_unique<HdrHistogram>();
+    for (const auto& host : hosts) {
+        merged->merge(host->latency());
+        metrics.signals += host->signals();
+        metrics.orders += host->orders();
+    }
+    for (const auto& stats : lanes->stats()) {
+        metrics.ticks_dropped += stats.ticks_dropped;
+    }
+    for (size_t d = 1; d < risk::kRiskDecisionCount; ++d) {
+        metrics.risk_rejects += gateway.risk().rejected(static_cast<risk::RiskDecision>(d));
+    }
+    metrics.risk_reject_ratio = metrics.signals > 0
+        ? static_cast<double>(metrics.risk_rejects) / static_cast<double>(metrics.signals) : 0.0;
+    metrics.ticks = source.replayed();
+    metrics.elapsed_s = elapsed;
+    metrics.ticks_per_second = elapsed > 0.0 ? static_cast<double>(metrics.ticks) / elapsed : 0.0;
+    metrics.p50_ns = static_cast<double>(merged->percentile(50.0));
+    metrics.p99_ns = static_cast<double>(merged->percentile(99.0));
+    metrics.p999_ns = static_cast<double>(merged->percentile(99.9));
+    metrics.max_ns = static_cast<double>(merged->max());
+
+    std::string json = to_json(metrics);
+    std::cout << json;
+    if (!options.out.empty()) {
+        std::ofstream(options.out) << json;
+    }
+    if (open_orders != resting || orphaned != 0) {
+        std::cerr << "Order tracking out of sync: " << open_orders << " open orders, " << resting
+                  << " resting at the exchange, " << orphaned << " unmatched reports" << std::endl;
+        return 1;
+    }
+    if (options.baseline.empty()) {
+        return 0;
+    }
+    if (options.update_baseline) {
+        std::ofstream(options.baseline) << json;
+        std::cout << "Baseline updated: " << options.baseline << std::endl;
+        return 0;
+    }
+    std::ifstream in(options.baseline);
+    if (!in) {
+        std::cerr << "Baseline " << options.baseline << " not found (run with --update-baseline first)" << std::endl;
+        return 1;
+    }
+    std::stringstream baseline;
+    baseline << in.rdbuf();
+    std::cout << "Comparing against " << options.baseline << " (threshold "
+              << options.threshold * 100.0 << "%)" << std::endl;
+    return compare_with_baseline(metrics, baseline.str(), options.threshold) ? 1 : 0;
+}
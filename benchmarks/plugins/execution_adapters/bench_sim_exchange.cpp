@@ -0,0 +1,71 @@
+#include <benchmark/benchmark.h>
+#include <atomic>
+#include <thread>
+#include <random>
+#include <string>
+#include <vector>
+#include "plugins/execution_adapters/sim_exchange/matching_engine.h"
+#include "plugins/execution_adapters/sim_exchange/sim_exchange_adapter.h"
+
+using namespace quant::core;
+using namespace quant::plugins::execution_adapters::sim_exchange;
+
+// 撮合引擎：围绕中间价的随机限价单流（约一半主动成交、一半挂单），挂单过多时撤掉最早的
+static void BM_OrderBookMatch(benchmark::State& state) {
+    OrderBook book(0, 2000, 1 << 16);
+    std::mt19937_64 rng(1);
+    std::vector<SimFill> fills;
+    fills.reserve(64);
+    uint64_t id = 0;
+    uint64_t oldest = 1;
+    for (auto _ : state) {
+        fills.clear();
+        bool is_buy = (rng() & 1) != 0;
+        int64_t price = 995 + static_cast<int64_t>(rng() % 11);
+        book.submit(++id, is_buy, price, 1 + static_cast<int64_t>(rng() % 5), fills);
+        if (book.order_count() > 30000) {
+            book.cancel(oldest++);
+        }
+        benchmark::DoNotOptimize(fills.data());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_OrderBookMatch);
+
+// 适配器端到端：异步批量报单 -> 撮合线程 -> 完成通知回收（无注入延迟）
+static void BM_SimExchangeRoundTrip(benchmark::State& state) {
+    const size_t batch = static_cast<size_t>(state.range(0));
+    SimExchangeAdapter adapter({{"max_orders", "1048576"}, {"queue_capacity", "65536"}});
+    adapter.connect();
+
+    std::mt19937_64 rng(1);
+    std::vector<oms::Order> orders(batch);
+    std::vector<ems::OrderRequest> requests(batch);
+    std::vector<ems::OrderCompletion> completions(batch);
+    uint64_t request_id = 0;
+    for (auto _ : state) {
+        for (size_t i = 0; i < batch; ++i) {
+            orders[i].instrument = "rb2410";
+            orders[i].is_buy = (rng() & 1) != 0;
+            orders[i].price = 3995.0 + static_cast<double>(rng() % 11);
+            orders[i].volume = 1;
+            requests[i].request_id = ++request_id;
+            requests[i].order = &orders[i];
+        }
+        size_t sent = 0;
+        while (sent < batch) {
+            sent += adapter.send_orders(requests.data() + sent, batch - sent);
+        }
+        size_t done = 0;
+        while (done < batch) {
+            size_t n = adapter.poll_completions(completions.data(), batch);
+            if (n == 0) {
+                std::this_thread::yield();
+            }
+            done += n;
+        }
+    }
+    adapter.disconnect();
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(batch));
+}
+BENCHMARK(BM_SimExchangeRoundTrip)->Arg(1)->Arg(64)->UseRealTime();
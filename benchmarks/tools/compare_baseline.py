@@ -0,0 +1,73 @@
+#!/usr/bin/env python3
+"""对比两份 Google Benchmark JSON 结果（--benchmark_out_format=json）。
+
+用法：
+    compare_baseline.py <baseline.json> <current.json> [--threshold 0.10] [--metric real_time]
+
+按基准名称逐项比较耗时（统一换算为纳秒）；同名多次重复取平均。
+任一基准变慢超过阈值时以退出码 1 结束，便于在 CI 中拦截性能回退。
+"""
+
+import argparse
+import json
+import sys
+
+UNIT_TO_NS = {"ns": 1.0, "us": 1e3, "ms": 1e6, "s": 1e9}
+
+
+def load(path, metric):
+    with open(path) as f:
+        data = json.load(f)
+    sums = {}
+    for bench in data.get("benchmarks", []):
+        if bench.get("run_type", "iteration") != "iteration" or "error_occurred" in bench:
+            continue
+        value = float(bench[metric]) * UNIT_TO_NS.get(bench.get("time_unit", "ns"), 1.0)
+        total, count = sums.get(bench["name"], (0.0, 0))
+        sums[bench["name"]] = (total + value, count + 1)
+    return {name: total / count for name, (total, count) in sums.items()}
+
+
+def format_ns(value):
+    for unit, scale in (("s", 1e9), ("ms", 1e6), ("us", 1e3)):
+        if value >= scale:
+            return "%.2f %s" % (value / scale, unit)
+    return "%.2f ns" % value
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("baseline")
+    parser.add_argument("current")
+    parser.add_argument("--threshold", type=float, default=0.10, help="允许的相对变慢幅度（默认 0.10）")
+    parser.add_argument("--metric", choices=("real_time", "cpu_time"), default="real_time")
+    args = parser.parse_args()
+
+    baseline = load(args.baseline, args.metric)
+    current = load(args.current, args.metric)
+
+    regressions = []
+    width = max([len(name) for name in current] + [9])
+    print("%-*s %14s %14s %9s" % (width, "benchmark", "baseline", "current", "change"))
+    for name in sorted(current):
+        if name not in baseline:
+            print("%-*s %14s %14s %9s" % (width, name, "-", format_ns(current[name]), "new"))
+            continue
+        change = (current[name] - baseline[name]) / baseline[name] if baseline[name] > 0 else 0.0
+        flag = ""
+        if change > args.threshold:
+            flag = "  REGRESSION"
+            regressions.append(name)
+        print("%-*s %14s %14s %+8.1f%%%s" % (width, name, format_ns(baseline[name]),
+                                             format_ns(current[name]), change * 100.0, flag))
+    for name in sorted(set(baseline) - set(current)):
+        print("%-*s %14s %14s %9s" % (width, name, format_ns(baseline[name]), "-", "missing"))
+
+    if regressions:
+        print("\n%d benchmark(s) regressed by more than %.0f%%" % (len(regressions), args.threshold * 100.0))
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,94 @@
+#include "account_snapshot.h"
+
+#include <algorithm>
+
+namespace quant {
+namespace core {
+namespace account {
+
+AccountSnapshotBook::AccountSnapshotBook(size_t max_accounts, size_t max_instruments)
+    : max_accounts_(max_accounts),
+      max_instruments_(max_instruments),
+      balances_(new BalanceSlot[max_accounts]),
+      positions_(new PositionSlot[max_accounts * max_instruments]) {}
+
+bool AccountSnapshotBook::publish_balance(uint32_t account, const BalanceSnapshot& snapshot) {
+    if (account >= max_accounts_) {
+        return false;
+    }
+    balances_[account].store(snapshot);
+    return true;
+}
+
+bool AccountSnapshotBook::publish_position(uint32_t account, uint32_t instrument,
+                                           const PositionSnapshot& snapshot) {
+    if (account >= max_accounts_ || instrument >= max_instruments_) {
+        return false;
+    }
+    positions_[position_index(account, instrument)].store(snapshot);
+    return true;
+}
+
+bool AccountSnapshotBook::apply_fill(uint32_t account, uint32_t instrument, bool is_buy, double price,
+                                     int64_t volume, double multiplier, double commission, int64_t now_ns) {
+    if (account >= max_accounts_ || instrument >= max_instruments_ || volume <= 0) {
+        return false;
+    }
+
+    double realized = 0.0;
+    positions_[position_index(account, instrument)].update([&](PositionSnapshot& position) {
+        // 先平反向持仓
+        int64_t& opposite = is_buy ? position.short_volume : position.long_volume;
+        double opposite_avg = is_buy ? position.short_avg_price : position.long_avg_price;
+        int64_t closed = std::min(opposite, volume);
+        if (closed > 0) {
+            double diff = is_buy ? opposite_avg - price : price - opposite_avg;
+            realized = diff * static_cast<double>(closed) * multiplier;
+            opposite -= closed;
+        }
+
+        // 剩余数量开同向持仓，按成交量加权更新均价
+        int64_t opened = volume - closed;
+        if (opened > 0) {
+            int64_t& same = is_buy ? position.long_volume : position.short_volume;
+            double& same_avg = is_buy ? position.long_avg_price : position.short_avg_price;
+            same_avg = (same_avg * static_cast<double>(same) + price * static_cast<double>(opened)) /
+                       static_cast<double>(same + opened);
+            same += opened;
+        }
+        position.update_ns = now_ns;
+    });
+
+    balances_[account].update([&](BalanceSnapshot& balance) {
+        balance.realized_pnl += realized;
+        balance.commission += commission;
+        balance.balance += realized - commission;
+        balance.available += realized - commission;
+        balance.update_ns = now_ns;
+    });
+    return true;
+}
+
+bool AccountSnapshotBook::balance(uint32_t account, BalanceSnapshot& out) const {
+    if (account >= max_accounts_) {
+        return false;
+    }
+    out = balances_[account].load();
+    return true;
+}
+
+bool AccountSnapshotBook::position(uint32_t account, uint32_t instrument, PositionSnapshot& out) const {
+    if (account >= max_accounts_ || instrument >= max_instruments_) {
+        return false;
+    }
+    out = positions_[position_index(account, instrument)].load();
+    return true;
+}
+
+uint64_t AccountSnapshotBook::balance_version(uint32_t account) const {
+    return account < max_accounts_ ? balances_[account].version() : 0;
+}
+
+} // namespace account
+} // namespace core
+} // namespace quant
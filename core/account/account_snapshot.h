@@ -0,0 +1,81 @@
+#pragma once
+
+#include <memory>
+#include <cstdint>
+#include <cstddef>
+#include "common/seqlock/seqlock.h"
+
+namespace quant {
+namespace core {
+namespace account {
+
+// 资金快照（按账户）
+struct BalanceSnapshot {
+    double balance = 0.0;             // 动态权益
+    double available = 0.0;           // 可用资金
+    double frozen = 0.0;              // 冻结资金（在途订单占用）
+    double realized_pnl = 0.0;        // 已实现盈亏
+    double commission = 0.0;          // 累计手续费
+    int64_t update_ns = 0;            // 最后更新时间
+};
+
+// 持仓快照（按 账户 x 合约）
+struct PositionSnapshot {
+    int64_t long_volume = 0;          // 多头持仓
+    int64_t short_volume = 0;         // 空头持仓
+    double long_avg_price = 0.0;      // 多头均价
+    double short_avg_price = 0.0;     // 空头均价
+    int64_t update_ns = 0;            // 最后更新时间
+
+    int64_t net() const { return long_volume - short_volume; }
+};
+
+// 账户快照簿：AccountManager 的读侧发布层
+// - 成交回报线程是唯一写者，通过 publish_*/apply_fill 更新，从不等待读者
+// - RiskManager、OrderManager 和策略线程通过 balance()/position() 读取，
+//   每个快照经顺序锁发布，读者只做普通原子读取并在与写入重叠时重试，不阻塞写者
+// - 资金与各合约持仓分别发布，跨快照之间不保证同一时刻（需要时比较 update_ns）
+// 账户与合约使用启动时分配的稠密编号
+class AccountSnapshotBook {
+public:
+    AccountSnapshotBook(size_t max_accounts, size_t max_instruments);
+
+    AccountSnapshotBook(const AccountSnapshotBook&) = delete;
+    AccountSnapshotBook& operator=(const AccountSnapshotBook&) = delete;
+
+    // 1. 写者
+    bool publish_balance(uint32_t account, const BalanceSnapshot& snapshot);
+    bool publish_position(uint32_t account, uint32_t instrument, const PositionSnapshot& snapshot);
+
+    // 应用一笔成交：开仓增加同向持仓并更新均价，平仓先减少反向持仓并计算已实现盈亏；
+    // 手续费与盈亏计入资金快照
+    bool apply_fill(uint32_t account, uint32_t instrument, bool is_buy, double price, int64_t volume,
+                    double multiplier, double commission, int64_t now_ns);
+
+    // 2. 读者（越界返回 false）
+    bool balance(uint32_t account, BalanceSnapshot& out) const;
+    bool position(uint32_t account, uint32_t instrument, PositionSnapshot& out) const;
+
+    // 快照版本（每次发布递增），可用于读者判断是否需要刷新
+    uint64_t balance_version(uint32_t account) const;
+
+    size_t max_accounts() const { return max_accounts_; }
+    size_t max_instruments() const { return max_instruments_; }
+
+private:
+    using BalanceSlot = base::common::seqlock::SeqLock<BalanceSnapshot>;
+    using PositionSlot = base::common::seqlock::SeqLock<PositionSnapshot>;
+
+    size_t position_index(uint32_t account, uint32_t instrument) const {
+        return static_cast<size_t>(account) * max_instruments_ + instrument;
+    }
+
+    size_t max_accounts_;
+    size_t max_instruments_;
+    std::unique_ptr<BalanceSlot[]> balances_;
+    std::unique_ptr<PositionSlot[]> positions_;
+};
+
+} // namespace account
+} // namespace core
+} // namespace quant
@@ -0,0 +1,51 @@
+#include "adapter_shim.h"
+
+namespace quant {
+namespace core {
+namespace ems {
+
+size_t SyncCompletionAdapter::send_orders(const OrderRequest* requests, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        complete(requests[i].request_id, OrderRequestType::kSend, inner_->send_order(*requests[i].order));
+    }
+    return count;
+}
+
+bool SyncCompletionAdapter::submit_cancel(uint64_t request_id, const std::string& order_id) {
+    complete(request_id, OrderRequestType::kCancel, inner_->cancel_order(order_id));
+    return true;
+}
+
+bool SyncCompletionAdapter::submit_modify(uint64_t request_id, const oms::Order& order) {
+    complete(request_id, OrderRequestType::kModify, inner_->modify_order(order));
+    return true;
+}
+
+size_t SyncCompletionAdapter::poll_completions(OrderCompletion* out, size_t max) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    size_t n = 0;
+    while (n < max && !completions_.empty()) {
+        out[n++] = std::move(completions_.front());
+        completions_.pop_front();
+    }
+    return n;
+}
+
+void SyncCompletionAdapter::complete(uint64_t request_id, OrderRequestType type, ExecutionResult result) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    completions_.push_back(OrderCompletion{request_id, type, std::move(result)});
+}
+
+std::shared_ptr<IAsyncExecutionAdapter> make_async_adapter(std::shared_ptr<IExecutionAdapter> adapter) {
+    if (!adapter) {
+        return nullptr;
+    }
+    if (auto async = std::dynamic_pointer_cast<IAsyncExecutionAdapter>(adapter)) {
+        return async;
+    }
+    return std::make_shared<SyncCompletionAdapter>(std::move(adapter));
+}
+
+} // namespace ems
+} // namespace core
+} // namespace quant
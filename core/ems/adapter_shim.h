@@ -0,0 +1,66 @@
+#pragma once
+
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "execution_adapter.h"
+
+namespace quant {
+namespace core {
+namespace ems {
+
+// 转发外壳：把同步接口原样转发给内部适配器，供把同步适配器包装为异步适配器的外壳复用
+class ExecutionAdapterShim : public IAsyncExecutionAdapter {
+public:
+    explicit ExecutionAdapterShim(std::shared_ptr<IExecutionAdapter> inner) : inner_(std::move(inner)) {}
+
+    bool connect() override { return inner_->connect(); }
+    void disconnect() override { inner_->disconnect(); }
+    ExecutionResult send_order(const oms::Order& order) override { return inner_->send_order(order); }
+    ExecutionResult cancel_order(const std::string& order_id) override { return inner_->cancel_order(order_id); }
+    ExecutionResult modify_order(const oms::Order& order) override { return inner_->modify_order(order); }
+    std::vector<oms::Order> query_orders(const std::string& instrument = "") override {
+        return inner_->query_orders(instrument);
+    }
+    std::vector<oms::Trade> query_trades(const std::string& instrument = "") override {
+        return inner_->query_trades(instrument);
+    }
+    std::string id() const override { return inner_->id(); }
+    std::vector<std::string> supported_instruments() const override { return inner_->supported_instruments(); }
+    void set_order_callback(OrderCallback callback) override { inner_->set_order_callback(std::move(callback)); }
+    void set_trade_callback(TradeCallback callback) override { inner_->set_trade_callback(std::move(callback)); }
+
+    const std::shared_ptr<IExecutionAdapter>& inner() const { return inner_; }
+
+protected:
+    std::shared_ptr<IExecutionAdapter> inner_;
+};
+
+// 同步完成外壳：在调用线程上逐笔调用同步接口，结果写入完成队列
+// 不把交易所往返移出调用线程，仅让同步适配器能以异步批量接口接入（如路由器、回测）；
+// 需要管线化时使用 PipelinedExecutionAdapter
+class SyncCompletionAdapter : public ExecutionAdapterShim {
+public:
+    explicit SyncCompletionAdapter(std::shared_ptr<IExecutionAdapter> inner)
+        : ExecutionAdapterShim(std::move(inner)) {}
+
+    size_t send_orders(const OrderRequest* requests, size_t count) override;
+    bool submit_cancel(uint64_t request_id, const std::string& order_id) override;
+    bool submit_modify(uint64_t request_id, const oms::Order& order) override;
+    size_t poll_completions(OrderCompletion* out, size_t max) override;
+
+private:
+    void complete(uint64_t request_id, OrderRequestType type, ExecutionResult result);
+
+    std::mutex mutex_;
+    std::deque<OrderCompletion> completions_;
+};
+
+// 取得适配器的异步接口：原生异步适配器直接返回，否则包装为 SyncCompletionAdapter
+std::shared_ptr<IAsyncExecutionAdapter> make_async_adapter(std::shared_ptr<IExecutionAdapter> adapter);
+
+} // namespace ems
+} // namespace core
+} // namespace quant
@@ -3,6 +3,10 @@
 #include <string>
 #include <vector>
 #include <memory>
+#include <cstdint>
+#include <cstddef>
+#include <functional>
+#include <unordered_map>
 #include "../oms/order.h"
 #include "../oms/trade.h"
 #include "execution_result.h"
@@ -11,6 +15,27 @@ namespace quant {
 namespace core {
 namespace ems {
 
+// 异步订单请求类型
+enum class OrderRequestType : uint8_t {
+    kSend,
+    kCancel,
+    kModify,
+};
+
+// 批量报单请求：request_id 由调用方分配（如 OMS 内部订单号），用于匹配完成通知
+struct OrderRequest {
+    uint64_t request_id = 0;
+    const oms::Order* order = nullptr;
+};
+
+// 完成通知：一次异步请求被交易通道受理（或拒绝）的结果；
+// 订单后续状态与成交仍通过 OrderCallback/TradeCallback 推送
+struct OrderCompletion {
+    uint64_t request_id = 0;
+    OrderRequestType type = OrderRequestType::kSend;
+    ExecutionResult result;
+};
+
 // 执行适配器接口
 class IExecutionAdapter {
 public:
@@ -52,6 +77,50 @@ public:
     virtual void set_trade_callback(TradeCallback callback) = 0;
 };
 
+// 异步批量执行适配器接口
+// 在 IExecutionAdapter 之后派生的独立接口，不改变同步接口的虚表与对象布局，
+// 按旧接口编译的适配器插件无需重新编译。提交后立即返回，受理结果写入完成队列，
+// 由调用方通过 poll_completions 批量取回。原生异步适配器直接实现本接口；
+// 只实现同步接口的适配器经 make_async_adapter() 接入（SyncCompletionAdapter 或 PipelinedExecutionAdapter）
+class IAsyncExecutionAdapter : public IExecutionAdapter {
+public:
+    // 批量报单，返回已受理的请求数（管线已满时可能小于 count，剩余部分由调用方稍后重试）
+    virtual size_t send_orders(const OrderRequest* requests, size_t count) = 0;
+
+    // 异步撤单/改单，管线已满时返回 false。
+    // 撤单的 order_id 为交易通道订单号（报单确认中的 ExecutionResult::order_id）；报单尚未确认时调用方只有
+    // 自己的订单号，此时以原报单的 request_id 提交撤单，能按请求号定位报单的适配器据此撤单，否则返回 false
+    virtual bool submit_cancel(uint64_t request_id, const std::string& order_id) = 0;
+    virtual bool submit_modify(uint64_t request_id, const oms::Order& order) = 0;
+
+    // 取回最多 max 个完成通知，返回实际数量
+    virtual size_t poll_completions(OrderCompletion* out, size_t max) = 0;
+
+    // 查询结果写入调用方提供的缓冲区（先清空，复用其容量），返回条数
+    virtual size_t query_orders_into(const std::string& instrument, std::vector<oms::Order>& out) {
+        out.clear();
+        for (auto& order : query_orders(instrument)) {
+            out.push_back(std::move(order));
+        }
+        return out.size();
+    }
+
+    virtual size_t query_trades_into(const std::string& instrument, std::vector<oms::Trade>& out) {
+        out.clear();
+        for (auto& trade : query_trades(instrument)) {
+            out.push_back(std::move(trade));
+        }
+        return out.size();
+    }
+};
+
+// 插件入口函数声明（执行适配器插件以 create_execution_adapter/destroy_execution_adapter 导出）
+extern "C" {
+    using CreateExecutionAdapterFunc = std::shared_ptr<IExecutionAdapter>(*)(
+        const std::unordered_map<std::string, std::string>& config);
+    using DestroyExecutionAdapterFunc = void(*)(std::shared_ptr<IExecutionAdapter>);
+}
+
 // 执行适配器工厂
 class ExecutionAdapterFactory {
 public:
@@ -0,0 +1,197 @@
+#include "pipelined_execution_adapter.h"
+#include <functional>
+#include "../trace/tick_trace.h"
+
+namespace quant {
+namespace core {
+namespace ems {
+
+PipelinedExecutionAdapter::PipelinedExecutionAdapter(std::shared_ptr<IExecutionAdapter> inner, size_t senders,
+                                                     size_t queue_capacity)
+    : ExecutionAdapterShim(std::move(inner)),
+      completed_(queue_capacity),
+      running_(false) {
+    if (senders == 0) {
+        senders = 1;
+    }
+    size_t lane_capacity = queue_capacity / senders > 0 ? queue_capacity / senders : 1;
+    lanes_.reserve(senders);
+    for (size_t i = 0; i < senders; ++i) {
+        lanes_.push_back(std::make_unique<SenderLane>(lane_capacity));
+    }
+}
+
+PipelinedExecutionAdapter::~PipelinedExecutionAdapter() {
+    disconnect();
+}
+
+bool PipelinedExecutionAdapter::connect() {
+    if (!inner_->connect()) {
+        return false;
+    }
+    if (!running_.exchange(true, std::memory_order_acq_rel)) {
+        for (auto& lane : lanes_) {
+            SenderLane* target = lane.get();
+            lane->thread = std::thread([this, target]() { run(*target); });
+        }
+    }
+    return true;
+}
+
+void PipelinedExecutionAdapter::disconnect() {
+    if (running_.exchange(false, std::memory_order_acq_rel)) {
+        {
+            // 唤醒阻塞在完成环上的发送线程（其在 completion_mutex_ 下检查 running_，不会漏掉）
+            std::lock_guard<std::mutex> lock(completion_mutex_);
+            completion_space_.notify_all();
+        }
+        for (auto& lane : lanes_) {
+            {
+                std::lock_guard<std::mutex> lock(lane->mutex);
+                lane->wakeup.notify_all();
+            }
+            if (lane->thread.joinable()) {
+                lane->thread.join();
+            }
+        }
+        inner_->disconnect();
+    }
+}
+
+size_t PipelinedExecutionAdapter::in_flight() const {
+    size_t total = 0;
+    for (const auto& lane : lanes_) {
+        total += lane->submissions.size();
+    }
+    return total;
+}
+
+PipelinedExecutionAdapter::SenderLane& PipelinedExecutionAdapter::lane_for(const std::string& order_id) {
+    // 只按 OMS 订单号分片：同一订单的报单、改单、撤单总是落在同一发送线程上，保持提交顺序
+    return *lanes_[std::hash<std::string>()(order_id) % lanes_.size()];
+}
+
+bool PipelinedExecutionAdapter::submit(SenderLane& lane, Submission&& submission) {
+    if (!running_.load(std::memory_order_acquire) || !lane.submissions.push(std::move(submission))) {
+        return false;
+    }
+    // 与 run() 中"置 idle -> 栅栏 -> 复查提交环"配对：要么发送线程复查时看到新请求，要么这里看到 idle
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (lane.idle.load(std::memory_order_relaxed)) {
+        std::lock_guard<std::mutex> lock(lane.mutex);
+        lane.wakeup.notify_one();
+    }
+    return true;
+}
+
+size_t PipelinedExecutionAdapter::send_orders(const OrderRequest* requests, size_t count) {
+    QT_TRACE_STAGE(trace::TickStage::kSendOrder);
+    if (!running_.load(std::memory_order_acquire)) {
+        return 0;
+    }
+    size_t accepted = 0;
+    for (; accepted < count; ++accepted) {
+        Submission submission;
+        submission.request_id = requests[accepted].request_id;
+        submission.type = OrderRequestType::kSend;
+        submission.order = *requests[accepted].order;
+        SenderLane& lane = lane_for(submission.order.order_id);
+        if (!submit(lane, std::move(submission))) {
+            break;
+        }
+    }
+    return accepted;
+}
+
+bool PipelinedExecutionAdapter::submit_cancel(uint64_t request_id, const std::string& order_id) {
+    Submission submission;
+    submission.request_id = request_id;
+    submission.type = OrderRequestType::kCancel;
+    submission.order_id = order_id;
+    return submit(lane_for(order_id), std::move(submission));
+}
+
+bool PipelinedExecutionAdapter::submit_modify(uint64_t request_id, const oms::Order& order) {
+    Submission submission;
+    submission.request_id = request_id;
+    submission.type = OrderRequestType::kModify;
+    submission.order = order;
+    return submit(lane_for(order.order_id), std::move(submission));
+}
+
+size_t PipelinedExecutionAdapter::poll_completions(OrderCompletion* out, size_t max) {
+    size_t n = 0;
+    while (n < max && completed_.pop(out[n])) {
+        ++n;
+    }
+    if (n > 0) {
+        // 与 execute() 中"登记等待 -> 栅栏 -> 重试入环"配对，避免漏掉唤醒
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (completion_waiters_.load(std::memory_order_relaxed) > 0) {
+            std::lock_guard<std::mutex> lock(completion_mutex_);
+            completion_space_.notify_all();
+        }
+    }
+    return n;
+}
+
+void PipelinedExecutionAdapter::run(SenderLane& lane) {
+    Submission submission;
+    while (true) {
+        if (lane.submissions.pop(submission)) {
+            execute(submission);
+            continue;
+        }
+        if (!running_.load(std::memory_order_acquire)) {
+            break;
+        }
+        // 提交环为空：阻塞到 submit() 或 disconnect() 唤醒
+        std::unique_lock<std::mutex> lock(lane.mutex);
+        lane.idle.store(true, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        lane.wakeup.wait(lock, [this, &lane]() {
+            return !lane.submissions.empty() || !running_.load(std::memory_order_acquire);
+        });
+        lane.idle.store(false, std::memory_order_relaxed);
+    }
+    // 断开前处理完已受理的请求（此时完成环仍满则丢弃通知，见 execute）
+    while (lane.submissions.pop(submission)) {
+        execute(submission);
+    }
+}
+
+void PipelinedExecutionAdapter::execute(Submission& submission) {
+    OrderCompletion completion;
+    completion.request_id = submission.request_id;
+    completion.type = submission.type;
+    switch (submission.type) {
+    case OrderRequestType::kSend:
+        completion.result = inner_->send_order(submission.order);
+        break;
+    case OrderRequestType::kCancel:
+        completion.result = inner_->cancel_order(submission.order_id);
+        break;
+    case OrderRequestType::kModify:
+        completion.result = inner_->modify_order(submission.order);
+        break;
+    }
+    if (completed_.push(std::move(completion))) {
+        return;
+    }
+    // 完成环满时阻塞到 OMS 经 poll_completions 取走通知；已断开时不再等待，丢弃该通知
+    std::unique_lock<std::mutex> lock(completion_mutex_);
+    completion_waiters_.fetch_add(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    while (!completed_.push(std::move(completion))) {
+        if (!running_.load(std::memory_order_acquire)) {
+            completions_dropped_.fetch_add(1, std::memory_order_relaxed);
+            break;
+        }
+        completion_space_.wait(lock);
+    }
+    completion_waiters_.fetch_sub(1, std::memory_order_relaxed);
+}
+
+} // namespace ems
+} // namespace core
+} // namespace quant
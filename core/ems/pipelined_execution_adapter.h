@@ -0,0 +1,88 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "adapter_shim.h"
+#include "common/ring_queue/ring_queue.h"
+
+namespace quant {
+namespace core {
+namespace ems {
+
+// 管线化执行适配器：把只实现同步接口的适配器包装为异步适配器
+// - send_orders/submit_* 只把请求写入提交环后立即返回，不阻塞 OMS 线程
+// - senders 个发送线程并发调用内部适配器的同步接口，最多 senders 个交易所往返同时在途；
+//   请求按 OMS 订单号（Order::order_id，报单前由 OMS 分配）分片到固定的发送线程，
+//   同一订单的报单/改单/撤单保持提交顺序。撤单/改单须使用同一订单号；
+//   未填订单号的报单全部落在同一发送线程上（保持顺序，但彼此不并发）
+//   （内部适配器须允许多线程并发调用同步接口；只允许单线程调用时 senders 取 1）
+// - 空闲的发送线程阻塞等待新请求，完成环满时发送线程阻塞到 poll_completions 取走通知，均不空转
+// - 只在 connect() 与 disconnect() 之间受理请求；断开时完成环仍满，剩余的完成通知被丢弃
+//   （计入 completions_dropped），不会阻塞 disconnect() 与析构
+// - 结果写入共享的完成环；订单状态/成交回调、连接管理与查询直接转发给内部适配器
+class PipelinedExecutionAdapter : public ExecutionAdapterShim {
+public:
+    PipelinedExecutionAdapter(std::shared_ptr<IExecutionAdapter> inner, size_t senders = 4,
+                              size_t queue_capacity = 4096);
+    ~PipelinedExecutionAdapter() override;
+
+    PipelinedExecutionAdapter(const PipelinedExecutionAdapter&) = delete;
+    PipelinedExecutionAdapter& operator=(const PipelinedExecutionAdapter&) = delete;
+
+    // 连接成功后启动发送线程，断开前处理完已提交的请求
+    bool connect() override;
+    void disconnect() override;
+
+    // 异步接口（未连接时拒绝：send_orders 返回 0，submit_* 返回 false）
+    size_t send_orders(const OrderRequest* requests, size_t count) override;
+    bool submit_cancel(uint64_t request_id, const std::string& order_id) override;
+    bool submit_modify(uint64_t request_id, const oms::Order& order) override;
+    size_t poll_completions(OrderCompletion* out, size_t max) override;
+
+    // 提交环中等待发送的请求数
+    size_t in_flight() const;
+    size_t sender_count() const { return lanes_.size(); }
+    // 断开时因完成环已满而丢弃的完成通知数
+    uint64_t completions_dropped() const { return completions_dropped_.load(std::memory_order_relaxed); }
+
+private:
+    struct Submission {
+        uint64_t request_id = 0;
+        OrderRequestType type = OrderRequestType::kSend;
+        oms::Order order;
+        std::string order_id;
+    };
+
+    struct SenderLane {
+        explicit SenderLane(size_t capacity) : submissions(capacity) {}
+        base::common::ring_queue::RingQueue<Submission> submissions;    // OMS -> 发送线程
+        std::thread thread;
+        std::mutex mutex;                       // 只配合 wakeup 使用，不保护提交环
+        std::condition_variable wakeup;         // 有新请求或停止时唤醒空闲的发送线程
+        std::atomic<bool> idle{false};          // 发送线程正在（或即将）等待 wakeup
+    };
+
+    SenderLane& lane_for(const std::string& order_id);
+    bool submit(SenderLane& lane, Submission&& submission);
+    void run(SenderLane& lane);
+    void execute(Submission& submission);
+
+    std::vector<std::unique_ptr<SenderLane>> lanes_;
+    base::common::ring_queue::RingQueue<OrderCompletion> completed_;  // 发送线程 -> OMS
+    std::atomic<bool> running_;
+
+    // 完成环满时发送线程在此等待 poll_completions 腾出空间
+    std::mutex completion_mutex_;
+    std::condition_variable completion_space_;
+    std::atomic<size_t> completion_waiters_{0};
+    std::atomic<uint64_t> completions_dropped_{0};
+};
+
+} // namespace ems
+} // namespace core
+} // namespace quant
@@ -0,0 +1,340 @@
+#include "smart_order_router.h"
+
+#include <cmath>
+#include <limits>
+#include <algorithm>
+
+namespace quant {
+namespace core {
+namespace ems {
+
+// ==================== LatencyEstimator ====================
+
+LatencyEstimator::LatencyEstimator(double alpha, uint32_t window)
+    : alpha_(alpha), window_(window) {}
+
+void LatencyEstimator::record(int64_t latency_ns) {
+    latency_ns = std::max<int64_t>(latency_ns, 0);
+    ewma_ns_ = samples_ == 0 ? static_cast<double>(latency_ns)
+                             : ewma_ns_ + alpha_ * (static_cast<double>(latency_ns) - ewma_ns_);
+    ++samples_;
+
+    counts_[bucket_of(latency_ns)] += 1.0;
+    total_ += 1.0;
+    if (++since_decay_ >= window_) {
+        for (auto& count : counts_) {
+            count *= 0.5;
+        }
+        total_ *= 0.5;
+        since_decay_ = 0;
+    }
+}
+
+void LatencyEstimator::reset() {
+    ewma_ns_ = 0.0;
+    samples_ = 0;
+    since_decay_ = 0;
+    total_ = 0.0;
+    counts_.fill(0.0);
+}
+
+int64_t LatencyEstimator::percentile_ns(double quantile) const {
+    if (total_ <= 0.0) {
+        return 0;
+    }
+    double target = quantile * total_;
+    double cumulative = 0.0;
+    for (size_t i = 0; i < kBuckets; ++i) {
+        cumulative += counts_[i];
+        if (cumulative >= target && counts_[i] > 0.0) {
+            return bucket_upper(i);
+        }
+    }
+    return bucket_upper(kBuckets - 1);
+}
+
+size_t LatencyEstimator::bucket_of(int64_t latency_ns) {
+    uint64_t value = static_cast<uint64_t>(latency_ns);
+    if (value < 4) {
+        return static_cast<size_t>(value);
+    }
+    size_t msb = 63 - static_cast<size_t>(__builtin_clzll(value));
+    size_t sub = static_cast<size_t>((value >> (msb - 2)) & 3);
+    return msb * 4 + sub;
+}
+
+int64_t LatencyEstimator::bucket_upper(size_t bucket) {
+    if (bucket < 8) {
+        return static_cast<int64_t>(bucket);
+    }
+    size_t msb = bucket / 4;
+    uint64_t sub = bucket % 4;
+    if (msb >= 62) {
+        return std::numeric_limits<int64_t>::max();
+    }
+    return static_cast<int64_t>(((4 + sub + 1) << (msb - 2)) - 1);
+}
+
+// ==================== SmartOrderRouter ====================
+
+SmartOrderRouter::SmartOrderRouter(const RouterConfig& config)
+    : config_(config) {
+    completion_buffer_.resize(256);
+}
+
+size_t SmartOrderRouter::add_adapter(std::shared_ptr<IExecutionAdapter> adapter,
+                                     const std::vector<std::string>& instruments) {
+    size_t index = adapters_.size();
+    const std::vector<std::string>& supported = instruments.empty() ? adapter->supported_instruments() : instruments;
+    for (const auto& instrument : supported) {
+        capabilities_[instrument].push_back(index);
+    }
+    AdapterState state;
+    state.adapter = make_async_adapter(std::move(adapter));
+    state.rtt = LatencyEstimator(config_.ewma_alpha);
+    adapters_.push_back(std::move(state));
+    return index;
+}
+
+bool SmartOrderRouter::select(const std::string& instrument, size_t& adapter) const {
+    auto it = capabilities_.find(instrument);
+    if (it == capabilities_.end()) {
+        return false;
+    }
+    int64_t best_score = std::numeric_limits<int64_t>::max();
+    bool found = false;
+    for (size_t index : it->second) {
+        const AdapterState& state = adapters_[index];
+        if (!state.healthy) {
+            continue;
+        }
+        int64_t score = state.rtt.samples() == 0 ? config_.initial_rtt_us * 1000 : state.rtt.ewma_ns();
+        if (score < best_score) {
+            best_score = score;
+            adapter = index;
+            found = true;
+        }
+    }
+    return found;
+}
+
+bool SmartOrderRouter::route(uint64_t request_id, const oms::Order& order, int64_t now_ns) {
+    size_t adapter = 0;
+    if (in_flight_.count(request_id) != 0 || !select(order.instrument, adapter)) {
+        return false;
+    }
+    InFlight& entry = in_flight_[request_id];
+    entry.order = order;
+    if (!submit(request_id, entry, adapter, now_ns)) {
+        in_flight_.erase(request_id);
+        return false;
+    }
+    return true;
+}
+
+bool SmartOrderRouter::submit(uint64_t request_id, InFlight& entry, size_t adapter, int64_t now_ns) {
+    AdapterState& state = adapters_[adapter];
+    OrderRequest request;
+    request.request_id = request_id;
+    request.order = &entry.order;
+    if (state.adapter->send_orders(&request, 1) != 1) {
+        return false;
+    }
+    entry.adapter = adapter;
+    entry.sent_ns = now_ns;
+    entry.phase = Phase::kSent;
+    ++state.in_flight;
+    ++state.routed;
+    return true;
+}
+
+size_t SmartOrderRouter::poll(std::vector<RoutedCompletion>& out, int64_t now_ns) {
+    size_t before = out.size();
+    for (size_t i = 0; i < adapters_.size(); ++i) {
+        size_t n = 0;
+        while ((n = adapters_[i].adapter->poll_completions(completion_buffer_.data(), completion_buffer_.size())) > 0) {
+            for (size_t k = 0; k < n; ++k) {
+                on_completion(i, completion_buffer_[k], out, now_ns);
+            }
+        }
+    }
+    expire_requests(out, now_ns);
+    check_health(now_ns);
+    return out.size() - before;
+}
+
+void SmartOrderRouter::on_completion(size_t adapter, OrderCompletion& completion,
+                                     std::vector<RoutedCompletion>& out, int64_t now_ns) {
+    AdapterState& state = adapters_[adapter];
+    auto it = in_flight_.find(completion.request_id);
+    if (it == in_flight_.end() || it->second.adapter != adapter) {
+        // 报单只经路由器提交：不在途（或已转投到其他适配器）的报单通知是转投后原适配器的残留通知，丢弃；
+        // 调用方直接提交的撤单/改单原样上报
+        if (completion.type != OrderRequestType::kSend && it == in_flight_.end()) {
+            out.push_back(RoutedCompletion{adapter, std::move(completion)});
+        }
+        return;
+    }
+    InFlight& entry = it->second;
+
+    if (completion.type == OrderRequestType::kCancel) {
+        if (entry.phase == Phase::kCancelling) {
+            on_failover_cancel(completion.request_id, entry, completion, out, now_ns);
+        } else {
+            out.push_back(RoutedCompletion{adapter, std::move(completion)});
+        }
+        return;
+    }
+    if (completion.type != OrderRequestType::kSend) {
+        out.push_back(RoutedCompletion{adapter, std::move(completion)});
+        return;
+    }
+
+    state.rtt.record(now_ns - entry.sent_ns);
+    state.error_rate += config_.ewma_alpha * ((completion.result.success ? 0.0 : 1.0) - state.error_rate);
+    if (entry.phase == Phase::kCancelling) {
+        // 撤单结果返回前原报单先被确认：不再转投，确认照常上报，撤单结果到达时吸收
+        entry.acked = true;
+    } else {
+        --state.in_flight;
+        in_flight_.erase(it);
+    }
+    out.push_back(RoutedCompletion{adapter, std::move(completion)});
+}
+
+void SmartOrderRouter::on_failover_cancel(uint64_t request_id, InFlight& entry, const OrderCompletion& completion,
+                                          std::vector<RoutedCompletion>& out, int64_t now_ns) {
+    AdapterState& state = adapters_[entry.adapter];
+    if (entry.acked) {
+        // 原报单已确认并上报，撤单结果由订单回报体现
+        ++state.failovers_aborted;
+        --state.in_flight;
+        in_flight_.erase(request_id);
+        return;
+    }
+    if (!completion.result.success) {
+        // 撤单失败：订单可能已在原适配器上受理甚至成交，不能转投，继续等待原确认
+        ++state.failovers_aborted;
+        entry.phase = Phase::kAwaitAck;
+        return;
+    }
+
+    // 撤单成功：原适配器上已无该订单，转投到当前最优的适配器
+    size_t from = entry.adapter;
+    --state.in_flight;
+    size_t target = 0;
+    if (select(entry.order.instrument, target) && submit(request_id, entry, target, now_ns)) {
+        ++adapters_[from].failovers;
+        return;
+    }
+    fail(request_id, from, "Execution adapter " + adapters_[from].adapter->id() +
+                           " degraded and no healthy adapter is available", out);
+    in_flight_.erase(request_id);
+}
+
+void SmartOrderRouter::fail(uint64_t request_id, size_t adapter, const std::string& message,
+                            std::vector<RoutedCompletion>& out) {
+    RoutedCompletion failed;
+    failed.adapter = adapter;
+    failed.completion.request_id = request_id;
+    failed.completion.type = OrderRequestType::kSend;
+    failed.completion.result.success = false;
+    failed.completion.result.message = message;
+    out.push_back(std::move(failed));
+}
+
+void SmartOrderRouter::expire_requests(std::vector<RoutedCompletion>& out, int64_t now_ns) {
+    const int64_t timeout_ns = config_.request_timeout_us * 1000;
+    for (auto it = in_flight_.begin(); it != in_flight_.end();) {
+        InFlight& entry = it->second;
+        if (now_ns - entry.sent_ns <= timeout_ns) {
+            ++it;
+            continue;
+        }
+        AdapterState& state = adapters_[entry.adapter];
+        --state.in_flight;
+        ++state.timeouts;
+        if (!entry.acked) {
+            // 确认已上报的（转投撤单中先被确认）只移除，其余上报失败
+            fail(it->first, entry.adapter, "No result from execution adapter " + state.adapter->id() +
+                                           " within request timeout; order state unknown", out);
+        }
+        it = in_flight_.erase(it);
+    }
+}
+
+void SmartOrderRouter::check_health(int64_t now_ns) {
+    const int64_t ack_timeout_ns = config_.ack_timeout_us * 1000;
+    for (size_t i = 0; i < adapters_.size(); ++i) {
+        AdapterState& state = adapters_[i];
+
+        // 冷却结束：重置估计值后重新参与路由
+        if (!state.healthy) {
+            if (now_ns - state.degraded_at_ns >= config_.cooldown_us * 1000) {
+                state.healthy = true;
+                state.rtt.reset();
+                state.error_rate = 0.0;
+            }
+            continue;
+        }
+
+        bool degraded = state.rtt.samples() >= config_.min_samples &&
+                        (state.rtt.ewma_ns() > config_.max_ewma_us * 1000 ||
+                         state.rtt.p99_ns() > config_.max_p99_us * 1000 ||
+                         state.error_rate > config_.max_error_rate);
+        if (!degraded && state.in_flight > 0) {
+            for (const auto& entry : in_flight_) {
+                if (entry.second.adapter == i && entry.second.phase == Phase::kSent &&
+                    now_ns - entry.second.sent_ns > ack_timeout_ns) {
+                    degraded = true;
+                    break;
+                }
+            }
+        }
+        if (!degraded) {
+            continue;
+        }
+
+        // 劣化：摘除适配器（不再接收新报单）；开启转投时先撤销其上未确认的请求，撤单结果返回后再决定是否转投
+        state.healthy = false;
+        state.degraded_at_ns = now_ns;
+        if (!config_.failover_unacked) {
+            continue;
+        }
+        for (auto& entry : in_flight_) {
+            if (entry.second.adapter != i || entry.second.phase != Phase::kSent) {
+                continue;
+            }
+            if (state.adapter->submit_cancel(entry.first, entry.second.order.order_id)) {
+                entry.second.phase = Phase::kCancelling;
+            } else {
+                ++state.failovers_aborted;          // 撤单提交失败：同样留在原适配器
+                entry.second.phase = Phase::kAwaitAck;
+            }
+        }
+    }
+}
+
+std::vector<AdapterHealth> SmartOrderRouter::health() const {
+    std::vector<AdapterHealth> result;
+    result.reserve(adapters_.size());
+    for (const auto& state : adapters_) {
+        AdapterHealth health;
+        health.id = state.adapter->id();
+        health.healthy = state.healthy;
+        health.ewma_us = state.rtt.ewma_ns() / 1000;
+        health.p99_us = state.rtt.p99_ns() / 1000;
+        health.error_rate = state.error_rate;
+        health.in_flight = state.in_flight;
+        health.routed = state.routed;
+        health.failovers = state.failovers;
+        health.failovers_aborted = state.failovers_aborted;
+        health.timeouts = state.timeouts;
+        result.push_back(std::move(health));
+    }
+    return result;
+}
+
+} // namespace ems
+} // namespace core
+} // namespace quant
@@ -0,0 +1,163 @@
+#pragma once
+
+#include <array>
+#include <memory>
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <unordered_map>
+#include "adapter_shim.h"
+
+namespace quant {
+namespace core {
+namespace ems {
+
+// 往返时延估计：EWMA + 近期分布的 p99
+// 分布为对数分桶直方图（每个 2 的幂区间再分 4 档，误差约 19%），
+// 每累计 window 个样本计数减半，使分位数跟随最近的行为
+class LatencyEstimator {
+public:
+    explicit LatencyEstimator(double alpha = 0.1, uint32_t window = 1024);
+
+    void record(int64_t latency_ns);
+    void reset();
+
+    int64_t ewma_ns() const { return static_cast<int64_t>(ewma_ns_); }
+    int64_t percentile_ns(double quantile) const;
+    int64_t p99_ns() const { return percentile_ns(0.99); }
+    uint64_t samples() const { return samples_; }
+
+private:
+    static constexpr size_t kBuckets = 64 * 4;
+
+    static size_t bucket_of(int64_t latency_ns);
+    static int64_t bucket_upper(size_t bucket);
+
+    double alpha_;
+    uint32_t window_;
+    double ewma_ns_ = 0.0;
+    uint64_t samples_ = 0;
+    uint32_t since_decay_ = 0;
+    double total_ = 0.0;
+    std::array<double, kBuckets> counts_{};
+};
+
+// 路由配置（时间单位：微秒）
+struct RouterConfig {
+    double ewma_alpha = 0.1;              // RTT EWMA 平滑系数
+    int64_t initial_rtt_us = 1000;        // 尚无样本的适配器的假定 RTT（保证新适配器能被试探）
+    int64_t max_ewma_us = 50000;          // EWMA 超过该值判定为劣化
+    int64_t max_p99_us = 200000;          // p99 超过该值判定为劣化
+    double max_error_rate = 0.2;          // 拒单率（EWMA）超过该值判定为劣化
+    int64_t ack_timeout_us = 500000;      // 在途请求超过该时间未确认判定为劣化
+    int64_t request_timeout_us = 5000000; // 在途请求超过该时间仍无结果（不论通道是否劣化）：上报失败并移除
+    int64_t cooldown_us = 5000000;        // 劣化适配器冷却该时间后重新参与路由（估计值重置）
+    uint32_t min_samples = 20;            // 样本数达到该值后才按 EWMA/p99/拒单率判定劣化
+    bool failover_unacked = false;        // 劣化时转投未确认的请求（先在原适配器撤单，撤单成功后才转投）
+};
+
+// 路由后的完成通知
+struct RoutedCompletion {
+    size_t adapter = 0;                   // 受理该请求的适配器下标
+    OrderCompletion completion;
+};
+
+// 适配器健康状态快照
+struct AdapterHealth {
+    std::string id;
+    bool healthy = true;
+    int64_t ewma_us = 0;
+    int64_t p99_us = 0;
+    double error_rate = 0.0;
+    size_t in_flight = 0;
+    uint64_t routed = 0;                  // 路由到该适配器的请求数
+    uint64_t failovers = 0;               // 在该适配器撤单成功后转投到其他适配器的请求数
+    uint64_t failovers_aborted = 0;       // 撤单失败或先被确认、因而留在该适配器上的请求数
+    uint64_t timeouts = 0;                // 超过 request_timeout 仍无结果、被上报失败并移除的请求数
+};
+
+// 延迟感知的智能订单路由
+// - 合约能力表：每个合约可由哪些适配器执行（注册时指定，或取适配器的 supported_instruments）
+// - 每个适配器维护 RTT 估计（请求提交到完成通知的时间）和拒单率；报单路由到可执行该合约、
+//   健康且 EWMA 最低的适配器
+// - poll() 在回收完成通知后做健康检查：适配器劣化（时延/拒单率超限或确认超时）时不再接收新报单，
+//   冷却后重新参与路由；其上已提交的请求默认留在原适配器等待确认
+// - failover_unacked 开启时转投未确认的请求，但先在原适配器撤单：此时尚无交易通道订单号，撤单以原报单的
+//   request_id 和 OMS 订单号（Order::order_id）提交，由适配器按请求号定位报单（见 IAsyncExecutionAdapter）。
+//   撤单成功才用同一 request_id 转投到下一个最优适配器；撤单失败或原报单先被确认时，请求留在
+//   原适配器（确认照常上报），同一订单不会同时在两个交易通道上存活
+// - 在途请求（含撤单失败后等待确认的、劣化通道上未转投的）超过 request_timeout 仍无结果时上报失败并移除，
+//   订单状态未知，由 OMS 经查询/回报对账；之后到达的原报单确认被丢弃
+// 使用异步批量接口（同步适配器注册时经 make_async_adapter 包装，或预先用 PipelinedExecutionAdapter 包装）；
+// 非线程安全，由 OMS 线程独占调用
+class SmartOrderRouter {
+public:
+    explicit SmartOrderRouter(const RouterConfig& config = RouterConfig());
+
+    SmartOrderRouter(const SmartOrderRouter&) = delete;
+    SmartOrderRouter& operator=(const SmartOrderRouter&) = delete;
+
+    // 注册适配器，instruments 为空时使用 adapter->supported_instruments()；返回适配器下标
+    size_t add_adapter(std::shared_ptr<IExecutionAdapter> adapter,
+                       const std::vector<std::string>& instruments = {});
+
+    // 路由报单，返回 false 表示没有可用的适配器或提交失败
+    bool route(uint64_t request_id, const oms::Order& order, int64_t now_ns);
+
+    // 回收所有适配器的完成通知并执行健康检查与故障转移，返回写入 out 的数量
+    size_t poll(std::vector<RoutedCompletion>& out, int64_t now_ns);
+
+    // 选择路由目标（不提交），没有可用适配器返回 false
+    bool select(const std::string& instrument, size_t& adapter) const;
+
+    std::vector<AdapterHealth> health() const;
+    size_t adapter_count() const { return adapters_.size(); }
+
+private:
+    struct AdapterState {
+        std::shared_ptr<IAsyncExecutionAdapter> adapter;
+        LatencyEstimator rtt;
+        double error_rate = 0.0;
+        bool healthy = true;
+        int64_t degraded_at_ns = 0;
+        size_t in_flight = 0;
+        uint64_t routed = 0;
+        uint64_t failovers = 0;
+        uint64_t failovers_aborted = 0;
+        uint64_t timeouts = 0;
+    };
+
+    // 在途请求的阶段：转投前的撤单结果返回之前，请求始终归属原适配器
+    enum class Phase : uint8_t {
+        kSent,          // 已提交，等待确认
+        kCancelling,    // 原适配器劣化，已提交撤单，等待撤单结果
+        kAwaitAck,      // 撤单失败：订单可能仍在原适配器上，只等待其确认，不再转投
+    };
+
+    struct InFlight {
+        size_t adapter = 0;
+        int64_t sent_ns = 0;
+        Phase phase = Phase::kSent;
+        bool acked = false;           // kCancelling 期间原报单已被确认（确认已上报，撤单结果吸收）
+        oms::Order order;
+    };
+
+    bool submit(uint64_t request_id, InFlight& entry, size_t adapter, int64_t now_ns);
+    void on_completion(size_t adapter, OrderCompletion& completion, std::vector<RoutedCompletion>& out,
+                       int64_t now_ns);
+    void on_failover_cancel(uint64_t request_id, InFlight& entry, const OrderCompletion& completion,
+                            std::vector<RoutedCompletion>& out, int64_t now_ns);
+    void fail(uint64_t request_id, size_t adapter, const std::string& message, std::vector<RoutedCompletion>& out);
+    void expire_requests(std::vector<RoutedCompletion>& out, int64_t now_ns);
+    void check_health(int64_t now_ns);
+
+    RouterConfig config_;
+    std::vector<AdapterState> adapters_;
+    std::unordered_map<std::string, std::vector<size_t>> capabilities_;    // 合约 -> 适配器下标
+    std::unordered_map<uint64_t, InFlight> in_flight_;                     // request_id -> 在途请求（含转投中的请求）
+    std::vector<OrderCompletion> completion_buffer_;
+};
+
+} // namespace ems
+} // namespace core
+} // namespace quant
@@ -7,6 +7,8 @@
 #include <mutex>
 #include <typeindex>
 #include "event.h"
+#include "../trace/tick_trace.h"
+#include "common/metrics/metrics.h"
 
 namespace quant {
 namespace core {
@@ -37,10 +39,13 @@ public:
     // 发布事件
     template <typename EventType>
     void publish(const EventType& event) {
+        QT_TRACE_STAGE(trace::TickStage::kEventBusPublish);
         std::lock_guard<std::mutex> lock(mutex_);
         auto type = std::type_index(typeid(EventType));
         auto it = handlers_.find(type);
+        published_.inc();
         if (it != handlers_.end()) {
+            dispatched_.add(it->second.size());
             for (const auto& handler : it->second) {
                 handler(event);
             }
@@ -53,6 +58,12 @@ private:
     std::mutex mutex_;
     using Handler = std::function<void(const Event&)>;
     std::unordered_map<std::type_index, std::vector<Handler>> handlers_;
+
+    // 监控指标：发布次数与处理函数调用次数
+    base::common::metrics::Counter published_ =
+        base::common::metrics::MetricsRegistry::instance().counter("event_bus.published");
+    base::common::metrics::Counter dispatched_ =
+        base::common::metrics::MetricsRegistry::instance().counter("event_bus.dispatched");
 };
 
 } // namespace event_bus
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <string>
+#include "event.h"
+#include "../market_data/tick_data.h"
+#include "../oms/order.h"
+#include "../oms/trade.h"
+
+namespace quant {
+namespace core {
+namespace event_bus {
+
+// 行情事件：MarketDataProcessor 解码后发布，策略引擎扇出到各执行通道
+struct TickEvent : public Event {
+    market_data::TickData tick;
+};
+
+// 订单回报事件：OMS 发布，只投递给下单策略
+struct OrderEvent : public Event {
+    std::string strategy_id;
+    oms::Order order;
+};
+
+// 成交回报事件：OMS 发布，只投递给下单策略
+struct TradeEvent : public Event {
+    std::string strategy_id;
+    oms::Trade trade;
+};
+
+} // namespace event_bus
+} // namespace core
+} // namespace quant
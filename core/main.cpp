@@ -1,5 +1,8 @@
 #include <iostream>
 #include <memory>
+#include <string>
+#include <utility>
+#include <vector>
 #include "event_bus/event_bus.h"
 #include "market_data/market_data_processor.h"
 #include "strategy/strategy_engine.h"
@@ -7,6 +10,7 @@
 #include "ems/execution_manager.h"
 #include "account/account_manager.h"
 #include "risk/risk_manager.h"
+#include "startup/startup_orchestrator.h"
 #include "../services/config_service/config_client.h"
 
 int main(int argc, char* argv[]) {
@@ -18,73 +22,143 @@ int main(int argc, char* argv[]) {
         quant::services::config::ConfigClient config_client(
             grpc::CreateChannel("localhost:50051", grpc::InsecureChannelCredentials()));
         
-        // 初始化账户管理器
+        // 构造各组件（仅绑定依赖，不做 I/O）
         quant::core::account::AccountManager account_manager(event_bus, config_client);
-        if (!account_manager.initialize()) {
-            std::cerr << "Failed to initialize account manager" << std::endl;
-            return 1;
-        }
-        
-        // 初始化风险管理器
         quant::core::risk::RiskManager risk_manager(event_bus, config_client, account_manager);
-        if (!risk_manager.initialize()) {
-            std::cerr << "Failed to initialize risk manager" << std::endl;
-            return 1;
-        }
-        
-        // 初始化执行管理器
         quant::core::ems::ExecutionManager execution_manager(event_bus, config_client);
-        if (!execution_manager.initialize()) {
-            std::cerr << "Failed to initialize execution manager" << std::endl;
-            return 1;
-        }
-        
-        // 初始化订单管理器
         quant::core::oms::OrderManager order_manager(
             event_bus, config_client, execution_manager, risk_manager, account_manager);
-        if (!order_manager.initialize()) {
-            std::cerr << "Failed to initialize order manager" << std::endl;
-            return 1;
-        }
-        
-        // 初始化行情处理器
         quant::core::market_data::MarketDataProcessor market_data_processor(event_bus);
-        if (!market_data_processor.initialize("config/market_data.json")) {
-            std::cerr << "Failed to initialize market data processor" << std::endl;
-            return 1;
+        quant::core::strategy::StrategyEngine strategy_engine(event_bus);
+
+        // 分阶段并行初始化：互不依赖的组件同时连接/拉取配置；
+        // 同一处理器/引擎上的插件加载放在同一互斥组内串行执行
+        quant::core::startup::StartupOrchestrator startup;
+        startup.add("account_manager", [&]() { return account_manager.initialize(); });
+        startup.add("risk_manager", [&]() { return risk_manager.initialize(); }, {"account_manager"});
+        startup.add("execution_manager", [&]() { return execution_manager.initialize(); });
+        startup.add("order_manager", [&]() { return order_manager.initialize(); },
+                    {"execution_manager", "risk_manager", "account_manager"});
+        startup.add("market_data_processor", [&]() {
+            if (!market_data_processor.initialize("config/market_data.json")) {
+                return false;
+            }
+            // 共享内存行情总线创建失败只影响进程外读者，不阻止启动
+            std::string tick_bus_error;
+            auto tick_bus = quant::base::utils::tick_bus::TickBusPublisher::create(
+                quant::base::utils::tick_bus::kDefaultBusName, 65536, &tick_bus_error);
+            if (tick_bus) {
+                market_data_processor.attach_tick_bus(std::move(tick_bus));
+            } else {
+                std::cerr << "Tick bus disabled: " << tick_bus_error << std::endl;
+            }
+            return true;
+        });
+
+        // 加载数据源（单个插件加载失败不影响启动，与其余数据源一起启动）
+        const std::vector<std::pair<std::string, std::string>> data_sources = {
+            {"CTP", "plugins/data_sources/ctp_data_source.so"},
+            {"Binance", "plugins/data_sources/binance_data_source.so"},
+        };
+        std::vector<std::string> data_source_stages;
+        for (const auto& source : data_sources) {
+            data_source_stages.push_back("data_source." + source.first);
+            startup.add(data_source_stages.back(), [&market_data_processor, source]() {
+                if (!market_data_processor.load_data_source(source.first, source.second)) {
+                    std::cerr << "Failed to load data source " << source.first << std::endl;
+                }
+                return true;
+            }, {"market_data_processor"}, "market_data_processor");
         }
-        
-        // 加载数据源
-        market_data_processor.load_data_source("CTP", "plugins/data_sources/ctp_data_source.so");
-        market_data_processor.load_data_source("Binance", "plugins/data_sources/binance_data_source.so");
-        
-        // 启动数据源
-        if (!market_data_processor.start_all()) {
-            std::cerr << "Failed to start data sources" << std::endl;
-            return 1;
+        // 暖启动：数据源启动前恢复最新行情表（行情线程启动后只由其自身写入）
+        const std::string checkpoint_path = "state/checkpoint.bin";
+        auto image = quant::base::common::checkpoint::CheckpointImage::open(checkpoint_path);
+        data_source_stages.push_back("market_data.restore");
+        startup.add(data_source_stages.back(), [&market_data_processor, &image]() {
+            if (image) {
+                size_t restored = market_data_processor.restore_checkpoint(*image);
+                std::cout << "Restored " << restored << " last ticks from checkpoint #" << image->sequence() << std::endl;
+            }
+            return true;
+        }, {"market_data_processor"}, "market_data_processor");
+        startup.add("data_sources.start", [&]() { return market_data_processor.start_all(); },
+                    data_source_stages);
+
+        // 策略配置与策略插件
+        startup.add("strategy_config", [&]() { return strategy_engine.load_config("config/strategies.json"); });
+        for (const char* plugin : {"trend_following", "arbitrage"}) {
+            std::string path = std::string("plugins/strategies/") + plugin + ".so";
+            startup.add(std::string("strategy_plugin.") + plugin, [&strategy_engine, path]() {
+                strategy_engine.load_strategy_plugin(path);
+                return true;
+            }, {"strategy_config"}, "strategy_engine");
         }
-        
-        // 初始化策略引擎
-        quant::core::strategy::StrategyEngine strategy_engine(event_bus);
-        if (!strategy_engine.load_config("config/strategies.json")) {
-            std::cerr << "Failed to load strategy config" << std::endl;
+
+        bool started = false;
+        {
+            auto startup_pool = quant::base::common::thread_pool::ThreadPool::create(4, "startup");
+            started = startup.run(*startup_pool);
+        }
+        std::cout << startup.report();
+        if (!started) {
+            std::cerr << "Startup failed: " << startup.error() << std::endl;
+            market_data_processor.stop_all();
             return 1;
         }
         
-        // 加载策略插件
-        strategy_engine.load_strategy_plugin("plugins/strategies/trend_following.so");
-        strategy_engine.load_strategy_plugin("plugins/strategies/arbitrage.so");
-        
         // 创建策略实例
         // ...
         
+        // 执行通道：每个通道独占一个线程，策略按 ID 轮转分配；引擎构造时已订阅事件总线，
+        // 总线上的行情扇出到各通道，订单/成交回报只投递到下单策略所在的通道
+        std::vector<quant::core::strategy::LaneConfig> lane_configs;
+        for (size_t i = 0; i < 2; ++i) {
+            quant::core::strategy::LaneConfig lane;
+            lane.name = "strategy_lane." + std::to_string(i);
+            lane_configs.push_back(lane);
+        }
+        size_t placed = strategy_engine.configure_lanes(lane_configs);
+        std::cout << "Placed " << placed << " strategies on " << lane_configs.size() << " execution lanes" << std::endl;
+        
+        // 暖启动：从上一次的检查点恢复策略状态，跳过指标预热
+        if (image) {
+            size_t restored = strategy_engine.restore_checkpoint(*image);
+            std::cout << "Restored " << restored << " strategies from checkpoint #" << image->sequence() << std::endl;
+            image.reset();
+        }
+        
+        // 周期检查点（后台线程，交易线程不暂停）
+        quant::base::common::checkpoint::CheckpointOptions checkpoint_options;
+        checkpoint_options.path = checkpoint_path;
+        std::string checkpoint_error;
+        auto checkpointer = quant::base::common::checkpoint::Checkpointer::create(checkpoint_options, &checkpoint_error);
+        if (!checkpointer) {
+            std::cerr << "Checkpoint disabled: " << checkpoint_error << std::endl;
+        }
+        
         // 启动所有策略
         strategy_engine.start_all_strategies();
+        if (checkpointer) {
+            // 段注册失败时该部分状态不会被保存，启动日志中明确报告
+            std::string failed;
+            if (!strategy_engine.register_checkpoints(*checkpointer, &failed)) {
+                std::cerr << "Checkpoint sections not registered: " << failed << std::endl;
+            }
+            if (!market_data_processor.register_checkpoints(*checkpointer)) {
+                std::cerr << "Checkpoint section not registered: market_data.last_ticks" << std::endl;
+            }
+            checkpointer->start();
+        }
         
         // 等待用户输入退出
         std::cout << "Quant trading system is running. Press Enter to exit..." << std::endl;
         std::cin.get();
         
+        // 退出前保存最后一次检查点，再停止策略
+        if (checkpointer) {
+            checkpointer->stop();
+        }
+        
         // 停止策略
         strategy_engine.stop_all_strategies();
         
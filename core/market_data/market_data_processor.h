@@ -1,12 +1,22 @@
 #pragma once
 
+#include <algorithm>
+#include <chrono>
+#include <cstring>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_map>
+#include <vector>
 #include "data_source.h"
 #include "../event_bus/event_bus.h"
+#include "../event_bus/trading_events.h"
+#include "../trace/tick_trace.h"
 #include "tick_data.h"
 #include "bar_data.h"
+#include "common/checkpoint/checkpoint.h"
+#include "utils/tick_bus/tick_bus.h"
+#include "utils/tick_decoder/tick_decoder.h"
 
 namespace quant {
 namespace core {
@@ -36,16 +46,134 @@ public:
     // 停止所有数据源
     void stop_all();
     
+    // 挂接共享内存行情总线：标准化后的行情除发布到事件总线外再写入一次，
+    // 供本机回测/监控/研究等进程零拷贝读取（未挂接时不写）。须在 start_all() 之前调用
+    void attach_tick_bus(std::shared_ptr<base::utils::tick_bus::TickBusPublisher> tick_bus) {
+        std::lock_guard<std::mutex> lock(tick_mutex_);
+        tick_bus_ = std::move(tick_bus);
+    }
+    
+    // 数据源行情回调入口（数据源线程调用）：解码 -> 更新最新行情表 -> 写入行情总线 -> 生成K线
+    // -> 发布 TickEvent 到事件总线（发布前对 process_raw_tick 阶段打点）；解码失败的帧计入 market_data.decode_errors 后丢弃。
+    // 各数据源线程在 tick_mutex_ 下串行更新共享状态（行情总线只允许单写者，写者从不等待读者）
+    void process_raw_tick(const std::string& data_source, const RawTickData& raw_tick) {
+        core::event_bus::TickEvent event;
+        if (decode_raw_tick(raw_tick, event.tick) != base::utils::tick_decoder::DecodeStatus::kOk) {
+            decode_errors_.inc();
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(tick_mutex_);
+            record_last_tick(data_source, event.tick);
+            if (tick_bus_) {
+                tick_bus_->publish(event.tick);
+            }
+            generate_bars(event.tick);
+        }
+        QT_TRACE_STAGE(trace::TickStage::kProcessRawTick);
+        event_bus_.publish(event);
+    }
+    
+    // 查询某数据源某合约的最新行情，尚无行情时返回 false
+    bool get_last_tick(const std::string& data_source, const std::string& instrument, TickData& tick) const {
+        std::lock_guard<std::mutex> lock(tick_mutex_);
+        auto source = last_ticks_.find(data_source);
+        if (source == last_ticks_.end()) {
+            return false;
+        }
+        auto entry = source->second.find(instrument);
+        if (entry == source->second.end()) {
+            return false;
+        }
+        tick = entry->second;
+        return true;
+    }
+    
+    // 注册检查点段 "market_data.last_ticks"（各数据源各合约的最新行情），段注册失败时返回 false。
+    // 采集经 CheckpointCell 交接：行情线程在 record_last_tick() 中复制快照，检查点线程不读实时表；
+    // 超时（期间没有行情到达）时沿用该段上一次的内容
+    bool register_checkpoints(base::common::checkpoint::Checkpointer& checkpointer,
+                              std::chrono::milliseconds timeout = std::chrono::milliseconds(200)) {
+        return checkpointer.add_section("market_data.last_ticks", [this, timeout](std::string& out) {
+            return last_ticks_cell_.collect([&out](const std::vector<LastTickRecord>& records) {
+                out.clear();
+                base::common::checkpoint::append_pod_array(out, records.data(), records.size());
+            }, timeout);
+        });
+    }
+    
+    // 暖启动：在 start_all() 之前从检查点恢复最新行情表，返回恢复的记录数
+    size_t restore_checkpoint(const base::common::checkpoint::CheckpointImage& image) {
+        const uint8_t* data = nullptr;
+        size_t size = 0;
+        if (!image.find("market_data.last_ticks", data, size)) {
+            return 0;
+        }
+        const uint8_t* end = data + size;
+        size_t restored = 0;
+        LastTickRecord record;
+        while (base::common::checkpoint::read_pod(data, end, record)) {
+            if (record.tick.version != base::utils::tick_bus::kBusTickVersion) {
+                continue;
+            }
+            record.data_source[sizeof(record.data_source) - 1] = '\0';
+            TickData tick{};
+            base::utils::tick_bus::from_bus_tick(record.tick, tick);
+            last_ticks_[record.data_source][tick.instrument] = tick;
+            ++restored;
+        }
+        return restored;
+    }
+    
 private:
-    // 处理原始行情数据
-    void process_raw_tick(const std::string& data_source, const RawTickData& raw_tick);
+    // 检查点记录：数据源名 + 行情总线的定长行情布局
+    struct LastTickRecord {
+        char data_source[base::utils::tick_bus::kMaxInstrument];
+        base::utils::tick_bus::BusTick tick;
+    };
+    
+    // 更新最新行情表：process_raw_tick() 解码成功后在 tick_mutex_ 下调用（各数据源线程串行写入）；
+    // 检查点线程发出请求时在此安全点把整张表复制到影子副本（无请求时只有一次 relaxed 读取）
+    void record_last_tick(const std::string& data_source, const TickData& tick) {
+        last_ticks_[data_source][tick.instrument] = tick;
+        if (!last_ticks_cell_.requested()) {
+            return;
+        }
+        last_ticks_cell_.offer_with([this](std::vector<LastTickRecord>& shadow) {
+            shadow.clear();
+            for (const auto& source : last_ticks_) {
+                for (const auto& entry : source.second) {
+                    LastTickRecord record{};
+                    size_t length = std::min(source.first.size(), sizeof(record.data_source) - 1);
+                    std::memcpy(record.data_source, source.first.data(), length);
+                    base::utils::tick_bus::to_bus_tick(entry.second, record.tick);
+                    shadow.push_back(record);
+                }
+            }
+        });
+    }
     
     // 生成K线数据
     void generate_bars(const TickData& tick);
     
+    // 原始帧解码：CTP 为定长结构体，Binance 为行情 JSON（按模式直接写入 TickData，不构建 DOM）
+    base::utils::tick_decoder::DecodeStatus decode_raw_tick(const RawTickData& raw_tick, TickData& tick) const {
+        if (raw_tick.data_source == "CTP") {
+            return ctp_decoder_.decode(raw_tick.raw_data, tick);
+        }
+        return json_decoder_.decode(raw_tick.raw_data, tick);
+    }
+    
     core::event_bus::EventBus& event_bus_;
     std::unordered_map<std::string, std::shared_ptr<IDataSource>> data_sources_;
+    mutable std::mutex tick_mutex_;     // 串行化各数据源线程对最新行情表、行情总线与K线状态的更新
     std::unordered_map<std::string, std::unordered_map<std::string, TickData>> last_ticks_;
+    base::common::checkpoint::CheckpointCell<std::vector<LastTickRecord>> last_ticks_cell_;   // 最新行情表的检查点交接
+    std::shared_ptr<base::utils::tick_bus::TickBusPublisher> tick_bus_;
+    base::utils::tick_decoder::JsonTickDecoder json_decoder_{base::utils::tick_decoder::JsonTickSchema::binance_ticker()};
+    base::utils::tick_decoder::CtpTickDecoder ctp_decoder_;
+    base::common::metrics::Counter decode_errors_ =
+        base::common::metrics::MetricsRegistry::instance().counter("market_data.decode_errors");
     // 其他成员变量...
 };
 
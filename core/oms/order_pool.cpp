@@ -0,0 +1,66 @@
+#include "order_pool.h"
+
+namespace quant {
+namespace core {
+namespace oms {
+
+OrderPool::OrderPool(size_t capacity)
+    : orders_(capacity),
+      by_exchange_id_(capacity),
+      exchange_ids_(capacity) {}
+
+Order* OrderPool::create(InternalOrderId& id) {
+    id = orders_.acquire();
+    return id == kInvalidOrderId ? nullptr : orders_.get(id);
+}
+
+Order* OrderPool::find(InternalOrderId id) {
+    return orders_.get(id);
+}
+
+bool OrderPool::bind_exchange_id(InternalOrderId id, std::string_view exchange_id) {
+    if (orders_.get(id) == nullptr) {
+        return false;
+    }
+    ExchangeOrderId key(exchange_id);
+    ExchangeOrderId& bound = exchange_ids_[Pool::index_of(id)];
+    if (key.empty() || !bound.empty()) {
+        return false;
+    }
+    if (!by_exchange_id_.insert(key, id)) {
+        return false;
+    }
+    bound = key;
+    return true;
+}
+
+Order* OrderPool::find_by_exchange_id(std::string_view exchange_id, InternalOrderId* id) {
+    ExchangeOrderId key(exchange_id);
+    if (key.empty()) {
+        return nullptr;
+    }
+    const InternalOrderId* found = by_exchange_id_.find(key);
+    if (found == nullptr) {
+        return nullptr;
+    }
+    if (id != nullptr) {
+        *id = *found;
+    }
+    return orders_.get(*found);
+}
+
+bool OrderPool::release(InternalOrderId id) {
+    if (orders_.get(id) == nullptr) {
+        return false;
+    }
+    ExchangeOrderId& bound = exchange_ids_[Pool::index_of(id)];
+    if (!bound.empty()) {
+        by_exchange_id_.erase(bound);
+        bound = ExchangeOrderId();
+    }
+    return orders_.release(id);
+}
+
+} // namespace oms
+} // namespace core
+} // namespace quant
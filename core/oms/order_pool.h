@@ -0,0 +1,95 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <string_view>
+#include "order.h"
+#include "common/object_pool/object_pool.h"
+#include "common/flat_hash_map/flat_hash_map.h"
+
+namespace quant {
+namespace core {
+namespace oms {
+
+// 内部订单号：订单池句柄（槽位下标 + 代数），订单释放后旧编号自动失效
+using InternalOrderId = uint64_t;
+constexpr InternalOrderId kInvalidOrderId = 0;
+
+// 交易所订单号：定长内联存储，作为索引键时不做堆分配
+class ExchangeOrderId {
+public:
+    static constexpr size_t kMaxLength = 39;
+
+    ExchangeOrderId() = default;
+
+    // 超过 kMaxLength 的编号无法表示，构造结果为空（调用方通过 empty() 判断）
+    explicit ExchangeOrderId(std::string_view id) {
+        if (id.size() <= kMaxLength) {
+            std::memcpy(data_, id.data(), id.size());
+            length_ = static_cast<uint8_t>(id.size());
+        }
+    }
+
+    std::string_view view() const { return std::string_view(data_, length_); }
+    bool empty() const { return length_ == 0; }
+
+    bool operator==(const ExchangeOrderId& other) const { return view() == other.view(); }
+    bool operator!=(const ExchangeOrderId& other) const { return !(*this == other); }
+
+private:
+    uint8_t length_ = 0;
+    char data_[kMaxLength] = {};
+};
+
+struct ExchangeOrderIdHash {
+    size_t operator()(const ExchangeOrderId& id) const {
+        return std::hash<std::string_view>()(id.view());
+    }
+};
+
+// 订单池：OMS 的订单存储与索引
+// - 订单对象在预分配的定长槽位中创建，运行期无 new/make_shared
+// - 内部订单号直接定位槽位；交易所订单号经开放寻址表映射到内部订单号，
+//   OrderCallback/TradeCallback 的回报查找通常一次探测完成
+// - 非线程安全：只由订单管理线程访问
+class OrderPool {
+public:
+    // capacity 为同时在途（未释放）订单的上限
+    explicit OrderPool(size_t capacity);
+
+    OrderPool(const OrderPool&) = delete;
+    OrderPool& operator=(const OrderPool&) = delete;
+
+    // 创建订单：返回默认状态的订单供调用方填写，id 输出内部订单号；池满返回 nullptr
+    Order* create(InternalOrderId& id);
+
+    // 按内部订单号查找，已释放或无效返回 nullptr
+    Order* find(InternalOrderId id);
+
+    // 交易所确认后绑定交易所订单号（每个订单只能绑定一次，编号不可重复）
+    bool bind_exchange_id(InternalOrderId id, std::string_view exchange_id);
+
+    // 按交易所订单号查找（回报路径），id 非空时同时输出内部订单号
+    Order* find_by_exchange_id(std::string_view exchange_id, InternalOrderId* id = nullptr);
+
+    // 释放订单（终态后调用），同时解除交易所订单号索引
+    bool release(InternalOrderId id);
+
+    size_t size() const { return orders_.size(); }
+    size_t capacity() const { return orders_.capacity(); }
+
+private:
+    using Pool = base::common::object_pool::ObjectPool<Order>;
+    using Index = base::common::flat_hash_map::FlatHashMap<ExchangeOrderId, InternalOrderId, ExchangeOrderIdHash>;
+
+    Pool orders_;                                   // 订单槽位
+    Index by_exchange_id_;                          // 交易所订单号 -> 内部订单号
+    std::vector<ExchangeOrderId> exchange_ids_;     // 槽位下标 -> 已绑定的交易所订单号
+};
+
+} // namespace oms
+} // namespace core
+} // namespace quant
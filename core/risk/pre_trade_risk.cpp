@@ -0,0 +1,239 @@
+#include "pre_trade_risk.h"
+
+#include <cmath>
+#include <limits>
+#include <algorithm>
+#include "../trace/tick_trace.h"
+
+namespace quant {
+namespace core {
+namespace risk {
+
+namespace {
+
+constexpr uint64_t kPriceMask = 0xFFFFFFFFull;
+
+uint64_t resting_count(uint64_t state) { return state >> 32; }
+uint64_t resting_price(uint64_t state) { return state & kPriceMask; }
+
+// 登记一笔挂单：is_bid 时最优价取最大值，否则取最小值；首笔挂单直接设置最优价
+void add_resting(std::atomic<uint64_t>& side, uint64_t ticks, bool is_bid) {
+    uint64_t state = side.load(std::memory_order_relaxed);
+    for (;;) {
+        uint64_t count = resting_count(state);
+        uint64_t best = count == 0 ? ticks
+                                   : (is_bid ? std::max(resting_price(state), ticks)
+                                             : std::min(resting_price(state), ticks));
+        if (side.compare_exchange_weak(state, ((count + 1) << 32) | best, std::memory_order_seq_cst)) {
+            return;
+        }
+    }
+}
+
+// 移除一笔挂单：只减少计数，最优价保留到该方向清空
+void remove_resting(std::atomic<uint64_t>& side) {
+    uint64_t state = side.load(std::memory_order_relaxed);
+    while (resting_count(state) != 0 &&
+           !side.compare_exchange_weak(state, state - (1ull << 32), std::memory_order_seq_cst)) {
+    }
+}
+
+// 买单价格不低于本方最低卖价，或卖单价格不高于本方最高买价，即可能自成交
+bool crosses_own(const std::atomic<uint64_t>& opposite, uint64_t ticks, bool is_buy) {
+    uint64_t state = opposite.load(std::memory_order_seq_cst);
+    if (resting_count(state) == 0) {
+        return false;
+    }
+    return is_buy ? ticks >= resting_price(state) : ticks <= resting_price(state);
+}
+
+} // namespace
+
+const char* to_string(RiskDecision decision) {
+    switch (decision) {
+    case RiskDecision::kAccepted: return "accepted";
+    case RiskDecision::kUnknownInstrument: return "unknown instrument";
+    case RiskDecision::kOrderVolumeLimit: return "order volume limit";
+    case RiskDecision::kOrderNotionalLimit: return "order notional limit";
+    case RiskDecision::kSelfTrade: return "self trade";
+    case RiskDecision::kOrderRateLimit: return "order rate limit";
+    case RiskDecision::kAccountNotionalLimit: return "account notional limit";
+    case RiskDecision::kPositionLimit: return "position limit";
+    }
+    return "unknown";
+}
+
+PreTradeRiskEngine::PreTradeRiskEngine(size_t max_accounts, size_t max_instruments)
+    : max_accounts_(max_accounts),
+      max_instruments_(max_instruments),
+      instruments_(max_instruments),
+      accounts_(max_accounts),
+      cells_(max_accounts * max_instruments) {}
+
+bool PreTradeRiskEngine::set_instrument_rule(uint32_t instrument, const InstrumentRule& rule) {
+    if (instrument >= max_instruments_ || rule.multiplier <= 0.0 || rule.tick_size <= 0.0) {
+        return false;
+    }
+    instruments_[instrument].rule = rule;
+    instruments_[instrument].configured = true;
+    return true;
+}
+
+bool PreTradeRiskEngine::set_account_rule(uint32_t account, const AccountRule& rule) {
+    if (account >= max_accounts_) {
+        return false;
+    }
+    AccountState& state = accounts_[account];
+    state.max_outstanding_notional = rule.max_outstanding_notional > 0.0
+        ? std::llround(rule.max_outstanding_notional * kNotionalScale)
+        : INT64_MAX;
+    state.throttle.configure(rule.orders_per_second, rule.order_burst);
+    return true;
+}
+
+bool PreTradeRiskEngine::set_position_limit(uint32_t account, uint32_t instrument,
+                                            int64_t max_long, int64_t max_short) {
+    if (account >= max_accounts_ || instrument >= max_instruments_) {
+        return false;
+    }
+    PositionCell& target = cell(account, instrument);
+    target.max_long = max_long > 0 ? max_long : INT64_MAX;
+    target.max_short = max_short > 0 ? max_short : INT64_MAX;
+    return true;
+}
+
+RiskDecision PreTradeRiskEngine::check(const RiskOrder& order) {
+    return check(order, base::common::token_bucket::TokenBucket::now_ns());
+}
+
+RiskDecision PreTradeRiskEngine::check(const RiskOrder& order, int64_t now_ns) {
+    QT_TRACE_STAGE(trace::TickStage::kRiskCheck);
+    // 1. 无状态检查：编号、单笔数量与金额
+    if (order.account >= max_accounts_ || order.instrument >= max_instruments_ ||
+        !instruments_[order.instrument].configured) {
+        return reject(RiskDecision::kUnknownInstrument);
+    }
+    const InstrumentRule& rule = instruments_[order.instrument].rule;
+    if (order.volume <= 0 || (rule.max_order_volume > 0 && order.volume > rule.max_order_volume)) {
+        return reject(RiskDecision::kOrderVolumeLimit);
+    }
+    double notional = order.price * static_cast<double>(order.volume) * rule.multiplier;
+    if (rule.max_order_notional > 0.0 && notional > rule.max_order_notional) {
+        return reject(RiskDecision::kOrderNotionalLimit);
+    }
+
+    PositionCell& target = cell(order.account, order.instrument);
+    std::atomic<uint64_t>& own_side = order.is_buy ? target.resting_bids : target.resting_asks;
+    std::atomic<uint64_t>& opposite = order.is_buy ? target.resting_asks : target.resting_bids;
+    uint64_t ticks = static_cast<uint64_t>(to_ticks(rule, order.price));
+    if (crosses_own(opposite, ticks, order.is_buy)) {
+        return reject(RiskDecision::kSelfTrade);
+    }
+
+    // 2. 报单频率
+    AccountState& account = accounts_[order.account];
+    if (!account.throttle.try_acquire(now_ns)) {
+        return reject(RiskDecision::kOrderRateLimit);
+    }
+
+    // 3. 预占在途金额与持仓额度，超限回滚
+    int64_t units = to_notional_units(rule, order.price, order.volume);
+    if (account.outstanding_notional.fetch_add(units, std::memory_order_relaxed) + units >
+        account.max_outstanding_notional) {
+        account.outstanding_notional.fetch_sub(units, std::memory_order_relaxed);
+        return reject(RiskDecision::kAccountNotionalLimit);
+    }
+
+    std::atomic<int64_t>& pending = order.is_buy ? target.pending_buy : target.pending_sell;
+    int64_t reserved = pending.fetch_add(order.volume, std::memory_order_relaxed) + order.volume;
+    int64_t position = target.position.load(std::memory_order_relaxed);
+    bool over = order.is_buy ? position + reserved > target.max_long
+                             : reserved - position > target.max_short;
+    if (over) {
+        pending.fetch_sub(order.volume, std::memory_order_relaxed);
+        account.outstanding_notional.fetch_sub(units, std::memory_order_relaxed);
+        return reject(RiskDecision::kPositionLimit);
+    }
+
+    // 4. 登记挂单后复查对手方，排除并发的对向报单
+    add_resting(own_side, ticks, order.is_buy);
+    if (crosses_own(opposite, ticks, order.is_buy)) {
+        remove_resting(own_side);
+        pending.fetch_sub(order.volume, std::memory_order_relaxed);
+        account.outstanding_notional.fetch_sub(units, std::memory_order_relaxed);
+        return reject(RiskDecision::kSelfTrade);
+    }
+    return RiskDecision::kAccepted;
+}
+
+void PreTradeRiskEngine::on_fill(const RiskOrder& order, int64_t fill_volume) {
+    if (order.account >= max_accounts_ || order.instrument >= max_instruments_ || fill_volume <= 0) {
+        return;
+    }
+    const InstrumentRule& rule = instruments_[order.instrument].rule;
+    PositionCell& target = cell(order.account, order.instrument);
+    // 先增加持仓再释放在途，中间状态只会高估敞口
+    target.position.fetch_add(order.is_buy ? fill_volume : -fill_volume, std::memory_order_relaxed);
+    (order.is_buy ? target.pending_buy : target.pending_sell).fetch_sub(fill_volume, std::memory_order_relaxed);
+    accounts_[order.account].outstanding_notional.fetch_sub(
+        to_notional_units(rule, order.price, fill_volume), std::memory_order_relaxed);
+}
+
+void PreTradeRiskEngine::on_order_closed(const RiskOrder& order, int64_t remaining_volume) {
+    if (order.account >= max_accounts_ || order.instrument >= max_instruments_) {
+        return;
+    }
+    const InstrumentRule& rule = instruments_[order.instrument].rule;
+    PositionCell& target = cell(order.account, order.instrument);
+    if (remaining_volume > 0) {
+        (order.is_buy ? target.pending_buy : target.pending_sell).fetch_sub(remaining_volume, std::memory_order_relaxed);
+        accounts_[order.account].outstanding_notional.fetch_sub(
+            to_notional_units(rule, order.price, remaining_volume), std::memory_order_relaxed);
+    }
+    remove_resting(order.is_buy ? target.resting_bids : target.resting_asks);
+}
+
+int64_t PreTradeRiskEngine::position(uint32_t account, uint32_t instrument) const {
+    if (account >= max_accounts_ || instrument >= max_instruments_) {
+        return 0;
+    }
+    return cell(account, instrument).position.load(std::memory_order_relaxed);
+}
+
+int64_t PreTradeRiskEngine::pending_volume(uint32_t account, uint32_t instrument, bool is_buy) const {
+    if (account >= max_accounts_ || instrument >= max_instruments_) {
+        return 0;
+    }
+    const PositionCell& target = cell(account, instrument);
+    return (is_buy ? target.pending_buy : target.pending_sell).load(std::memory_order_relaxed);
+}
+
+double PreTradeRiskEngine::outstanding_notional(uint32_t account) const {
+    if (account >= max_accounts_) {
+        return 0.0;
+    }
+    return static_cast<double>(accounts_[account].outstanding_notional.load(std::memory_order_relaxed)) /
+           kNotionalScale;
+}
+
+uint64_t PreTradeRiskEngine::rejected(RiskDecision decision) const {
+    return rejected_[static_cast<size_t>(decision)].load(std::memory_order_relaxed);
+}
+
+int64_t PreTradeRiskEngine::to_notional_units(const InstrumentRule& rule, double price, int64_t volume) const {
+    return std::llround(price * static_cast<double>(volume) * rule.multiplier * kNotionalScale);
+}
+
+int64_t PreTradeRiskEngine::to_ticks(const InstrumentRule& rule, double price) {
+    double ticks = std::round(price / rule.tick_size);
+    return static_cast<int64_t>(std::clamp(ticks, 0.0, static_cast<double>(kPriceMask)));
+}
+
+RiskDecision PreTradeRiskEngine::reject(RiskDecision decision) {
+    rejected_[static_cast<size_t>(decision)].fetch_add(1, std::memory_order_relaxed);
+    return decision;
+}
+
+} // namespace risk
+} // namespace core
+} // namespace quant
@@ -0,0 +1,142 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include "common/token_bucket/token_bucket.h"
+
+namespace quant {
+namespace core {
+namespace risk {
+
+// 事前风控检查结果
+enum class RiskDecision : uint8_t {
+    kAccepted,
+    kUnknownInstrument,       // 账户/合约编号越界或合约未配置
+    kOrderVolumeLimit,        // 单笔数量超限
+    kOrderNotionalLimit,      // 单笔金额超限
+    kSelfTrade,               // 与本账户同合约的对手方挂单可能成交
+    kOrderRateLimit,          // 报单频率超限
+    kAccountNotionalLimit,    // 账户在途金额超限
+    kPositionLimit,           // 多/空持仓（含在途）超限
+};
+
+constexpr size_t kRiskDecisionCount = 8;
+
+const char* to_string(RiskDecision decision);
+
+// 风控视角的订单：账户与合约均为启动时分配的稠密编号，价格以浮点表示
+struct RiskOrder {
+    uint32_t account = 0;
+    uint32_t instrument = 0;
+    bool is_buy = true;
+    double price = 0.0;
+    int64_t volume = 0;
+};
+
+// 合约规则（按合约编号），限额 <= 0 表示不限
+struct InstrumentRule {
+    double multiplier = 1.0;              // 合约乘数
+    double tick_size = 0.01;              // 最小变动价位（自成交检查按跳数比较价格）
+    int64_t max_order_volume = 0;         // 单笔最大数量
+    double max_order_notional = 0.0;      // 单笔最大金额
+};
+
+// 账户规则（按账户编号），限额 <= 0 表示不限
+struct AccountRule {
+    double max_outstanding_notional = 0.0;  // 在途（未成交未撤）订单金额上限
+    double orders_per_second = 0.0;         // 报单速率上限，<=0 表示不限
+    double order_burst = 1.0;               // 允许的瞬时突发报单数
+};
+
+// 事前风控引擎
+// - 规则按 账户 x 合约 预编译为稠密数组，检查路径只做下标访问，无查找、无锁、无分配
+// - 持仓、在途数量、在途金额均为原子计数：检查时先 fetch_add 预占，超限则回滚，
+//   并发检查之间互相可见预占额度，因此多个策略线程同时报单也不会突破限额（只可能偏保守）
+// - 报单频率由账户级无锁令牌桶控制
+// - 自成交检查：每个 账户 x 合约 维护本方挂单数与最优挂单价（打包在一个 64 位原子量中），
+//   买单价格不低于本方最低卖价（或卖单不高于本方最高买价）即拒绝。
+//   最优价只在该方向挂单全部撤完/成交后复位，因此最优挂单离场后判断偏保守；
+//   本方挂单先登记再复查对手方（顺序一致的原子操作），并发的对向报单至少有一笔被拒
+// 规则须在报单开始前配置完毕（set_* 非实时路径）；检查与回报更新可在任意线程并发调用
+class PreTradeRiskEngine {
+public:
+    PreTradeRiskEngine(size_t max_accounts, size_t max_instruments);
+
+    PreTradeRiskEngine(const PreTradeRiskEngine&) = delete;
+    PreTradeRiskEngine& operator=(const PreTradeRiskEngine&) = delete;
+
+    // 1. 规则配置
+    bool set_instrument_rule(uint32_t instrument, const InstrumentRule& rule);
+    bool set_account_rule(uint32_t account, const AccountRule& rule);
+    bool set_position_limit(uint32_t account, uint32_t instrument, int64_t max_long, int64_t max_short);
+
+    // 2. 报单检查：通过时预占持仓、在途金额与挂单额度，之后必须通过 on_fill/on_order_closed 释放
+    RiskDecision check(const RiskOrder& order);
+    RiskDecision check(const RiskOrder& order, int64_t now_ns);
+
+    // 3. 回报更新
+    // 成交：持仓增加，对应的在途数量与金额释放
+    void on_fill(const RiskOrder& order, int64_t fill_volume);
+
+    // 订单终态（全部成交/撤单/拒单）：释放剩余未成交数量的预占并移除挂单
+    void on_order_closed(const RiskOrder& order, int64_t remaining_volume);
+
+    // 4. 状态查询
+    int64_t position(uint32_t account, uint32_t instrument) const;
+    int64_t pending_volume(uint32_t account, uint32_t instrument, bool is_buy) const;
+    double outstanding_notional(uint32_t account) const;
+    uint64_t rejected(RiskDecision decision) const;
+
+    size_t max_accounts() const { return max_accounts_; }
+    size_t max_instruments() const { return max_instruments_; }
+
+private:
+    // 账户 x 合约 单元，独占缓存行避免不同单元间的伪共享
+    struct alignas(64) PositionCell {
+        std::atomic<int64_t> position{0};          // 已成交净持仓
+        std::atomic<int64_t> pending_buy{0};       // 在途买量
+        std::atomic<int64_t> pending_sell{0};      // 在途卖量
+        std::atomic<uint64_t> resting_bids{0};     // 高 32 位：挂单数；低 32 位：最高买价（跳数）
+        std::atomic<uint64_t> resting_asks{0};     // 高 32 位：挂单数；低 32 位：最低卖价（跳数）
+        int64_t max_long = INT64_MAX;
+        int64_t max_short = INT64_MAX;
+    };
+
+    struct alignas(64) AccountState {
+        std::atomic<int64_t> outstanding_notional{0};  // 在途金额（按 kNotionalScale 定点）
+        int64_t max_outstanding_notional = INT64_MAX;
+        base::common::token_bucket::TokenBucket throttle;
+    };
+
+    struct InstrumentState {
+        InstrumentRule rule;
+        bool configured = false;
+    };
+
+    static constexpr double kNotionalScale = 100.0;
+
+    PositionCell& cell(uint32_t account, uint32_t instrument) {
+        return cells_[static_cast<size_t>(account) * max_instruments_ + instrument];
+    }
+    const PositionCell& cell(uint32_t account, uint32_t instrument) const {
+        return cells_[static_cast<size_t>(account) * max_instruments_ + instrument];
+    }
+
+    int64_t to_notional_units(const InstrumentRule& rule, double price, int64_t volume) const;
+    static int64_t to_ticks(const InstrumentRule& rule, double price);
+    RiskDecision reject(RiskDecision decision);
+
+    size_t max_accounts_;
+    size_t max_instruments_;
+    std::vector<InstrumentState> instruments_;
+    std::vector<AccountState> accounts_;
+    std::vector<PositionCell> cells_;
+    std::array<std::atomic<uint64_t>, kRiskDecisionCount> rejected_{};
+};
+
+} // namespace risk
+} // namespace core
+} // namespace quant
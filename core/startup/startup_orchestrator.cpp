@@ -0,0 +1,264 @@
+#include "startup_orchestrator.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <exception>
+
+namespace quant {
+namespace core {
+namespace startup {
+
+const char* to_string(StageStatus status) {
+    switch (status) {
+    case StageStatus::kPending:
+        return "pending";
+    case StageStatus::kSucceeded:
+        return "ok";
+    case StageStatus::kFailed:
+        return "FAILED";
+    case StageStatus::kSkipped:
+        return "skipped";
+    }
+    return "unknown";
+}
+
+bool StartupOrchestrator::add(const std::string& name, InitFn init,
+                              std::vector<std::string> depends_on, std::string exclusive_group) {
+    if (name.empty() || !init || index_.count(name) != 0) {
+        return false;
+    }
+    index_[name] = stages_.size();
+    Stage stage;
+    stage.init = std::move(init);
+    stage.depends_on = std::move(depends_on);
+    stage.group = std::move(exclusive_group);
+    stages_.push_back(std::move(stage));
+    StageResult result;
+    result.name = name;
+    results_.push_back(std::move(result));
+    return true;
+}
+
+const StageResult* StartupOrchestrator::result(const std::string& name) const {
+    auto it = index_.find(name);
+    return it != index_.end() ? &results_[it->second] : nullptr;
+}
+
+bool StartupOrchestrator::validate() {
+    for (auto& stage : stages_) {
+        stage.dependents.clear();
+        stage.remaining = 0;
+    }
+    for (size_t i = 0; i < stages_.size(); ++i) {
+        for (const auto& dependency : stages_[i].depends_on) {
+            auto it = index_.find(dependency);
+            if (it == index_.end()) {
+                error_ = results_[i].name + " depends on unknown component " + dependency;
+                return false;
+            }
+            stages_[it->second].dependents.push_back(i);
+            ++stages_[i].remaining;
+        }
+    }
+
+    // 拓扑排序检测依赖环
+    std::vector<size_t> remaining(stages_.size());
+    std::vector<size_t> queue;
+    for (size_t i = 0; i < stages_.size(); ++i) {
+        remaining[i] = stages_[i].remaining;
+        if (remaining[i] == 0) {
+            queue.push_back(i);
+        }
+    }
+    size_t visited = 0;
+    while (visited < queue.size()) {
+        size_t current = queue[visited++];
+        for (size_t dependent : stages_[current].dependents) {
+            if (--remaining[dependent] == 0) {
+                queue.push_back(dependent);
+            }
+        }
+    }
+    if (visited != stages_.size()) {
+        for (size_t i = 0; i < stages_.size(); ++i) {
+            if (remaining[i] != 0) {
+                error_ = "dependency cycle involving " + results_[i].name;
+                break;
+            }
+        }
+        return false;
+    }
+    return true;
+}
+
+bool StartupOrchestrator::run(base::common::thread_pool::ThreadPool& pool) {
+    error_.clear();
+    if (!validate()) {
+        return false;
+    }
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    pool_ = &pool;
+    busy_groups_.clear();
+    group_waiting_.clear();
+    running_ = 0;
+    finished_ = 0;
+    failed_ = false;
+    for (auto& result : results_) {
+        result.status = StageStatus::kPending;
+        result.error.clear();
+        result.start_ns = 0;
+        result.duration_ns = 0;
+    }
+    run_start_ns_ = now_ns();
+
+    for (size_t i = 0; i < stages_.size(); ++i) {
+        if (stages_[i].remaining == 0) {
+            ready_locked(i);
+        }
+    }
+    done_cv_.wait(lock, [this]() {
+        return running_ == 0 && (failed_ || finished_ == stages_.size());
+    });
+    total_ns_ = now_ns() - run_start_ns_;
+    pool_ = nullptr;
+
+    for (auto& result : results_) {
+        if (result.status == StageStatus::kPending) {
+            result.status = StageStatus::kSkipped;
+        }
+    }
+    return !failed_;
+}
+
+void StartupOrchestrator::ready_locked(size_t index) {
+    if (failed_) {
+        return;
+    }
+    const std::string& group = stages_[index].group;
+    if (!group.empty()) {
+        if (busy_groups_.count(group) != 0) {
+            group_waiting_[group].push_back(index);
+            return;
+        }
+        busy_groups_.insert(group);
+    }
+    launch_locked(index);
+}
+
+void StartupOrchestrator::launch_locked(size_t index) {
+    ++running_;
+    try {
+        pool_->submit([this, index]() {
+            int64_t start = now_ns();
+            bool ok = false;
+            std::string error;
+            try {
+                ok = stages_[index].init();
+                if (!ok) {
+                    error = "initialization returned false";
+                }
+            } catch (const std::exception& e) {
+                error = e.what();
+            } catch (...) {
+                error = "unknown exception";
+            }
+            int64_t end = now_ns();
+
+            std::lock_guard<std::mutex> guard(mutex_);
+            complete_locked(index, ok, error, start, end);
+        });
+    } catch (const std::exception& e) {
+        // 线程池已停止：按失败处理，避免 run() 永久等待
+        int64_t now = now_ns();
+        complete_locked(index, false, e.what(), now, now);
+    }
+}
+
+void StartupOrchestrator::complete_locked(size_t index, bool ok, const std::string& error,
+                                          int64_t start_ns, int64_t end_ns) {
+    StageResult& result = results_[index];
+    result.status = ok ? StageStatus::kSucceeded : StageStatus::kFailed;
+    result.error = error;
+    result.start_ns = start_ns - run_start_ns_;
+    result.duration_ns = end_ns - start_ns;
+    --running_;
+    ++finished_;
+    if (!ok && !failed_) {
+        failed_ = true;
+        error_ = result.name + ": " + error;
+    }
+
+    // 释放互斥组，唤醒组内下一个等待者
+    const std::string& group = stages_[index].group;
+    if (!group.empty()) {
+        busy_groups_.erase(group);
+        auto waiting = group_waiting_.find(group);
+        if (waiting != group_waiting_.end() && !waiting->second.empty()) {
+            size_t next = waiting->second.front();
+            waiting->second.erase(waiting->second.begin());
+            ready_locked(next);
+        }
+    }
+
+    if (ok) {
+        for (size_t dependent : stages_[index].dependents) {
+            if (--stages_[dependent].remaining == 0) {
+                ready_locked(dependent);
+            }
+        }
+    }
+    done_cv_.notify_all();
+}
+
+int64_t StartupOrchestrator::serial_ns() const {
+    int64_t sum = 0;
+    for (const auto& result : results_) {
+        sum += result.duration_ns;
+    }
+    return sum;
+}
+
+std::string StartupOrchestrator::report() const {
+    std::vector<const StageResult*> ordered;
+    for (const auto& result : results_) {
+        ordered.push_back(&result);
+    }
+    std::stable_sort(ordered.begin(), ordered.end(), [](const StageResult* a, const StageResult* b) {
+        bool a_ran = a->status == StageStatus::kSucceeded || a->status == StageStatus::kFailed;
+        bool b_ran = b->status == StageStatus::kSucceeded || b->status == StageStatus::kFailed;
+        if (a_ran != b_ran) {
+            return a_ran;
+        }
+        return a->start_ns < b->start_ns;
+    });
+
+    std::string text;
+    char line[256];
+    std::snprintf(line, sizeof(line), "%-32s %12s %12s  %s\n", "component", "start(ms)", "time(ms)", "status");
+    text += line;
+    for (const StageResult* result : ordered) {
+        std::snprintf(line, sizeof(line), "%-32s %12.3f %12.3f  %s", result->name.c_str(),
+                      static_cast<double>(result->start_ns) / 1e6,
+                      static_cast<double>(result->duration_ns) / 1e6, to_string(result->status));
+        text += line;
+        if (!result->error.empty()) {
+            text += " (" + result->error + ")";
+        }
+        text += '\n';
+    }
+    std::snprintf(line, sizeof(line), "startup %.3f ms wall, %.3f ms serial\n",
+                  static_cast<double>(total_ns_) / 1e6, static_cast<double>(serial_ns()) / 1e6);
+    text += line;
+    return text;
+}
+
+int64_t StartupOrchestrator::now_ns() const {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+} // namespace startup
+} // namespace core
+} // namespace quant
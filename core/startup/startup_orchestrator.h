@@ -0,0 +1,111 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include "common/thread_pool/thread_pool.h"
+
+namespace quant {
+namespace core {
+namespace startup {
+
+enum class StageStatus {
+    kPending,       // 未执行
+    kSucceeded,     // 初始化成功
+    kFailed,        // 初始化返回 false 或抛出异常
+    kSkipped,       // 依赖失败或启动已中止，未执行
+};
+
+const char* to_string(StageStatus status);
+
+// 单个组件的初始化结果（时间为相对 run() 开始的偏移）
+struct StageResult {
+    std::string name;
+    StageStatus status = StageStatus::kPending;
+    std::string error;
+    int64_t start_ns = 0;
+    int64_t duration_ns = 0;
+};
+
+// 分阶段并行启动：
+// - 每个组件声明其依赖，依赖全部成功后立即提交到线程池，互不依赖的组件并行初始化
+// - 同一互斥组（exclusive_group）内的组件不会同时执行，用于保护非线程安全的共享对象
+//   （如同一个 MarketDataProcessor 上的多个插件加载）
+// - 任一组件失败后不再启动新组件，已在执行的组件完成后 run() 返回 false（快速失败）
+// - 记录每个组件的起止时间，report() 输出耗时表，便于定位拖慢重启的组件
+//
+// 初始化函数在线程池工作线程上执行，不能再同步等待同一线程池上的其他任务
+class StartupOrchestrator {
+public:
+    using InitFn = std::function<bool()>;
+
+    StartupOrchestrator() = default;
+
+    StartupOrchestrator(const StartupOrchestrator&) = delete;
+    StartupOrchestrator& operator=(const StartupOrchestrator&) = delete;
+
+    // 注册组件；名称重复时返回 false。依赖可以引用之后才注册的组件
+    bool add(const std::string& name, InitFn init,
+             std::vector<std::string> depends_on = {}, std::string exclusive_group = "");
+
+    // 执行全部组件并阻塞到结束；依赖缺失或存在环时不执行任何组件并返回 false
+    bool run(base::common::thread_pool::ThreadPool& pool);
+
+    // 结果按注册顺序排列
+    const std::vector<StageResult>& results() const { return results_; }
+    const StageResult* result(const std::string& name) const;
+
+    // 第一个错误（配置错误或首个失败组件）
+    const std::string& error() const { return error_; }
+
+    // 墙钟总耗时与各组件耗时之和（两者之比即并行收益）
+    int64_t total_ns() const { return total_ns_; }
+    int64_t serial_ns() const;
+
+    // 按开始时间排序的耗时表
+    std::string report() const;
+
+private:
+    struct Stage {
+        InitFn init;
+        std::vector<std::string> depends_on;
+        std::string group;
+        std::vector<size_t> dependents;     // 依赖本组件的组件下标
+        size_t remaining = 0;               // 尚未完成的依赖数
+    };
+
+    bool validate();
+    // 以下均要求持有 mutex_
+    void ready_locked(size_t index);
+    void launch_locked(size_t index);
+    void complete_locked(size_t index, bool ok, const std::string& error, int64_t start_ns, int64_t end_ns);
+
+    int64_t now_ns() const;
+
+    std::vector<Stage> stages_;
+    std::vector<StageResult> results_;
+    std::unordered_map<std::string, size_t> index_;
+
+    // run() 期间的调度状态
+    base::common::thread_pool::ThreadPool* pool_ = nullptr;
+    std::mutex mutex_;
+    std::condition_variable done_cv_;
+    std::unordered_set<std::string> busy_groups_;
+    std::unordered_map<std::string, std::vector<size_t>> group_waiting_;
+    size_t running_ = 0;
+    size_t finished_ = 0;
+    bool failed_ = false;
+    int64_t run_start_ns_ = 0;
+    int64_t total_ns_ = 0;
+    std::string error_;
+};
+
+} // namespace startup
+} // namespace core
+} // namespace quant
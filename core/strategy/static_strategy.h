@@ -0,0 +1,152 @@
+#pragma once
+
+#include <string>
+#include <tuple>
+#include <utility>
+#include <cstddef>
+#include <type_traits>
+#include "strategy_base.h"
+#include "../trace/tick_trace.h"
+
+namespace quant {
+namespace core {
+namespace strategy {
+
+// 编译期类型列表：描述一组在编译期已知的策略类型
+template <typename... Ts>
+struct TypeList {
+    static constexpr size_t size = sizeof...(Ts);
+};
+
+// 交易信号出口（由宿主绑定，参数与 StrategyBase::send_signal 一致）
+using StrategySignalSink = void (*)(void* context, const std::string& instrument,
+                                    double price, int volume, bool is_buy, bool is_open);
+
+// 静态分发策略基类（CRTP）
+// 派生类以非虚成员函数实现 on_tick/on_bar/on_order/on_trade，调用在编译期绑定、可被内联；
+// 未实现的回调使用这里的空实现。用法：
+//     class MyStrategy : public StaticStrategy<MyStrategy> {
+//     public:
+//         void on_tick(const market_data::TickData& tick) { ... }
+//     };
+template <typename Derived>
+class StaticStrategy {
+public:
+    // 事件入口：静态转发到派生类
+    void handle_tick(const market_data::TickData& tick) { derived().on_tick(tick); }
+    void handle_bar(const market_data::BarData& bar) { derived().on_bar(bar); }
+    void handle_order(const oms::Order& order) { derived().on_order(order); }
+    void handle_trade(const oms::Trade& trade) { derived().on_trade(trade); }
+
+    // 默认空实现（派生类按需以同名函数隐藏）
+    void on_bar(const market_data::BarData&) {}
+    void on_order(const oms::Order&) {}
+    void on_trade(const oms::Trade&) {}
+
+    // 绑定信号出口
+    void bind_signal_sink(StrategySignalSink sink, void* context) {
+        signal_sink_ = sink;
+        signal_context_ = context;
+    }
+
+protected:
+    StaticStrategy() = default;
+    ~StaticStrategy() = default;
+
+    // 发送交易信号（未绑定宿主时忽略）
+    void send_signal(const std::string& instrument, double price, int volume, bool is_buy, bool is_open) {
+        if (signal_sink_ != nullptr) {
+            QT_TRACE_STAGE(trace::TickStage::kSendSignal);
+            signal_sink_(signal_context_, instrument, price, volume, is_buy, is_open);
+        }
+    }
+
+private:
+    Derived& derived() { return static_cast<Derived&>(*this); }
+
+    StrategySignalSink signal_sink_ = nullptr;
+    void* signal_context_ = nullptr;
+};
+
+// 静态策略集合：按 TypeList 持有一组策略实例，事件按声明顺序逐个分发（无虚调用、无 std::function）
+template <typename List>
+class StaticStrategySet;
+
+template <typename... Strategies>
+class StaticStrategySet<TypeList<Strategies...>> {
+    static_assert(sizeof...(Strategies) > 0, "StaticStrategySet requires at least one strategy");
+    static_assert((std::is_base_of<StaticStrategy<Strategies>, Strategies>::value && ...),
+                  "Strategies must derive from StaticStrategy<Self>");
+
+public:
+    StaticStrategySet() = default;
+
+    // 逐个构造策略：参数个数必须与策略个数一致，第 i 个参数用于构造第 i 个策略
+    template <typename... Args,
+              typename = std::enable_if_t<sizeof...(Args) == sizeof...(Strategies) && (sizeof...(Args) > 0)>>
+    explicit StaticStrategySet(Args&&... args) : strategies_(std::forward<Args>(args)...) {}
+
+    void on_tick(const market_data::TickData& tick) {
+        std::apply([&tick](auto&... strategy) { (strategy.handle_tick(tick), ...); }, strategies_);
+    }
+
+    void on_bar(const market_data::BarData& bar) {
+        std::apply([&bar](auto&... strategy) { (strategy.handle_bar(bar), ...); }, strategies_);
+    }
+
+    void on_order(const oms::Order& order) {
+        std::apply([&order](auto&... strategy) { (strategy.handle_order(order), ...); }, strategies_);
+    }
+
+    void on_trade(const oms::Trade& trade) {
+        std::apply([&trade](auto&... strategy) { (strategy.handle_trade(trade), ...); }, strategies_);
+    }
+
+    // 为集合中所有策略绑定同一个信号出口
+    void bind_signal_sink(StrategySignalSink sink, void* context) {
+        std::apply([&](auto&... strategy) { (strategy.bind_signal_sink(sink, context), ...); }, strategies_);
+    }
+
+    // 按类型获取策略实例
+    template <typename Strategy>
+    Strategy& get() { return std::get<Strategy>(strategies_); }
+
+    template <typename Strategy>
+    const Strategy& get() const { return std::get<Strategy>(strategies_); }
+
+    static constexpr size_t size() { return sizeof...(Strategies); }
+
+private:
+    std::tuple<Strategies...> strategies_;
+};
+
+// 静态策略适配器：把一组静态策略包装成一个 StrategyBase 插件实例，
+// 现有引擎/事件总线路径只需一次虚调用，之后在集合内部静态分发
+template <typename List>
+class StaticStrategyAdapter : public StrategyBase {
+public:
+    template <typename... Args>
+    explicit StaticStrategyAdapter(const StrategyConfig& config, Args&&... args)
+        : StrategyBase(config), strategies_(std::forward<Args>(args)...) {
+        strategies_.bind_signal_sink(&StaticStrategyAdapter::forward_signal, this);
+    }
+
+    void on_tick(const market_data::TickData& tick) override { strategies_.on_tick(tick); }
+    void on_bar(const market_data::BarData& bar) override { strategies_.on_bar(bar); }
+    void on_order(const oms::Order& order) override { strategies_.on_order(order); }
+    void on_trade(const oms::Trade& trade) override { strategies_.on_trade(trade); }
+
+    StaticStrategySet<List>& strategies() { return strategies_; }
+
+private:
+    static void forward_signal(void* context, const std::string& instrument,
+                               double price, int volume, bool is_buy, bool is_open) {
+        static_cast<StaticStrategyAdapter*>(context)->send_signal(instrument, price, volume, is_buy, is_open);
+    }
+
+    StaticStrategySet<List> strategies_;
+};
+
+} // namespace strategy
+} // namespace core
+} // namespace quant
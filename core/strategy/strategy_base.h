@@ -6,9 +6,11 @@
 #include "../event_bus/event_bus.h"
 #include "strategy_status.h"
 #include "strategy_config.h"
+#include "strategy_parameters.h"
 #include "../market_data/tick_data.h"
 #include "../oms/order.h"
 #include "../oms/trade.h"
+#include "../trace/tick_trace.h"
 
 namespace quant {
 namespace core {
@@ -45,13 +47,19 @@ public:
     virtual void on_tick(const market_data::TickData& tick) = 0;
     
     // 处理K线事件
-    virtual void on_bar(const market_data::BarData& bar) {}
+    virtual void on_bar(const market_data::BarData&) {}
     
     // 处理订单事件
-    virtual void on_order(const oms::Order& order) {}
+    virtual void on_order(const oms::Order&) {}
     
     // 处理成交事件
-    virtual void on_trade(const oms::Trade& trade) {}
+    virtual void on_trade(const oms::Trade&) {}
+    
+    // 导出策略状态（热更新时由旧实例导出，格式由策略自行定义）
+    virtual std::string save_state() const { return std::string(); }
+    
+    // 恢复策略状态（热更新时由新实例导入，失败返回 false 则放弃本次更新）
+    virtual bool restore_state(const std::string& state) { return state.empty(); }
     
     // 获取策略ID
     std::string id() const;
@@ -62,20 +70,35 @@ public:
     // 获取策略状态
     StrategyStatus status() const;
     
+    // 获取策略配置
+    const StrategyConfig& config() const { return config_; }
+    
     // 获取策略参数
     std::string get_parameter(const std::string& key) const;
     
     // 设置策略参数
     void set_parameter(const std::string& key, const std::string& value);
     
+    // 类型化参数（预注册槽位 + RCU 快照，热更新不阻塞行情路径）
+    ParameterSet& parameters() { return parameters_; }
+    const ParameterSet& parameters() const { return parameters_; }
+    
 protected:
-    // 发送交易信号
-    void send_signal(const std::string& instrument, double price, int volume, bool is_buy, bool is_open);
+    // 发送交易信号（行情触发时对 send_signal 阶段打点，再交给 route_signal 送往 OMS）
+    void send_signal(const std::string& instrument, double price, int volume, bool is_buy, bool is_open) {
+        QT_TRACE_STAGE(trace::TickStage::kSendSignal);
+        route_signal(instrument, price, volume, is_buy, is_open);
+    }
     
     StrategyConfig config_;
     StrategyStatus status_;
     event_bus::EventBus* event_bus_;
+    ParameterSet parameters_;
     // 其他成员变量...
+    
+private:
+    // 把交易信号送往 OMS（strategy_base.cpp）
+    void route_signal(const std::string& instrument, double price, int volume, bool is_buy, bool is_open);
 };
 
 } // namespace strategy
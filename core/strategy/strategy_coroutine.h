@@ -0,0 +1,749 @@
+#pragma once
+
+// 策略协程接口：以 co_await 编写"发单 -> 等待回报/超时 -> 对冲"等流程，替代分散在回调中的状态机。
+// 需以 C++20 编译（策略插件单独编译为动态库，可单独开启 -std=c++20；核心模块仍为 C++17）。
+#if !defined(__cpp_impl_coroutine)
+#error "strategy_coroutine.h requires C++20 coroutines (compile the strategy plugin with -std=c++20)"
+#endif
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <vector>
+#include <string>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <coroutine>
+#include <functional>
+#include <stdexcept>
+#include <type_traits>
+#include "strategy_base.h"
+#include "common/timer_wheel/timer_wheel.h"
+#include "utils/async_logger/async_logger.h"
+
+namespace quant {
+namespace core {
+namespace strategy {
+
+class CoroutineStrategy;
+
+// ==================== 协程帧内存池 ====================
+
+// 按大小分级的协程帧内存池（每个策略一个，仅在策略自身线程上使用，无需加锁）
+// 帧释放后回到对应级别的空闲链表，稳定运行后创建协程不再向系统申请内存
+class FrameArena {
+public:
+    FrameArena() = default;
+    FrameArena(const FrameArena&) = delete;
+    FrameArena& operator=(const FrameArena&) = delete;
+
+    void* allocate(size_t size) {
+        size_t total = size + kHeaderSize;
+        size_t level = level_of(total);
+        Header* header = nullptr;
+        if (level >= kLevelCount) {
+            header = static_cast<Header*>(::operator new(total));   // 超大帧直接走系统分配
+        } else if (free_lists_[level] != nullptr) {
+            header = free_lists_[level];
+            free_lists_[level] = header->next;
+        } else {
+            header = grow(level);
+        }
+        header->arena = this;
+        header->level = level;
+        return reinterpret_cast<char*>(header) + kHeaderSize;
+    }
+
+    static void deallocate(void* ptr) {
+        Header* header = reinterpret_cast<Header*>(static_cast<char*>(ptr) - kHeaderSize);
+        if (header->level >= kLevelCount) {
+            ::operator delete(header);
+            return;
+        }
+        FrameArena* arena = header->arena;
+        size_t level = header->level;
+        header->next = arena->free_lists_[level];
+        arena->free_lists_[level] = header;
+    }
+
+private:
+    static constexpr size_t kHeaderSize = 16;         // 保持帧按 16 字节对齐
+    static constexpr size_t kMinBlock = 128;          // 最小级别块大小
+    static constexpr size_t kLevelCount = 7;          // 128 ~ 8192 字节
+    static constexpr size_t kBlocksPerChunk = 16;     // 每次扩容的块数
+
+    // 块头：已分配时记录所属内存池与级别，空闲时复用为链表指针
+    struct Header {
+        FrameArena* arena;
+        union {
+            size_t level;
+            Header* next;
+        };
+    };
+    static_assert(sizeof(Header) <= kHeaderSize, "FrameArena header too large");
+
+    static size_t level_of(size_t size) {
+        size_t level = 0;
+        size_t block = kMinBlock;
+        while (block < size && level < kLevelCount) {
+            block <<= 1;
+            ++level;
+        }
+        return level;
+    }
+
+    Header* grow(size_t level) {
+        size_t block = kMinBlock << level;
+        chunks_.emplace_back(new char[block * kBlocksPerChunk]);
+        char* base = chunks_.back().get();
+        for (size_t i = 1; i < kBlocksPerChunk; ++i) {
+            Header* header = reinterpret_cast<Header*>(base + i * block);
+            header->next = free_lists_[level];
+            free_lists_[level] = header;
+        }
+        return reinterpret_cast<Header*>(base);
+    }
+
+    std::array<Header*, kLevelCount> free_lists_{};
+    std::vector<std::unique_ptr<char[]>> chunks_;
+};
+
+// ==================== 协程任务类型 ====================
+
+// 策略协程返回类型：立即开始执行，结束后自动销毁帧（即发即忘）
+// 只能声明为 CoroutineStrategy 派生类的成员函数，协程帧从该策略的 FrameArena 分配
+struct StrategyTask {
+    struct promise_type {
+        template <typename Self, typename... Args>
+        static void* operator new(size_t size, Self& self, Args&&...) {
+            static_assert(std::is_base_of<CoroutineStrategy, Self>::value,
+                          "StrategyTask coroutines must be member functions of a CoroutineStrategy");
+            return arena_of(self).allocate(size);
+        }
+
+        static void operator delete(void* ptr) {
+            FrameArena::deallocate(ptr);
+        }
+
+        StrategyTask get_return_object() { return {}; }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() {}
+        void unhandled_exception() {
+            try {
+                throw;
+            } catch (const std::exception& e) {
+                QT_LOG_ERROR("[StrategyTask] Coroutine error: {}", e.what());
+            } catch (...) {
+                QT_LOG_ERROR("[StrategyTask] Unknown coroutine error");
+            }
+        }
+
+    private:
+        static FrameArena& arena_of(CoroutineStrategy& strategy);
+    };
+};
+
+// ==================== 等待链表 ====================
+
+// 侵入式双向链表节点（内嵌在 awaiter 中，awaiter 位于协程帧内，挂起时不分配内存）
+struct WaitNode {
+    WaitNode* prev = nullptr;
+    WaitNode* next = nullptr;
+    class Awaiter* owner = nullptr;
+
+    bool linked() const { return prev != nullptr; }
+
+    void unlink() {
+        if (prev != nullptr) {
+            prev->next = next;
+            next->prev = prev;
+            prev = next = nullptr;
+        }
+    }
+};
+
+class WaitList {
+public:
+    WaitList() { head_.prev = head_.next = &head_; }
+    WaitList(const WaitList&) = delete;
+    WaitList& operator=(const WaitList&) = delete;
+
+    bool empty() const { return head_.next == &head_; }
+
+    void push_back(WaitNode& node) {
+        node.prev = head_.prev;
+        node.next = &head_;
+        head_.prev->next = &node;
+        head_.prev = &node;
+    }
+
+    WaitNode* front() { return empty() ? nullptr : head_.next; }
+    WaitNode* end() { return &head_; }
+
+private:
+    WaitNode head_;
+};
+
+// 等待键：合约代码或订单号，定长内联存储在 awaiter 中（不随挂起分配内存）
+class WaitKey {
+public:
+    static constexpr size_t kCapacity = 63;     // 最大长度（交易所订单号与合约代码均远小于此）
+
+    WaitKey() = default;
+    explicit WaitKey(const std::string& value) {
+        if (value.size() > kCapacity) {
+            throw std::length_error("WaitKey too long: " + value);
+        }
+        std::memcpy(data_, value.data(), value.size());
+        size_ = static_cast<uint8_t>(value.size());
+    }
+
+    bool matches(const std::string& value) const {
+        return value.size() == size_ && std::memcmp(data_, value.data(), size_) == 0;
+    }
+
+private:
+    char data_[kCapacity] = {};
+    uint8_t size_ = 0;
+};
+
+// 所有 awaiter 的公共部分：挂起的协程句柄、关注的合约或订单号、事件/定时两条链表的节点
+class Awaiter {
+public:
+    Awaiter() { init_nodes(); }
+    explicit Awaiter(const std::string& key) : key_(key) { init_nodes(); }
+    Awaiter(const Awaiter&) = delete;
+    Awaiter& operator=(const Awaiter&) = delete;
+
+protected:
+    friend class CoroutineStrategy;
+
+    void init_nodes() {
+        event_node_.owner = this;
+        timer_node_.owner = this;
+    }
+
+    // 从两条链表中摘除并恢复协程
+    void wake(const void* payload, bool timed_out) {
+        event_node_.unlink();
+        timer_node_.unlink();
+        payload_ = payload;
+        timed_out_ = timed_out;
+        handle_.resume();
+    }
+
+    std::coroutine_handle<> handle_;
+    WaitKey key_;                         // 行情/成交/发单等待为合约代码，订单回报等待为订单号
+    const void* payload_ = nullptr;       // 唤醒事件（仅在 await_resume 中使用，指向回调参数）
+    WaitNode event_node_;
+    WaitNode timer_node_;
+    std::chrono::steady_clock::time_point deadline_{};
+    bool timed_out_ = false;
+};
+
+// 等待结果
+struct TickResult {
+    market_data::TickData tick;
+};
+
+struct OrderResult {
+    bool timed_out = false;
+    uint64_t request_id = 0;              // send_order 在本策略内的序号（从 1 递增，wait_order 为 0）
+    oms::Order order;
+};
+
+struct TradeResult {
+    bool timed_out = false;
+    oms::Trade trade;
+};
+
+// ==================== 协程策略基类 ====================
+
+// 支持协程的策略基类
+// - 所有协程都在策略自身的回调线程（执行通道线程）上恢复，不阻塞任何线程
+// - on_tick/on_order/on_trade 先唤醒等待中的协程，再调用 process_* 钩子
+// - 订单回报按订单号关联（只依赖 Order 已有字段）：首次出现的订单号认领给最早一笔合约/方向/价格/数量
+//   一致的在途 send_order（OMS 按信号顺序建单），其后该订单的回报只唤醒 wait_order(订单号) 的协程；
+//   超时放弃的委托保留认领资格一个超时周期，其迟到回报交给 process_abandoned_order，不唤醒后续的同参数委托。
+//   直接调用 send_signal 发出的订单同样会被认领，同一策略内不要与参数相同的 send_order 混用
+// - 合约代码与订单号以定长键（WaitKey）保存在协程帧内的 awaiter 中，挂起、唤醒均不分配内存
+// - 定时（sleep_for 与超时）在每次事件到达或 poll_timers() 时检查；attach_timer_wheel() 后由时间轮驱动，
+//   没有事件时也按时恢复
+// - 仍在等待的协程帧在 stop() 中销毁（帧内局部对象可能引用派生类成员，不能留到基类析构时）
+class CoroutineStrategy : public StrategyBase {
+public:
+    using Clock = std::chrono::steady_clock;
+    using TimerWheel = base::common::timer_wheel::TimerWheel;
+    // 把回调包装为"在本策略所在执行通道上执行"的定时器回调，通常绑定 StrategyEngine::on_strategy_lane
+    using LaneBinder = std::function<TimerWheel::Callback(std::function<void()>)>;
+
+    explicit CoroutineStrategy(const StrategyConfig& config) : StrategyBase(config) {}
+
+    ~CoroutineStrategy() override {
+        detach_timer_wheel();
+        if (!tick_waiters_.empty() || !send_waiters_.empty() || !order_waiters_.empty() ||
+            !trade_waiters_.empty() || !timers_.empty()) {
+            // 派生类成员已析构，销毁帧会在其上运行局部对象的析构函数：放弃这些帧（内存随 frame_arena_ 释放）
+            QT_LOG_ERROR("[CoroutineStrategy] Strategy {} destroyed with suspended coroutines, stop() was not called",
+                         config_.id);
+        }
+    }
+
+    // 停止策略：停止时间轮驱动并销毁仍在等待的协程帧，再转入 StrategyBase::stop()。
+    // 须在策略线程上、或执行通道已不再向本策略分发事件后调用（热更新在 quiesce 之后调用）；
+    // 派生类重写时须调用 CoroutineStrategy::stop()
+    void stop() override {
+        detach_timer_wheel();
+        destroy_waiting(tick_waiters_);
+        destroy_waiting(send_waiters_);
+        destroy_waiting(order_waiters_);
+        destroy_waiting(trade_waiters_);
+        destroy_waiting(timers_);
+        publish_deadline(Clock::time_point::max());
+        StrategyBase::stop();
+    }
+
+    void on_tick(const market_data::TickData& tick) final {
+        wake_matching(tick_waiters_, tick.instrument, &tick);
+        poll_timers();
+        process_tick(tick);
+    }
+
+    void on_order(const oms::Order& order) final {
+        if (!remember_order(order.order_id) || !claim_order(order)) {
+            wake_matching(order_waiters_, order.order_id, &order);
+        }
+        poll_timers();
+        process_order(order);
+    }
+
+    void on_trade(const oms::Trade& trade) final {
+        wake_matching(trade_waiters_, trade.instrument, &trade);
+        poll_timers();
+        process_trade(trade);
+    }
+
+    // 检查到期的定时（attach_timer_wheel 后由时间轮投递到执行通道调用，也可由宿主在空闲时调用）
+    void poll_timers() {
+        if (timers_.empty()) {
+            if (next_deadline_ != Clock::time_point::max()) {
+                publish_deadline(Clock::time_point::max());   // 等待者已被事件唤醒，时间轮不必再投递
+            }
+            return;
+        }
+        auto now = Clock::now();
+        if (now < next_deadline_) {
+            return;
+        }
+        WaitList expired;
+        Clock::time_point next = Clock::time_point::max();
+        for (WaitNode* node = timers_.front(); node != timers_.end();) {
+            WaitNode* next_node = node->next;
+            if (node->owner->deadline_ <= now) {
+                node->unlink();
+                expired.push_back(*node);
+            } else if (node->owner->deadline_ < next) {
+                next = node->owner->deadline_;
+            }
+            node = next_node;
+        }
+        publish_deadline(next);
+        while (WaitNode* node = expired.front()) {
+            node->owner->wake(nullptr, true);
+        }
+    }
+
+    // 由时间轮驱动定时：在 wheel 上挂一个按刻度触发的周期定时器，驱动线程每次只读取一次最近到期时刻
+    // （原子量）；到期时经 on_lane 把 poll_timers() 投递到策略所在执行通道，与 on_tick/on_order 串行执行。例：
+    //   strategy->attach_timer_wheel(wheel, [&engine, id](std::function<void()> poll) {
+    //       return engine.on_strategy_lane(id, std::move(poll));
+    //   });
+    // 只调用一次，须在策略开始处理事件之前；stop() 或策略析构后周期定时器在下一次触发时自行取消
+    void attach_timer_wheel(TimerWheel& wheel, const LaneBinder& on_lane) {
+        auto link = std::make_shared<TimerLink>();
+        link->owner.store(this, std::memory_order_relaxed);
+        link->next_deadline.store(to_ns(next_deadline_), std::memory_order_relaxed);
+        TimerWheel::Callback poll = on_lane([link]() {
+            link->posted_at.store(0, std::memory_order_relaxed);
+            if (CoroutineStrategy* owner = link->owner.load(std::memory_order_acquire)) {
+                owner->poll_timers();
+            }
+        });
+        // 已投递的 poll_timers 在该时长内未执行（通道入站环满时回调被丢弃）则重新投递
+        const int64_t repost_ns = static_cast<int64_t>(wheel.resolution().count()) * kRepostTicks;
+        TimerWheel* driver = &wheel;
+        timer_link_ = link;
+        link->timer_id.store(wheel.schedule_every(wheel.resolution(), [link, driver, poll, repost_ns]() {
+            if (link->owner.load(std::memory_order_acquire) == nullptr) {
+                driver->cancel(link->timer_id.load(std::memory_order_relaxed));
+                return;
+            }
+            int64_t now = to_ns(Clock::now());
+            if (link->next_deadline.load(std::memory_order_acquire) > now) {
+                return;
+            }
+            int64_t posted = link->posted_at.load(std::memory_order_relaxed);
+            if (posted != 0 && now - posted < repost_ns) {
+                return;
+            }
+            link->posted_at.store(now, std::memory_order_relaxed);
+            poll();
+        }), std::memory_order_relaxed);
+    }
+
+protected:
+    // 事件钩子：派生类在此实现常规回调逻辑
+    virtual void process_tick(const market_data::TickData& tick) { (void)tick; }
+    virtual void process_order(const oms::Order& order) { (void)order; }
+    virtual void process_trade(const oms::Trade& trade) { (void)trade; }
+    // 超时放弃（或未被 co_await）的 send_order 的首条回报：订单可能已在交易所，派生类可在此撤单；
+    // 之后该订单的回报照常经 process_order 送达
+    virtual void process_abandoned_order(uint64_t request_id, const oms::Order& order) {
+        (void)request_id;
+        (void)order;
+    }
+
+    // co_await next_tick(instrument)：等待该合约的下一笔行情
+    class TickAwaiter : public Awaiter {
+    public:
+        TickAwaiter(CoroutineStrategy& owner, const std::string& instrument)
+            : Awaiter(instrument), owner_(owner) {}
+        bool await_ready() const noexcept { return false; }
+        void await_suspend(std::coroutine_handle<> handle) {
+            handle_ = handle;
+            owner_.tick_waiters_.push_back(event_node_);
+        }
+        TickResult await_resume() const {
+            return TickResult{*static_cast<const market_data::TickData*>(payload_)};
+        }
+
+    private:
+        CoroutineStrategy& owner_;
+    };
+
+    // co_await send_order(...)：发送交易信号并等待这笔委托的首条订单回报或超时
+    class SendAwaiter : public Awaiter {
+    public:
+        SendAwaiter(CoroutineStrategy& owner, uint64_t request_id, const std::string& instrument,
+                    double price, int volume, bool is_buy, Clock::duration timeout)
+            : Awaiter(instrument), owner_(owner), request_id_(request_id), price_(price),
+              volume_(volume), is_buy_(is_buy), timeout_(timeout) {}
+        // 未被 co_await 的委托（即发即忘）：其回报仍会到达，登记为已放弃，避免被之后的同参数委托认领
+        ~SendAwaiter() {
+            if (!handle_) {
+                owner_.abandon_send(*this);
+            }
+        }
+        bool await_ready() const noexcept { return false; }
+        void await_suspend(std::coroutine_handle<> handle) {
+            handle_ = handle;
+            owner_.send_waiters_.push_back(event_node_);
+            owner_.arm_timer(*this, timeout_);
+        }
+        // 超时后这笔委托仍可能被 OMS 受理：保留其认领资格一个超时周期，迟到的首条回报交给
+        // process_abandoned_order（携带 result.request_id），不会唤醒之后的同参数委托
+        OrderResult await_resume() {
+            OrderResult result;
+            result.timed_out = timed_out_;
+            result.request_id = request_id_;
+            if (timed_out_) {
+                owner_.abandon_send(*this);
+            } else {
+                result.order = *static_cast<const oms::Order*>(payload_);
+            }
+            return result;
+        }
+
+    private:
+        friend class CoroutineStrategy;
+
+        bool matches(const oms::Order& order) const {
+            return key_.matches(order.instrument) && is_buy_ == order.is_buy &&
+                   volume_ == order.volume && price_ == order.price;
+        }
+
+        CoroutineStrategy& owner_;
+        uint64_t request_id_;
+        double price_;
+        int volume_;
+        bool is_buy_;
+        Clock::duration timeout_;
+    };
+
+    // co_await wait_order(order_id, timeout)：等待指定订单的下一条回报（成交、撤单确认等）或超时
+    class OrderAwaiter : public Awaiter {
+    public:
+        OrderAwaiter(CoroutineStrategy& owner, const std::string& order_id, Clock::duration timeout)
+            : Awaiter(order_id), owner_(owner), timeout_(timeout) {}
+        bool await_ready() const noexcept { return false; }
+        void await_suspend(std::coroutine_handle<> handle) {
+            handle_ = handle;
+            owner_.order_waiters_.push_back(event_node_);
+            owner_.arm_timer(*this, timeout_);
+        }
+        OrderResult await_resume() const {
+            OrderResult result;
+            result.timed_out = timed_out_;
+            if (!timed_out_) {
+                result.order = *static_cast<const oms::Order*>(payload_);
+            }
+            return result;
+        }
+
+    private:
+        CoroutineStrategy& owner_;
+        Clock::duration timeout_;
+    };
+
+    // co_await next_trade(instrument, timeout)：等待该合约的成交回报或超时
+    class TradeAwaiter : public Awaiter {
+    public:
+        TradeAwaiter(CoroutineStrategy& owner, const std::string& instrument, Clock::duration timeout)
+            : Awaiter(instrument), owner_(owner), timeout_(timeout) {}
+        bool await_ready() const noexcept { return false; }
+        void await_suspend(std::coroutine_handle<> handle) {
+            handle_ = handle;
+            owner_.trade_waiters_.push_back(event_node_);
+            owner_.arm_timer(*this, timeout_);
+        }
+        TradeResult await_resume() const {
+            TradeResult result;
+            result.timed_out = timed_out_;
+            if (!timed_out_) {
+                result.trade = *static_cast<const oms::Trade*>(payload_);
+            }
+            return result;
+        }
+
+    private:
+        CoroutineStrategy& owner_;
+        Clock::duration timeout_;
+    };
+
+    // co_await sleep_for(duration)：在策略线程上延迟恢复
+    class SleepAwaiter : public Awaiter {
+    public:
+        SleepAwaiter(CoroutineStrategy& owner, Clock::duration duration)
+            : owner_(owner), duration_(duration) {}
+        bool await_ready() const noexcept { return duration_ <= Clock::duration::zero(); }
+        void await_suspend(std::coroutine_handle<> handle) {
+            handle_ = handle;
+            owner_.arm_timer(*this, duration_);
+        }
+        void await_resume() const noexcept {}
+
+    private:
+        CoroutineStrategy& owner_;
+        Clock::duration duration_;
+    };
+
+    TickAwaiter next_tick(const std::string& instrument) {
+        return TickAwaiter(*this, instrument);
+    }
+
+    // 信号立即发出（不论是否 co_await）；回报经执行通道异步送达，总是晚于 await_suspend 挂入等待链表
+    SendAwaiter send_order(const std::string& instrument, double price, int volume,
+                           bool is_buy, bool is_open, Clock::duration timeout) {
+        send_signal(instrument, price, volume, is_buy, is_open);
+        return SendAwaiter(*this, ++last_send_id_, instrument, price, volume, is_buy, timeout);
+    }
+
+    OrderAwaiter wait_order(const std::string& order_id, Clock::duration timeout) {
+        return OrderAwaiter(*this, order_id, timeout);
+    }
+
+    TradeAwaiter next_trade(const std::string& instrument, Clock::duration timeout) {
+        return TradeAwaiter(*this, instrument, timeout);
+    }
+
+    SleepAwaiter sleep_for(Clock::duration duration) {
+        return SleepAwaiter(*this, duration);
+    }
+
+private:
+    friend struct StrategyTask::promise_type;
+
+    static constexpr int64_t kRepostTicks = 64;     // poll_timers 投递后多少个刻度未执行则重投
+    static constexpr size_t kAbandonedCapacity = 16;    // 同时保留认领资格的已放弃委托数（满时淘汰最早的）
+    static constexpr size_t kSeenOrderCapacity = 256;   // 记住的最近订单号数（按哈希，只用于判断"首次出现"）
+
+    // 已放弃的 send_order：在 expires 之前仍可认领首次出现的同参数订单
+    struct AbandonedSend {
+        uint64_t request_id = 0;            // 0 表示空槽
+        WaitKey instrument;
+        double price = 0.0;
+        int volume = 0;
+        bool is_buy = true;
+        Clock::time_point expires{};
+
+        bool matches(const oms::Order& order) const {
+            return instrument.matches(order.instrument) && is_buy == order.is_buy &&
+                   volume == order.volume && price == order.price;
+        }
+    };
+
+    // 与时间轮回调共享的定时状态：驱动线程与执行通道线程只通过原子量访问
+    struct TimerLink {
+        std::atomic<CoroutineStrategy*> owner{nullptr};     // 策略析构后置空
+        std::atomic<int64_t> next_deadline{INT64_MAX};      // 最近到期时刻（steady_clock 纳秒）
+        std::atomic<int64_t> posted_at{0};                  // 已投递、尚未执行的 poll_timers 的投递时刻
+        std::atomic<base::common::timer_wheel::TimerId> timer_id{base::common::timer_wheel::kInvalidTimer};
+    };
+
+    static int64_t to_ns(Clock::time_point when) {
+        if (when == Clock::time_point::max()) {
+            return INT64_MAX;
+        }
+        return static_cast<int64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(when.time_since_epoch()).count());
+    }
+
+    // 更新最近到期时刻（只在策略线程上写，时间轮驱动线程读）
+    void publish_deadline(Clock::time_point deadline) {
+        next_deadline_ = deadline;
+        if (timer_link_) {
+            timer_link_->next_deadline.store(to_ns(deadline), std::memory_order_release);
+        }
+    }
+
+    void arm_timer(Awaiter& awaiter, Clock::duration timeout) {
+        awaiter.deadline_ = Clock::now() + timeout;
+        timers_.push_back(awaiter.timer_node_);
+        if (awaiter.deadline_ < next_deadline_) {
+            publish_deadline(awaiter.deadline_);
+        }
+    }
+
+    // 停止时间轮驱动：周期定时器在下一次触发时自行取消
+    void detach_timer_wheel() {
+        if (timer_link_) {
+            timer_link_->owner.store(nullptr, std::memory_order_release);
+            timer_link_.reset();
+        }
+    }
+
+    void abandon_send(const SendAwaiter& send) {
+        AbandonedSend* slot = &abandoned_[0];
+        for (auto& entry : abandoned_) {
+            if (entry.request_id == 0) {
+                slot = &entry;
+                break;
+            }
+            if (entry.request_id < slot->request_id) {
+                slot = &entry;
+            }
+        }
+        slot->request_id = send.request_id_;
+        slot->instrument = send.key_;
+        slot->price = send.price_;
+        slot->volume = send.volume_;
+        slot->is_buy = send.is_buy_;
+        slot->expires = Clock::now() + send.timeout_;
+    }
+
+    // 记录订单号，首次出现返回 true（只保留最近 kSeenOrderCapacity 个订单号的哈希，不分配内存）
+    bool remember_order(const std::string& order_id) {
+        size_t hash = std::hash<std::string>()(order_id);
+        size_t count = seen_count_ < kSeenOrderCapacity ? seen_count_ : kSeenOrderCapacity;
+        for (size_t i = 0; i < count; ++i) {
+            if (seen_orders_[i] == hash) {
+                return false;
+            }
+        }
+        seen_orders_[seen_count_ % kSeenOrderCapacity] = hash;
+        ++seen_count_;
+        return true;
+    }
+
+    // 首次出现的订单号认领给序号最小（最早发出）的同参数委托：等待中的唤醒，已放弃的交给
+    // process_abandoned_order；没有可认领的委托返回 false
+    bool claim_order(const oms::Order& order) {
+        SendAwaiter* waiter = nullptr;
+        for (WaitNode* node = send_waiters_.empty() ? send_waiters_.end() : send_waiters_.front();
+             node != send_waiters_.end(); node = node->next) {
+            auto* send = static_cast<SendAwaiter*>(node->owner);
+            if (send->matches(order) && (waiter == nullptr || send->request_id_ < waiter->request_id_)) {
+                waiter = send;
+            }
+        }
+        AbandonedSend* abandoned = nullptr;
+        Clock::time_point now{};
+        for (auto& entry : abandoned_) {
+            if (entry.request_id == 0 || !entry.matches(order)) {
+                continue;
+            }
+            if (now == Clock::time_point{}) {
+                now = Clock::now();
+            }
+            if (entry.expires <= now) {
+                entry.request_id = 0;
+            } else if (abandoned == nullptr || entry.request_id < abandoned->request_id) {
+                abandoned = &entry;
+            }
+        }
+        if (abandoned != nullptr && (waiter == nullptr || abandoned->request_id < waiter->request_id_)) {
+            uint64_t request_id = abandoned->request_id;
+            abandoned->request_id = 0;
+            process_abandoned_order(request_id, order);
+            return true;
+        }
+        if (waiter != nullptr) {
+            waiter->wake(&order, false);
+            return true;
+        }
+        return false;
+    }
+
+    // 先把匹配的等待者摘到局部链表，再逐个恢复：恢复过程中新挂起的协程等待的是"下一次"事件
+    void wake_matching(WaitList& waiters, const std::string& key, const void* payload) {
+        if (waiters.empty()) {
+            return;
+        }
+        WaitList ready;
+        for (WaitNode* node = waiters.front(); node != waiters.end();) {
+            WaitNode* next = node->next;
+            if (node->owner->key_.matches(key)) {
+                node->unlink();
+                ready.push_back(*node);
+            }
+            node = next;
+        }
+        while (WaitNode* node = ready.front()) {
+            node->owner->wake(payload, false);
+        }
+    }
+
+    void destroy_waiting(WaitList& waiters) {
+        while (WaitNode* node = waiters.front()) {
+            Awaiter* awaiter = node->owner;
+            awaiter->event_node_.unlink();
+            awaiter->timer_node_.unlink();
+            awaiter->handle_.destroy();
+        }
+    }
+
+    FrameArena frame_arena_;        // 协程帧内存池（须先于等待链表构造、后于其析构）
+    WaitList tick_waiters_;
+    WaitList send_waiters_;         // send_order：认领首次出现的同参数订单
+    WaitList order_waiters_;        // wait_order：按订单号匹配
+    WaitList trade_waiters_;
+    WaitList timers_;
+    Clock::time_point next_deadline_ = Clock::time_point::max();   // timers_ 中最早的到期时刻（可能偏早，不会偏晚）
+    std::shared_ptr<TimerLink> timer_link_;                        // attach_timer_wheel 后、stop() 前非空
+    uint64_t last_send_id_ = 0;                                    // 最近一次 send_order 的序号
+    std::array<AbandonedSend, kAbandonedCapacity> abandoned_{};
+    std::array<size_t, kSeenOrderCapacity> seen_orders_{};
+    size_t seen_count_ = 0;
+};
+
+inline FrameArena& StrategyTask::promise_type::arena_of(CoroutineStrategy& strategy) {
+    return strategy.frame_arena_;
+}
+
+} // namespace strategy
+} // namespace core
+} // namespace quant
@@ -1,11 +1,20 @@
 #pragma once
 
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <future>
 #include <unordered_map>
 #include <memory>
 #include <string>
+#include <vector>
 #include "strategy_base.h"
 #include "strategy_factory.h"
+#include "strategy_lane.h"
+#include "strategy_plugin.h"
 #include "../event_bus/event_bus.h"
+#include "common/checkpoint/checkpoint.h"
+#include "common/timer_wheel/timer_wheel.h"
 
 namespace quant {
 namespace core {
@@ -22,6 +31,18 @@ public:
     // 加载策略插件
     bool load_strategy_plugin(const std::string& plugin_path);
     
+    // 热更新单个策略的插件（策略须运行在执行通道上），其他策略不受影响；
+    // 返回的报告包含暂停窗口时长
+    ReloadReport reload_strategy_plugin(const std::string& strategy_id, const std::string& plugin_path) {
+        auto it = strategies_.find(strategy_id);
+        if (it == strategies_.end()) {
+            ReloadReport report;
+            report.error = "Unknown strategy: " + strategy_id;
+            return report;
+        }
+        return hot_swap_strategy(*lanes_, event_bus_, it->second, plugin_path);
+    }
+    
     // 创建策略实例
     bool create_strategy(const StrategyConfig& config);
     
@@ -40,10 +61,142 @@ public:
     // 获取策略状态
     StrategyStatus get_strategy_status(const std::string& strategy_id) const;
     
+    // 热更新策略参数（如 ConfigService 推送的配置），新快照原子发布，不阻塞策略线程
+    bool reload_strategy_parameters(const std::string& strategy_id,
+                                    const std::unordered_map<std::string, std::string>& values) {
+        auto it = strategies_.find(strategy_id);
+        if (it == strategies_.end()) {
+            return false;
+        }
+        return it->second->parameters().apply(values);
+    }
+    
+    // 新增执行通道（独立线程 + 入站事件环），返回通道编号
+    size_t add_lane(const LaneConfig& config) {
+        return lanes_->add_lane(config);
+    }
+    
+    // 按配置创建执行通道，并把尚未挂载的策略按 ID 顺序轮转分配到这些通道上，返回本次挂载的策略数
+    size_t configure_lanes(const std::vector<LaneConfig>& configs) {
+        std::vector<size_t> lanes;
+        for (const auto& config : configs) {
+            lanes.push_back(lanes_->add_lane(config));
+        }
+        if (lanes.empty()) {
+            return 0;
+        }
+        std::vector<std::string> ids;
+        for (const auto& entry : strategies_) {
+            size_t current = 0;
+            if (!lanes_->lane_of(entry.second.get(), current)) {
+                ids.push_back(entry.first);
+            }
+        }
+        std::sort(ids.begin(), ids.end());
+        size_t placed = 0;
+        for (size_t i = 0; i < ids.size(); ++i) {
+            if (lanes_->assign(strategies_.at(ids[i]), lanes[i % lanes.size()])) {
+                ++placed;
+            }
+        }
+        return placed;
+    }
+    
+    // 将策略挂载到执行通道；已挂载的策略会在运行期迁移到新通道
+    bool assign_strategy_lane(const std::string& strategy_id, size_t lane) {
+        auto it = strategies_.find(strategy_id);
+        if (it == strategies_.end()) {
+            return false;
+        }
+        size_t current = 0;
+        if (lanes_->lane_of(it->second.get(), current)) {
+            return lanes_->rebalance(it->second, lane);
+        }
+        return lanes_->assign(it->second, lane);
+    }
+    
+    // 注册暖启动检查点：每个策略一个段 "strategy.<id>"，save_state() 在其执行通道线程上执行，
+    // 检查点线程只等待结果；超时、策略未挂载到通道或正在热更新时沿用该段上一次的内容。
+    // 有段注册失败（名称过长或重复）时返回 false，error 中列出失败的段名
+    bool register_checkpoints(base::common::checkpoint::Checkpointer& checkpointer,
+                              std::string* error = nullptr,
+                              std::chrono::milliseconds timeout = std::chrono::milliseconds(200)) {
+        bool ok = true;
+        for (const auto& entry : strategies_) {
+            const std::string id = entry.first;
+            const std::string section = "strategy." + id;
+            bool added = checkpointer.add_section(section, [this, id, timeout](std::string& out) {
+                std::future<std::string> state;
+                if (!lanes_->checkpoint(id, state) || state.wait_for(timeout) != std::future_status::ready) {
+                    return false;
+                }
+                try {
+                    out = state.get();
+                } catch (const std::exception&) {
+                    return false;
+                }
+                return true;
+            });
+            if (!added) {
+                ok = false;
+                if (error) {
+                    *error += (error->empty() ? "" : ", ") + section;
+                }
+            }
+        }
+        return ok;
+    }
+    
+    // 暖启动：在 start_all_strategies() 之前从检查点恢复策略状态（指标、持仓视图等），
+    // 返回成功恢复的策略数
+    size_t restore_checkpoint(const base::common::checkpoint::CheckpointImage& image) {
+        size_t restored = 0;
+        for (const auto& entry : strategies_) {
+            const uint8_t* data = nullptr;
+            size_t size = 0;
+            if (image.find("strategy." + entry.first, data, size) &&
+                entry.second->restore_state(std::string(reinterpret_cast<const char*>(data), size))) {
+                ++restored;
+            }
+        }
+        return restored;
+    }
+    
+    // 定时器回调适配：到期时投递到策略所在执行通道执行，与该策略的行情/回报回调串行，策略内无需加锁
+    // 例：timers.schedule_after(500ms, engine.on_strategy_lane("s1", [...]() { /* 撤单超时 */ }));
+    // 策略实例在到期时按 ID 解析（闭包只持有调度器的弱引用与策略 ID），热更新后定时器投递到替换实例所在通道，
+    // 与新实例的事件串行；到期时定时器线程只做一次 ID 查找和一次非阻塞入队。
+    // 回调若捕获了某个具体实例，须自行判断该实例是否已停止（如 CoroutineStrategy 的时间轮链接在 stop() 时断开）。
+    // 引擎已析构、策略已移除或不在通道上、通道入站环满时丢弃（后者计入 callbacks_dropped）
+    base::common::timer_wheel::TimerWheel::Callback on_strategy_lane(const std::string& strategy_id,
+                                                                     std::function<void()> callback) {
+        std::weak_ptr<LaneDispatcher> lanes = lanes_;
+        return [lanes, strategy_id, callback = std::move(callback)]() {
+            if (auto dispatcher = lanes.lock()) {
+                dispatcher->post_callback(strategy_id, callback);
+            }
+        };
+    }
+    
+    // 获取各执行通道的队列深度与回调耗时指标
+    std::vector<LaneStats> get_lane_stats() const {
+        return lanes_->stats();
+    }
+    
 private:
+    // 创建调度器并订阅事件总线：引擎构造后总线上的行情/订单/成交事件即经执行通道分发
+    static std::shared_ptr<LaneDispatcher> make_lanes(event_bus::EventBus& event_bus) {
+        auto lanes = std::make_shared<LaneDispatcher>();
+        subscribe_lanes(event_bus, lanes);
+        return lanes;
+    }
+    
     event_bus::EventBus& event_bus_;
     StrategyFactory strategy_factory_;
     std::unordered_map<std::string, std::shared_ptr<StrategyBase>> strategies_;
+    // 执行通道：行情/订单/成交事件经此扇出到各策略线程（共享持有，定时器回调只持有弱引用）；
+    // 在 event_bus_ 之后初始化
+    std::shared_ptr<LaneDispatcher> lanes_ = make_lanes(event_bus_);
     // 其他成员变量...
 };
 
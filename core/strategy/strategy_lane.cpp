@@ -0,0 +1,614 @@
+#include "strategy_lane.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include "common/rcu/rcu.h"
+#include "utils/thread_affinity/thread_affinity.h"
+
+namespace quant {
+namespace core {
+namespace strategy {
+
+namespace {
+
+// 更新原子最大值（仅在新值更大时写入）
+template <typename T>
+void update_max(std::atomic<T>& target, T value) {
+    T current = target.load(std::memory_order_relaxed);
+    while (value > current &&
+           !target.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+    }
+}
+
+} // namespace
+
+// ==================== StrategyLane ====================
+
+StrategyLane::StrategyLane(const LaneConfig& config)
+    : config_(config),
+      inbox_(config.queue_capacity),
+      running_(false),
+      overflow_size_(0),
+      strategy_count_(0),
+      max_queue_depth_(0),
+      events_handled_(0),
+      ticks_dropped_(0),
+      events_overflowed_(0),
+      callbacks_dropped_(0),
+      handler_ns_total_(0),
+      handler_ns_max_(0) {}
+
+StrategyLane::~StrategyLane() {
+    stop();
+}
+
+void StrategyLane::start() {
+    if (running_.exchange(true, std::memory_order_acq_rel)) {
+        return;
+    }
+    thread_ = std::thread(&StrategyLane::run, this);
+    base::utils::thread_affinity::set_thread_name(thread_.native_handle(), config_.name);
+    if (!base::utils::thread_affinity::pin_thread(thread_.native_handle(), config_.cpu_core)) {
+        std::cerr << "[StrategyLane] Failed to pin lane " << config_.name
+                  << " to core " << config_.cpu_core << std::endl;
+    }
+}
+
+void StrategyLane::stop() {
+    if (!running_.exchange(false, std::memory_order_acq_rel)) {
+        return;
+    }
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+}
+
+bool StrategyLane::post_tick(const market_data::TickData& tick) {
+    LaneEvent event;
+    event.type = LaneEvent::Type::kTick;
+    event.payload = tick;
+    QT_TRACE_STAGE(trace::TickStage::kLaneEnqueue);
+    QT_TRACE_CAPTURE(event.trace);
+    // 溢出队列非空时行情不能越过其中的事件入环，与队满同样处理为丢弃
+    if (overflow_size_.load(std::memory_order_acquire) != 0 || !inbox_.push(std::move(event))) {
+        ticks_dropped_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    note_depth();
+    return true;
+}
+
+void StrategyLane::post(LaneEvent&& event) {
+    if (overflow_size_.load(std::memory_order_acquire) == 0 && inbox_.push(std::move(event))) {
+        note_depth();
+        return;
+    }
+    std::lock_guard<std::mutex> lock(overflow_mutex_);
+    if (overflow_.empty() && inbox_.push(std::move(event))) {
+        note_depth();
+        return;
+    }
+    overflow_.push_back(std::move(event));
+    overflow_size_.store(overflow_.size(), std::memory_order_release);
+    events_overflowed_.fetch_add(1, std::memory_order_relaxed);
+}
+
+bool StrategyLane::try_post(LaneEvent&& event) {
+    // 与 post_tick 相同：溢出队列非空时不能越过其中的事件入环
+    if (overflow_size_.load(std::memory_order_acquire) != 0 || !inbox_.push(std::move(event))) {
+        callbacks_dropped_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    note_depth();
+    return true;
+}
+
+LaneStats StrategyLane::stats() const {
+    LaneStats stats;
+    stats.name = config_.name;
+    stats.strategy_count = strategy_count_.load(std::memory_order_relaxed);
+    stats.queue_depth = inbox_.size() + overflow_size_.load(std::memory_order_relaxed);
+    stats.max_queue_depth = max_queue_depth_.load(std::memory_order_relaxed);
+    stats.events_handled = events_handled_.load(std::memory_order_relaxed);
+    stats.ticks_dropped = ticks_dropped_.load(std::memory_order_relaxed);
+    stats.events_overflowed = events_overflowed_.load(std::memory_order_relaxed);
+    stats.callbacks_dropped = callbacks_dropped_.load(std::memory_order_relaxed);
+    stats.handler_ns_total = handler_ns_total_.load(std::memory_order_relaxed);
+    stats.handler_ns_max = handler_ns_max_.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void StrategyLane::note_depth() {
+    update_max(max_queue_depth_, inbox_.size());
+}
+
+bool StrategyLane::next_event(LaneEvent& event) {
+    // 取出的溢出批次先于环中的事件处理：批次中的事件入队时环已满，环中剩余的都比它们早，
+    // 此后入环的都比它们晚
+    if (overflow_batch_.empty()) {
+        if (inbox_.pop(event)) {
+            return true;
+        }
+        if (overflow_size_.load(std::memory_order_acquire) == 0) {
+            return false;
+        }
+        std::lock_guard<std::mutex> lock(overflow_mutex_);
+        overflow_batch_.swap(overflow_);
+        overflow_size_.store(0, std::memory_order_release);
+        if (overflow_batch_.empty()) {
+            return false;
+        }
+    }
+    event = std::move(overflow_batch_.front());
+    overflow_batch_.pop_front();
+    return true;
+}
+
+void StrategyLane::run() {
+    // 通道线程注册为 RCU 读者：策略在回调中读取的参数快照等，在事件之间报告静止状态
+    base::common::rcu::RcuReader rcu_reader;
+    bool online = true;
+
+    LaneEvent event;
+    while (running_.load(std::memory_order_acquire)) {
+        if (next_event(event)) {
+            if (!online) {
+                rcu_reader.online();
+                online = true;
+            }
+            handle(event);
+            rcu_reader.quiescent();
+        } else {
+            if (online) {
+                rcu_reader.offline();   // 空闲时离线，避免阻塞写者回收
+                online = false;
+            }
+            std::this_thread::yield();
+        }
+    }
+
+    if (!online) {
+        rcu_reader.online();
+    }
+
+    // 停止后处理完剩余事件，保证已投递的订单/成交回报不丢失
+    while (next_event(event)) {
+        handle(event);
+    }
+}
+
+void StrategyLane::handle(LaneEvent& event) {
+    switch (event.type) {
+    case LaneEvent::Type::kTick:
+        for (auto& strategy : strategies_) {
+            dispatch(event, *strategy);
+        }
+        // 迁移中的策略：先缓存，等源通道处理完其剩余事件后再回放
+        for (auto& entry : pending_) {
+            entry.second.push_back(event);
+        }
+        break;
+
+    case LaneEvent::Type::kAttach:
+        strategies_.push_back(std::move(event.strategy));
+        break;
+
+    case LaneEvent::Type::kAttachPending:
+        pending_[event.strategy.get()];
+        break;
+
+    case LaneEvent::Type::kDetach: {
+        auto it = std::find(strategies_.begin(), strategies_.end(), event.strategy);
+        if (it != strategies_.end()) {
+            strategies_.erase(it);
+        }
+        if (event.handoff_to != nullptr) {
+            // post() 从不阻塞：目标通道满或已停止时进入其溢出队列，本通道不会因此卡住
+            LaneEvent activate;
+            activate.type = LaneEvent::Type::kActivate;
+            activate.strategy = std::move(event.strategy);
+            activate.migrated = std::move(event.migrated);
+            event.handoff_to->post(std::move(activate));
+        }
+        break;
+    }
+
+    case LaneEvent::Type::kActivate: {
+        auto it = pending_.find(event.strategy.get());
+        if (it != pending_.end()) {
+            for (const auto& buffered : it->second) {
+                dispatch(buffered, *event.strategy);
+            }
+            pending_.erase(it);
+        }
+        strategies_.push_back(std::move(event.strategy));
+        if (event.migrated) {
+            event.migrated->store(true, std::memory_order_release);
+        }
+        break;
+    }
+
+    case LaneEvent::Type::kQuiesce: {
+        auto it = std::find(strategies_.begin(), strategies_.end(), event.strategy);
+        if (it != strategies_.end()) {
+            strategies_.erase(it);
+        }
+        pending_[event.strategy.get()];
+        if (event.done) {
+            event.done->set_value();
+        }
+        break;
+    }
+
+    case LaneEvent::Type::kResume: {
+        auto it = pending_.find(event.strategy.get());
+        if (it != pending_.end()) {
+            for (const auto& buffered : it->second) {
+                dispatch(buffered, *event.replacement);
+            }
+            pending_.erase(it);
+        }
+        strategies_.push_back(std::move(event.replacement));
+        break;
+    }
+
+    case LaneEvent::Type::kOrder:
+    case LaneEvent::Type::kTrade:
+    case LaneEvent::Type::kCallback: {
+        // 只分发给目标策略；迁移/热更新中的策略先缓存，随其事件一起回放
+        bool attached = false;
+        for (auto& strategy : strategies_) {
+            if (strategy.get() == event.target) {
+                dispatch(event, *strategy);
+                attached = true;
+                break;
+            }
+        }
+        if (!attached) {
+            auto it = pending_.find(const_cast<StrategyBase*>(event.target));
+            if (it != pending_.end()) {
+                it->second.push_back(event);
+            }
+        }
+        break;
+    }
+
+    case LaneEvent::Type::kCheckpoint: {
+        // 只保存本通道当前持有的策略：热更新中的策略不在 strategies_ 中，promise 随事件释放
+        for (auto& strategy : strategies_) {
+            if (strategy.get() == event.target && event.saved) {
+                try {
+                    event.saved->set_value(strategy->save_state());
+                } catch (...) {
+                    event.saved->set_exception(std::current_exception());
+                }
+                break;
+            }
+        }
+        break;
+    }
+    }
+
+    strategy_count_.store(strategies_.size(), std::memory_order_relaxed);
+    event.payload = std::monostate{};
+    event.strategy.reset();
+    event.replacement.reset();
+    event.done.reset();
+    event.migrated.reset();
+    event.saved.reset();
+    event.callback = nullptr;
+}
+
+void StrategyLane::dispatch(const LaneEvent& event, StrategyBase& strategy) {
+    auto start = std::chrono::steady_clock::now();
+    try {
+        switch (event.type) {
+        case LaneEvent::Type::kTick:
+            QT_TRACE_RESUME(event.trace);
+            QT_TRACE_STAGE(trace::TickStage::kLaneDequeue);
+            strategy.on_tick(std::get<market_data::TickData>(event.payload));
+            QT_TRACE_STAGE(trace::TickStage::kOnTick);
+            QT_TRACE_RECORD();
+            break;
+        case LaneEvent::Type::kOrder:
+            strategy.on_order(std::get<oms::Order>(event.payload));
+            break;
+        case LaneEvent::Type::kTrade:
+            strategy.on_trade(std::get<oms::Trade>(event.payload));
+            break;
+        case LaneEvent::Type::kCallback:
+            event.callback();
+            break;
+        default:
+            return;
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "[StrategyLane] Strategy " << strategy.id() << " handler error: " << e.what() << std::endl;
+    } catch (...) {
+        std::cerr << "[StrategyLane] Strategy " << strategy.id() << " unknown handler error" << std::endl;
+    }
+    auto elapsed = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - start).count());
+
+    events_handled_.fetch_add(1, std::memory_order_relaxed);
+    handler_ns_total_.fetch_add(elapsed, std::memory_order_relaxed);
+    update_max(handler_ns_max_, elapsed);
+}
+
+// ==================== LaneDispatcher ====================
+
+LaneDispatcher::~LaneDispatcher() {
+    stop_all();
+}
+
+size_t LaneDispatcher::add_lane(const LaneConfig& config) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    lanes_.push_back(std::make_unique<StrategyLane>(config));
+    lane_strategies_.push_back(0);
+    lanes_.back()->start();
+    return lanes_.size() - 1;
+}
+
+bool LaneDispatcher::assign(const std::shared_ptr<StrategyBase>& strategy, size_t lane) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!strategy || lane >= lanes_.size() || placement_.count(strategy.get()) != 0 ||
+        by_id_.count(strategy->id()) != 0) {
+        return false;
+    }
+    LaneEvent attach;
+    attach.type = LaneEvent::Type::kAttach;
+    attach.strategy = strategy;
+    lanes_[lane]->post(std::move(attach));
+    placement_[strategy.get()] = lane;
+    by_id_[strategy->id()] = strategy.get();
+    ++lane_strategies_[lane];
+    return true;
+}
+
+bool LaneDispatcher::rebalance(const std::shared_ptr<StrategyBase>& strategy, size_t lane) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!strategy || lane >= lanes_.size()) {
+        return false;
+    }
+    auto it = placement_.find(strategy.get());
+    if (it == placement_.end()) {
+        return false;
+    }
+    size_t from = it->second;
+    if (from == lane) {
+        return true;
+    }
+    if (migrating(strategy.get())) {
+        return false;
+    }
+
+    // 两条控制事件在持锁期间投递，期间没有任何行情/回报插入：
+    // 源通道处理完 kDetach 之前的事件后交出策略，目标通道缓存 kAttachPending 之后的事件，
+    // 两段恰好首尾相接
+    LaneEvent pending;
+    pending.type = LaneEvent::Type::kAttachPending;
+    pending.strategy = strategy;
+    lanes_[lane]->post(std::move(pending));
+
+    LaneEvent detach;
+    detach.type = LaneEvent::Type::kDetach;
+    detach.strategy = strategy;
+    detach.handoff_to = lanes_[lane].get();
+    detach.migrated = std::make_shared<std::atomic<bool>>(false);
+    migrations_[strategy.get()] = detach.migrated;
+    lanes_[from]->post(std::move(detach));
+
+    it->second = lane;
+    --lane_strategies_[from];
+    ++lane_strategies_[lane];
+    return true;
+}
+
+bool LaneDispatcher::quiesce(const std::shared_ptr<StrategyBase>& strategy, std::future<void>& quiesced) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = placement_.find(strategy.get());
+    if (it == placement_.end() || migrating(strategy.get())) {
+        return false;
+    }
+    LaneEvent event;
+    event.type = LaneEvent::Type::kQuiesce;
+    event.strategy = strategy;
+    event.done = std::make_shared<std::promise<void>>();
+    quiesced = event.done->get_future();
+    lanes_[it->second]->post(std::move(event));
+    return true;
+}
+
+bool LaneDispatcher::resume(const std::shared_ptr<StrategyBase>& strategy,
+                            const std::shared_ptr<StrategyBase>& replacement) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = placement_.find(strategy.get());
+    if (it == placement_.end() || !replacement) {
+        return false;
+    }
+    size_t lane = it->second;
+    LaneEvent event;
+    event.type = LaneEvent::Type::kResume;
+    event.strategy = strategy;
+    event.replacement = replacement;
+    lanes_[lane]->post(std::move(event));
+
+    placement_.erase(it);
+    placement_[replacement.get()] = lane;
+    by_id_[replacement->id()] = replacement.get();
+    return true;
+}
+
+bool LaneDispatcher::checkpoint(const std::string& strategy_id, std::future<std::string>& state) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    LaneEvent event;
+    event.type = LaneEvent::Type::kCheckpoint;
+    size_t lane = 0;
+    if (!locate(strategy_id, event.target, lane)) {
+        return false;
+    }
+    event.saved = std::make_shared<std::promise<std::string>>();
+    state = event.saved->get_future();
+    lanes_[lane]->post(std::move(event));
+    return true;
+}
+
+bool LaneDispatcher::post_callback(const StrategyBase* strategy, std::function<void()> callback) {
+    LaneEvent event;
+    event.type = LaneEvent::Type::kCallback;
+    event.target = strategy;
+    event.callback = std::move(callback);
+    // 持锁只做一次指针查找和一次非阻塞入队，保证与迁移在同一位置切分
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = placement_.find(const_cast<StrategyBase*>(strategy));
+    if (it == placement_.end()) {
+        return false;
+    }
+    return lanes_[it->second]->try_post(std::move(event));
+}
+
+bool LaneDispatcher::post_callback(const std::string& strategy_id, std::function<void()> callback) {
+    LaneEvent event;
+    event.type = LaneEvent::Type::kCallback;
+    event.callback = std::move(callback);
+    std::lock_guard<std::mutex> lock(mutex_);
+    size_t lane = 0;
+    if (!locate(strategy_id, event.target, lane)) {
+        return false;
+    }
+    return lanes_[lane]->try_post(std::move(event));
+}
+
+bool LaneDispatcher::migrating(StrategyBase* strategy) {
+    // 迁移的 kActivate 还没被目标通道处理时，策略仍在目标通道的缓存中，
+    // 此时再发 kDetach/kQuiesce 会被目标通道忽略，缓存的事件随之丢失
+    auto it = migrations_.find(strategy);
+    if (it == migrations_.end()) {
+        return false;
+    }
+    if (!it->second->load(std::memory_order_acquire)) {
+        return true;
+    }
+    migrations_.erase(it);
+    return false;
+}
+
+bool LaneDispatcher::locate(const std::string& strategy_id, const StrategyBase*& strategy, size_t& lane) const {
+    auto it = by_id_.find(strategy_id);
+    if (it == by_id_.end()) {
+        return false;
+    }
+    strategy = it->second;
+    lane = placement_.at(it->second);
+    return true;
+}
+
+bool LaneDispatcher::remove(const std::shared_ptr<StrategyBase>& strategy) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = placement_.find(strategy.get());
+    if (it == placement_.end() || migrating(strategy.get())) {
+        return false;
+    }
+    LaneEvent detach;
+    detach.type = LaneEvent::Type::kDetach;
+    detach.strategy = strategy;
+    lanes_[it->second]->post(std::move(detach));
+    --lane_strategies_[it->second];
+    placement_.erase(it);
+    auto id = by_id_.find(strategy->id());
+    if (id != by_id_.end() && id->second == strategy.get()) {
+        by_id_.erase(id);
+    }
+    return true;
+}
+
+bool LaneDispatcher::lane_of(const StrategyBase* strategy, size_t& lane) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = placement_.find(const_cast<StrategyBase*>(strategy));
+    if (it == placement_.end()) {
+        return false;
+    }
+    lane = it->second;
+    return true;
+}
+
+void LaneDispatcher::dispatch_tick(const market_data::TickData& tick) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (size_t i = 0; i < lanes_.size(); ++i) {
+        if (lane_strategies_[i] != 0) {
+            lanes_[i]->post_tick(tick);
+        }
+    }
+}
+
+bool LaneDispatcher::dispatch_order(const std::string& strategy_id, const oms::Order& order) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    LaneEvent event;
+    event.type = LaneEvent::Type::kOrder;
+    size_t lane = 0;
+    if (!locate(strategy_id, event.target, lane)) {
+        return false;
+    }
+    event.payload = order;
+    lanes_[lane]->post(std::move(event));
+    return true;
+}
+
+bool LaneDispatcher::dispatch_trade(const std::string& strategy_id, const oms::Trade& trade) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    LaneEvent event;
+    event.type = LaneEvent::Type::kTrade;
+    size_t lane = 0;
+    if (!locate(strategy_id, event.target, lane)) {
+        return false;
+    }
+    event.payload = trade;
+    lanes_[lane]->post(std::move(event));
+    return true;
+}
+
+void LaneDispatcher::stop_all() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto& lane : lanes_) {
+        lane->stop();
+    }
+}
+
+std::vector<LaneStats> LaneDispatcher::stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<LaneStats> result;
+    result.reserve(lanes_.size());
+    for (const auto& lane : lanes_) {
+        result.push_back(lane->stats());
+    }
+    return result;
+}
+
+size_t LaneDispatcher::lane_count() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return lanes_.size();
+}
+
+void subscribe_lanes(event_bus::EventBus& event_bus, const std::shared_ptr<LaneDispatcher>& lanes) {
+    std::weak_ptr<LaneDispatcher> weak = lanes;
+    event_bus.subscribe<event_bus::TickEvent>([weak](const event_bus::TickEvent& event) {
+        if (auto dispatcher = weak.lock()) {
+            dispatcher->dispatch_tick(event.tick);
+        }
+    });
+    event_bus.subscribe<event_bus::OrderEvent>([weak](const event_bus::OrderEvent& event) {
+        if (auto dispatcher = weak.lock()) {
+            dispatcher->dispatch_order(event.strategy_id, event.order);
+        }
+    });
+    event_bus.subscribe<event_bus::TradeEvent>([weak](const event_bus::TradeEvent& event) {
+        if (auto dispatcher = weak.lock()) {
+            dispatcher->dispatch_trade(event.strategy_id, event.trade);
+        }
+    });
+}
+
+} // namespace strategy
+} // namespace core
+} // namespace quant
@@ -0,0 +1,225 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+#include "strategy_base.h"
+#include "../market_data/tick_data.h"
+#include "../oms/order.h"
+#include "../oms/trade.h"
+#include "../trace/tick_trace.h"
+#include "../event_bus/trading_events.h"
+#include "common/ring_queue/ring_queue.h"
+
+namespace quant {
+namespace core {
+namespace strategy {
+
+// 执行通道配置
+struct LaneConfig {
+    std::string name;                   // 通道名称（同时用作线程名）
+    int cpu_core = -1;                  // 绑定的 CPU 核心，-1 表示不绑定
+    size_t queue_capacity = 65536;      // 入站事件环容量（向上取整为 2 的幂）
+};
+
+// 执行通道运行指标（快照）
+struct LaneStats {
+    std::string name;
+    size_t strategy_count = 0;          // 通道上的策略数
+    size_t queue_depth = 0;             // 当前入站队列深度
+    size_t max_queue_depth = 0;         // 入站队列深度峰值
+    uint64_t events_handled = 0;        // 已分发的事件数
+    uint64_t ticks_dropped = 0;         // 队满丢弃的行情数
+    uint64_t events_overflowed = 0;     // 队满时转入溢出队列的订单/成交/控制事件数
+    uint64_t callbacks_dropped = 0;     // 队满丢弃的定时器回调数
+    uint64_t handler_ns_total = 0;      // 回调累计耗时（纳秒）
+    uint64_t handler_ns_max = 0;        // 单次回调最大耗时（纳秒）
+};
+
+// 通道入站事件
+struct LaneEvent {
+    enum class Type : uint8_t {
+        kTick,            // 行情：分发给通道上的所有策略
+        kOrder,           // 订单回报：只分发给 target（下单策略）
+        kTrade,           // 成交回报：只分发给 target
+        kAttach,          // 直接挂载策略
+        kAttachPending,   // 迁移目标：开始缓存该策略的事件，等待 kActivate
+        kDetach,          // 迁移源：卸下策略，并通知目标通道 kActivate
+        kActivate,        // 迁移目标：回放缓存事件后正式接管策略
+        kQuiesce,         // 暂停：卸下策略并开始缓存其事件（热更新）
+        kResume,          // 恢复：缓存事件回放给替换实例，由其接管
+        kCheckpoint,      // 检查点：在通道线程上保存目标策略的状态
+        kCallback,        // 回调（定时器等）：在通道线程上执行，与目标策略的事件串行
+    };
+
+    Type type = Type::kTick;
+    std::variant<std::monostate, market_data::TickData, oms::Order, oms::Trade> payload;
+    std::shared_ptr<StrategyBase> strategy;         // 控制事件的目标策略
+    class StrategyLane* handoff_to = nullptr;       // kDetach：迁移目标通道
+    std::shared_ptr<StrategyBase> replacement;      // kResume：接管的新实例
+    std::shared_ptr<std::promise<void>> done;       // kQuiesce：卸下完成通知
+    std::shared_ptr<std::atomic<bool>> migrated;    // kDetach/kActivate：目标通道接管后置位
+    const StrategyBase* target = nullptr;           // kOrder/kTrade/kCallback/kCheckpoint：目标策略（仅比较地址）
+    std::shared_ptr<std::promise<std::string>> saved;   // kCheckpoint：保存的策略状态
+    std::function<void()> callback;                 // kCallback：要执行的回调（target 为目标策略）
+#ifdef QT_ENABLE_LATENCY_TRACE
+    base::utils::latency_trace::TraceStamps trace;  // kTick：上游各阶段时间戳
+#endif
+};
+
+// 策略执行通道：独占一个（可绑核）线程和一个入站事件环，
+// 通道上所有策略的 on_tick/on_order/on_trade 都只在该线程上执行
+class StrategyLane {
+public:
+    explicit StrategyLane(const LaneConfig& config);
+    ~StrategyLane();
+
+    // 禁止拷贝和移动
+    StrategyLane(const StrategyLane&) = delete;
+    StrategyLane& operator=(const StrategyLane&) = delete;
+    StrategyLane(StrategyLane&&) = delete;
+    StrategyLane& operator=(StrategyLane&&) = delete;
+
+    // 启动/停止通道线程（停止时先处理完队列中剩余的事件）
+    void start();
+    void stop();
+
+    // 投递行情：队满时丢弃并计数，不阻塞发布线程
+    bool post_tick(const market_data::TickData& tick);
+
+    // 投递订单/成交/控制事件：不可丢弃，也从不阻塞调用方——入站环满时转入溢出队列，
+    // 通道线程按投递顺序先处理完环中的事件再处理溢出队列；溢出期间到达的行情直接丢弃
+    void post(LaneEvent&& event);
+
+    // 投递可丢弃的事件（定时器回调）：入站环满或溢出队列非空时丢弃并计数，返回是否受理
+    bool try_post(LaneEvent&& event);
+
+    // 获取运行指标快照
+    LaneStats stats() const;
+
+    const std::string& name() const { return config_.name; }
+
+private:
+    void run();
+    bool next_event(LaneEvent& event);
+    void handle(LaneEvent& event);
+    void dispatch(const LaneEvent& event, StrategyBase& strategy);
+    void note_depth();
+
+    LaneConfig config_;
+    base::common::ring_queue::RingQueue<LaneEvent> inbox_;
+    std::thread thread_;
+    std::atomic<bool> running_;
+
+    // 溢出队列：入站环满时不可丢弃的事件暂存于此（非空期间所有新事件都排在其后，保持顺序）
+    std::mutex overflow_mutex_;
+    std::deque<LaneEvent> overflow_;
+    std::atomic<size_t> overflow_size_;
+
+    // 以下成员仅由通道线程访问
+    std::deque<LaneEvent> overflow_batch_;                                 // 从溢出队列取出、待处理的事件
+    std::vector<std::shared_ptr<StrategyBase>> strategies_;
+    std::unordered_map<StrategyBase*, std::vector<LaneEvent>> pending_;   // 迁移中策略的缓存事件
+
+    // 运行指标（通道线程写，其他线程只读）
+    std::atomic<size_t> strategy_count_;
+    std::atomic<size_t> max_queue_depth_;
+    std::atomic<uint64_t> events_handled_;
+    std::atomic<uint64_t> ticks_dropped_;
+    std::atomic<uint64_t> events_overflowed_;
+    std::atomic<uint64_t> callbacks_dropped_;
+    std::atomic<uint64_t> handler_ns_total_;
+    std::atomic<uint64_t> handler_ns_max_;
+};
+
+// 通道调度器：维护策略到通道的映射，将事件扇出到各通道，并支持运行期重平衡
+// 引擎订阅事件总线后调用 dispatch_*：行情扇出到所有挂有策略的通道，订单/成交回报只投递到
+// 下单策略所在的通道。扇出过程与重平衡互斥，保证迁移时源通道与目标通道看到的事件序列
+// 在同一位置切分（不丢、不重、不并发）；投递从不阻塞，持锁时间只含入队
+class LaneDispatcher {
+public:
+    LaneDispatcher() = default;
+    ~LaneDispatcher();
+
+    LaneDispatcher(const LaneDispatcher&) = delete;
+    LaneDispatcher& operator=(const LaneDispatcher&) = delete;
+
+    // 新增通道，返回通道编号（通道立即启动）
+    size_t add_lane(const LaneConfig& config);
+
+    // 将策略挂载到指定通道
+    bool assign(const std::shared_ptr<StrategyBase>& strategy, size_t lane);
+
+    // 将策略迁移到另一个通道（异步完成，迁移期间事件在目标通道缓存）；
+    // 上一次迁移尚未被目标通道接管时返回 false，由调用方稍后重试
+    bool rebalance(const std::shared_ptr<StrategyBase>& strategy, size_t lane);
+
+    // 暂停策略（热更新第一步）：通道处理到该位置时卸下策略并开始缓存其事件，
+    // quiesced 在卸下完成后就绪，此后可安全地读取/迁移策略状态；
+    // 迁移尚未被目标通道接管时返回 false（与 rebalance/remove 相同，由调用方稍后重试）
+    bool quiesce(const std::shared_ptr<StrategyBase>& strategy, std::future<void>& quiesced);
+
+    // 恢复策略（热更新第二步）：把暂停期间缓存的事件回放给 replacement（可为原实例），由其接管
+    bool resume(const std::shared_ptr<StrategyBase>& strategy, const std::shared_ptr<StrategyBase>& replacement);
+
+    // 采集策略状态（暖启动检查点）：通道处理到该位置时在通道线程上调用 save_state()，
+    // 策略不在任何通道上（或正在热更新中）时 state 以 broken_promise 结束
+    bool checkpoint(const std::string& strategy_id, std::future<std::string>& state);
+
+    // 在策略所在通道上执行回调（定时器到期、撤单超时等）：与该策略的 on_tick/on_order 串行，
+    // 迁移或热更新期间随策略的事件一起缓存。按实例定位（一次指针查找），投递不阻塞：
+    // 策略不在任何通道上或入站环满时丢弃回调并返回 false（后者计入 LaneStats::callbacks_dropped）
+    bool post_callback(const StrategyBase* strategy, std::function<void()> callback);
+
+    // 同上，按策略 ID 定位：投递时解析 ID 当前对应的实例，热更新后投递到替换实例所在通道
+    bool post_callback(const std::string& strategy_id, std::function<void()> callback);
+
+    // 从调度器中移除策略（迁移尚未完成时返回 false）
+    bool remove(const std::shared_ptr<StrategyBase>& strategy);
+
+    // 查询策略所在通道，未挂载返回 false
+    bool lane_of(const StrategyBase* strategy, size_t& lane) const;
+
+    // 事件扇出（由事件总线回调调用）；订单/成交回报按下单策略路由，策略不在任何通道上时返回 false
+    void dispatch_tick(const market_data::TickData& tick);
+    bool dispatch_order(const std::string& strategy_id, const oms::Order& order);
+    bool dispatch_trade(const std::string& strategy_id, const oms::Trade& trade);
+
+    // 停止所有通道
+    void stop_all();
+
+    // 各通道运行指标
+    std::vector<LaneStats> stats() const;
+
+    size_t lane_count() const;
+
+private:
+    // 按策略 ID 查找通道上的实例与所在通道（调用方持有 mutex_）
+    bool locate(const std::string& strategy_id, const StrategyBase*& strategy, size_t& lane) const;
+    // 策略是否有尚未被目标通道接管的迁移（调用方持有 mutex_）
+    bool migrating(StrategyBase* strategy);
+
+    mutable std::mutex mutex_;                                      // 保护扇出与映射变更
+    std::vector<std::unique_ptr<StrategyLane>> lanes_;
+    std::unordered_map<StrategyBase*, size_t> placement_;           // 策略 -> 通道编号
+    std::unordered_map<std::string, StrategyBase*> by_id_;          // 策略 ID -> 通道上的实例
+    std::vector<size_t> lane_strategies_;                           // 各通道挂载的策略数（行情只扇出到非空通道）
+    std::unordered_map<StrategyBase*, std::shared_ptr<std::atomic<bool>>> migrations_;   // 进行中的迁移
+};
+
+// 把事件总线上的行情/订单/成交事件接入调度器：发布线程上只做入队，策略回调在各自的通道线程上执行。
+// 处理函数只持有调度器的弱引用（事件总线不支持退订），调度器析构后到达的事件被忽略
+void subscribe_lanes(event_bus::EventBus& event_bus, const std::shared_ptr<LaneDispatcher>& lanes);
+
+} // namespace strategy
+} // namespace core
+} // namespace quant
@@ -0,0 +1,292 @@
+#pragma once
+
+#include <mutex>
+#include <memory>
+#include <string>
+#include <vector>
+#include <cmath>
+#include <cctype>
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <utility>
+#include <stdexcept>
+#include <type_traits>
+#include <unordered_map>
+#include "common/rcu/rcu.h"
+
+namespace quant {
+namespace core {
+namespace strategy {
+
+// 参数类型
+enum class ParameterType : uint8_t {
+    kInt,
+    kDouble,
+    kBool,
+    kEnum,
+};
+
+// 参数值（8 字节，按类型解释）
+union ParameterValue {
+    int64_t int_value;
+    double double_value;
+    bool bool_value;
+};
+
+// 类型化参数槽位：注册时返回，读取时按下标直接访问，无字符串查找
+template <typename T>
+class ParameterSlot {
+public:
+    ParameterSlot() = default;
+    size_t index() const { return index_; }
+
+private:
+    friend class ParameterSet;
+    explicit ParameterSlot(size_t index) : index_(index) {}
+    size_t index_ = 0;
+};
+
+// 不可变参数快照：一次热更新的全部参数值，发布后不再修改
+class ParameterSnapshot {
+public:
+    uint64_t version() const { return version_; }
+
+    int64_t get(ParameterSlot<int64_t> slot) const { return values_[slot.index()].int_value; }
+    double get(ParameterSlot<double> slot) const { return values_[slot.index()].double_value; }
+    bool get(ParameterSlot<bool> slot) const { return values_[slot.index()].bool_value; }
+
+    template <typename E, typename = std::enable_if_t<std::is_enum<E>::value>>
+    E get(ParameterSlot<E> slot) const { return static_cast<E>(values_[slot.index()].int_value); }
+
+private:
+    friend class ParameterSet;
+    uint64_t version_ = 0;
+    std::vector<ParameterValue> values_;
+};
+
+// 策略参数集合
+// - 启动前通过 add_* 预注册参数，得到类型化槽位
+// - 行情路径：在线 RCU 读者线程（策略执行通道线程已自动注册）上 snapshot()/get() 只做一次
+//   acquire 指针读取 + 下标访问，无锁、无字符串解析
+// - 其他线程：get()/copy_snapshot() 在更新锁内读取（旧快照只在持锁发布时退役，持锁期间不会被回收）；
+//   snapshot() 返回的引用只在读者静止前有效，非读者线程调用抛出 std::logic_error
+// - 热更新：apply() 在冷路径解析字符串、构造新快照并通过 RCU 原子发布，旧快照在读者静止后回收
+class ParameterSet {
+public:
+    ParameterSet() : current_(std::make_unique<ParameterSnapshot>()) {}
+
+    // 禁止拷贝和移动
+    ParameterSet(const ParameterSet&) = delete;
+    ParameterSet& operator=(const ParameterSet&) = delete;
+
+    // 1. 参数注册（策略初始化阶段调用）
+    ParameterSlot<int64_t> add_int(const std::string& key, int64_t default_value) {
+        ParameterValue value;
+        value.int_value = default_value;
+        return ParameterSlot<int64_t>(add(key, ParameterType::kInt, value, {}));
+    }
+
+    ParameterSlot<double> add_double(const std::string& key, double default_value) {
+        ParameterValue value;
+        value.double_value = default_value;
+        return ParameterSlot<double>(add(key, ParameterType::kDouble, value, {}));
+    }
+
+    ParameterSlot<bool> add_bool(const std::string& key, bool default_value) {
+        ParameterValue value;
+        value.bool_value = default_value;
+        return ParameterSlot<bool>(add(key, ParameterType::kBool, value, {}));
+    }
+
+    // 枚举参数：配置中以名称表示，如 {{"market", Mode::kMarket}, {"limit", Mode::kLimit}}
+    template <typename E>
+    ParameterSlot<E> add_enum(const std::string& key,
+                              const std::vector<std::pair<std::string, E>>& choices, E default_value) {
+        static_assert(std::is_enum<E>::value, "add_enum requires an enum type");
+        std::vector<std::pair<std::string, int64_t>> names;
+        names.reserve(choices.size());
+        for (const auto& choice : choices) {
+            names.emplace_back(choice.first, static_cast<int64_t>(choice.second));
+        }
+        ParameterValue value;
+        value.int_value = static_cast<int64_t>(default_value);
+        return ParameterSlot<E>(add(key, ParameterType::kEnum, value, std::move(names)));
+    }
+
+
+    // 2. 热路径读取
+    // 获取当前快照（同一事件内读取多个参数时应先取快照，保证一致性）；仅限在线 RCU 读者线程
+    const ParameterSnapshot& snapshot() const {
+        if (!base::common::rcu::RcuReader::active(current_.domain())) {
+            throw std::logic_error("ParameterSet::snapshot() requires an online RCU reader; use copy_snapshot()");
+        }
+        return *current_.load();
+    }
+
+    template <typename T>
+    T get(ParameterSlot<T> slot) const {
+        if (base::common::rcu::RcuReader::active(current_.domain())) {
+            return current_.load()->get(slot);
+        }
+        std::lock_guard<std::mutex> lock(write_mutex_);
+        return current_.load()->get(slot);
+    }
+
+    // 当前快照的副本（任意线程，冷路径）
+    ParameterSnapshot copy_snapshot() const {
+        std::lock_guard<std::mutex> lock(write_mutex_);
+        return *current_.load();
+    }
+
+
+    // 3. 冷路径更新
+    // 批量应用字符串配置（如 ConfigService 下发的配置）；未注册的键忽略，
+    // 任一值解析失败则整批不生效，返回 false
+    bool apply(const std::unordered_map<std::string, std::string>& values, std::string* error = nullptr) {
+        std::lock_guard<std::mutex> lock(write_mutex_);
+        const ParameterSnapshot* current = current_.load();
+        auto next = std::make_unique<ParameterSnapshot>();
+        next->values_ = current->values_;
+        for (const auto& entry : values) {
+            auto it = index_.find(entry.first);
+            if (it == index_.end()) {
+                continue;
+            }
+            if (!parse(specs_[it->second], entry.second, next->values_[it->second])) {
+                if (error != nullptr) {
+                    *error = "invalid value for parameter " + entry.first + ": " + entry.second;
+                }
+                return false;
+            }
+        }
+        next->version_ = current->version_ + 1;
+        current_.publish(std::move(next));
+        return true;
+    }
+
+    // 单个参数更新
+    bool set(const std::string& key, const std::string& value) {
+        return apply({{key, value}});
+    }
+
+    // 以字符串形式读取参数（冷路径，兼容 StrategyBase::get_parameter）
+    std::string get_string(const std::string& key) const {
+        std::lock_guard<std::mutex> lock(write_mutex_);
+        auto it = index_.find(key);
+        if (it == index_.end()) {
+            return "";
+        }
+        const ParameterSpec& spec = specs_[it->second];
+        const ParameterValue& value = current_.load()->values_[it->second];
+        switch (spec.type) {
+        case ParameterType::kInt:
+            return std::to_string(value.int_value);
+        case ParameterType::kDouble:
+            return std::to_string(value.double_value);
+        case ParameterType::kBool:
+            return value.bool_value ? "true" : "false";
+        case ParameterType::kEnum:
+            for (const auto& choice : spec.choices) {
+                if (choice.second == value.int_value) {
+                    return choice.first;
+                }
+            }
+            return std::to_string(value.int_value);
+        }
+        return "";
+    }
+
+    bool contains(const std::string& key) const {
+        std::lock_guard<std::mutex> lock(write_mutex_);
+        return index_.count(key) != 0;
+    }
+
+    size_t size() const {
+        std::lock_guard<std::mutex> lock(write_mutex_);
+        return specs_.size();
+    }
+
+private:
+    struct ParameterSpec {
+        std::string key;
+        ParameterType type;
+        std::vector<std::pair<std::string, int64_t>> choices;   // 枚举可选值
+    };
+
+    size_t add(const std::string& key, ParameterType type, ParameterValue default_value,
+               std::vector<std::pair<std::string, int64_t>> choices) {
+        std::lock_guard<std::mutex> lock(write_mutex_);
+        if (index_.count(key) != 0) {
+            throw std::invalid_argument("Duplicate strategy parameter: " + key);
+        }
+        size_t index = specs_.size();
+        specs_.push_back(ParameterSpec{key, type, std::move(choices)});
+        index_[key] = index;
+
+        const ParameterSnapshot* current = current_.load();
+        auto next = std::make_unique<ParameterSnapshot>();
+        next->values_ = current->values_;
+        next->values_.push_back(default_value);
+        next->version_ = current->version_;
+        current_.publish(std::move(next));
+        return index;
+    }
+
+    // 数值须完整解析：拒绝首尾空白（strtoll/strtod 会跳过前导空白）、溢出（ERANGE）以及 nan/inf，
+    // 避免配置错误变成极端参数
+    static bool parse(const ParameterSpec& spec, const std::string& text, ParameterValue& value) {
+        if (text.empty() || std::isspace(static_cast<unsigned char>(text.front()))) {
+            return false;
+        }
+        char* end = nullptr;
+        switch (spec.type) {
+        case ParameterType::kInt: {
+            errno = 0;
+            long long parsed = std::strtoll(text.c_str(), &end, 10);
+            if (*end != '\0' || errno == ERANGE) {
+                return false;
+            }
+            value.int_value = parsed;
+            return true;
+        }
+        case ParameterType::kDouble: {
+            errno = 0;
+            double parsed = std::strtod(text.c_str(), &end);
+            if (*end != '\0' || errno == ERANGE || !std::isfinite(parsed)) {
+                return false;
+            }
+            value.double_value = parsed;
+            return true;
+        }
+        case ParameterType::kBool:
+            if (text == "true" || text == "1") {
+                value.bool_value = true;
+                return true;
+            }
+            if (text == "false" || text == "0") {
+                value.bool_value = false;
+                return true;
+            }
+            return false;
+        case ParameterType::kEnum:
+            for (const auto& choice : spec.choices) {
+                if (choice.first == text) {
+                    value.int_value = choice.second;
+                    return true;
+                }
+            }
+            return false;
+        }
+        return false;
+    }
+
+    mutable std::mutex write_mutex_;                       // 保护注册与更新（仅冷路径）
+    std::vector<ParameterSpec> specs_;                     // 参数描述（按槽位下标）
+    std::unordered_map<std::string, size_t> index_;        // 参数名 -> 槽位下标（仅冷路径使用）
+    base::common::rcu::RcuCell<ParameterSnapshot> current_; // 当前快照
+};
+
+} // namespace strategy
+} // namespace core
+} // namespace quant
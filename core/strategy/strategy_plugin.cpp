@@ -0,0 +1,164 @@
+#include "strategy_plugin.h"
+
+#include <dlfcn.h>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <iostream>
+#include <filesystem>
+#include <unistd.h>
+
+namespace quant {
+namespace core {
+namespace strategy {
+
+namespace {
+
+int64_t elapsed_us(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start).count();
+}
+
+// 生成影子副本路径：<原路径>.<进程号>.<序号>
+std::string make_shadow_path(const std::string& path) {
+    static std::atomic<uint64_t> sequence(0);
+    return path + "." + std::to_string(::getpid()) + "." +
+           std::to_string(sequence.fetch_add(1, std::memory_order_relaxed));
+}
+
+} // namespace
+
+std::shared_ptr<StrategyPlugin> StrategyPlugin::load(const std::string& path, bool shadow_copy, std::string* error) {
+    std::shared_ptr<StrategyPlugin> plugin(new StrategyPlugin());
+    plugin->path_ = path;
+    plugin->loaded_path_ = path;
+
+    if (shadow_copy) {
+        std::error_code ec;
+        plugin->loaded_path_ = make_shadow_path(path);
+        std::filesystem::copy_file(path, plugin->loaded_path_,
+                                   std::filesystem::copy_options::overwrite_existing, ec);
+        if (ec) {
+            if (error != nullptr) {
+                *error = "Failed to copy strategy plugin " + path + ": " + ec.message();
+            }
+            return nullptr;
+        }
+    }
+
+    plugin->handle_ = ::dlopen(plugin->loaded_path_.c_str(), RTLD_NOW | RTLD_LOCAL);
+    if (plugin->handle_ == nullptr) {
+        if (error != nullptr) {
+            *error = "Failed to load strategy plugin " + path + ": " + ::dlerror();
+        }
+        return nullptr;
+    }
+
+    plugin->create_ = reinterpret_cast<CreateStrategyFunc>(::dlsym(plugin->handle_, kCreateStrategySymbol));
+    plugin->destroy_ = reinterpret_cast<DestroyStrategyFunc>(::dlsym(plugin->handle_, kDestroyStrategySymbol));
+    if (plugin->create_ == nullptr || plugin->destroy_ == nullptr) {
+        if (error != nullptr) {
+            *error = "Strategy plugin " + path + " does not export create_strategy/destroy_strategy";
+        }
+        return nullptr;
+    }
+    return plugin;
+}
+
+StrategyPlugin::~StrategyPlugin() {
+    if (handle_ != nullptr) {
+        ::dlclose(handle_);
+    }
+    if (loaded_path_ != path_) {
+        std::error_code ec;
+        std::filesystem::remove(loaded_path_, ec);
+    }
+}
+
+std::shared_ptr<StrategyBase> StrategyPlugin::create(const StrategyConfig& config) {
+    StrategyBase* raw = create_(config);
+    if (raw == nullptr) {
+        return nullptr;
+    }
+    // 删除器持有插件引用：实例由插件自身的 destroy 函数释放，之后插件才可能被 dlclose
+    auto self = shared_from_this();
+    DestroyStrategyFunc destroy = destroy_;
+    return std::shared_ptr<StrategyBase>(raw, [self, destroy](StrategyBase* strategy) {
+        destroy(strategy);
+    });
+}
+
+ReloadReport hot_swap_strategy(LaneDispatcher& lanes, event_bus::EventBus& event_bus,
+                               std::shared_ptr<StrategyBase>& strategy, const std::string& plugin_path,
+                               std::chrono::milliseconds quiesce_timeout) {
+    ReloadReport report;
+    size_t lane = 0;
+    if (!strategy || !lanes.lane_of(strategy.get(), lane)) {
+        report.error = "Strategy is not running on an execution lane";
+        return report;
+    }
+
+    // 1. 暂停前完成所有耗时操作：加载新插件（影子副本，允许覆盖部署同一路径）并创建实例
+    auto load_start = std::chrono::steady_clock::now();
+    auto plugin = StrategyPlugin::load(plugin_path, true, &report.error);
+    if (!plugin) {
+        return report;
+    }
+    auto replacement = plugin->create(strategy->config());
+    if (!replacement || !replacement->initialize(event_bus)) {
+        report.error = "Failed to create strategy from plugin " + plugin_path;
+        return report;
+    }
+    int64_t load_us = elapsed_us(load_start);
+
+    report = swap_strategy(lanes, strategy, replacement, quiesce_timeout);
+    report.load_us = load_us;
+    return report;
+}
+
+ReloadReport swap_strategy(LaneDispatcher& lanes, std::shared_ptr<StrategyBase>& strategy,
+                           const std::shared_ptr<StrategyBase>& replacement,
+                           std::chrono::milliseconds quiesce_timeout) {
+    ReloadReport report;
+
+    // 2. 暂停旧实例：通道处理到此位置后卸下它，之后的事件进入缓存
+    auto pause_start = std::chrono::steady_clock::now();
+    std::future<void> quiesced;
+    if (!lanes.quiesce(strategy, quiesced)) {
+        // 新实例已 initialize()（可能已订阅事件总线），放弃前先停止它
+        replacement->stop();
+        report.error = "Failed to quiesce strategy " + strategy->id();
+        return report;
+    }
+    if (quiesced.wait_for(quiesce_timeout) != std::future_status::ready) {
+        // 通道按序处理：恢复事件排在暂停之后，旧实例卸下后立即重新挂上并回放缓存的事件
+        lanes.resume(strategy, strategy);
+        replacement->stop();
+        report.error = "Timed out waiting for strategy " + strategy->id() + " to quiesce";
+        report.pause_us = elapsed_us(pause_start);
+        return report;
+    }
+
+    // 3. 迁移状态；新实例拒绝状态时恢复旧实例，缓存的事件照常回放给它
+    std::string state = strategy->save_state();
+    if (!replacement->restore_state(state)) {
+        lanes.resume(strategy, strategy);
+        replacement->stop();
+        report.error = "New strategy instance rejected the saved state";
+        report.pause_us = elapsed_us(pause_start);
+        return report;
+    }
+    strategy->stop();
+    replacement->start();
+
+    // 4. 新实例回放缓存事件并接管；旧实例在最后一个引用释放时连同旧插件一起卸载
+    lanes.resume(strategy, replacement);
+    report.pause_us = elapsed_us(pause_start);
+    strategy = replacement;
+    report.success = true;
+    return report;
+}
+
+} // namespace strategy
+} // namespace core
+} // namespace quant
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <chrono>
+#include <string>
+#include <memory>
+#include <cstdint>
+#include "strategy_base.h"
+#include "strategy_lane.h"
+#include "../event_bus/event_bus.h"
+
+namespace quant {
+namespace core {
+namespace strategy {
+
+// 插件入口函数声明（策略插件以 extern "C" 导出以下符号）
+// 插件须与宿主使用同一版本的 strategy_base.h 编译：StrategyBase 的布局与虚表不提供跨版本兼容
+extern "C" {
+    using CreateStrategyFunc = StrategyBase* (*)(const StrategyConfig& config);
+    using DestroyStrategyFunc = void (*)(StrategyBase* strategy);
+}
+
+constexpr const char* kCreateStrategySymbol = "create_strategy";
+constexpr const char* kDestroyStrategySymbol = "destroy_strategy";
+
+// 已加载的策略插件（dlopen 句柄的 RAII 封装）
+// 由插件创建的策略实例持有插件的引用，最后一个实例销毁后才 dlclose，保证析构代码仍在内存中
+class StrategyPlugin : public std::enable_shared_from_this<StrategyPlugin> {
+public:
+    // 加载插件；shadow_copy=true 时先复制为唯一文件名再加载，
+    // 使同一路径被覆盖部署后也能与旧版本同时驻留（dlopen 按路径复用已加载的句柄）
+    static std::shared_ptr<StrategyPlugin> load(const std::string& path, bool shadow_copy, std::string* error);
+
+    ~StrategyPlugin();
+
+    StrategyPlugin(const StrategyPlugin&) = delete;
+    StrategyPlugin& operator=(const StrategyPlugin&) = delete;
+
+    // 创建策略实例
+    std::shared_ptr<StrategyBase> create(const StrategyConfig& config);
+
+    const std::string& path() const { return path_; }
+
+private:
+    StrategyPlugin() = default;
+
+    void* handle_ = nullptr;
+    CreateStrategyFunc create_ = nullptr;
+    DestroyStrategyFunc destroy_ = nullptr;
+    std::string path_;               // 部署路径
+    std::string loaded_path_;        // 实际 dlopen 的路径（影子副本时与 path_ 不同）
+};
+
+// 热更新结果
+struct ReloadReport {
+    bool success = false;
+    std::string error;
+    int64_t load_us = 0;             // 新插件加载耗时（暂停前完成，不计入暂停窗口）
+    int64_t pause_us = 0;            // 策略暂停窗口：从卸下旧实例到新实例接管
+};
+
+// 在执行通道上热替换单个策略：
+// 1. 预先加载新插件并创建实例（不影响运行中的策略）；
+// 2. 暂停旧实例（通道开始缓存其事件），导出状态、导入新实例并启动；
+// 3. 新实例回放缓存事件后接管，旧实例随其插件一并释放。
+// 其他策略始终照常运行；strategy 为输入输出参数，成功后指向新实例
+ReloadReport hot_swap_strategy(LaneDispatcher& lanes, event_bus::EventBus& event_bus,
+                               std::shared_ptr<StrategyBase>& strategy, const std::string& plugin_path,
+                               std::chrono::milliseconds quiesce_timeout = std::chrono::milliseconds(1000));
+
+// hot_swap_strategy 的第 2、3 步：用已创建并初始化的 replacement 替换通道上的 strategy。
+// 暂停失败、quiesce_timeout 内通道未处理到暂停位置（卡在其他回调中）或 replacement 拒绝状态时
+// replacement 被 stop()，旧实例继续运行（缓存的事件照常回放给它）
+ReloadReport swap_strategy(LaneDispatcher& lanes, std::shared_ptr<StrategyBase>& strategy,
+                           const std::shared_ptr<StrategyBase>& replacement,
+                           std::chrono::milliseconds quiesce_timeout = std::chrono::milliseconds(1000));
+
+} // namespace strategy
+} // namespace core
+} // namespace quant
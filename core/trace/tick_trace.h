@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstdint>
+#include "utils/latency_trace/latency_trace.h"
+
+namespace quant {
+namespace core {
+namespace trace {
+
+// 行情到下单（tick-to-trade）链路上的打点阶段，编号即报告中的顺序（各阶段记录相对上一个已打点阶段的增量）
+// 链路：数据源回调 -> process_raw_tick -> EventBus::publish -> 通道投递 -> 通道取出
+//       -> send_signal -> 风控检查 -> send_order -> on_tick 返回
+// - on_tick 在回调返回后打点、排在最后：没有信号时其增量为整个策略回调耗时，
+//   有信号时为下单之后的剩余耗时（信号之前的策略计算计入 send_signal）
+// - 数据源回调线程：入口处 QT_TRACE_BEGIN(kDataSourceCallback)，同步调用链上各阶段 QT_TRACE_STAGE，
+//   回调返回前 QT_TRACE_END()（行情已随通道事件交给策略线程继续跟踪）
+// - 策略通道线程：取出事件后 QT_TRACE_RESUME，on_tick 及其同步触发的信号/风控/下单继续打点，
+//   处理完毕 QT_TRACE_RECORD() 记录各阶段增量与端到端延迟
+enum class TickStage : uint8_t {
+    kDataSourceCallback = 0,
+    kProcessRawTick,
+    kEventBusPublish,
+    kLaneEnqueue,
+    kLaneDequeue,
+    kSendSignal,
+    kRiskCheck,
+    kSendOrder,
+    kOnTick,
+    kCount,
+};
+
+static_assert(static_cast<size_t>(TickStage::kCount) <= base::utils::latency_trace::kMaxTraceStages,
+              "too many tick trace stages");
+
+inline const char* to_string(TickStage stage) {
+    switch (stage) {
+    case TickStage::kDataSourceCallback: return "data_source_callback";
+    case TickStage::kProcessRawTick:     return "process_raw_tick";
+    case TickStage::kEventBusPublish:    return "event_bus_publish";
+    case TickStage::kLaneEnqueue:        return "lane_enqueue";
+    case TickStage::kLaneDequeue:        return "lane_dequeue";
+    case TickStage::kSendSignal:         return "send_signal";
+    case TickStage::kRiskCheck:          return "risk_check";
+    case TickStage::kSendOrder:          return "send_order";
+    case TickStage::kOnTick:             return "on_tick";
+    default:                             return "unknown";
+    }
+}
+
+// 向跟踪注册表登记阶段名称（引擎启动时调用一次）
+inline void register_tick_stages() {
+    auto& registry = base::utils::latency_trace::TraceRegistry::instance();
+    for (size_t i = 0; i < static_cast<size_t>(TickStage::kCount); ++i) {
+        registry.set_stage_name(i, to_string(static_cast<TickStage>(i)));
+    }
+}
+
+} // namespace trace
+} // namespace core
+} // namespace quant
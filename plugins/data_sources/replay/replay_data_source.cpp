@@ -0,0 +1,230 @@
+#include "replay_data_source.h"
+
+#include <chrono>
+#include <cstdlib>
+#include "utils/tsc_clock/tsc_clock.h"
+#include "../../../core/trace/tick_trace.h"
+
+namespace quant {
+namespace plugins {
+namespace data_sources {
+namespace replay {
+
+using base::utils::tsc_clock::TscClock;
+
+namespace {
+
+const std::string* find_config(const std::unordered_map<std::string, std::string>& config, const std::string& key) {
+    auto it = config.find(key);
+    return it == config.end() ? nullptr : &it->second;
+}
+
+// 解析一行录制记录："<recv_ns>\t<data_source>\t<raw_data>"
+bool parse_record(const std::string& line, CaptureRecord& record) {
+    size_t first = line.find('\t');
+    if (first == std::string::npos || first == 0) {
+        return false;
+    }
+    size_t second = line.find('\t', first + 1);
+    if (second == std::string::npos) {
+        return false;
+    }
+    char* end = nullptr;
+    long long recv_ns = std::strtoll(line.c_str(), &end, 10);
+    if (end != line.c_str() + first) {
+        return false;
+    }
+    record.recv_ns = recv_ns;
+    record.tick.data_source = line.substr(first + 1, second - first - 1);
+    record.tick.raw_data = line.substr(second + 1);
+    return true;
+}
+
+} // namespace
+
+// ==================== 录制文件 ====================
+
+bool load_capture(const std::string& path, std::vector<CaptureRecord>& records,
+                  size_t* skipped, std::string* error) {
+    std::ifstream in(path);
+    if (!in) {
+        if (error != nullptr) {
+            *error = "Failed to open capture file " + path;
+        }
+        return false;
+    }
+    records.clear();
+    size_t bad = 0;
+    std::string line;
+    CaptureRecord record;
+    while (std::getline(in, line)) {
+        if (line.empty()) {
+            continue;
+        }
+        if (parse_record(line, record)) {
+            records.push_back(record);
+        } else {
+            ++bad;
+        }
+    }
+    if (skipped != nullptr) {
+        *skipped = bad;
+    }
+    return true;
+}
+
+bool CaptureWriter::open(const std::string& path) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    out_.open(path, std::ios::out | std::ios::trunc);
+    written_ = 0;
+    return out_.is_open();
+}
+
+void CaptureWriter::write(const core::market_data::RawTickData& tick, int64_t recv_ns) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!out_.is_open()) {
+        return;
+    }
+    out_ << recv_ns << '\t' << tick.data_source << '\t' << tick.raw_data << '\n';
+    ++written_;
+}
+
+void CaptureWriter::close() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (out_.is_open()) {
+        out_.flush();
+        out_.close();
+    }
+}
+
+// ==================== ReplayDataSource ====================
+
+ReplayDataSource::~ReplayDataSource() {
+    disconnect();
+}
+
+bool ReplayDataSource::initialize(const std::unordered_map<std::string, std::string>& config) {
+    if (const std::string* name = find_config(config, "name")) {
+        name_ = *name;
+    }
+    if (const std::string* speed = find_config(config, "speed")) {
+        if (*speed == "max") {
+            speed_ = 0.0;
+        } else {
+            char* end = nullptr;
+            double value = std::strtod(speed->c_str(), &end);
+            if (speed->empty() || *end != '\0' || value <= 0.0) {
+                return false;
+            }
+            speed_ = value;
+        }
+    }
+    if (const std::string* loops = find_config(config, "loops")) {
+        char* end = nullptr;
+        unsigned long long value = std::strtoull(loops->c_str(), &end, 10);
+        if (loops->empty() || *end != '\0' || value == 0) {
+            return false;
+        }
+        loops_ = static_cast<size_t>(value);
+    }
+    ticks_counter_ = base::common::metrics::MetricsRegistry::instance().counter("data_source." + name_ + ".ticks");
+    const std::string* file = find_config(config, "file");
+    return file != nullptr && load_capture(*file, records_);
+}
+
+bool ReplayDataSource::connect() {
+    if (running_.exchange(true, std::memory_order_acq_rel)) {
+        return true;
+    }
+    finished_.store(false, std::memory_order_release);
+    replayed_.store(0, std::memory_order_relaxed);
+    thread_ = std::thread(&ReplayDataSource::run, this);
+    return true;
+}
+
+void ReplayDataSource::disconnect() {
+    running_.store(false, std::memory_order_release);
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+}
+
+bool ReplayDataSource::subscribe(const std::vector<std::string>& instruments) {
+    instruments_.insert(instruments_.end(), instruments.begin(), instruments.end());
+    return true;
+}
+
+bool ReplayDataSource::unsubscribe(const std::vector<std::string>& instruments) {
+    for (const auto& instrument : instruments) {
+        for (auto it = instruments_.begin(); it != instruments_.end(); ++it) {
+            if (*it == instrument) {
+                instruments_.erase(it);
+                break;
+            }
+        }
+    }
+    return true;
+}
+
+void ReplayDataSource::wait_finished() const {
+    while (!finished()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+}
+
+void ReplayDataSource::run() {
+    int64_t start_ns = TscClock::now_ns();
+    int64_t offset_ns = 0;       // 已回放轮次的录制时长累计（循环回放时保持节奏连续）
+    for (size_t loop = 0; loop < loops_ && running_.load(std::memory_order_acquire); ++loop) {
+        if (records_.empty()) {
+            break;
+        }
+        int64_t first_ns = records_.front().recv_ns;
+        for (const auto& record : records_) {
+            if (!running_.load(std::memory_order_relaxed)) {
+                break;
+            }
+            if (speed_ > 0.0) {
+                // 按录制节奏：毫秒级以上的间隔休眠，剩余部分让出 CPU 等待
+                int64_t due_ns = start_ns + static_cast<int64_t>(
+                    static_cast<double>(offset_ns + record.recv_ns - first_ns) / speed_);
+                int64_t wait_ns = due_ns - TscClock::now_ns();
+                if (wait_ns > 2000000) {
+                    std::this_thread::sleep_for(std::chrono::nanoseconds(wait_ns - 1000000));
+                }
+                while (TscClock::now_ns() < due_ns) {
+                    std::this_thread::yield();
+                }
+            }
+            QT_TRACE_BEGIN(core::trace::TickStage::kDataSourceCallback);
+            if (callback_) {
+                callback_(record.tick);
+            }
+            QT_TRACE_END();
+            ticks_counter_.inc();
+            replayed_.fetch_add(1, std::memory_order_relaxed);
+        }
+        offset_ns += records_.back().recv_ns - first_ns;
+    }
+    elapsed_ns_.store(TscClock::now_ns() - start_ns, std::memory_order_relaxed);
+    running_.store(false, std::memory_order_release);
+    finished_.store(true, std::memory_order_release);
+}
+
+} // namespace replay
+} // namespace data_sources
+} // namespace plugins
+} // namespace quant
+
+// 插件导出函数
+extern "C" {
+
+std::shared_ptr<quant::plugins::data_sources::IDataSource> create_data_source() {
+    return std::make_shared<quant::plugins::data_sources::replay::ReplayDataSource>();
+}
+
+void destroy_data_source(std::shared_ptr<quant::plugins::data_sources::IDataSource> source) {
+    source.reset();
+}
+
+}
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <unordered_map>
+#include "../idata_source.h"
+#include "common/metrics/metrics.h"
+
+namespace quant {
+namespace plugins {
+namespace data_sources {
+namespace replay {
+
+// 录制文件中的一条原始行情：接收时刻（Unix 纳秒）+ 数据源原始报文
+struct CaptureRecord {
+    int64_t recv_ns = 0;
+    core::market_data::RawTickData tick;
+};
+
+// 录制文件格式：每行一条，"<recv_ns>\t<data_source>\t<raw_data>"，raw_data 中不含换行
+// 读取整个录制文件，格式错误的行跳过并计数
+bool load_capture(const std::string& path, std::vector<CaptureRecord>& records,
+                  size_t* skipped = nullptr, std::string* error = nullptr);
+
+// 行情录制：在真实数据源回调中调用 write()，生成可回放的录制文件（线程安全）
+class CaptureWriter {
+public:
+    CaptureWriter() = default;
+    ~CaptureWriter() { close(); }
+
+    CaptureWriter(const CaptureWriter&) = delete;
+    CaptureWriter& operator=(const CaptureWriter&) = delete;
+
+    bool open(const std::string& path);
+    void write(const core::market_data::RawTickData& tick, int64_t recv_ns);
+    void close();
+
+    uint64_t written() const { return written_; }
+
+private:
+    std::mutex mutex_;
+    std::ofstream out_;
+    uint64_t written_ = 0;
+};
+
+// 回放数据源：把录制文件中的原始行情按录制节奏（可加速）或尽可能快地推给行情回调，
+// 作为真实数据源的替身驱动完整的行情 -> 策略 -> 下单链路
+// 配置项：
+//   file    录制文件路径（必填）
+//   speed   回放速度倍数，默认 1（按录制节奏）；"max" 表示不等待、尽可能快
+//   loops   循环回放次数，默认 1
+//   name    数据源名称，默认 "REPLAY"
+// 推送条数导出为指标 data_source.<name>.ticks（监控端按差分计算行情速率）
+// connect() 启动回放线程，回调在回放线程上执行
+class ReplayDataSource : public IDataSource {
+public:
+    ReplayDataSource() = default;
+    ~ReplayDataSource() override;
+
+    bool initialize(const std::unordered_map<std::string, std::string>& config) override;
+    bool connect() override;
+    void disconnect() override;
+    bool subscribe(const std::vector<std::string>& instruments) override;
+    bool unsubscribe(const std::vector<std::string>& instruments) override;
+    std::string name() const override { return name_; }
+    std::vector<std::string> supported_instruments() const override { return instruments_; }
+    void set_tick_callback(TickCallback callback) override { callback_ = std::move(callback); }
+
+    // 回放进度
+    bool finished() const { return finished_.load(std::memory_order_acquire); }
+    uint64_t replayed() const { return replayed_.load(std::memory_order_relaxed); }
+    size_t record_count() const { return records_.size(); }
+
+    // 阻塞等待回放结束
+    void wait_finished() const;
+
+    // 实际回放耗时（纳秒，首条推送到最后一条推送）
+    int64_t elapsed_ns() const { return elapsed_ns_.load(std::memory_order_relaxed); }
+
+private:
+    void run();
+
+    std::string name_ = "REPLAY";
+    double speed_ = 1.0;                       // 0 表示尽可能快
+    size_t loops_ = 1;
+    std::vector<CaptureRecord> records_;
+    std::vector<std::string> instruments_;     // 已订阅合约（原始报文不解析，仅记录）
+    TickCallback callback_;
+    base::common::metrics::Counter ticks_counter_;
+
+    std::thread thread_;
+    std::atomic<bool> running_{false};
+    std::atomic<bool> finished_{false};
+    std::atomic<uint64_t> replayed_{0};
+    std::atomic<int64_t> elapsed_ns_{0};
+};
+
+} // namespace replay
+} // namespace data_sources
+} // namespace plugins
+} // namespace quant
+
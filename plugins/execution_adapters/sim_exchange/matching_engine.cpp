@@ -0,0 +1,181 @@
+#include "matching_engine.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace quant {
+namespace plugins {
+namespace execution_adapters {
+namespace sim_exchange {
+
+OrderBook::OrderBook(int64_t min_price, int64_t max_price, size_t max_orders)
+    : min_price_(min_price),
+      max_price_(max_price),
+      best_bid_(min_price),
+      best_ask_(max_price),
+      levels_(max_price >= min_price ? static_cast<size_t>(max_price - min_price + 1) : 0),
+      orders_(max_orders),
+      index_(max_orders) {
+    if (max_price < min_price) {
+        throw std::invalid_argument("OrderBook max_price must not be less than min_price");
+    }
+}
+
+SubmitStatus OrderBook::submit(uint64_t id, bool is_buy, int64_t price, int64_t volume,
+                               std::vector<SimFill>& fills, int64_t* remaining) {
+    if (price < min_price_ || price > max_price_) {
+        return SubmitStatus::kInvalidPrice;
+    }
+    if (volume <= 0) {
+        return SubmitStatus::kInvalidVolume;
+    }
+    if (index_.contains(id)) {
+        return SubmitStatus::kDuplicateId;
+    }
+
+    match(id, is_buy, price, volume, fills);
+    if (remaining != nullptr) {
+        *remaining = volume;
+    }
+    if (volume == 0) {
+        return SubmitStatus::kAccepted;
+    }
+
+    // 剩余数量挂单；池满时剩余部分视为被拒（已发生的成交保留）
+    Handle handle = orders_.acquire();
+    if (handle == Pool::kInvalidHandle) {
+        return SubmitStatus::kBookFull;
+    }
+    RestingOrder* order = orders_.get(handle);
+    order->id = id;
+    order->price = price;
+    order->remaining = volume;
+    order->is_buy = is_buy;
+    index_.insert(id, handle);
+    rest(handle);
+    return SubmitStatus::kAccepted;
+}
+
+bool OrderBook::cancel(uint64_t id, int64_t* remaining) {
+    Handle* found = index_.find(id);
+    if (found == nullptr) {
+        return false;
+    }
+    Handle handle = *found;
+    if (remaining != nullptr) {
+        *remaining = orders_.get(handle)->remaining;
+    }
+    unlink(handle);
+    index_.erase(id);
+    orders_.release(handle);
+    return true;
+}
+
+int64_t OrderBook::depth(int64_t price) const {
+    if (price < min_price_ || price > max_price_) {
+        return 0;
+    }
+    return levels_[static_cast<size_t>(price - min_price_)].volume;
+}
+
+void OrderBook::match(uint64_t id, bool is_buy, int64_t price, int64_t& volume, std::vector<SimFill>& fills) {
+    // 买单吃卖方（从最低卖价向上），卖单吃买方（从最高买价向下），同价位按挂单先后成交
+    while (volume > 0) {
+        size_t& opposite_count = is_buy ? ask_count_ : bid_count_;
+        if (opposite_count == 0) {
+            return;
+        }
+        int64_t best = is_buy ? best_ask_ : best_bid_;
+        if (is_buy ? best > price : best < price) {
+            return;
+        }
+
+        Level& target = level(best);
+        while (volume > 0 && target.head != 0) {
+            Handle maker_handle = target.head;
+            RestingOrder* maker = orders_.get(maker_handle);
+            int64_t traded = std::min(volume, maker->remaining);
+            volume -= traded;
+            maker->remaining -= traded;
+            target.volume -= traded;
+
+            SimFill fill;
+            fill.taker_id = id;
+            fill.maker_id = maker->id;
+            fill.price = best;
+            fill.volume = traded;
+            fill.taker_remaining = volume;
+            fill.maker_remaining = maker->remaining;
+            fills.push_back(fill);
+
+            if (maker->remaining == 0) {
+                index_.erase(maker->id);
+                unlink(maker_handle);
+                orders_.release(maker_handle);
+            }
+        }
+    }
+}
+
+void OrderBook::rest(Handle handle) {
+    RestingOrder* order = orders_.get(handle);
+    Level& target = level(order->price);
+    order->prev = target.tail;
+    order->next = 0;
+    if (target.tail != 0) {
+        orders_.get(target.tail)->next = handle;
+    } else {
+        target.head = handle;
+    }
+    target.tail = handle;
+    target.volume += order->remaining;
+
+    if (order->is_buy) {
+        best_bid_ = bid_count_++ == 0 ? order->price : std::max(best_bid_, order->price);
+    } else {
+        best_ask_ = ask_count_++ == 0 ? order->price : std::min(best_ask_, order->price);
+    }
+}
+
+void OrderBook::unlink(Handle handle) {
+    RestingOrder* order = orders_.get(handle);
+    Level& target = level(order->price);
+    if (order->prev != 0) {
+        orders_.get(order->prev)->next = order->next;
+    } else {
+        target.head = order->next;
+    }
+    if (order->next != 0) {
+        orders_.get(order->next)->prev = order->prev;
+    } else {
+        target.tail = order->prev;
+    }
+    target.volume -= order->remaining;
+
+    if (order->is_buy) {
+        --bid_count_;
+    } else {
+        --ask_count_;
+    }
+    // 最优价位被清空时移动到下一个非空价位
+    if (target.head == 0 && order->price == (order->is_buy ? best_bid_ : best_ask_)) {
+        advance_best(order->is_buy);
+    }
+}
+
+void OrderBook::advance_best(bool bid_side) {
+    if (bid_side) {
+        while (bid_count_ > 0 && level(best_bid_).head == 0) {
+            --best_bid_;
+        }
+    } else {
+        while (ask_count_ > 0 && level(best_ask_).head == 0) {
+            ++best_ask_;
+        }
+    }
+}
+
+} // namespace sim_exchange
+} // namespace execution_adapters
+} // namespace plugins
+} // namespace quant
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include "common/object_pool/object_pool.h"
+#include "common/flat_hash_map/flat_hash_map.h"
+
+namespace quant {
+namespace plugins {
+namespace execution_adapters {
+namespace sim_exchange {
+
+// 报单结果
+enum class SubmitStatus : uint8_t {
+    kAccepted,          // 已受理（可能已全部/部分成交，剩余部分挂单）
+    kInvalidPrice,      // 价格超出价格阶梯范围
+    kInvalidVolume,     // 数量 <= 0
+    kDuplicateId,       // 订单号重复
+    kBookFull,          // 挂单数达到上限
+};
+
+// 一次撮合产生的成交（价格为跳数，取挂单方价格）
+struct SimFill {
+    uint64_t taker_id = 0;
+    uint64_t maker_id = 0;
+    int64_t price = 0;
+    int64_t volume = 0;
+    int64_t taker_remaining = 0;      // 成交后主动方剩余数量
+    int64_t maker_remaining = 0;      // 成交后被动方剩余数量
+};
+
+// 挂单（对象池元素）
+struct RestingOrder {
+    uint64_t id = 0;
+    int64_t price = 0;
+    int64_t remaining = 0;
+    bool is_buy = true;
+    uint64_t prev = 0;            // 同价位前一笔挂单句柄
+    uint64_t next = 0;            // 同价位后一笔挂单句柄
+};
+
+// 单合约价格优先、时间优先的限价订单簿
+// - 价格以跳数表示，在 [min_price, max_price] 范围内用稠密数组作价格阶梯，定位价位为 O(1)
+// - 每个价位是挂单的侵入式双向链表（FIFO），挂单存放在预分配的对象池中，撤单 O(1)
+// - 订单号经开放寻址表映射到挂单句柄
+// 运行期不分配内存（成交输出缓冲区由调用方复用）；非线程安全，由撮合线程独占
+class OrderBook {
+public:
+    static constexpr int64_t kNoPrice = INT64_MIN;
+
+    OrderBook(int64_t min_price, int64_t max_price, size_t max_orders);
+
+    OrderBook(const OrderBook&) = delete;
+    OrderBook& operator=(const OrderBook&) = delete;
+
+    // 限价单：先与对手方撮合（成交追加到 fills），剩余数量按时间顺序挂在本方价位
+    // remaining 非空时输出挂单剩余数量（0 表示已全部成交）
+    SubmitStatus submit(uint64_t id, bool is_buy, int64_t price, int64_t volume,
+                        std::vector<SimFill>& fills, int64_t* remaining = nullptr);
+
+    // 撤单：挂单不存在（已成交/已撤）返回 false；remaining 输出被撤销的数量
+    bool cancel(uint64_t id, int64_t* remaining = nullptr);
+
+    // 最优价（跳数），无挂单返回 kNoPrice
+    int64_t best_bid() const { return bid_count_ > 0 ? best_bid_ : kNoPrice; }
+    int64_t best_ask() const { return ask_count_ > 0 ? best_ask_ : kNoPrice; }
+
+    // 价位上的挂单总量
+    int64_t depth(int64_t price) const;
+
+    size_t order_count() const { return orders_.size(); }
+    int64_t min_price() const { return min_price_; }
+    int64_t max_price() const { return max_price_; }
+
+private:
+    using Pool = base::common::object_pool::ObjectPool<RestingOrder>;
+    using Handle = Pool::Handle;
+
+    struct Level {
+        Handle head = 0;
+        Handle tail = 0;
+        int64_t volume = 0;
+    };
+
+    Level& level(int64_t price) { return levels_[static_cast<size_t>(price - min_price_)]; }
+
+    void match(uint64_t id, bool is_buy, int64_t price, int64_t& volume, std::vector<SimFill>& fills);
+    void rest(Handle handle);
+    void unlink(Handle handle);
+    void advance_best(bool bid_side);
+
+    int64_t min_price_;
+    int64_t max_price_;
+    int64_t best_bid_;
+    int64_t best_ask_;
+    size_t bid_count_ = 0;
+    size_t ask_count_ = 0;
+    std::vector<Level> levels_;
+    Pool orders_;
+    base::common::flat_hash_map::FlatHashMap<uint64_t, Handle> index_;
+};
+
+} // namespace sim_exchange
+} // namespace execution_adapters
+} // namespace plugins
+} // namespace quant
@@ -0,0 +1,581 @@
+#include "sim_exchange_adapter.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <algorithm>
+
+namespace quant {
+namespace plugins {
+namespace execution_adapters {
+namespace sim_exchange {
+
+using core::ems::ExecutionResult;
+using core::ems::OrderCompletion;
+using core::ems::OrderRequest;
+using core::ems::OrderRequestType;
+
+namespace {
+
+// 距离到期不足该时长时不再进入条件变量等待（其唤醒误差为数十微秒，会扭曲注入的延迟）
+constexpr int64_t kSpinWaitNs = 50000;
+
+int64_t now_ns() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+const std::string* find_config(const std::unordered_map<std::string, std::string>& config, const std::string& key) {
+    auto it = config.find(key);
+    return it == config.end() ? nullptr : &it->second;
+}
+
+// 读取正整数配置，缺省或格式错误时返回默认值
+size_t config_size(const std::unordered_map<std::string, std::string>& config, const std::string& key,
+                   size_t default_value) {
+    const std::string* text = find_config(config, key);
+    if (text == nullptr) {
+        return default_value;
+    }
+    char* end = nullptr;
+    unsigned long long value = std::strtoull(text->c_str(), &end, 10);
+    return (text->empty() || *end != '\0' || value == 0) ? default_value : static_cast<size_t>(value);
+}
+
+bool parse_double(const std::string& text, double& value) {
+    char* end = nullptr;
+    value = std::strtod(text.c_str(), &end);
+    return !text.empty() && *end == '\0';
+}
+
+} // namespace
+
+// ==================== LatencyModel ====================
+
+bool LatencyModel::parse(const std::string& spec, LatencyModel& model) {
+    model = LatencyModel();
+    if (spec.empty() || spec == "none") {
+        return true;
+    }
+    size_t colon = spec.find(':');
+    if (colon == std::string::npos) {
+        return false;
+    }
+    std::string kind = spec.substr(0, colon);
+    std::string args = spec.substr(colon + 1);
+    size_t comma = args.find(',');
+    std::string first = args.substr(0, comma);
+    std::string second = comma == std::string::npos ? "" : args.substr(comma + 1);
+
+    if (kind == "fixed") {
+        model.kind_ = Kind::kFixed;
+        return parse_double(first, model.a_) && model.a_ >= 0.0;
+    }
+    if (kind == "uniform") {
+        model.kind_ = Kind::kUniform;
+        return parse_double(first, model.a_) && parse_double(second, model.b_) &&
+               model.a_ >= 0.0 && model.b_ >= model.a_;
+    }
+    if (kind == "lognormal") {
+        model.kind_ = Kind::kLogNormal;
+        return parse_double(first, model.a_) && parse_double(second, model.b_) &&
+               model.a_ > 0.0 && model.b_ >= 0.0;
+    }
+    return false;
+}
+
+int64_t LatencyModel::sample(std::mt19937_64& rng) const {
+    double us = 0.0;
+    switch (kind_) {
+    case Kind::kNone:
+        return 0;
+    case Kind::kFixed:
+        us = a_;
+        break;
+    case Kind::kUniform:
+        us = std::uniform_real_distribution<double>(a_, b_)(rng);
+        break;
+    case Kind::kLogNormal:
+        us = std::lognormal_distribution<double>(std::log(a_), b_)(rng);
+        break;
+    }
+    return static_cast<int64_t>(us * 1000.0);
+}
+
+// ==================== SimExchangeAdapter ====================
+
+SimExchangeAdapter::SimExchangeAdapter(const std::unordered_map<std::string, std::string>& config)
+    : max_orders_(config_size(config, "max_orders", 1 << 16)),
+      inbound_(config_size(config, "queue_capacity", 1 << 16)),
+      completed_(config_size(config, "queue_capacity", 1 << 16)),
+      next_exchange_id_(1),
+      running_(false),
+      requests_(0),
+      rejects_(0),
+      fills_(0),
+      resting_(0),
+      order_book_(max_orders_) {
+    double value = 0.0;
+    if (const std::string* text = find_config(config, "tick_size")) {
+        valid_ &= parse_double(*text, tick_size_) && tick_size_ > 0.0;
+    }
+    if (const std::string* text = find_config(config, "min_price")) {
+        valid_ &= parse_double(*text, value);
+        min_price_ = std::llround(value / tick_size_);
+    }
+    if (const std::string* text = find_config(config, "max_price")) {
+        valid_ &= parse_double(*text, value);
+        max_price_ = std::llround(value / tick_size_);
+    } else {
+        max_price_ = std::llround(100000.0 / tick_size_);
+    }
+    if (const std::string* text = find_config(config, "inbound_latency")) {
+        valid_ &= LatencyModel::parse(*text, inbound_latency_);
+    }
+    if (const std::string* text = find_config(config, "outbound_latency")) {
+        valid_ &= LatencyModel::parse(*text, outbound_latency_);
+    }
+    rng_.seed(config_size(config, "seed", 42));
+    valid_ &= max_price_ >= min_price_;
+    fills_buffer_.reserve(64);
+}
+
+SimExchangeAdapter::~SimExchangeAdapter() {
+    disconnect();
+}
+
+bool SimExchangeAdapter::connect() {
+    if (!valid_) {
+        std::cerr << "[SimExchangeAdapter] Invalid configuration" << std::endl;
+        return false;
+    }
+    if (!running_.exchange(true, std::memory_order_acq_rel)) {
+        matcher_ = std::thread(&SimExchangeAdapter::run, this);
+    }
+    return true;
+}
+
+void SimExchangeAdapter::disconnect() {
+    if (running_.exchange(false, std::memory_order_acq_rel) && matcher_.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(wakeup_mutex_);
+            wakeup_.notify_all();
+        }
+        {
+            std::lock_guard<std::mutex> lock(completion_mutex_);
+            completion_space_.notify_all();
+        }
+        matcher_.join();
+    }
+}
+
+ExecutionResult SimExchangeAdapter::send_order(const core::oms::Order& order) {
+    Request request;
+    request.type = RequestType::kSend;
+    request.exchange_id = next_exchange_id_.fetch_add(1, std::memory_order_relaxed);
+    request.order = order;
+    ExecutionResult result;
+    result.order_id = format_exchange_id(request.exchange_id);
+    result.success = enqueue(std::move(request));
+    if (!result.success) {
+        result.message = "Simulated exchange inbound queue is full";
+    }
+    return result;
+}
+
+ExecutionResult SimExchangeAdapter::cancel_order(const std::string& order_id) {
+    Request request;
+    request.type = RequestType::kCancel;
+    request.exchange_id = parse_exchange_id(order_id);
+    ExecutionResult result;
+    result.order_id = order_id;
+    result.success = request.exchange_id != 0 && enqueue(std::move(request));
+    if (!result.success) {
+        result.message = "Failed to submit cancel for " + order_id;
+    }
+    return result;
+}
+
+ExecutionResult SimExchangeAdapter::modify_order(const core::oms::Order& order) {
+    Request request;
+    request.type = RequestType::kModify;
+    request.exchange_id = parse_exchange_id(order.order_id);
+    request.order = order;
+    ExecutionResult result;
+    result.order_id = order.order_id;
+    result.success = request.exchange_id != 0 && enqueue(std::move(request));
+    if (!result.success) {
+        result.message = "Failed to submit modify for " + order.order_id;
+    }
+    return result;
+}
+
+std::vector<core::oms::Order> SimExchangeAdapter::query_orders(const std::string& instrument) {
+    (void)instrument;
+    return {};   // 模拟交易所不保留历史，订单状态以回调为准
+}
+
+std::vector<core::oms::Trade> SimExchangeAdapter::query_trades(const std::string& instrument) {
+    (void)instrument;
+    return {};
+}
+
+size_t SimExchangeAdapter::send_orders(const OrderRequest* requests, size_t count) {
+    size_t accepted = 0;
+    for (; accepted < count; ++accepted) {
+        Request request;
+        request.type = RequestType::kSend;
+        request.has_request_id = true;
+        request.request_id = requests[accepted].request_id;
+        request.exchange_id = next_exchange_id_.fetch_add(1, std::memory_order_relaxed);
+        request.order = *requests[accepted].order;
+        uint64_t exchange_id = request.exchange_id;
+        if (!enqueue(std::move(request))) {
+            break;
+        }
+        unacked_sends_[requests[accepted].request_id] = exchange_id;
+    }
+    return accepted;
+}
+
+bool SimExchangeAdapter::submit_cancel(uint64_t request_id, const std::string& order_id) {
+    Request request;
+    request.type = RequestType::kCancel;
+    request.has_request_id = true;
+    request.request_id = request_id;
+    request.exchange_id = parse_exchange_id(order_id);
+    if (request.exchange_id == 0) {
+        // 调用方订单号：撤销以同一 request_id 提交、完成通知尚未取回的报单
+        auto it = unacked_sends_.find(request_id);
+        if (it == unacked_sends_.end()) {
+            return false;
+        }
+        request.exchange_id = it->second;
+    }
+    return enqueue(std::move(request));
+}
+
+bool SimExchangeAdapter::submit_modify(uint64_t request_id, const core::oms::Order& order) {
+    Request request;
+    request.type = RequestType::kModify;
+    request.has_request_id = true;
+    request.request_id = request_id;
+    request.exchange_id = parse_exchange_id(order.order_id);
+    request.order = order;
+    return request.exchange_id != 0 && enqueue(std::move(request));
+}
+
+size_t SimExchangeAdapter::poll_completions(OrderCompletion* out, size_t max) {
+    size_t n = 0;
+    while (n < max && completed_.pop(out[n])) {
+        if (out[n].type == OrderRequestType::kSend) {
+            unacked_sends_.erase(out[n].request_id);
+        }
+        ++n;
+    }
+    if (n > 0) {
+        // 与 dispatch() 中"登记等待 -> 栅栏 -> 重试入环"配对，避免漏掉唤醒
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (completion_waiting_.load(std::memory_order_relaxed)) {
+            std::lock_guard<std::mutex> lock(completion_mutex_);
+            completion_space_.notify_one();
+        }
+    }
+    return n;
+}
+
+SimExchangeStats SimExchangeAdapter::stats() const {
+    SimExchangeStats stats;
+    stats.requests = requests_.load(std::memory_order_relaxed);
+    stats.rejects = rejects_.load(std::memory_order_relaxed);
+    stats.fills = fills_.load(std::memory_order_relaxed);
+    stats.resting_orders = resting_.load(std::memory_order_relaxed);
+    return stats;
+}
+
+bool SimExchangeAdapter::enqueue(Request&& request) {
+    request.enqueue_ns = inbound_latency_.kind() == LatencyModel::Kind::kNone ? 0 : now_ns();
+    if (!inbound_.push(std::move(request))) {
+        return false;
+    }
+    // 与 wait_for_work() 中"置 idle -> 栅栏 -> 复查入站环"配对：要么撮合线程复查时看到新请求，要么这里看到 idle
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (idle_.load(std::memory_order_relaxed)) {
+        std::lock_guard<std::mutex> lock(wakeup_mutex_);
+        wakeup_.notify_one();
+    }
+    return true;
+}
+
+void SimExchangeAdapter::run() {
+    Request pending;
+    bool has_pending = false;
+    while (running_.load(std::memory_order_acquire)) {
+        bool progressed = false;
+        int64_t now = now_ns();
+
+        // 入站：按到达顺序处理，队首请求未到期时等待（保持先进先出）
+        if (!has_pending && inbound_.pop(pending)) {
+            int64_t due = pending.enqueue_ns + inbound_latency_.sample(rng_);
+            pending.enqueue_ns = std::max(due, last_inbound_due_);
+            last_inbound_due_ = pending.enqueue_ns;
+            has_pending = true;
+        }
+        if (has_pending && pending.enqueue_ns <= now) {
+            process(pending, now);
+            has_pending = false;
+            progressed = true;
+        }
+
+        // 出站：到期的回调与完成通知
+        while (!outbound_.empty() && outbound_.front().due_ns <= now) {
+            dispatch(outbound_.front());
+            outbound_.pop_front();
+            progressed = true;
+        }
+
+        if (!progressed) {
+            int64_t next_due = has_pending ? pending.enqueue_ns : INT64_MAX;
+            if (!outbound_.empty()) {
+                next_due = std::min(next_due, outbound_.front().due_ns);
+            }
+            wait_for_work(next_due, !has_pending);
+        }
+    }
+}
+
+void SimExchangeAdapter::wait_for_work(int64_t next_due, bool wake_on_request) {
+    int64_t wait_ns = next_due == INT64_MAX ? INT64_MAX : next_due - now_ns();
+    if (wait_ns <= kSpinWaitNs) {
+        std::this_thread::yield();
+        return;
+    }
+    // 阻塞到最近的到期时刻（提前 kSpinWaitNs 醒来）、新请求入队（队首请求未到期时新请求不影响处理顺序）
+    // 或 disconnect()
+    std::unique_lock<std::mutex> lock(wakeup_mutex_);
+    idle_.store(wake_on_request, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    auto ready = [this, wake_on_request]() {
+        return !running_.load(std::memory_order_acquire) || (wake_on_request && !inbound_.empty());
+    };
+    if (wait_ns == INT64_MAX) {
+        wakeup_.wait(lock, ready);
+    } else {
+        wakeup_.wait_for(lock, std::chrono::nanoseconds(wait_ns - kSpinWaitNs), ready);
+    }
+    idle_.store(false, std::memory_order_relaxed);
+}
+
+void SimExchangeAdapter::process(Request& request, int64_t now) {
+    requests_.fetch_add(1, std::memory_order_relaxed);
+    int64_t due = outbound_latency_.kind() == LatencyModel::Kind::kNone ? 0 : now + outbound_latency_.sample(rng_);
+    due = std::max(due, last_outbound_due_);
+    last_outbound_due_ = due;
+
+    ExecutionResult result;
+    result.order_id = format_exchange_id(request.exchange_id);
+    switch (request.type) {
+    case RequestType::kSend:
+        handle_send(request, result, due);
+        break;
+    case RequestType::kCancel:
+        handle_cancel(request, result, due);
+        break;
+    case RequestType::kModify:
+        // 改单 = 撤销剩余数量 + 以新价格/数量重新挂单（失去时间优先级）
+        handle_cancel(request, result, due);
+        if (result.success) {
+            handle_send(request, result, due);
+        }
+        break;
+    }
+
+    if (!result.success) {
+        rejects_.fetch_add(1, std::memory_order_relaxed);
+    }
+    if (request.has_request_id) {
+        Outbound event;
+        event.kind = Outbound::Kind::kCompletion;
+        event.completion.request_id = request.request_id;
+        event.completion.type = request.type == RequestType::kSend ? OrderRequestType::kSend
+                              : request.type == RequestType::kCancel ? OrderRequestType::kCancel
+                                                                      : OrderRequestType::kModify;
+        event.completion.result = std::move(result);
+        emit(std::move(event), due);
+    }
+}
+
+void SimExchangeAdapter::handle_send(Request& request, ExecutionResult& result, int64_t due) {
+    Book* book = book_for(request.order.instrument);
+    int64_t price = std::llround(request.order.price / tick_size_);
+    int64_t remaining = 0;
+    fills_buffer_.clear();
+    SubmitStatus status = book == nullptr
+        ? SubmitStatus::kBookFull
+        : book->book->submit(request.exchange_id, request.order.is_buy, price,
+                             request.order.volume, fills_buffer_, &remaining);
+    if (status != SubmitStatus::kAccepted) {
+        result.success = false;
+        result.message = status == SubmitStatus::kInvalidPrice ? "price out of range"
+                       : status == SubmitStatus::kInvalidVolume ? "invalid volume"
+                       : status == SubmitStatus::kDuplicateId ? "duplicate order id"
+                                                              : "order book full";
+        if (status == SubmitStatus::kBookFull && !fills_buffer_.empty()) {
+            result.message += " (partially filled before rejection)";
+        }
+    } else {
+        result.success = true;
+    }
+
+    // 成交先于确认：主动方与被动方各一条成交回报，被全部成交的挂单随后回调终态
+    for (const SimFill& fill : fills_buffer_) {
+        fills_.fetch_add(1, std::memory_order_relaxed);
+        ++trade_sequence_;
+        for (uint64_t side_id : {fill.taker_id, fill.maker_id}) {
+            Outbound trade;
+            trade.kind = Outbound::Kind::kTrade;
+            trade.trade.trade_id = "T" + std::to_string(trade_sequence_);
+            trade.trade.order_id = format_exchange_id(side_id);
+            trade.trade.instrument = book->instrument;
+            trade.trade.price = static_cast<double>(fill.price) * tick_size_;
+            trade.trade.volume = static_cast<int>(fill.volume);
+            emit(std::move(trade), due);
+        }
+        if (fill.maker_remaining == 0) {
+            order_book_.erase(fill.maker_id);
+            resting_.fetch_sub(1, std::memory_order_relaxed);
+            Outbound closed;
+            closed.kind = Outbound::Kind::kOrder;
+            closed.order.order_id = format_exchange_id(fill.maker_id);
+            closed.order.instrument = book->instrument;
+            closed.order.price = static_cast<double>(fill.price) * tick_size_;
+            closed.order.is_buy = !request.order.is_buy;
+            closed.order.volume = 0;
+            emit(std::move(closed), due);
+        }
+    }
+
+    // 确认：剩余数量为 0 表示已全部成交，拒单为 kRejectedVolume（拒绝前的部分成交已在上面回调）
+    Outbound ack;
+    ack.kind = Outbound::Kind::kOrder;
+    ack.order = request.order;
+    ack.order.order_id = result.order_id;
+    ack.order.volume = status == SubmitStatus::kAccepted ? static_cast<int>(remaining) : kRejectedVolume;
+    emit(std::move(ack), due);
+
+    if (status == SubmitStatus::kAccepted && remaining > 0) {
+        order_book_.insert(request.exchange_id, static_cast<uint32_t>(book - books_.data()));
+        resting_.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void SimExchangeAdapter::handle_cancel(Request& request, ExecutionResult& result, int64_t due) {
+    const uint32_t* index = order_book_.find(request.exchange_id);
+    int64_t remaining = 0;
+    if (index == nullptr || !books_[*index].book->cancel(request.exchange_id, &remaining)) {
+        result.success = false;
+        result.message = "order not found or already closed";
+        return;
+    }
+    Book& book = books_[*index];
+    order_book_.erase(request.exchange_id);
+    resting_.fetch_sub(1, std::memory_order_relaxed);
+    result.success = true;
+
+    Outbound ack;
+    ack.kind = Outbound::Kind::kOrder;
+    ack.order.order_id = result.order_id;
+    ack.order.instrument = book.instrument;
+    ack.order.volume = 0;
+    emit(std::move(ack), due);
+    (void)remaining;
+}
+
+SimExchangeAdapter::Book* SimExchangeAdapter::book_for(const std::string& instrument) {
+    auto it = book_index_.find(instrument);
+    if (it != book_index_.end()) {
+        return &books_[it->second];
+    }
+    try {
+        Book book;
+        book.instrument = instrument;
+        book.book = std::make_unique<OrderBook>(min_price_, max_price_, max_orders_);
+        books_.push_back(std::move(book));
+    } catch (const std::exception& e) {
+        std::cerr << "[SimExchangeAdapter] Failed to create order book for " << instrument
+                  << ": " << e.what() << std::endl;
+        return nullptr;
+    }
+    book_index_[instrument] = books_.size() - 1;
+    return &books_.back();
+}
+
+void SimExchangeAdapter::emit(Outbound&& event, int64_t due) {
+    // 无出站延迟且没有更早的积压事件时直接回调
+    if (due == 0 && outbound_.empty()) {
+        dispatch(event);
+        return;
+    }
+    event.due_ns = due;
+    outbound_.push_back(std::move(event));
+}
+
+void SimExchangeAdapter::dispatch(Outbound& event) {
+    switch (event.kind) {
+    case Outbound::Kind::kOrder:
+        if (order_callback_) {
+            order_callback_(event.order);
+        }
+        break;
+    case Outbound::Kind::kTrade:
+        if (trade_callback_) {
+            trade_callback_(event.trade);
+        }
+        break;
+    case Outbound::Kind::kCompletion: {
+        if (completed_.push(std::move(event.completion))) {
+            break;
+        }
+        // 完成环满时阻塞到调用方经 poll_completions 取走通知，不丢弃完成通知（已断开时放弃）
+        std::unique_lock<std::mutex> lock(completion_mutex_);
+        completion_waiting_.store(true, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        while (!completed_.push(std::move(event.completion)) && running_.load(std::memory_order_acquire)) {
+            completion_space_.wait(lock);
+        }
+        completion_waiting_.store(false, std::memory_order_relaxed);
+        break;
+    }
+    }
+}
+
+uint64_t SimExchangeAdapter::parse_exchange_id(const std::string& order_id) {
+    if (order_id.size() <= 3 || order_id.compare(0, 3, "SIM") != 0) {
+        return 0;
+    }
+    return std::strtoull(order_id.c_str() + 3, nullptr, 10);
+}
+
+std::string SimExchangeAdapter::format_exchange_id(uint64_t exchange_id) {
+    return "SIM" + std::to_string(exchange_id);
+}
+
+} // namespace sim_exchange
+} // namespace execution_adapters
+} // namespace plugins
+} // namespace quant
+
+// 插件入口
+extern "C" {
+
+std::shared_ptr<quant::core::ems::IExecutionAdapter> create_execution_adapter(
+    const std::unordered_map<std::string, std::string>& config) {
+    return std::make_shared<quant::plugins::execution_adapters::sim_exchange::SimExchangeAdapter>(config);
+}
+
+void destroy_execution_adapter(std::shared_ptr<quant::core::ems::IExecutionAdapter> adapter) {
+    adapter.reset();
+}
+
+}
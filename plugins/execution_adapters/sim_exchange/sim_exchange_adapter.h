@@ -0,0 +1,191 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include <cstdint>
+#include <unordered_map>
+#include "../../../core/ems/execution_adapter.h"
+#include "common/ring_queue/ring_queue.h"
+#include "common/flat_hash_map/flat_hash_map.h"
+#include "matching_engine.h"
+
+namespace quant {
+namespace plugins {
+namespace execution_adapters {
+namespace sim_exchange {
+
+// 注入延迟分布（单位：微秒），配置格式：
+//   "none" | "fixed:<us>" | "uniform:<min_us>,<max_us>" | "lognormal:<median_us>,<sigma>"
+class LatencyModel {
+public:
+    enum class Kind : uint8_t { kNone, kFixed, kUniform, kLogNormal };
+
+    LatencyModel() = default;
+
+    // 解析配置，格式错误返回 false
+    static bool parse(const std::string& spec, LatencyModel& model);
+
+    // 采样一次延迟（纳秒）
+    int64_t sample(std::mt19937_64& rng) const;
+
+    Kind kind() const { return kind_; }
+
+private:
+    Kind kind_ = Kind::kNone;
+    double a_ = 0.0;
+    double b_ = 0.0;
+};
+
+// 模拟交易所运行指标
+struct SimExchangeStats {
+    uint64_t requests = 0;            // 已处理的请求数（报单/撤单/改单）
+    uint64_t rejects = 0;             // 被拒绝的请求数
+    uint64_t fills = 0;               // 撮合次数
+    size_t resting_orders = 0;        // 当前挂单数
+};
+
+// 本地模拟交易所适配器
+// - 进程内按合约维护价格优先、时间优先的订单簿，支持部分成交
+// - 请求经入站延迟后由撮合线程处理；确认、成交与完成通知经出站延迟后回调
+//   （同一连接上保持先进先出，随机延迟不会造成乱序）
+// - 回调在撮合线程上执行：OrderCallback 的 volume 为剩余未成交数量，0 表示订单已结束（全部成交或
+//   撤单确认），kRejectedVolume 表示拒单；order_id 为模拟交易所分配的编号（"SIM" + 序号）
+// - 一次撮合先回调成交（主动方与被动方各一条），再回调被全部成交的挂单的终态（volume 为 0），
+//   最后回调主动方的确认，确认到达时其成交已全部送达
+// - 撮合线程空闲时阻塞等待新请求或最近的到期时刻，完成环满时阻塞到 poll_completions 取走通知
+// - 原生支持异步批量接口，可直接作为回测成交模型和本地压测的交易所替身
+// 配置项：tick_size、min_price、max_price、max_orders（每个合约的挂单上限）、
+//         queue_capacity、inbound_latency、outbound_latency、seed
+class SimExchangeAdapter : public core::ems::IAsyncExecutionAdapter {
+public:
+    // 拒单回报的 volume（Order 没有状态字段，以保留值与全部成交的 0 区分）
+    static constexpr int kRejectedVolume = -1;
+
+    explicit SimExchangeAdapter(const std::unordered_map<std::string, std::string>& config);
+    ~SimExchangeAdapter() override;
+
+    SimExchangeAdapter(const SimExchangeAdapter&) = delete;
+    SimExchangeAdapter& operator=(const SimExchangeAdapter&) = delete;
+
+    bool connect() override;
+    void disconnect() override;
+
+    // 同步接口：请求入队后立即返回已分配的交易所订单号，处理结果经回调通知
+    core::ems::ExecutionResult send_order(const core::oms::Order& order) override;
+    core::ems::ExecutionResult cancel_order(const std::string& order_id) override;
+    core::ems::ExecutionResult modify_order(const core::oms::Order& order) override;
+    std::vector<core::oms::Order> query_orders(const std::string& instrument = "") override;
+    std::vector<core::oms::Trade> query_trades(const std::string& instrument = "") override;
+
+    std::string id() const override { return "SIM"; }
+    std::vector<std::string> supported_instruments() const override { return {}; }
+    void set_order_callback(OrderCallback callback) override { order_callback_ = std::move(callback); }
+    void set_trade_callback(TradeCallback callback) override { trade_callback_ = std::move(callback); }
+
+    // 异步接口：完成通知在撮合线程处理请求后（加出站延迟）进入完成环。
+    // 与 send_orders/poll_completions 在同一调用方线程上使用：submit_cancel 的 order_id 不是 "SIM..."
+    // 编号时，按 request_id 撤销同一请求号提交、完成通知尚未取回的报单（此时调用方还不知道交易所订单号）
+    size_t send_orders(const core::ems::OrderRequest* requests, size_t count) override;
+    bool submit_cancel(uint64_t request_id, const std::string& order_id) override;
+    bool submit_modify(uint64_t request_id, const core::oms::Order& order) override;
+    size_t poll_completions(core::ems::OrderCompletion* out, size_t max) override;
+
+    SimExchangeStats stats() const;
+
+    // 配置是否有效（构造时解析失败则 connect 返回 false）
+    bool valid() const { return valid_; }
+
+private:
+    enum class RequestType : uint8_t { kSend, kCancel, kModify };
+
+    struct Request {
+        RequestType type = RequestType::kSend;
+        bool has_request_id = false;          // 异步请求：需要完成通知
+        uint64_t request_id = 0;
+        uint64_t exchange_id = 0;
+        int64_t enqueue_ns = 0;
+        core::oms::Order order;
+    };
+
+    struct Outbound {
+        enum class Kind : uint8_t { kOrder, kTrade, kCompletion } kind = Kind::kOrder;
+        int64_t due_ns = 0;
+        core::oms::Order order;
+        core::oms::Trade trade;
+        core::ems::OrderCompletion completion;
+    };
+
+    struct Book {
+        std::string instrument;
+        std::unique_ptr<OrderBook> book;
+    };
+
+    bool enqueue(Request&& request);
+    void run();
+    void wait_for_work(int64_t next_due, bool wake_on_request);
+    void process(Request& request, int64_t now);
+    void handle_send(Request& request, core::ems::ExecutionResult& result, int64_t due);
+    void handle_cancel(Request& request, core::ems::ExecutionResult& result, int64_t due);
+    Book* book_for(const std::string& instrument);
+    void emit(Outbound&& event, int64_t due);
+    void dispatch(Outbound& event);
+    static uint64_t parse_exchange_id(const std::string& order_id);
+    static std::string format_exchange_id(uint64_t exchange_id);
+
+    // 配置
+    bool valid_ = true;
+    double tick_size_ = 0.01;
+    int64_t min_price_ = 0;
+    int64_t max_price_ = 10000000;
+    size_t max_orders_ = 1 << 16;
+    LatencyModel inbound_latency_;
+    LatencyModel outbound_latency_;
+
+    // 跨线程
+    base::common::ring_queue::RingQueue<Request> inbound_;
+    base::common::ring_queue::RingQueue<core::ems::OrderCompletion> completed_;
+    std::atomic<uint64_t> next_exchange_id_;
+    std::atomic<bool> running_;
+    std::thread matcher_;
+    OrderCallback order_callback_;
+    TradeCallback trade_callback_;
+    std::atomic<uint64_t> requests_;
+    std::atomic<uint64_t> rejects_;
+    std::atomic<uint64_t> fills_;
+    std::atomic<size_t> resting_;
+
+    // 撮合线程空闲时在此等待新请求（只在 idle_ 时由 enqueue 唤醒）
+    std::mutex wakeup_mutex_;
+    std::condition_variable wakeup_;
+    std::atomic<bool> idle_{false};
+    // 完成环满时撮合线程在此等待 poll_completions 腾出空间
+    std::mutex completion_mutex_;
+    std::condition_variable completion_space_;
+    std::atomic<bool> completion_waiting_{false};
+
+    // 以下仅由撮合线程访问
+    std::mt19937_64 rng_;
+    int64_t last_inbound_due_ = 0;
+    int64_t last_outbound_due_ = 0;
+    std::deque<Outbound> outbound_;
+    std::vector<Book> books_;
+    std::unordered_map<std::string, size_t> book_index_;
+    base::common::flat_hash_map::FlatHashMap<uint64_t, uint32_t> order_book_;   // 挂单编号 -> 订单簿下标
+    std::vector<SimFill> fills_buffer_;
+    uint64_t trade_sequence_ = 0;
+
+    // 以下仅由调用方线程访问：异步报单 request_id -> 交易所订单号，取回其完成通知时移除
+    std::unordered_map<uint64_t, uint64_t> unacked_sends_;
+};
+
+} // namespace sim_exchange
+} // namespace execution_adapters
+} // namespace plugins
+} // namespace quant
@@ -0,0 +1,47 @@
+// 二进制日志解码工具：把 BinaryLogSink 写出的文件还原为文本日志
+//
+// 用法：
+//   qt_log_decode <file.blog> [--level TRACE|DEBUG|INFO|WARN|ERROR]
+
+#include <cstring>
+#include <iostream>
+#include <string>
+#include "utils/async_logger/async_logger.h"
+
+using namespace quant::base::utils::async_logger;
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        std::cerr << "Usage: " << argv[0] << " <file.blog> [--level TRACE|DEBUG|INFO|WARN|ERROR]" << std::endl;
+        return 2;
+    }
+    LogLevel min_level = LogLevel::kTrace;
+    if (argc >= 4 && std::strcmp(argv[2], "--level") == 0) {
+        for (uint8_t l = 0; l <= static_cast<uint8_t>(LogLevel::kError); ++l) {
+            if (std::strcmp(argv[3], to_string(static_cast<LogLevel>(l))) == 0) {
+                min_level = static_cast<LogLevel>(l);
+            }
+        }
+    }
+
+    uint64_t records = 0;
+    std::string error;
+    bool ok = decode_binary_log(argv[1], [&](const LogEntry& entry) {
+        if (entry.site_id == kPaddingSite && entry.site == nullptr) {
+            std::cout << "[WARN] [" << entry.thread_id << "] " << entry.payload_size
+                      << " log messages dropped (ring full)\n";
+            return;
+        }
+        if (entry.site != nullptr && entry.site->level < min_level) {
+            return;
+        }
+        std::cout << format_entry(entry) << '\n';
+        ++records;
+    }, &error);
+    std::cout << std::flush;
+    if (!ok) {
+        std::cerr << error << " (after " << records << " records)" << std::endl;
+        return 1;
+    }
+    return 0;
+}
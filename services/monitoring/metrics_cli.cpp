@@ -0,0 +1,59 @@
+// 指标查看工具：只读映射交易进程导出的指标共享内存段（交易进程以 QT_METRICS_SHM=<name> 启动）
+//
+// 用法：
+//   qt_metrics <shm_name>                 输出一次全部指标
+//   qt_metrics <shm_name> <interval_ms>   周期输出，计数器附带区间内的速率（每秒）
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include "common/metrics/metrics.h"
+
+using namespace quant::base::common::metrics;
+
+int main(int argc, char* argv[]) {
+    if (argc < 2) {
+        std::cerr << "Usage: " << argv[0] << " <shm_name> [interval_ms]" << std::endl;
+        return 2;
+    }
+    std::string error;
+    auto reader = MetricsReader::open(argv[1], &error);
+    if (!reader) {
+        std::cerr << error << std::endl;
+        return 1;
+    }
+    if (argc < 3) {
+        std::cout << format_metrics(reader->snapshot());
+        return 0;
+    }
+
+    auto interval = std::chrono::milliseconds(std::max(1L, std::strtol(argv[2], nullptr, 10)));
+    std::unordered_map<std::string, int64_t> previous;
+    auto last = std::chrono::steady_clock::now();
+    for (;;) {
+        std::this_thread::sleep_for(interval);
+        auto now = std::chrono::steady_clock::now();
+        double seconds = std::chrono::duration<double>(now - last).count();
+        last = now;
+
+        auto metrics = reader->snapshot();
+        std::cout << "--- pid " << reader->writer_pid() << " ---\n" << format_metrics(metrics);
+        for (const auto& metric : metrics) {
+            if (metric.type != MetricType::kCounter) {
+                continue;
+            }
+            auto it = previous.find(metric.name);
+            if (it != previous.end() && seconds > 0.0) {
+                std::printf("%-48s rate      %.1f/s\n", metric.name.c_str(),
+                            static_cast<double>(metric.value - it->second) / seconds);
+            }
+            previous[metric.name] = metric.value;
+        }
+        std::cout << std::flush;
+    }
+}
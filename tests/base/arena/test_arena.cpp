@@ -0,0 +1,249 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+#include "base/common/arena/arena.h"
+#include "base/common/object_pool/object_pool.h"
+#include "base/common/ring_queue/ring_queue.h"
+#include "base/common/safe_queue/safe_queue.h"
+#include "base/common/thread_pool/thread_pool.h"
+
+using namespace quant::base::common::arena;
+
+namespace {
+
+std::shared_ptr<Arena> make_arena(size_t bytes, bool heap_fallback = true) {
+    ArenaOptions options;
+    options.bytes = bytes;
+    options.page_size = PageSize::kDefault;
+    options.heap_fallback = heap_fallback;
+    std::string error;
+    auto arena = Arena::create(options, &error);
+    EXPECT_NE(arena, nullptr) << error;
+    return arena;
+}
+
+}  // namespace
+
+// 创建：普通页 + 预缺页；大页不可用时按选项回退或失败
+TEST(ArenaTest, CreateAndPageFallback) {
+    auto arena = make_arena(3 << 20);
+    ASSERT_NE(arena, nullptr);
+    ArenaStats stats = arena->stats();
+    EXPECT_EQ(stats.capacity, 4u << 20);       // 向上取整到 2MB
+    EXPECT_EQ(stats.in_use, 0u);
+    EXPECT_FALSE(stats.huge_pages);
+    EXPECT_EQ(stats.numa_node, -1);
+
+    // 2MB 大页：系统未预留大页时回退为普通页
+    ArenaOptions options;
+    options.bytes = 2 << 20;
+    options.page_size = PageSize::k2MB;
+    std::string error;
+    auto huge = Arena::create(options, &error);
+    ASSERT_NE(huge, nullptr) << error;
+    EXPECT_EQ(huge->stats().page_bytes, huge->stats().huge_pages ? (2u << 20) : 4096u);
+
+    // 要求大页：要么拿到大页，要么失败并给出原因
+    options.page_size = PageSize::k1GB;
+    options.bytes = 1 << 30;
+    options.require_huge_pages = true;
+    options.prefault = false;
+    error.clear();
+    auto strict = Arena::create(options, &error);
+    if (strict) {
+        EXPECT_TRUE(strict->stats().huge_pages);
+    } else {
+        EXPECT_FALSE(error.empty());
+    }
+
+    // NUMA：节点 0 总是存在（内核不支持 mbind 时不绑定继续）；不存在的节点在严格模式下失败
+    ArenaOptions numa;
+    numa.bytes = 2 << 20;
+    numa.page_size = PageSize::kDefault;
+    numa.numa_node = 0;
+    auto bound = Arena::create(numa, &error);
+    ASSERT_NE(bound, nullptr);
+    EXPECT_TRUE(bound->stats().numa_node == 0 || bound->stats().numa_node == -1);
+    numa.numa_node = 1000;
+    numa.require_numa = true;
+    EXPECT_EQ(Arena::create(numa, &error), nullptr);
+    EXPECT_NE(error.find("NUMA"), std::string::npos);
+}
+
+// 分级分配：按 2 的幂取整、对齐、归还后复用，耗尽时回退到全局堆或失败
+TEST(ArenaTest, SizeClassesReuseAndExhaustion) {
+    auto arena = make_arena(2 << 20, false);
+    ASSERT_NE(arena, nullptr);
+
+    void* a = arena->allocate(100);
+    ASSERT_NE(a, nullptr);
+    EXPECT_TRUE(arena->owns(a));
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(a) % 64, 0u);
+    EXPECT_EQ(arena->stats().in_use, 128u);
+    void* page = arena->allocate(10, 4096);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(page) % 4096, 0u);
+    arena->deallocate(page, 10, 4096);
+
+    arena->deallocate(a, 100);
+    EXPECT_EQ(arena->stats().in_use, 0u);
+    EXPECT_EQ(arena->allocate(120), a);         // 同级别复用
+    EXPECT_NE(arena->allocate(200), a);
+
+    std::vector<void*> blocks;
+    while (void* block = arena->allocate(256 << 10)) {
+        blocks.push_back(block);
+    }
+    EXPECT_GE(blocks.size(), 6u);
+    EXPECT_LE(blocks.size(), 8u);
+    EXPECT_EQ(arena->stats().heap_fallbacks, 0u);
+
+    auto fallback = make_arena(2 << 20, true);
+    void* big = fallback->allocate(4 << 20);
+    ASSERT_NE(big, nullptr);
+    EXPECT_FALSE(fallback->owns(big));
+    EXPECT_EQ(fallback->stats().heap_fallbacks, 1u);
+    fallback->deallocate(big, 4 << 20);
+}
+
+// 接入容器：SafeQueue / RingQueue / ObjectPool / ThreadPool / 标准容器
+TEST(ArenaTest, Containers) {
+    auto arena = make_arena(16 << 20, false);
+    ASSERT_NE(arena, nullptr);
+    Arena* raw = arena.get();
+
+    {
+        // deque 分段持续申请/归还：空闲链表复用，切分量不随吞吐增长
+        quant::base::common::safe_queue::SafeQueue<int64_t, ArenaAllocator<int64_t>> queue{
+            ArenaAllocator<int64_t>(raw)};
+        for (int round = 0; round < 100; ++round) {
+            for (int64_t i = 0; i < 1000; ++i) {
+                queue.push(i);
+            }
+            int64_t value = 0;
+            for (int64_t i = 0; i < 1000; ++i) {
+                ASSERT_TRUE(queue.pop(value));
+                ASSERT_EQ(value, i);
+            }
+        }
+        EXPECT_GT(arena->stats().in_use, 0u);
+        EXPECT_LT(arena->stats().reserved, 64u << 10);
+    }
+
+    {
+        quant::base::common::ring_queue::RingQueue<std::string, ArenaAllocator<std::string>> ring(
+            1000, ArenaAllocator<std::string>(raw));
+        EXPECT_EQ(ring.capacity(), 1024u);
+        ASSERT_TRUE(ring.push(std::string(100, 'x')));
+        std::string out;
+        ASSERT_TRUE(ring.pop(out));
+        EXPECT_EQ(out.size(), 100u);
+    }
+
+    {
+        struct Order {
+            int64_t id;
+            double price;
+        };
+        quant::base::common::object_pool::ObjectPool<Order, ArenaAllocator<Order>> pool(
+            10000, ArenaAllocator<Order>(raw));
+        auto handle = pool.acquire();
+        ASSERT_NE(pool.get(handle), nullptr);
+        EXPECT_TRUE(raw->owns(pool.get(handle)));
+    }
+
+    {
+        using Pool = quant::base::common::thread_pool::BasicThreadPool<ArenaAllocator<std::function<void()>>>;
+        auto pool = Pool::create(2, "", ArenaAllocator<std::function<void()>>(raw));
+        std::vector<std::future<int>> results;
+        for (int i = 0; i < 100; ++i) {
+            results.push_back(pool->submit([i]() { return i * 2; }));
+        }
+        for (int i = 0; i < 100; ++i) {
+            EXPECT_EQ(results[i].get(), i * 2);
+        }
+        pool->stop(true);
+    }
+
+    {
+        std::vector<double, ArenaAllocator<double>> panel{ArenaAllocator<double>(raw)};
+        panel.resize(100000, 1.0);
+        EXPECT_TRUE(raw->owns(panel.data()));
+    }
+    EXPECT_EQ(arena->stats().in_use, 0u);
+    EXPECT_EQ(arena->stats().heap_fallbacks, 0u);
+
+    // 默认构造的分配器使用全局堆
+    std::vector<int, ArenaAllocator<int>> heap_vector(10, 1);
+    EXPECT_FALSE(raw->owns(heap_vector.data()));
+}
+
+// 多线程同时分配/归还：块互不重叠
+TEST(ArenaTest, ConcurrentAllocate) {
+    auto arena = make_arena(32 << 20, false);
+    ASSERT_NE(arena, nullptr);
+    std::vector<std::thread> threads;
+    std::atomic<int> errors{0};
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([&, t]() {
+            std::vector<std::pair<uint8_t*, size_t>> held;
+            for (int i = 0; i < 20000; ++i) {
+                size_t bytes = 64u << (i % 5);
+                auto* block = static_cast<uint8_t*>(arena->allocate(bytes));
+                if (block == nullptr) {
+                    errors.fetch_add(1);
+                    continue;
+                }
+                std::memset(block, t + 1, bytes);
+                held.emplace_back(block, bytes);
+                if (held.size() > 64) {
+                    auto victim = held[i % held.size()];
+                    for (size_t b = 0; b < victim.second; b += 16) {
+                        if (victim.first[b] != t + 1) {
+                            errors.fetch_add(1);
+                        }
+                    }
+                    arena->deallocate(victim.first, victim.second);
+                    held[i % held.size()] = held.back();
+                    held.pop_back();
+                }
+            }
+            for (auto& block : held) {
+                arena->deallocate(block.first, block.second);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(errors.load(), 0);
+    EXPECT_EQ(arena->stats().in_use, 0u);
+}
+
+// 性能测试：区内分配/归还与全局堆对比
+TEST(ArenaTest, PerformanceTest) {
+    auto arena = make_arena(8 << 20, false);
+    ASSERT_NE(arena, nullptr);
+    const int kIterations = 1000000;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < kIterations; ++i) {
+        void* block = arena->allocate(512);
+        arena->deallocate(block, 512);
+    }
+    auto mid = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < kIterations; ++i) {
+        void* block = ::operator new(512);
+        asm volatile("" : : "r"(block) : "memory");
+        ::operator delete(block);
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+
+    auto arena_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(mid - start).count();
+    auto heap_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(end - mid).count();
+    std::cout << "Arena allocate+deallocate: " << static_cast<double>(arena_ns) / kIterations << " ns/op, "
+              << "heap: " << static_cast<double>(heap_ns) / kIterations << " ns/op" << std::endl;
+}
@@ -0,0 +1,248 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <unistd.h>
+#include "base/utils/async_logger/async_logger.h"
+
+using namespace quant::base::utils::async_logger;
+
+namespace {
+
+// 收集格式化结果的输出端
+class CaptureSink : public LogSink {
+public:
+    void write(const LogEntry& entry) override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        messages_.push_back(format_message(entry.site != nullptr ? entry.site->format : nullptr,
+                                           entry.payload, entry.payload_size));
+        timestamps_.push_back(entry.timestamp_ns);
+    }
+    void dropped(uint32_t, uint64_t count) override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        dropped_ += count;
+    }
+
+    std::vector<std::string> messages() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return messages_;
+    }
+    std::vector<int64_t> timestamps() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return timestamps_;
+    }
+    uint64_t dropped_count() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return dropped_;
+    }
+
+private:
+    mutable std::mutex mutex_;
+    std::vector<std::string> messages_;
+    std::vector<int64_t> timestamps_;
+    uint64_t dropped_ = 0;
+};
+
+const LogSite kSeqSite{LogLevel::kInfo, __FILE__, __LINE__, "thread {} seq {}"};
+const LogSite kMixedSite{LogLevel::kWarn, __FILE__, __LINE__, "order {} px={} qty={} buy={} side={} note={}"};
+
+uint32_t seq_site() {
+    static const uint32_t id = register_site(&kSeqSite);
+    return id;
+}
+
+uint32_t mixed_site() {
+    static const uint32_t id = register_site(&kMixedSite);
+    return id;
+}
+
+template <typename... Args>
+std::string encode_and_format(const char* format, const Args&... args) {
+    size_t size = 0;
+    using expand = int[];
+    (void)expand{0, (size += detail::encoded_size(args), 0)...};
+    std::vector<uint8_t> buffer(size);
+    uint8_t* p = buffer.data();
+    (void)expand{0, (detail::encode(p, args), 0)...};
+    EXPECT_EQ(static_cast<size_t>(p - buffer.data()), size);
+    return format_message(format, buffer.data(), buffer.size());
+}
+
+}  // namespace
+
+// 参数编码与延迟格式化
+TEST(AsyncLoggerTest, FormatMessage) {
+    EXPECT_EQ(encode_and_format("a={} b={} c={}", 42, -7LL, 3.5), "a=42 b=-7 c=3.5");
+    EXPECT_EQ(encode_and_format("{} {} {}", true, 'x', std::string("str")), "true x str");
+    EXPECT_EQ(encode_and_format("u={} s={}", 18446744073709551615ULL, "literal"), "u=18446744073709551615 s=literal");
+    EXPECT_EQ(encode_and_format("{{}} {}", 1), "{} 1");
+    EXPECT_EQ(encode_and_format("missing {} {}", 1), "missing 1 {}");
+    EXPECT_EQ(encode_and_format("no args"), "no args");
+
+    std::string long_string(kMaxStringArg + 100, 'z');
+    EXPECT_EQ(encode_and_format("{}", long_string).size(), kMaxStringArg);
+
+    int value = 0;
+    EXPECT_EQ(encode_and_format("{}", &value).substr(0, 2), "0x");
+    const char* null_string = nullptr;
+    EXPECT_EQ(encode_and_format("[{}]", null_string), "[]");
+}
+
+// 多线程写入：每个线程的日志按顺序、完整输出
+TEST(AsyncLoggerTest, MultiThreadOrdering) {
+    AsyncLogger logger;
+    auto* sink = new CaptureSink();
+    logger.set_sink(std::unique_ptr<LogSink>(sink));
+
+    const int kThreads = 4;
+    const int kPerThread = 2000;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&logger, t]() {
+            for (int i = 0; i < kPerThread; ++i) {
+                logger.log(seq_site(), kSeqSite.format, t, i);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    logger.flush();
+
+    auto messages = sink->messages();
+    EXPECT_EQ(messages.size() + sink->dropped_count(), static_cast<size_t>(kThreads * kPerThread));
+    EXPECT_EQ(logger.dropped(), 0u);
+    std::vector<int> next(kThreads, 0);
+    for (const auto& message : messages) {
+        int t = -1;
+        int seq = -1;
+        ASSERT_EQ(std::sscanf(message.c_str(), "thread %d seq %d", &t, &seq), 2) << message;
+        ASSERT_GE(t, 0);
+        ASSERT_LT(t, kThreads);
+        EXPECT_EQ(seq, next[t]);
+        next[t] = seq + 1;
+    }
+
+    // 时间戳换算为墙钟
+    auto timestamps = sink->timestamps();
+    ASSERT_FALSE(timestamps.empty());
+    int64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    EXPECT_LT(std::llabs(timestamps.back() - now), 10LL * 1000000000LL);
+}
+
+// 小环回绕与满环丢弃：输出条数 + 丢弃条数 = 写入条数，顺序不乱
+TEST(AsyncLoggerTest, RingWrapAndDrop) {
+    AsyncLogger::Options options;
+    options.ring_bytes = 1024;
+    AsyncLogger logger(options);
+    auto* sink = new CaptureSink();
+    logger.set_sink(std::unique_ptr<LogSink>(sink));
+
+    const int kMessages = 20000;
+    for (int i = 0; i < kMessages; ++i) {
+        logger.log(seq_site(), kSeqSite.format, 0, i);
+    }
+    logger.flush();
+    logger.stop();
+
+    auto messages = sink->messages();
+    EXPECT_EQ(messages.size() + sink->dropped_count(), static_cast<size_t>(kMessages));
+    EXPECT_EQ(logger.dropped(), sink->dropped_count());
+    int last = -1;
+    for (const auto& message : messages) {
+        int t = 0;
+        int seq = 0;
+        ASSERT_EQ(std::sscanf(message.c_str(), "thread %d seq %d", &t, &seq), 2);
+        EXPECT_GT(seq, last);
+        last = seq;
+    }
+
+    // 停止后没有消费者：环写满后全部丢弃，写线程不阻塞
+    uint64_t before = logger.dropped();
+    for (int i = 0; i < 1000; ++i) {
+        logger.log(seq_site(), kSeqSite.format, 1, i);
+    }
+    EXPECT_GT(logger.dropped(), before);
+}
+
+// 二进制输出与离线解码
+TEST(AsyncLoggerTest, BinaryRoundTrip) {
+    std::string path = "/tmp/qt_async_logger_test_" + std::to_string(getpid()) + ".blog";
+    {
+        AsyncLogger logger;
+        logger.set_sink(std::unique_ptr<LogSink>(new BinaryLogSink(path)));
+        for (int i = 0; i < 100; ++i) {
+            logger.log(mixed_site(), kMixedSite.format, i, 3500.5 + i, 10u, i % 2 == 0, 'B', std::string("ioc"));
+        }
+        logger.log(seq_site(), kSeqSite.format, 7, 8);
+        logger.stop();
+        logger.set_sink(nullptr);   // 关闭文件
+    }
+
+    std::vector<std::string> lines;
+    std::string error;
+    ASSERT_TRUE(decode_binary_log(path, [&lines](const LogEntry& entry) {
+        ASSERT_NE(entry.site, nullptr);
+        lines.push_back(format_entry(entry));
+    }, &error)) << error;
+    ASSERT_EQ(lines.size(), 101u);
+    EXPECT_NE(lines[0].find("[WARN]"), std::string::npos);
+    EXPECT_NE(lines[0].find("test_async_logger.cpp:"), std::string::npos);
+    EXPECT_NE(lines[0].find("order 0 px=3500.5 qty=10 buy=true side=B note=ioc"), std::string::npos);
+    EXPECT_NE(lines[99].find("order 99 px=3599.5 qty=10 buy=false"), std::string::npos);
+    EXPECT_NE(lines[100].find("thread 7 seq 8"), std::string::npos);
+    std::remove(path.c_str());
+
+    EXPECT_FALSE(decode_binary_log("/tmp/qt_async_logger_missing.blog", [](const LogEntry&) {}, &error));
+}
+
+// 宏：级别过滤时不求值参数
+TEST(AsyncLoggerTest, MacroLevelFilter) {
+    auto& logger = AsyncLogger::instance();
+    auto* sink = new CaptureSink();
+    logger.set_sink(std::unique_ptr<LogSink>(sink));
+    LogLevel saved = logger.level();
+    logger.set_level(LogLevel::kWarn);
+
+    int evaluated = 0;
+    auto touch = [&evaluated]() { return ++evaluated; };
+    QT_LOG_INFO("filtered {}", touch());
+    QT_LOG_WARN("kept {} {}", touch(), "warn");
+    QT_LOG_ERROR("no arguments");
+    logger.flush();
+
+    EXPECT_EQ(evaluated, 1);
+    auto messages = sink->messages();
+    ASSERT_EQ(messages.size(), 2u);
+    EXPECT_EQ(messages[0], "kept 1 warn");
+    EXPECT_EQ(messages[1], "no arguments");
+
+    logger.set_level(saved);
+    logger.set_sink(std::unique_ptr<LogSink>(new TextLogSink()));
+}
+
+// 性能测试：热路径单次日志调用开销（输出端丢弃，只测采集）
+TEST(AsyncLoggerTest, PerformanceTest) {
+    AsyncLogger::Options options;
+    options.ring_bytes = 64 << 20;
+    AsyncLogger logger(options);
+    logger.set_sink(nullptr);
+
+    const int kIterations = 1000000;
+    std::string instrument = "rb2401";
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < kIterations; ++i) {
+        logger.log(mixed_site(), kMixedSite.format, i, 3500.5, 10u, true, 'B', instrument);
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    logger.flush();
+
+    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+    std::cout << "AsyncLogger log (6 args): " << static_cast<double>(ns) / kIterations
+              << " ns/op, dropped=" << logger.dropped() << std::endl;
+}
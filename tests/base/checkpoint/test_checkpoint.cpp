@@ -0,0 +1,308 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <unistd.h>
+#include "base/common/checkpoint/checkpoint.h"
+
+using namespace quant::base::common::checkpoint;
+
+namespace {
+
+// 定长行情记录（模拟 last_ticks_ 的检查点布局）
+struct TickRecord {
+    char instrument[16];
+    double last_price;
+    int64_t volume;
+    int64_t update_ns;
+};
+
+std::string temp_path(const char* tag) {
+    return std::string("/tmp/qt_checkpoint_test_") + tag + "_" + std::to_string(getpid()) + ".bin";
+}
+
+CheckpointOptions make_options(const std::string& path, size_t slot_bytes = 1 << 20) {
+    CheckpointOptions options;
+    options.path = path;
+    options.slot_bytes = slot_bytes;
+    options.interval = std::chrono::milliseconds(5);
+    return options;
+}
+
+std::string section_string(const CheckpointImage& image, const std::string& name) {
+    const uint8_t* data = nullptr;
+    size_t size = 0;
+    if (!image.find(name, data, size)) {
+        return "<missing>";
+    }
+    return std::string(reinterpret_cast<const char*>(data), size);
+}
+
+}  // namespace
+
+// 提交与映射读取；定长记录零拷贝解析
+TEST(CheckpointTest, CommitAndMapBack) {
+    std::string path = temp_path("commit");
+    std::remove(path.c_str());
+    std::string error;
+    auto checkpointer = Checkpointer::create(make_options(path), &error);
+    ASSERT_NE(checkpointer, nullptr) << error;
+
+    std::vector<TickRecord> ticks(3);
+    for (size_t i = 0; i < ticks.size(); ++i) {
+        std::snprintf(ticks[i].instrument, sizeof(ticks[i].instrument), "rb24%02d", static_cast<int>(i));
+        ticks[i].last_price = 3500.0 + static_cast<double>(i);
+        ticks[i].volume = static_cast<int64_t>(i) * 10;
+    }
+    ASSERT_TRUE(checkpointer->add_section("market_data.last_ticks", [&ticks](std::string& out) {
+        append_pod(out, static_cast<uint32_t>(ticks.size()));
+        append_pod_array(out, ticks.data(), ticks.size());
+        return true;
+    }));
+    ASSERT_TRUE(checkpointer->add_section("strategy.trend", [](std::string& out) {
+        out = "ema=3501.25";
+        return true;
+    }));
+    EXPECT_FALSE(checkpointer->add_section("strategy.trend", [](std::string&) { return true; }));
+    EXPECT_FALSE(checkpointer->add_section(std::string(kMaxSectionName, 'x'), [](std::string&) { return true; }));
+
+    ASSERT_TRUE(checkpointer->checkpoint_now(&error)) << error;
+    EXPECT_EQ(checkpointer->sequence(), 1u);
+
+    auto image = CheckpointImage::open(path, &error);
+    ASSERT_NE(image, nullptr) << error;
+    EXPECT_EQ(image->sequence(), 1u);
+    EXPECT_GT(image->timestamp_ns(), 0);
+    EXPECT_EQ(image->sections().size(), 2u);
+    EXPECT_EQ(section_string(*image, "strategy.trend"), "ema=3501.25");
+    EXPECT_EQ(section_string(*image, "missing"), "<missing>");
+
+    const uint8_t* data = nullptr;
+    size_t size = 0;
+    ASSERT_TRUE(image->find("market_data.last_ticks", data, size));
+    const uint8_t* end = data + size;
+    uint32_t count = 0;
+    ASSERT_TRUE(read_pod(data, end, count));
+    ASSERT_EQ(count, 3u);
+    for (uint32_t i = 0; i < count; ++i) {
+        TickRecord record;
+        ASSERT_TRUE(read_pod(data, end, record));
+        EXPECT_DOUBLE_EQ(record.last_price, 3500.0 + i);
+        EXPECT_EQ(record.volume, static_cast<int64_t>(i) * 10);
+    }
+    EXPECT_EQ(data, end);
+    std::remove(path.c_str());
+}
+
+// 双槽位：新检查点写入旧槽位；正在写的槽位损坏时回退到上一次的检查点；重启后序号延续
+TEST(CheckpointTest, DoubleSlotAndRestart) {
+    std::string path = temp_path("slots");
+    std::remove(path.c_str());
+    int round = 0;
+    {
+        auto checkpointer = Checkpointer::create(make_options(path, 4096));
+        ASSERT_NE(checkpointer, nullptr);
+        checkpointer->add_section("state", [&round](std::string& out) {
+            out = "round-" + std::to_string(round);
+            return true;
+        });
+        for (round = 1; round <= 3; ++round) {
+            ASSERT_TRUE(checkpointer->checkpoint_now());
+        }
+    }
+    auto image = CheckpointImage::open(path);
+    ASSERT_NE(image, nullptr);
+    EXPECT_EQ(image->sequence(), 3u);
+    EXPECT_EQ(section_string(*image, "state"), "round-3");
+    image.reset();
+
+    // 模拟写入序号 3 的槽位（槽位 1）时崩溃：数据被部分覆盖，校验和不匹配
+    {
+        std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+        file.seekp(4096 + 4096 + 50);     // 槽位头之后的段表
+        file.write("garbage", 7);
+    }
+    image = CheckpointImage::open(path);
+    ASSERT_NE(image, nullptr);
+    EXPECT_EQ(image->sequence(), 2u);
+    EXPECT_EQ(section_string(*image, "state"), "round-2");
+    image.reset();
+
+    // 重启：复用文件，从最大有效序号继续，覆盖损坏的槽位
+    {
+        auto checkpointer = Checkpointer::create(make_options(path, 4096));
+        ASSERT_NE(checkpointer, nullptr);
+        EXPECT_EQ(checkpointer->sequence(), 2u);
+        checkpointer->add_section("state", [](std::string& out) {
+            out = "after-restart";
+            return true;
+        });
+        ASSERT_TRUE(checkpointer->checkpoint_now());
+        EXPECT_EQ(checkpointer->sequence(), 3u);
+    }
+    image = CheckpointImage::open(path);
+    ASSERT_NE(image, nullptr);
+    EXPECT_EQ(section_string(*image, "state"), "after-restart");
+    image.reset();
+
+    // 槽位容量改变：旧文件按新布局重建
+    {
+        auto checkpointer = Checkpointer::create(make_options(path, 8192));
+        ASSERT_NE(checkpointer, nullptr);
+        EXPECT_EQ(checkpointer->sequence(), 0u);
+    }
+    EXPECT_EQ(CheckpointImage::open(path), nullptr);
+    std::remove(path.c_str());
+    EXPECT_EQ(CheckpointImage::open(path), nullptr);
+}
+
+// 采集失败沿用上一次内容；超出槽位容量时提交失败且不破坏已有检查点
+TEST(CheckpointTest, CaptureFailureAndOverflow) {
+    std::string path = temp_path("overflow");
+    std::remove(path.c_str());
+    auto checkpointer = Checkpointer::create(make_options(path, 1024));
+    ASSERT_NE(checkpointer, nullptr);
+    bool succeed = true;
+    size_t payload = 10;
+    checkpointer->add_section("strategy.slow", [&](std::string& out) {
+        if (!succeed) {
+            return false;
+        }
+        out.assign(payload, 'a');
+        return true;
+    });
+    checkpointer->add_section("strategy.throws", [](std::string&) -> bool { throw std::runtime_error("boom"); });
+
+    ASSERT_TRUE(checkpointer->checkpoint_now());
+    succeed = false;
+    ASSERT_TRUE(checkpointer->checkpoint_now());
+    auto image = CheckpointImage::open(path);
+    ASSERT_NE(image, nullptr);
+    EXPECT_EQ(image->sequence(), 2u);
+    EXPECT_EQ(section_string(*image, "strategy.slow"), std::string(10, 'a'));
+    EXPECT_EQ(section_string(*image, "strategy.throws"), "");
+    image.reset();
+
+    succeed = true;
+    payload = 4096;
+    std::string error;
+    EXPECT_FALSE(checkpointer->checkpoint_now(&error));
+    EXPECT_NE(error.find("exceeds"), std::string::npos);
+    EXPECT_EQ(checkpointer->failures(), 1u);
+    image = CheckpointImage::open(path);
+    ASSERT_NE(image, nullptr);
+    EXPECT_EQ(image->sequence(), 2u);
+    std::remove(path.c_str());
+}
+
+// 交易线程双缓冲交接：交易线程只在安全点复制一次，检查点线程读取的副本内部一致
+TEST(CheckpointTest, CellHandoff) {
+    CheckpointCell<std::vector<int64_t>> cell;
+    std::atomic<bool> done{false};
+    std::thread trader([&]() {
+        std::vector<int64_t> live(64, 0);
+        int64_t tick = 0;
+        while (!done.load(std::memory_order_acquire)) {
+            ++tick;
+            for (auto& value : live) {
+                value = tick;       // 一次“行情处理”后全部字段一致
+            }
+            cell.offer(live);
+        }
+    });
+
+    int collected = 0;
+    int64_t last = 0;
+    for (int i = 0; i < 200; ++i) {
+        bool ok = cell.collect([&](const std::vector<int64_t>& shadow) {
+            ASSERT_EQ(shadow.size(), 64u);
+            for (auto value : shadow) {
+                EXPECT_EQ(value, shadow.front());
+            }
+            EXPECT_GE(shadow.front(), last);
+            last = shadow.front();
+        }, std::chrono::seconds(1));
+        collected += ok ? 1 : 0;
+    }
+    done.store(true, std::memory_order_release);
+    trader.join();
+    EXPECT_EQ(collected, 200);
+
+    // 没有交易线程响应时超时返回，并撤回请求
+    CheckpointCell<int> idle;
+    EXPECT_FALSE(idle.collect([](const int&) {}, std::chrono::milliseconds(1)));
+    EXPECT_FALSE(idle.requested());
+    EXPECT_FALSE(idle.offer(1));
+}
+
+// 后台线程周期检查点与退出前的最后一次检查点
+TEST(CheckpointTest, BackgroundThread) {
+    std::string path = temp_path("background");
+    std::remove(path.c_str());
+    auto checkpointer = Checkpointer::create(make_options(path));
+    ASSERT_NE(checkpointer, nullptr);
+    std::atomic<int> value{0};
+    checkpointer->add_section("counter", [&value](std::string& out) {
+        append_pod(out, value.load());
+        return true;
+    });
+    checkpointer->start();
+    for (int i = 0; i < 200 && checkpointer->sequence() < 3; ++i) {
+        value.fetch_add(1);
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    EXPECT_GE(checkpointer->sequence(), 3u);
+    value.store(12345);
+    checkpointer->stop();
+
+    auto image = CheckpointImage::open(path);
+    ASSERT_NE(image, nullptr);
+    const uint8_t* data = nullptr;
+    size_t size = 0;
+    ASSERT_TRUE(image->find("counter", data, size));
+    int restored = 0;
+    ASSERT_TRUE(read_pod(data, data + size, restored));
+    EXPECT_EQ(restored, 12345);
+    std::remove(path.c_str());
+}
+
+// 性能测试：1 万条定长行情记录的检查点耗时与交易线程交接开销
+TEST(CheckpointTest, PerformanceTest) {
+    std::string path = temp_path("perf");
+    std::remove(path.c_str());
+    auto checkpointer = Checkpointer::create(make_options(path, 4 << 20));
+    ASSERT_NE(checkpointer, nullptr);
+    std::vector<TickRecord> ticks(10000);
+    checkpointer->add_section("market_data.last_ticks", [&ticks](std::string& out) {
+        append_pod_array(out, ticks.data(), ticks.size());
+        return true;
+    });
+
+    const int kRounds = 50;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < kRounds; ++i) {
+        ASSERT_TRUE(checkpointer->checkpoint_now());
+    }
+    auto mid = std::chrono::high_resolution_clock::now();
+
+    // 交易线程无请求时的 offer() 开销（热路径常态）
+    CheckpointCell<std::vector<TickRecord>> cell;
+    const int kOffers = 10000000;
+    int published = 0;
+    for (int i = 0; i < kOffers; ++i) {
+        published += cell.offer(ticks) ? 1 : 0;
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    EXPECT_EQ(published, 0);
+
+    auto checkpoint_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(mid - start).count();
+    auto offer_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(end - mid).count();
+    std::cout << "Checkpoint 10k ticks: " << static_cast<double>(checkpoint_ns) / kRounds / 1000.0 << " us, "
+              << "idle offer: " << static_cast<double>(offer_ns) / kOffers << " ns/op" << std::endl;
+    std::remove(path.c_str());
+}
@@ -0,0 +1,324 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <unistd.h>
+#include "base/common/config_cache/config_cache.h"
+#include "base/common/rcu/rcu.h"
+
+using namespace quant::base::common::config_cache;
+
+namespace {
+
+// 模拟配置服务：可切换可用状态，手动推送增量
+class FakeSource : public ConfigSource {
+public:
+    std::unique_ptr<ConfigSnapshot> fetch_snapshot(std::string* error) override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ++fetches;
+        if (!available) {
+            if (error != nullptr) {
+                *error = "config service unavailable";
+            }
+            return nullptr;
+        }
+        return std::make_unique<ConfigSnapshot>(server);
+    }
+
+    bool subscribe(uint64_t from_version, DeltaCallback callback, std::string*) override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        subscribed_from = from_version;
+        callback_ = std::move(callback);
+        return available;
+    }
+
+    void unsubscribe() override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        callback_ = nullptr;
+        ++unsubscribes;
+    }
+
+    void push(const ConfigDelta& delta) {
+        DeltaCallback callback;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            callback = callback_;
+        }
+        if (callback) {
+            callback(delta);
+        }
+    }
+
+    bool available = true;
+    ConfigSnapshot server{1};
+    uint64_t subscribed_from = 0;
+    int fetches = 0;
+    int unsubscribes = 0;
+
+private:
+    std::mutex mutex_;
+    DeltaCallback callback_;
+};
+
+std::string temp_path(const char* tag) {
+    return std::string("/tmp/qt_config_cache_test_") + tag + "_" + std::to_string(getpid()) + ".bin";
+}
+
+ConfigSnapshot make_snapshot(uint64_t version) {
+    ConfigSnapshot snapshot(version);
+    snapshot.set_section("risk", "limits", {{"max_order_qty", "100"}, {"max_position", "1000"}});
+    snapshot.set_section("account", "default", {{"broker", "CTP"}});
+    return snapshot;
+}
+
+ConfigDelta make_delta(uint64_t from, uint64_t to, const std::string& qty) {
+    ConfigDelta delta;
+    delta.from_version = from;
+    delta.to_version = to;
+    delta.changes.push_back({"risk", "limits", {{"max_order_qty", qty}, {"max_position", "1000"}}, false});
+    return delta;
+}
+
+}  // namespace
+
+// 快照读取接口
+TEST(ConfigCacheTest, SnapshotLookup) {
+    ConfigSnapshot snapshot = make_snapshot(3);
+    EXPECT_EQ(snapshot.version(), 3u);
+    EXPECT_EQ(snapshot.section_count(), 2u);
+    ASSERT_NE(snapshot.find("risk", "limits"), nullptr);
+    EXPECT_EQ(snapshot.find("risk", "limits")->size(), 2u);
+    EXPECT_EQ(snapshot.find("risk", "missing"), nullptr);
+    EXPECT_EQ(snapshot.get("risk", "limits", "max_order_qty"), "100");
+    EXPECT_EQ(snapshot.get("risk", "limits", "missing", "dflt"), "dflt");
+
+    // 模块名与段名拼接不会产生歧义
+    snapshot.set_section("a.b", "c", {{"k", "1"}});
+    snapshot.set_section("a", "b.c", {{"k", "2"}});
+    EXPECT_EQ(snapshot.get("a.b", "c", "k"), "1");
+    EXPECT_EQ(snapshot.get("a", "b.c", "k"), "2");
+}
+
+// 持久化往返与损坏文件检测
+TEST(ConfigCacheTest, PersistRoundTrip) {
+    std::string path = temp_path("persist");
+    std::string error;
+    ASSERT_TRUE(save_snapshot(path, make_snapshot(42), &error)) << error;
+
+    auto loaded = load_snapshot(path, &error);
+    ASSERT_NE(loaded, nullptr) << error;
+    EXPECT_EQ(loaded->version(), 42u);
+    EXPECT_EQ(loaded->section_count(), 2u);
+    EXPECT_EQ(loaded->get("risk", "limits", "max_position"), "1000");
+    EXPECT_EQ(loaded->get("account", "default", "broker"), "CTP");
+
+    // 篡改载荷：校验和失败
+    {
+        std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+        file.seekp(-1, std::ios::end);
+        file.put('#');
+    }
+    EXPECT_EQ(load_snapshot(path, &error), nullptr);
+    EXPECT_NE(error.find("checksum"), std::string::npos);
+
+    // 截断
+    ASSERT_EQ(truncate(path.c_str(), 20), 0);
+    EXPECT_EQ(load_snapshot(path, &error), nullptr);
+    std::remove(path.c_str());
+    EXPECT_EQ(load_snapshot(path, &error), nullptr);
+}
+
+// 启动：全量同步、持久化、订阅；配置服务宕机时从本地缓存冷启动
+TEST(ConfigCacheTest, StartFromServiceThenFromLocalCache) {
+    std::string path = temp_path("restart");
+    std::remove(path.c_str());
+    auto source = std::make_shared<FakeSource>();
+    source->server = make_snapshot(7);
+    {
+        ConfigCache cache(source, ConfigCache::Options{path, false});
+        ASSERT_TRUE(cache.start());
+        EXPECT_FALSE(cache.stale());
+        EXPECT_EQ(cache.version(), 7u);
+        EXPECT_EQ(source->subscribed_from, 7u);
+        EXPECT_EQ(cache.get_config("risk", "limits").at("max_order_qty"), "100");
+    }
+    EXPECT_EQ(source->unsubscribes, 1);
+
+    // 配置服务不可用：本地缓存仍可启动，标记为过期
+    source->available = false;
+    {
+        ConfigCache cache(source, ConfigCache::Options{path, false});
+        std::string error;
+        ASSERT_TRUE(cache.start(&error)) << error;
+        EXPECT_TRUE(cache.stale());
+        EXPECT_EQ(cache.version(), 7u);
+        EXPECT_EQ(cache.snapshot()->get("account", "default", "broker"), "CTP");
+
+        // 服务恢复后重新同步
+        source->available = true;
+        source->server = make_snapshot(9);
+        EXPECT_TRUE(cache.resync());
+        EXPECT_FALSE(cache.stale());
+        EXPECT_EQ(cache.version(), 9u);
+    }
+
+    // 要求配置服务可用时拒绝使用本地缓存；既无服务也无缓存时启动失败
+    source->available = false;
+    {
+        ConfigCache cache(source, ConfigCache::Options{path, true});
+        EXPECT_FALSE(cache.start());
+    }
+    std::remove(path.c_str());
+    {
+        ConfigCache cache(source, ConfigCache::Options{path, false});
+        std::string error;
+        EXPECT_FALSE(cache.start(&error));
+        EXPECT_NE(error.find("unavailable"), std::string::npos);
+    }
+}
+
+// 增量：连续版本直接应用，旧快照保持不变；过期增量忽略；断档触发全量同步
+TEST(ConfigCacheTest, DeltaStream) {
+    std::string path = temp_path("delta");
+    auto source = std::make_shared<FakeSource>();
+    source->server = make_snapshot(1);
+    ConfigCache cache(source, ConfigCache::Options{path, false});
+    std::vector<uint64_t> notified;
+    cache.add_listener([&notified](const ConfigSnapshot& snapshot) { notified.push_back(snapshot.version()); });
+    ASSERT_TRUE(cache.start());
+
+    auto before = cache.snapshot();
+    source->push(make_delta(1, 2, "200"));
+    EXPECT_EQ(cache.version(), 2u);
+    EXPECT_EQ(cache.snapshot()->get("risk", "limits", "max_order_qty"), "200");
+    EXPECT_EQ(before->get("risk", "limits", "max_order_qty"), "100");   // 旧快照不可变
+    EXPECT_EQ(cache.snapshot()->get("account", "default", "broker"), "CTP");
+
+    ConfigDelta erase;
+    erase.from_version = 2;
+    erase.to_version = 3;
+    erase.changes.push_back({"account", "default", {}, true});
+    source->push(erase);
+    EXPECT_EQ(cache.snapshot()->find("account", "default"), nullptr);
+
+    // 重放的旧增量被忽略
+    EXPECT_FALSE(cache.apply_delta(make_delta(1, 2, "999")));
+    EXPECT_EQ(cache.snapshot()->get("risk", "limits", "max_order_qty"), "200");
+    EXPECT_EQ(cache.deltas_applied(), 2u);
+
+    // 断档：3 -> (丢失) -> 5，全量拉取服务端版本 5
+    source->server = make_snapshot(5);
+    source->server.set_section("risk", "limits", {{"max_order_qty", "500"}});
+    int fetches = source->fetches;
+    source->push(make_delta(4, 5, "ignored"));
+    EXPECT_EQ(source->fetches, fetches + 1);
+    EXPECT_EQ(cache.version(), 5u);
+    EXPECT_EQ(cache.snapshot()->get("risk", "limits", "max_order_qty"), "500");
+
+    std::vector<uint64_t> expected{1, 2, 3, 5};
+    EXPECT_EQ(notified, expected);
+
+    // 每次发布都落盘
+    auto persisted = load_snapshot(path);
+    ASSERT_NE(persisted, nullptr);
+    EXPECT_EQ(persisted->version(), 5u);
+    std::remove(path.c_str());
+}
+
+// 并发：读者（在线 RCU 读者与普通线程各一）持续读取的同时写者推送增量，读者看到的版本单调且快照内部一致；
+// 监听者在发布线程上读取快照不会阻塞
+TEST(ConfigCacheTest, ConcurrentReaders) {
+    auto source = std::make_shared<FakeSource>();
+    source->server = make_snapshot(1);
+    ConfigCache cache(source, ConfigCache::Options{"", false});
+    std::atomic<uint64_t> notified{0};
+    cache.add_listener([&cache, &notified](const ConfigSnapshot& snapshot) {
+        if (cache.snapshot()->version() == snapshot.version()) {
+            notified.store(snapshot.version(), std::memory_order_relaxed);
+        }
+    });
+    ASSERT_TRUE(cache.start());
+
+    std::atomic<bool> done{false};
+    std::vector<std::thread> readers;
+    std::atomic<int> errors{0};
+    for (int t = 0; t < 2; ++t) {
+        readers.emplace_back([&, t]() {
+            std::unique_ptr<quant::base::common::rcu::RcuReader> rcu_reader;
+            if (t == 0) {
+                rcu_reader.reset(new quant::base::common::rcu::RcuReader());
+            }
+            uint64_t last = 0;
+            while (!done.load(std::memory_order_acquire)) {
+                if (rcu_reader) {
+                    rcu_reader->quiescent();
+                }
+                auto snapshot = cache.snapshot();
+                if (snapshot->version() < last) {
+                    ++errors;
+                }
+                last = snapshot->version();
+                // 版本 v 的快照中 max_order_qty == v
+                if (last > 1 && snapshot->get("risk", "limits", "max_order_qty") != std::to_string(last)) {
+                    ++errors;
+                }
+            }
+        });
+    }
+    for (uint64_t v = 2; v <= 2000; ++v) {
+        source->push(make_delta(v - 1, v, std::to_string(v)));
+    }
+    done.store(true, std::memory_order_release);
+    for (auto& reader : readers) {
+        reader.join();
+    }
+    EXPECT_EQ(errors.load(), 0);
+    EXPECT_EQ(cache.version(), 2000u);
+    EXPECT_EQ(notified.load(), 2000u);
+}
+
+// 性能测试：缓存读取（在线 RCU 读者 / 普通线程）与逐次拷贝配置段（模拟同步 get_config）的开销对比
+TEST(ConfigCacheTest, PerformanceTest) {
+    auto source = std::make_shared<FakeSource>();
+    source->server = make_snapshot(1);
+    ConfigCache cache(source, ConfigCache::Options{"", false});
+    ASSERT_TRUE(cache.start());
+
+    const int kIterations = 1000000;
+    size_t total = 0;
+    auto start = std::chrono::high_resolution_clock::now();
+    {
+        quant::base::common::rcu::RcuReader reader;
+        for (int i = 0; i < kIterations; ++i) {
+            auto snapshot = cache.snapshot();
+            const ConfigSection* limits = snapshot->find("risk", "limits");
+            total += limits->size();
+            reader.quiescent();
+        }
+    }
+    auto rcu_end = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < kIterations; ++i) {
+        auto snapshot = cache.snapshot();
+        const ConfigSection* limits = snapshot->find("risk", "limits");
+        total += limits->size();
+    }
+    auto mid = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < kIterations; ++i) {
+        total += cache.get_config("risk", "limits").size();
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    EXPECT_EQ(total, 6u * kIterations);
+
+    auto rcu_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(rcu_end - start).count();
+    auto snapshot_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(mid - rcu_end).count();
+    auto copy_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(end - mid).count();
+    std::cout << "ConfigCache snapshot lookup (RCU reader): " << static_cast<double>(rcu_ns) / kIterations
+              << " ns/op, (other threads): " << static_cast<double>(snapshot_ns) / kIterations << " ns/op, "
+              << "get_config copy: " << static_cast<double>(copy_ns) / kIterations << " ns/op" << std::endl;
+}
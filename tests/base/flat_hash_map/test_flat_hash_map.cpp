@@ -0,0 +1,114 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include "base/common/flat_hash_map/flat_hash_map.h"
+
+using namespace quant::base::common::flat_hash_map;
+
+// 基本功能测试
+TEST(FlatHashMapTest, BasicOperations) {
+    EXPECT_THROW((FlatHashMap<int, int>(0)), std::invalid_argument);
+
+    FlatHashMap<std::string, int> map(8);
+    EXPECT_TRUE(map.empty());
+    EXPECT_TRUE(map.insert("A1001", 1));
+    EXPECT_TRUE(map.insert("A1002", 2));
+    EXPECT_FALSE(map.insert("A1001", 3));  // 重复键插入失败
+    EXPECT_EQ(map.size(), 2);
+
+    ASSERT_NE(map.find("A1001"), nullptr);
+    EXPECT_EQ(*map.find("A1001"), 1);
+    EXPECT_EQ(map.find("A1003"), nullptr);
+
+    EXPECT_TRUE(map.erase("A1001"));
+    EXPECT_FALSE(map.erase("A1001"));
+    EXPECT_FALSE(map.contains("A1001"));
+    EXPECT_TRUE(map.contains("A1002"));
+
+    map.clear();
+    EXPECT_TRUE(map.empty());
+}
+
+// 容量上限测试
+TEST(FlatHashMapTest, MaxSize) {
+    FlatHashMap<int, int> map(4);
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_TRUE(map.insert(i, i));
+    }
+    EXPECT_FALSE(map.insert(100, 100));  // 已满，不扩容
+    EXPECT_TRUE(map.erase(0));
+    EXPECT_TRUE(map.insert(100, 100));
+}
+
+// 冲突链删除测试：所有键落在同一探测链上，删除后其余键仍可找到
+struct CollidingHash {
+    size_t operator()(int key) const { return static_cast<size_t>(key % 2); }
+};
+
+TEST(FlatHashMapTest, EraseKeepsProbeChain) {
+    FlatHashMap<int, int, CollidingHash> map(8);
+    for (int i = 0; i < 8; ++i) {
+        EXPECT_TRUE(map.insert(i, i * 10));
+    }
+    EXPECT_TRUE(map.erase(0));
+    EXPECT_TRUE(map.erase(3));
+    for (int i = 0; i < 8; ++i) {
+        if (i == 0 || i == 3) {
+            EXPECT_EQ(map.find(i), nullptr);
+        } else {
+            ASSERT_NE(map.find(i), nullptr);
+            EXPECT_EQ(*map.find(i), i * 10);
+        }
+    }
+}
+
+// 与 std::unordered_map 随机对照测试
+TEST(FlatHashMapTest, RandomizedAgainstUnorderedMap) {
+    FlatHashMap<uint64_t, uint64_t> map(512);
+    std::unordered_map<uint64_t, uint64_t> reference;
+    std::mt19937_64 rng(42);
+
+    for (int i = 0; i < 100000; ++i) {
+        uint64_t key = rng() % 1024;
+        if (rng() % 2 == 0) {
+            bool expected = reference.size() < 512 && reference.count(key) == 0;
+            EXPECT_EQ(map.insert(key, key + 1), expected);
+            if (expected) {
+                reference[key] = key + 1;
+            }
+        } else {
+            EXPECT_EQ(map.erase(key), reference.erase(key) == 1);
+        }
+    }
+    EXPECT_EQ(map.size(), reference.size());
+    for (const auto& entry : reference) {
+        ASSERT_NE(map.find(entry.first), nullptr);
+        EXPECT_EQ(*map.find(entry.first), entry.second);
+    }
+}
+
+// 性能测试
+TEST(FlatHashMapTest, PerformanceTest) {
+    const int kNumItems = 100000;
+    FlatHashMap<uint64_t, uint64_t> map(kNumItems);
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < kNumItems; ++i) {
+        map.insert(static_cast<uint64_t>(i) * 7919, i);
+    }
+    auto insert_end = std::chrono::high_resolution_clock::now();
+    uint64_t sum = 0;
+    for (int i = 0; i < kNumItems; ++i) {
+        sum += *map.find(static_cast<uint64_t>(i) * 7919);
+    }
+    auto find_end = std::chrono::high_resolution_clock::now();
+
+    auto insert_time = std::chrono::duration_cast<std::chrono::milliseconds>(insert_end - start).count();
+    auto find_time = std::chrono::duration_cast<std::chrono::milliseconds>(find_end - insert_end).count();
+    EXPECT_EQ(sum, static_cast<uint64_t>(kNumItems) * (kNumItems - 1) / 2);
+    std::cout << "FlatHashMap Performance:" << std::endl;
+    std::cout << "  inserted " << kNumItems << " items in " << insert_time << "ms" << std::endl;
+    std::cout << "  found " << kNumItems << " items in " << find_time << "ms" << std::endl;
+}
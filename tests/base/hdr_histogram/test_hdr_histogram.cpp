@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <random>
+#include <thread>
+#include "base/common/hdr_histogram/hdr_histogram.h"
+
+using namespace quant::base::common::hdr_histogram;
+
+// 分桶映射：小值精确，桶边界连续且覆盖整个 uint64 范围
+TEST(HdrHistogramTest, BucketMapping) {
+    for (uint64_t v = 0; v < 32; ++v) {
+        EXPECT_EQ(HdrHistogram::bucket_of(v), v);
+    }
+    EXPECT_EQ(HdrHistogram::bucket_of(32), 32u);
+    EXPECT_EQ(HdrHistogram::bucket_of(63), 63u);
+    EXPECT_EQ(HdrHistogram::bucket_of(~uint64_t(0)), HdrHistogram::kBucketCount - 1);
+
+    for (size_t b = 0; b + 1 < HdrHistogram::kBucketCount; ++b) {
+        EXPECT_EQ(HdrHistogram::bucket_upper(b) + 1, HdrHistogram::bucket_lower(b + 1));
+        EXPECT_EQ(HdrHistogram::bucket_of(HdrHistogram::bucket_lower(b)), b);
+        EXPECT_EQ(HdrHistogram::bucket_of(HdrHistogram::bucket_upper(b)), b);
+    }
+    EXPECT_EQ(HdrHistogram::bucket_upper(HdrHistogram::kBucketCount - 1), ~uint64_t(0));
+}
+
+// 百分位数：相对误差不超过 1/32
+TEST(HdrHistogramTest, PercentileAccuracy) {
+    auto histogram = std::make_unique<HdrHistogram>();
+    EXPECT_EQ(histogram->percentile(50.0), 0u);
+
+    for (uint64_t v = 1; v <= 100000; ++v) {
+        histogram->record(v);
+    }
+    EXPECT_EQ(histogram->count(), 100000u);
+    EXPECT_EQ(histogram->max(), 100000u);
+
+    const double cases[][2] = {{50.0, 50000.0}, {99.0, 99000.0}, {99.9, 99900.0}, {100.0, 100000.0}};
+    for (const auto& c : cases) {
+        double value = static_cast<double>(histogram->percentile(c[0]));
+        EXPECT_GE(value, c[1]);
+        EXPECT_LE(value, c[1] * (1.0 + 1.0 / 32.0)) << "p" << c[0];
+    }
+    EXPECT_NEAR(histogram->mean(), 50000.5, 50000.5 / 32.0);
+}
+
+// 合并与清零
+TEST(HdrHistogramTest, MergeAndReset) {
+    auto a = std::make_unique<HdrHistogram>();
+    auto b = std::make_unique<HdrHistogram>();
+    for (int i = 0; i < 90; ++i) {
+        a->record(10);
+    }
+    for (int i = 0; i < 10; ++i) {
+        b->record(1000);
+    }
+    a->merge(*b);
+    EXPECT_EQ(a->count(), 100u);
+    EXPECT_EQ(a->max(), 1000u);
+    EXPECT_EQ(a->percentile(90.0), 10u);
+    EXPECT_GE(a->percentile(95.0), 1000u);
+
+    a->reset();
+    EXPECT_EQ(a->count(), 0u);
+    EXPECT_EQ(a->max(), 0u);
+    EXPECT_EQ(a->percentile(99.0), 0u);
+}
+
+// 单写者记录的同时读者并发查询
+TEST(HdrHistogramTest, ConcurrentReader) {
+    auto histogram = std::make_unique<HdrHistogram>();
+    std::atomic<bool> done(false);
+    const uint64_t kSamples = 200000;
+
+    std::thread writer([&]() {
+        for (uint64_t i = 0; i < kSamples; ++i) {
+            histogram->record(i % 5000);
+        }
+        done.store(true, std::memory_order_release);
+    });
+
+    uint64_t last_count = 0;
+    while (!done.load(std::memory_order_acquire)) {
+        uint64_t count = histogram->count();
+        EXPECT_GE(count, last_count);
+        EXPECT_LE(histogram->percentile(99.0), 5000u);
+        last_count = count;
+        std::this_thread::yield();
+    }
+    writer.join();
+    EXPECT_EQ(histogram->count(), kSamples);
+    EXPECT_EQ(histogram->max(), 4999u);
+}
+
+// 性能测试：单次记录开销
+TEST(HdrHistogramTest, PerformanceTest) {
+    auto histogram = std::make_unique<HdrHistogram>();
+    std::mt19937_64 rng(42);
+    std::vector<uint64_t> values(1 << 16);
+    for (auto& value : values) {
+        value = rng() % 1000000;
+    }
+
+    const size_t kIterations = 10000000;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (size_t i = 0; i < kIterations; ++i) {
+        histogram->record(values[i & (values.size() - 1)]);
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+
+    EXPECT_EQ(histogram->count(), kIterations);
+    std::cout << "HdrHistogram record: " << static_cast<double>(ns) / kIterations << " ns/op, p99="
+              << histogram->percentile(99.0) << std::endl;
+}
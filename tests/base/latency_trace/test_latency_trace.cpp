@@ -0,0 +1,132 @@
+#define QT_ENABLE_LATENCY_TRACE
+#include <gtest/gtest.h>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+#include "base/utils/latency_trace/latency_trace.h"
+
+using namespace quant::base::utils::latency_trace;
+
+namespace {
+
+// 注册表为进程级单例，各用例使用互不重叠的阶段编号区分自己的数据
+const StageLatency* find_stage(const std::vector<StageLatency>& report, const std::string& name) {
+    for (const auto& stage : report) {
+        if (stage.name == name) {
+            return &stage;
+        }
+    }
+    return nullptr;
+}
+
+void busy_wait_ns(int64_t ns) {
+    auto until = std::chrono::steady_clock::now() + std::chrono::nanoseconds(ns);
+    while (std::chrono::steady_clock::now() < until) {
+    }
+}
+
+} // namespace
+
+// 时间戳：打点标记与计数器单调递增
+TEST(LatencyTraceTest, StampsAndMask) {
+    TraceStamps stamps;
+    EXPECT_FALSE(stamps.active());
+    stamps.stamp(2);
+    stamps.stamp(5);
+    EXPECT_TRUE(stamps.active());
+    EXPECT_TRUE(stamps.has(2));
+    EXPECT_TRUE(stamps.has(5));
+    EXPECT_FALSE(stamps.has(3));
+    EXPECT_LE(stamps.tsc[2], stamps.tsc[5]);
+    stamps.clear();
+    EXPECT_FALSE(stamps.active());
+    EXPECT_GT(quant::base::utils::tsc_clock::TscClock::ticks_per_ns(), 0.0);
+}
+
+// 没有活动跟踪时中间阶段不打点、不记录
+TEST(LatencyTraceTest, InactiveTraceIgnored) {
+    QT_TRACE_END();
+    QT_TRACE_STAGE(9);
+    EXPECT_FALSE(current_trace().active());
+    QT_TRACE_RECORD();
+    EXPECT_EQ(find_stage(TraceRegistry::instance().report(), "ignored"), nullptr);
+}
+
+// 跨线程跟踪：生产者打点后随事件交给消费者，消费者继续打点并记录
+TEST(LatencyTraceTest, CrossThreadRecord) {
+    auto& registry = TraceRegistry::instance();
+    registry.set_stage_name(10, "t_enqueue");
+    registry.set_stage_name(11, "t_handle");
+
+    const int kEvents = 200;
+    std::vector<TraceStamps> events(kEvents);
+    for (auto& event : events) {
+        QT_TRACE_BEGIN(8);
+        busy_wait_ns(2000);
+        QT_TRACE_STAGE(10);
+        QT_TRACE_CAPTURE(event);
+        QT_TRACE_END();
+    }
+
+    std::thread consumer([&]() {
+        for (const auto& event : events) {
+            QT_TRACE_RESUME(event);
+            busy_wait_ns(5000);
+            QT_TRACE_STAGE(11);
+            QT_TRACE_RECORD();
+        }
+    });
+    consumer.join();
+
+    auto report = registry.report();
+    const StageLatency* enqueue = find_stage(report, "t_enqueue");
+    const StageLatency* handle = find_stage(report, "t_handle");
+    ASSERT_NE(enqueue, nullptr);
+    ASSERT_NE(handle, nullptr);
+    EXPECT_EQ(enqueue->count, static_cast<uint64_t>(kEvents));
+    EXPECT_EQ(handle->count, static_cast<uint64_t>(kEvents));
+    // 标定误差与分桶误差之内，增量不小于忙等时间
+    EXPECT_GT(enqueue->p50_ns, 1500.0);
+    EXPECT_GT(handle->p50_ns, 4000.0);
+    EXPECT_LE(enqueue->p50_ns, enqueue->p99_ns);
+    EXPECT_LE(enqueue->p99_ns, enqueue->max_ns + 1.0);
+
+    const StageLatency* end_to_end = find_stage(report, "end_to_end");
+    ASSERT_NE(end_to_end, nullptr);
+    EXPECT_GE(end_to_end->count, static_cast<uint64_t>(kEvents));
+    EXPECT_NE(registry.format_report().find("t_handle"), std::string::npos);
+}
+
+// 周期性输出
+TEST(LatencyTraceTest, PeriodicDump) {
+    auto& registry = TraceRegistry::instance();
+    std::atomic<int> dumps(0);
+    registry.start_periodic_dump(std::chrono::milliseconds(10), [&](const std::string& text) {
+        EXPECT_NE(text.find("end_to_end"), std::string::npos);
+        dumps.fetch_add(1);
+    });
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (dumps.load() < 2 && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    registry.stop_periodic_dump();
+    EXPECT_GE(dumps.load(), 2);
+}
+
+// 性能测试：单阶段打点与一次完整记录的开销
+TEST(LatencyTraceTest, PerformanceTest) {
+    const int kIterations = 1000000;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < kIterations; ++i) {
+        QT_TRACE_BEGIN(12);
+        QT_TRACE_STAGE(13);
+        QT_TRACE_STAGE(14);
+        QT_TRACE_STAGE(15);
+        QT_TRACE_RECORD();
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+    std::cout << "Latency trace: " << static_cast<double>(ns) / kIterations
+              << " ns per 4-stage trace (stamp + record)" << std::endl;
+}
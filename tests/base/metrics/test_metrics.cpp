@@ -0,0 +1,240 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <unistd.h>
+#include "base/common/metrics/metrics.h"
+#include "base/common/safe_queue/safe_queue.h"
+#include "base/common/thread_pool/thread_pool.h"
+
+using namespace quant::base::common::metrics;
+
+namespace {
+
+std::unique_ptr<MetricsRegistry> make_registry(size_t max_shards = 64, const std::string& shm_name = "") {
+    MetricsOptions options;
+    options.shm_name = shm_name;
+    options.max_counters = 16;
+    options.max_gauges = 16;
+    options.max_histograms = 4;
+    options.max_shards = max_shards;
+    std::string error;
+    auto registry = MetricsRegistry::create(options, &error);
+    EXPECT_NE(registry, nullptr) << error;
+    return registry;
+}
+
+const MetricValue* find_metric(const std::vector<MetricValue>& metrics, const std::string& name) {
+    for (const auto& metric : metrics) {
+        if (metric.name == name) {
+            return &metric;
+        }
+    }
+    return nullptr;
+}
+
+std::string unique_shm_name(const char* tag) {
+    return std::string("/qt_metrics_test_") + tag + "_" + std::to_string(getpid());
+}
+
+}  // namespace
+
+// 注册：同名同类型返回同一指标，类型冲突/名称过长/容量耗尽返回无效句柄
+TEST(MetricsTest, Registration) {
+    auto registry = make_registry();
+    Counter a = registry->counter("orders.sent");
+    Counter b = registry->counter("orders.sent");
+    ASSERT_TRUE(a.valid());
+    a.add(3);
+    b.inc();
+    EXPECT_EQ(a.value(), 4u);
+    EXPECT_EQ(registry->metric_count(), 1u);
+
+    EXPECT_FALSE(registry->gauge("orders.sent").valid());
+    EXPECT_FALSE(registry->counter(std::string(kMaxMetricName, 'x')).valid());
+    EXPECT_FALSE(registry->counter("").valid());
+
+    for (int i = 1; i < 16; ++i) {
+        EXPECT_TRUE(registry->counter("c" + std::to_string(i)).valid());
+    }
+    EXPECT_FALSE(registry->counter("one_too_many").valid());
+
+    // 无效句柄上的操作为空操作
+    Counter invalid;
+    invalid.inc();
+    EXPECT_EQ(invalid.value(), 0u);
+    Gauge no_gauge;
+    no_gauge.set(5);
+    EXPECT_EQ(no_gauge.value(), 0);
+}
+
+// 多线程计数：各线程写独占分片，求和精确
+TEST(MetricsTest, ShardedCounterSums) {
+    auto registry = make_registry();
+    Counter counter = registry->counter("ticks");
+    const int kThreads = 4;
+    const uint64_t kPerThread = 100000;
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&]() {
+            for (uint64_t i = 0; i < kPerThread; ++i) {
+                counter.inc();
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(counter.value(), kThreads * kPerThread);
+
+    // 线程退出后分片归还，数值保留
+    EXPECT_EQ(registry->shards_in_use(), 0u);
+    auto metrics = registry->snapshot();
+    const MetricValue* ticks = find_metric(metrics, "ticks");
+    ASSERT_NE(ticks, nullptr);
+    EXPECT_EQ(ticks->value, static_cast<int64_t>(kThreads * kPerThread));
+}
+
+// 分片用尽时退化为共享分片 0，结果仍然正确
+TEST(MetricsTest, OverflowShard) {
+    auto registry = make_registry(2);
+    Counter counter = registry->counter("events");
+    const int kThreads = 4;
+    const uint64_t kPerThread = 50000;
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&]() {
+            for (uint64_t i = 0; i < kPerThread; ++i) {
+                counter.inc();
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(counter.value(), kThreads * kPerThread);
+}
+
+// 仪表与直方图
+TEST(MetricsTest, GaugeAndHistogram) {
+    auto registry = make_registry();
+    Gauge depth = registry->gauge("queue.depth");
+    depth.set(42);
+    depth.add(-2);
+    EXPECT_EQ(depth.value(), 40);
+
+    Histogram latency = registry->histogram("latency_ns");
+    EXPECT_EQ(Histogram::bucket_of(0), 0u);
+    EXPECT_EQ(Histogram::bucket_of(1), 1u);
+    EXPECT_EQ(Histogram::bucket_of(1023), 10u);
+    EXPECT_EQ(Histogram::bucket_of(1024), 11u);
+    EXPECT_EQ(Histogram::bucket_of(~uint64_t(0)), 64u);
+    for (uint64_t v = 1; v <= 1000; ++v) {
+        latency.record(v);
+    }
+
+    auto metrics = registry->snapshot();
+    const MetricValue* gauge = find_metric(metrics, "queue.depth");
+    const MetricValue* histogram = find_metric(metrics, "latency_ns");
+    ASSERT_NE(gauge, nullptr);
+    ASSERT_NE(histogram, nullptr);
+    EXPECT_EQ(gauge->type, MetricType::kGauge);
+    EXPECT_EQ(gauge->value, 40);
+    EXPECT_EQ(histogram->value, 1000);
+    EXPECT_EQ(histogram->sum, 500500u);
+    EXPECT_EQ(histogram->percentile(50.0), 511u);    // 第 500 个样本落在 [256, 512)
+    EXPECT_EQ(histogram->percentile(99.9), 1023u);
+
+    std::string text = format_metrics(metrics);
+    EXPECT_NE(text.find("queue.depth"), std::string::npos);
+    EXPECT_NE(text.find("count=1000"), std::string::npos);
+}
+
+// 跨进程读取：读者打开同名共享内存段，看到写者的实时数值与后续注册的指标
+TEST(MetricsTest, SharedMemoryReader) {
+    std::string name = unique_shm_name("reader");
+    auto registry = make_registry(8, name);
+    ASSERT_NE(registry, nullptr);
+    Counter counter = registry->counter("data_source.CTP.ticks");
+    counter.add(7);
+
+    std::string error;
+    auto reader = MetricsReader::open(name, &error);
+    ASSERT_NE(reader, nullptr) << error;
+    EXPECT_EQ(reader->writer_pid(), getpid());
+
+    auto metrics = reader->snapshot();
+    const MetricValue* ticks = find_metric(metrics, "data_source.CTP.ticks");
+    ASSERT_NE(ticks, nullptr);
+    EXPECT_EQ(ticks->value, 7);
+
+    counter.add(3);
+    registry->gauge("late.gauge").set(9);
+    metrics = reader->snapshot();
+    EXPECT_EQ(find_metric(metrics, "data_source.CTP.ticks")->value, 10);
+    ASSERT_NE(find_metric(metrics, "late.gauge"), nullptr);
+    EXPECT_EQ(find_metric(metrics, "late.gauge")->value, 9);
+
+    // 注册表析构时删除共享内存段
+    registry.reset();
+    EXPECT_EQ(MetricsReader::open(name), nullptr);
+    EXPECT_EQ(MetricsReader::open("/qt_metrics_test_missing"), nullptr);
+}
+
+// 队列与线程池埋点：深度仪表与完成任务计数
+TEST(MetricsTest, QueueAndThreadPoolInstrumentation) {
+    auto& registry = MetricsRegistry::instance();
+    quant::base::common::safe_queue::SafeQueue<int> queue;
+    Gauge depth = registry.gauge("test.queue.depth");
+    queue.bind_depth_gauge(depth);
+    queue.push(1);
+    queue.push(2);
+    EXPECT_EQ(depth.value(), 2);
+    int value = 0;
+    queue.pop(value);
+    EXPECT_EQ(depth.value(), 1);
+
+    {
+        auto pool = quant::base::common::thread_pool::ThreadPool::create(2, "metrics_test");
+        for (int i = 0; i < 100; ++i) {
+            pool->submit([]() {});
+        }
+        pool->wait_all();
+    }
+    auto metrics = registry.snapshot();
+    const MetricValue* completed = find_metric(metrics, "thread_pool.metrics_test.tasks_completed");
+    const MetricValue* pool_depth = find_metric(metrics, "thread_pool.metrics_test.queue_depth");
+    ASSERT_NE(completed, nullptr);
+    ASSERT_NE(pool_depth, nullptr);
+    EXPECT_EQ(completed->value, 100);
+    EXPECT_EQ(pool_depth->value, 0);
+}
+
+// 性能测试：计数器、直方图写入开销
+TEST(MetricsTest, PerformanceTest) {
+    auto registry = make_registry();
+    Counter counter = registry->counter("perf.counter");
+    Histogram histogram = registry->histogram("perf.histogram");
+    const uint64_t kIterations = 10000000;
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (uint64_t i = 0; i < kIterations; ++i) {
+        counter.inc();
+    }
+    auto mid = std::chrono::high_resolution_clock::now();
+    for (uint64_t i = 0; i < kIterations; ++i) {
+        histogram.record(i & 0xffff);
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+
+    EXPECT_EQ(counter.value(), kIterations);
+    auto counter_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(mid - start).count();
+    auto histogram_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(end - mid).count();
+    std::cout << "Counter add: " << static_cast<double>(counter_ns) / kIterations << " ns/op, "
+              << "Histogram record: " << static_cast<double>(histogram_ns) / kIterations << " ns/op" << std::endl;
+}
@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <string>
+#include <vector>
+#include "base/common/object_pool/object_pool.h"
+
+using namespace quant::base::common::object_pool;
+
+// 基本功能测试
+TEST(ObjectPoolTest, BasicOperations) {
+    EXPECT_THROW(ObjectPool<int>(0), std::invalid_argument);
+    // 容量达到空闲链表结束标记时下标回绕：在分配槽位数组之前拒绝
+    EXPECT_THROW(ObjectPool<int>(static_cast<size_t>(UINT32_MAX)), std::invalid_argument);
+    EXPECT_THROW(ObjectPool<int>(static_cast<size_t>(UINT32_MAX) + 1), std::invalid_argument);
+
+    ObjectPool<std::string> pool(4);
+    EXPECT_EQ(pool.capacity(), 4);
+    EXPECT_EQ(pool.size(), 0);
+
+    auto handle = pool.acquire();
+    ASSERT_NE(handle, ObjectPool<std::string>::kInvalidHandle);
+    ASSERT_NE(pool.get(handle), nullptr);
+    *pool.get(handle) = "order-1";
+    EXPECT_EQ(*pool.get(handle), "order-1");
+    EXPECT_EQ(pool.size(), 1);
+    EXPECT_EQ(pool.available(), 3);
+
+    EXPECT_TRUE(pool.release(handle));
+    EXPECT_EQ(pool.size(), 0);
+    EXPECT_FALSE(pool.release(handle));  // 重复归还失败
+}
+
+// 耗尽与槽位复用测试
+TEST(ObjectPoolTest, ExhaustionAndReuse) {
+    ObjectPool<int> pool(3);
+    std::vector<ObjectPool<int>::Handle> handles;
+    for (int i = 0; i < 3; ++i) {
+        handles.push_back(pool.acquire());
+        *pool.get(handles.back()) = i;
+    }
+    EXPECT_EQ(pool.acquire(), ObjectPool<int>::kInvalidHandle);  // 池耗尽
+
+    EXPECT_TRUE(pool.release(handles[1]));
+    auto reused = pool.acquire();
+    ASSERT_NE(reused, ObjectPool<int>::kInvalidHandle);
+    EXPECT_EQ(ObjectPool<int>::index_of(reused), ObjectPool<int>::index_of(handles[1]));
+    EXPECT_EQ(*pool.get(reused), 0);  // 复用的对象已重置
+    EXPECT_EQ(*pool.get(handles[0]), 0);
+    EXPECT_EQ(*pool.get(handles[2]), 2);
+}
+
+// 旧句柄失效测试
+TEST(ObjectPoolTest, StaleHandle) {
+    ObjectPool<int> pool(1);
+    auto first = pool.acquire();
+    pool.release(first);
+    auto second = pool.acquire();
+
+    EXPECT_NE(first, second);              // 同一槽位，代数不同
+    EXPECT_EQ(pool.get(first), nullptr);   // 旧句柄不能访问新对象
+    EXPECT_FALSE(pool.release(first));
+    EXPECT_NE(pool.get(second), nullptr);
+    EXPECT_EQ(pool.get(ObjectPool<int>::kInvalidHandle), nullptr);
+}
+
+// 性能测试
+TEST(ObjectPoolTest, PerformanceTest) {
+    const int kNumItems = 1000000;
+    ObjectPool<std::string> pool(1024);
+    std::vector<ObjectPool<std::string>::Handle> handles(1024);
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < kNumItems; i += 1024) {
+        for (auto& handle : handles) {
+            handle = pool.acquire();
+        }
+        for (auto handle : handles) {
+            pool.release(handle);
+        }
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+
+    EXPECT_EQ(pool.size(), 0);
+    std::cout << "ObjectPool Performance:" << std::endl;
+    std::cout << "  acquired/released " << kNumItems << " objects in " << elapsed << "ms" << std::endl;
+}
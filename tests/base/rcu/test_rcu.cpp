@@ -0,0 +1,129 @@
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <memory>
+#include "base/common/rcu/rcu.h"
+
+using namespace quant::base::common::rcu;
+
+namespace {
+
+// 记录析构次数的快照对象，b 恒等于 a * 2（用于校验读者看到的是完整快照）
+struct Snapshot {
+    Snapshot(int value, std::atomic<int>& counter) : a(value), b(value * 2), destroyed(counter) {}
+    ~Snapshot() { destroyed++; }
+    int a;
+    int b;
+    std::atomic<int>& destroyed;
+};
+
+}  // namespace
+
+// 基本功能测试：发布后读到新对象，无读者时旧对象立即回收
+TEST(RcuTest, PublishAndReclaimWithoutReaders) {
+    RcuDomain domain;
+    std::atomic<int> destroyed(0);
+    {
+        RcuCell<Snapshot> cell(std::make_unique<Snapshot>(1, destroyed), domain);
+        EXPECT_EQ(cell.load()->a, 1);
+
+        cell.publish(std::make_unique<Snapshot>(2, destroyed));
+        EXPECT_EQ(cell.load()->a, 2);
+        EXPECT_EQ(destroyed, 1);
+        EXPECT_EQ(domain.pending(), 0);
+    }
+    EXPECT_EQ(destroyed, 2);  // 析构时回收当前对象
+}
+
+// 在线读者未经过静止状态前，旧对象不得回收
+TEST(RcuTest, DeferUntilQuiescent) {
+    RcuDomain domain;
+    std::atomic<int> destroyed(0);
+    RcuCell<Snapshot> cell(std::make_unique<Snapshot>(1, destroyed), domain);
+    RcuReader reader(domain);
+    ASSERT_TRUE(reader.valid());
+
+    const Snapshot* held = cell.load();
+    cell.publish(std::make_unique<Snapshot>(2, destroyed));
+    EXPECT_EQ(destroyed, 0);
+    EXPECT_EQ(domain.pending(), 1);
+    EXPECT_EQ(held->a, 1);  // 读者持有的旧对象仍然有效
+
+    reader.quiescent();
+    EXPECT_EQ(domain.reclaim(), 1);
+    EXPECT_EQ(destroyed, 1);
+}
+
+// 离线读者不阻塞回收，重新上线后读到最新对象
+TEST(RcuTest, OfflineReaderDoesNotBlock) {
+    RcuDomain domain;
+    std::atomic<int> destroyed(0);
+    RcuCell<Snapshot> cell(std::make_unique<Snapshot>(1, destroyed), domain);
+    RcuReader reader(domain);
+
+    reader.offline();
+    cell.publish(std::make_unique<Snapshot>(2, destroyed));
+    EXPECT_EQ(destroyed, 1);
+
+    reader.online();
+    EXPECT_EQ(cell.load()->a, 2);
+}
+
+// 读者槽位用尽时注册失败
+TEST(RcuTest, ReaderSlotsExhausted) {
+    RcuDomain domain;
+    std::vector<int> readers;
+    for (size_t i = 0; i < RcuDomain::kMaxReaders; ++i) {
+        int id = domain.register_reader();
+        ASSERT_GE(id, 0);
+        readers.push_back(id);
+    }
+    EXPECT_EQ(domain.register_reader(), -1);
+
+    domain.unregister_reader(readers.back());
+    EXPECT_GE(domain.register_reader(), 0);
+}
+
+// 并发测试：多个读者持续读取，写者持续发布，读者始终看到完整快照，且全部对象最终被回收
+TEST(RcuTest, ConcurrentReadersAndWriter) {
+    RcuDomain domain;
+    std::atomic<int> destroyed(0);
+    const int kNumReaders = 4;
+    const int kNumPublishes = 20000;
+    std::atomic<bool> done(false);
+    std::atomic<int> inconsistent(0);
+
+    {
+        RcuCell<Snapshot> cell(std::make_unique<Snapshot>(0, destroyed), domain);
+        std::vector<std::thread> readers;
+        for (int i = 0; i < kNumReaders; ++i) {
+            readers.emplace_back([&]() {
+                RcuReader reader(domain);
+                int last = 0;
+                while (!done) {
+                    const Snapshot* snapshot = cell.load();
+                    if (snapshot->b != snapshot->a * 2 || snapshot->a < last) {
+                        inconsistent++;
+                    }
+                    last = snapshot->a;
+                    reader.quiescent();
+                }
+                reader.offline();
+            });
+        }
+
+        for (int i = 1; i <= kNumPublishes; ++i) {
+            cell.publish(std::make_unique<Snapshot>(i, destroyed));
+        }
+        done = true;
+        for (auto& t : readers) {
+            t.join();
+        }
+        domain.synchronize();
+        EXPECT_EQ(destroyed, kNumPublishes);
+    }
+
+    EXPECT_EQ(inconsistent, 0);
+    EXPECT_EQ(destroyed, kNumPublishes + 1);
+}
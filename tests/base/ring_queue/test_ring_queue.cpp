@@ -0,0 +1,203 @@
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <algorithm>
+#include "base/common/ring_queue/ring_queue.h"
+
+using namespace quant::base::common::ring_queue;
+
+// 基本功能测试
+TEST(RingQueueTest, BasicOperations) {
+    RingQueue<int> queue(8);
+
+    // 初始状态应为空
+    EXPECT_TRUE(queue.empty());
+    EXPECT_EQ(queue.capacity(), 8);
+
+    // 入队操作
+    EXPECT_TRUE(queue.push(10));
+    EXPECT_TRUE(queue.push(20));
+    EXPECT_EQ(queue.size(), 2);
+
+    // 出队操作（FIFO）
+    int value;
+    EXPECT_TRUE(queue.pop(value));
+    EXPECT_EQ(value, 10);
+    EXPECT_TRUE(queue.pop(value));
+    EXPECT_EQ(value, 20);
+
+    // 队列应为空
+    EXPECT_FALSE(queue.pop(value));
+    EXPECT_TRUE(queue.empty());
+}
+
+// 容量向上取整与队满测试
+TEST(RingQueueTest, CapacityAndFull) {
+    EXPECT_THROW(RingQueue<int>(0), std::invalid_argument);
+
+    RingQueue<int> queue(5);
+    EXPECT_EQ(queue.capacity(), 8);  // 向上取整为 2 的幂
+
+    for (int i = 0; i < 8; ++i) {
+        EXPECT_TRUE(queue.push(i));
+    }
+    EXPECT_FALSE(queue.push(100));  // 队满时不阻塞，直接失败
+
+    // 出队一个后可以继续入队（环形复用槽位）
+    int value;
+    EXPECT_TRUE(queue.pop(value));
+    EXPECT_EQ(value, 0);
+    EXPECT_TRUE(queue.push(8));
+
+    for (int i = 1; i <= 8; ++i) {
+        EXPECT_TRUE(queue.pop(value));
+        EXPECT_EQ(value, i);
+    }
+}
+
+// 移动语义测试
+TEST(RingQueueTest, MoveSemantics) {
+    RingQueue<std::string> queue(4);
+    std::string str = "test string";
+
+    EXPECT_TRUE(queue.push(std::move(str)));
+    EXPECT_TRUE(str.empty());  // 原字符串应被移动
+
+    std::string result;
+    EXPECT_TRUE(queue.pop(result));
+    EXPECT_EQ(result, "test string");
+}
+
+namespace {
+
+// 统计构造/赋值/析构次数的元素类型
+struct Tracked {
+    static int constructed;
+    static int assigned;
+    static int destroyed;
+
+    explicit Tracked(int v = 0) : value(v) { ++constructed; }
+    Tracked(const Tracked& other) : value(other.value) { ++constructed; }
+    Tracked(Tracked&& other) noexcept : value(other.value) { ++constructed; }
+    Tracked& operator=(const Tracked& other) { value = other.value; ++assigned; return *this; }
+    Tracked& operator=(Tracked&& other) noexcept { value = other.value; ++assigned; return *this; }
+    ~Tracked() { ++destroyed; }
+
+    int value;
+};
+
+int Tracked::constructed = 0;
+int Tracked::assigned = 0;
+int Tracked::destroyed = 0;
+
+} // namespace
+
+// 原地构造：入队直接在槽位上构造元素（不经过临时对象与赋值），空槽位不持有元素，
+// 析构时销毁尚未取走的元素
+TEST(RingQueueTest, EmplaceConstructsInPlace) {
+    Tracked::constructed = Tracked::assigned = Tracked::destroyed = 0;
+    {
+        RingQueue<Tracked> queue(4);
+        EXPECT_EQ(Tracked::constructed, 0);
+
+        EXPECT_TRUE(queue.emplace(1));
+        EXPECT_EQ(Tracked::constructed, 1);
+        Tracked moved(2);
+        EXPECT_TRUE(queue.push(std::move(moved)));
+        EXPECT_EQ(Tracked::constructed, 3);
+        EXPECT_EQ(Tracked::assigned, 0);
+
+        Tracked out;
+        EXPECT_TRUE(queue.pop(out));
+        EXPECT_EQ(out.value, 1);
+        EXPECT_EQ(Tracked::assigned, 1);
+        EXPECT_TRUE(queue.emplace(3));
+    }
+    // 2 个留在队列中的元素 + moved + out + 已出队的 1 个
+    EXPECT_EQ(Tracked::destroyed, Tracked::constructed);
+}
+
+// 多生产者多消费者测试：所有元素恰好被消费一次
+TEST(RingQueueTest, MultipleProducersConsumers) {
+    RingQueue<int> queue(1024);
+    const int kNumProducers = 4;
+    const int kNumConsumers = 2;
+    const int kItemsPerProducer = 20000;
+    std::vector<std::thread> producers;
+    std::vector<std::thread> consumers;
+    std::atomic<int> producers_done(0);
+    std::vector<std::vector<int>> consumed(kNumConsumers);
+
+    for (int i = 0; i < kNumProducers; ++i) {
+        producers.emplace_back([&, i]() {
+            for (int j = 0; j < kItemsPerProducer; ++j) {
+                while (!queue.push(i * kItemsPerProducer + j)) {
+                    std::this_thread::yield();  // 队满时退避
+                }
+            }
+            producers_done++;
+        });
+    }
+
+    for (int i = 0; i < kNumConsumers; ++i) {
+        consumers.emplace_back([&, i]() {
+            int value;
+            while (producers_done < kNumProducers || !queue.empty()) {
+                if (queue.pop(value)) {
+                    consumed[i].push_back(value);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    for (auto& t : producers) {
+        t.join();
+    }
+    for (auto& t : consumers) {
+        t.join();
+    }
+
+    std::vector<int> results;
+    for (const auto& part : consumed) {
+        results.insert(results.end(), part.begin(), part.end());
+    }
+    ASSERT_EQ(results.size(), static_cast<size_t>(kNumProducers * kItemsPerProducer));
+    std::sort(results.begin(), results.end());
+    for (size_t i = 0; i < results.size(); ++i) {
+        EXPECT_EQ(results[i], static_cast<int>(i));
+    }
+}
+
+// 性能测试（可选）
+TEST(RingQueueTest, PerformanceTest) {
+    const int kNumItems = 1000000;
+    RingQueue<int> queue(kNumItems);
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < kNumItems; ++i) {
+        queue.push(i);
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    auto push_time = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+
+    start = std::chrono::high_resolution_clock::now();
+    int value;
+    int count = 0;
+    while (queue.pop(value)) {
+        count++;
+    }
+    end = std::chrono::high_resolution_clock::now();
+    auto pop_time = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+
+    EXPECT_EQ(count, kNumItems);
+
+    // 输出性能指标（仅作参考）
+    std::cout << "RingQueue Performance:" << std::endl;
+    std::cout << "  pushd " << kNumItems << " items in " << push_time << "ms" << std::endl;
+    std::cout << "  popd " << kNumItems << " items in " << pop_time << "ms" << std::endl;
+}
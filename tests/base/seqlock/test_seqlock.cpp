@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <chrono>
+#include "base/common/seqlock/seqlock.h"
+
+using namespace quant::base::common::seqlock;
+
+namespace {
+
+// 所有字段由写者写成同一个值，读者读到不一致的字段即说明读到了“撕裂”的快照
+struct Sample {
+    uint64_t values[7];
+    double price;
+};
+
+Sample make_sample(uint64_t n) {
+    Sample sample;
+    for (auto& value : sample.values) {
+        value = n;
+    }
+    sample.price = static_cast<double>(n) * 0.5;
+    return sample;
+}
+
+bool consistent(const Sample& sample) {
+    for (auto value : sample.values) {
+        if (value != sample.values[0]) {
+            return false;
+        }
+    }
+    return sample.price == static_cast<double>(sample.values[0]) * 0.5;
+}
+
+} // namespace
+
+// 基本功能测试
+TEST(SeqLockTest, BasicOperations) {
+    SeqLock<Sample> lock(make_sample(1));
+    EXPECT_EQ(lock.version(), 0u);
+    EXPECT_EQ(lock.load().values[3], 1u);
+
+    lock.store(make_sample(2));
+    EXPECT_EQ(lock.version(), 1u);
+    Sample out;
+    EXPECT_TRUE(lock.try_load(out));
+    EXPECT_EQ(out.values[0], 2u);
+
+    lock.update([](Sample& sample) { sample.price = 9.0; });
+    EXPECT_EQ(lock.version(), 2u);
+    EXPECT_EQ(lock.load().price, 9.0);
+    EXPECT_EQ(lock.load().values[6], 2u);
+}
+
+// 单写者 + 多读者压力测试：读者永远读到一致的快照，且版本单调不减
+TEST(SeqLockTest, ConcurrentReadersSeeConsistentSnapshots) {
+    const int kNumReaders = 4;
+    const uint64_t kNumWrites = 200000;
+    SeqLock<Sample> lock(make_sample(0));
+    std::atomic<bool> done(false);
+    std::atomic<uint64_t> torn(0);
+    std::atomic<uint64_t> reads(0);
+    std::vector<std::thread> readers;
+
+    for (int i = 0; i < kNumReaders; ++i) {
+        readers.emplace_back([&]() {
+            uint64_t last = 0;
+            uint64_t local_reads = 0;
+            // 至少读取一次：单核环境下读者可能在写者结束后才被调度
+            do {
+                Sample sample = lock.load();
+                if (!consistent(sample) || sample.values[0] < last) {
+                    torn.fetch_add(1, std::memory_order_relaxed);
+                }
+                last = sample.values[0];
+                ++local_reads;
+            } while (!done.load(std::memory_order_acquire));
+            reads.fetch_add(local_reads, std::memory_order_relaxed);
+        });
+    }
+
+    for (uint64_t n = 1; n <= kNumWrites; ++n) {
+        lock.store(make_sample(n));
+    }
+    done.store(true, std::memory_order_release);
+    for (auto& t : readers) {
+        t.join();
+    }
+
+    EXPECT_EQ(torn.load(), 0u);
+    EXPECT_GT(reads.load(), 0u);
+    EXPECT_EQ(lock.load().values[0], kNumWrites);
+    EXPECT_EQ(lock.version(), kNumWrites);
+}
+
+// 性能测试
+TEST(SeqLockTest, PerformanceTest) {
+    const int kNumItems = 1000000;
+    SeqLock<Sample> lock;
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < kNumItems; ++i) {
+        lock.store(make_sample(i));
+    }
+    auto store_end = std::chrono::high_resolution_clock::now();
+    uint64_t sum = 0;
+    for (int i = 0; i < kNumItems; ++i) {
+        sum += lock.load().values[0];
+    }
+    auto load_end = std::chrono::high_resolution_clock::now();
+
+    auto store_time = std::chrono::duration_cast<std::chrono::milliseconds>(store_end - start).count();
+    auto load_time = std::chrono::duration_cast<std::chrono::milliseconds>(load_end - store_end).count();
+    EXPECT_EQ(sum, static_cast<uint64_t>(kNumItems - 1) * kNumItems);
+    std::cout << "SeqLock Performance:" << std::endl;
+    std::cout << "  stored " << kNumItems << " snapshots in " << store_time << "ms" << std::endl;
+    std::cout << "  loaded " << kNumItems << " snapshots in " << load_time << "ms" << std::endl;
+}
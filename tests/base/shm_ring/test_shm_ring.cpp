@@ -0,0 +1,304 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "base/common/shm_ring/shm_ring.h"
+#include "base/utils/tick_bus/tick_bus.h"
+
+using namespace quant::base::common::shm_ring;
+using namespace quant::base::utils::tick_bus;
+
+namespace {
+
+struct Message {
+    uint64_t seq;
+    uint64_t payload[7];        // 全部等于 seq，用于检测撕裂
+};
+
+std::string unique_name(const char* tag) {
+    return std::string("/qt_shm_ring_test_") + tag + "_" + std::to_string(getpid());
+}
+
+std::unique_ptr<ShmRingWriter> make_writer(const std::string& name, size_t capacity, size_t slot_bytes = 64) {
+    ShmRingOptions options;
+    options.name = name;
+    options.capacity = capacity;
+    options.slot_bytes = slot_bytes;
+    std::string error;
+    auto writer = ShmRingWriter::create(options, &error);
+    EXPECT_NE(writer, nullptr) << error;
+    return writer;
+}
+
+Message make_message(uint64_t seq) {
+    Message message;
+    message.seq = seq;
+    for (auto& value : message.payload) {
+        value = seq;
+    }
+    return message;
+}
+
+}  // namespace
+
+// 基本收发：每个读者独立游标，kLatest 只看打开之后的消息
+TEST(ShmRingTest, IndependentCursors) {
+    std::string name = unique_name("cursors");
+    auto writer = make_writer(name, 16);
+    ASSERT_NE(writer, nullptr);
+    EXPECT_EQ(writer->capacity(), 16u);
+    writer->publish(make_message(0));
+
+    auto from_oldest = ShmRingReader::open(name, ShmRingReader::Start::kOldest);
+    auto from_latest = ShmRingReader::open(name, ShmRingReader::Start::kLatest);
+    ASSERT_NE(from_oldest, nullptr);
+    ASSERT_NE(from_latest, nullptr);
+    EXPECT_EQ(from_oldest->writer_pid(), getpid());
+
+    for (uint64_t i = 1; i <= 5; ++i) {
+        ASSERT_TRUE(writer->publish(make_message(i)));
+    }
+    Message message;
+    std::vector<uint64_t> oldest;
+    while (from_oldest->next(message)) {
+        oldest.push_back(message.seq);
+    }
+    std::vector<uint64_t> latest;
+    while (from_latest->next(message)) {
+        latest.push_back(message.seq);
+    }
+    EXPECT_EQ(oldest, (std::vector<uint64_t>{0, 1, 2, 3, 4, 5}));
+    EXPECT_EQ(latest, (std::vector<uint64_t>{1, 2, 3, 4, 5}));
+    EXPECT_EQ(from_oldest->lost(), 0u);
+
+    // 零拷贝读取与超长消息
+    writer->publish(make_message(6));
+    uint64_t seen = 0;
+    EXPECT_TRUE(from_latest->poll([&seen](const uint8_t* data, size_t size) {
+        EXPECT_EQ(size, sizeof(Message));
+        std::memcpy(&seen, data, sizeof(seen));
+    }));
+    EXPECT_EQ(seen, 6u);
+    EXPECT_FALSE(from_latest->poll([](const uint8_t*, size_t) {}));
+    std::vector<uint8_t> too_big(65);
+    EXPECT_FALSE(writer->publish(too_big.data(), too_big.size()));
+
+    // 写者析构后段被删除
+    from_oldest.reset();
+    from_latest.reset();
+    writer.reset();
+    EXPECT_EQ(ShmRingReader::open(name), nullptr);
+}
+
+// 慢读者被超车：检测并计入 lost()，之后读到的消息连续且完整
+TEST(ShmRingTest, OverrunDetection) {
+    std::string name = unique_name("overrun");
+    auto writer = make_writer(name, 8);
+    auto reader = ShmRingReader::open(name, ShmRingReader::Start::kLatest);
+    ASSERT_NE(reader, nullptr);
+
+    for (uint64_t i = 0; i < 100; ++i) {
+        writer->publish(make_message(i));
+    }
+    Message message;
+    std::vector<uint64_t> seen;
+    while (reader->cursor() < reader->head()) {
+        if (reader->next(message)) {
+            seen.push_back(message.seq);
+        }
+    }
+    ASSERT_FALSE(seen.empty());
+    EXPECT_EQ(seen.back(), 99u);
+    EXPECT_EQ(seen.size() + reader->lost(), 100u);
+    for (size_t i = 1; i < seen.size(); ++i) {
+        EXPECT_EQ(seen[i], seen[i - 1] + 1);
+    }
+}
+
+// 并发写读：读者看到的每条消息内部一致，序号单调
+TEST(ShmRingTest, ConcurrentNoTornReads) {
+    std::string name = unique_name("torn");
+    auto writer = make_writer(name, 64);
+    auto reader = ShmRingReader::open(name, ShmRingReader::Start::kOldest);
+    ASSERT_NE(reader, nullptr);
+
+    const uint64_t kMessages = 200000;
+    std::thread producer([&]() {
+        for (uint64_t i = 0; i < kMessages; ++i) {
+            writer->publish(make_message(i));
+        }
+    });
+    uint64_t received = 0;
+    uint64_t last = 0;
+    bool first = true;
+    Message message;
+    while (received + reader->lost() < kMessages) {
+        if (!reader->next(message)) {
+            std::this_thread::yield();
+            continue;
+        }
+        for (auto value : message.payload) {
+            ASSERT_EQ(value, message.seq);
+        }
+        if (!first) {
+            ASSERT_GT(message.seq, last);
+        }
+        first = false;
+        last = message.seq;
+        ++received;
+    }
+    producer.join();
+    EXPECT_EQ(received + reader->lost(), kMessages);
+}
+
+// 单写者守卫：两个线程误用同一个写者时，并发的一方被拒绝并计数，已发布的消息不会撕裂
+TEST(ShmRingTest, SingleWriterEnforced) {
+    std::string name = unique_name("single_writer");
+    auto writer = make_writer(name, 16);
+    ASSERT_NE(writer, nullptr);
+
+    const uint64_t kAttempts = 100000;
+    std::atomic<uint64_t> accepted{0};
+    auto produce = [&](uint64_t base) {
+        for (uint64_t i = 0; i < kAttempts; ++i) {
+            if (writer->publish(make_message(base + i))) {
+                accepted.fetch_add(1);
+            }
+        }
+    };
+    std::thread first(produce, 0);
+    std::thread second(produce, kAttempts);
+    first.join();
+    second.join();
+    EXPECT_EQ(accepted.load() + writer->contended(), 2 * kAttempts);
+    EXPECT_EQ(writer->published(), accepted.load());
+
+    auto reader = ShmRingReader::open(name, ShmRingReader::Start::kOldest);
+    ASSERT_NE(reader, nullptr);
+    Message message;
+    size_t checked = 0;
+    while (reader->next(message)) {
+        for (auto value : message.payload) {
+            ASSERT_EQ(value, message.seq);
+        }
+        ++checked;
+    }
+    EXPECT_GT(checked, 0u);
+}
+
+// 跨进程：子进程只读映射并校验内容，通过退出码回报
+TEST(ShmRingTest, CrossProcessReader) {
+    std::string name = unique_name("process");
+    auto publisher = TickBusPublisher::create(name, 1024);
+    ASSERT_NE(publisher, nullptr);
+
+    const int kTicks = 500;
+    pid_t child = fork();
+    ASSERT_GE(child, 0);
+    if (child == 0) {
+        auto reader = TickBusReader::open(name, TickBusReader::Start::kOldest);
+        if (!reader) {
+            _exit(2);
+        }
+        int received = 0;
+        BusTick tick;
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+        while (received < kTicks && std::chrono::steady_clock::now() < deadline) {
+            if (!reader->next(tick)) {
+                std::this_thread::yield();
+                continue;
+            }
+            if (std::strcmp(tick.instrument, "rb2410") != 0 || tick.volume != received ||
+                tick.publish_ns <= 0) {
+                _exit(3);
+            }
+            ++received;
+        }
+        _exit(received == kTicks && reader->lost() == 0 ? 0 : 4);
+    }
+
+    quant::base::data_types::TickData tick{};
+    tick.instrument = "rb2410";
+    tick.last_price = 3500.0;
+    for (int i = 0; i < kTicks; ++i) {
+        tick.volume = i;
+        ASSERT_TRUE(publisher->publish(tick));
+        if (i % 50 == 0) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+    int status = 0;
+    ASSERT_EQ(waitpid(child, &status, 0), child);
+    ASSERT_TRUE(WIFEXITED(status));
+    EXPECT_EQ(WEXITSTATUS(status), 0);
+}
+
+// 行情记录转换
+TEST(ShmRingTest, BusTickConversion) {
+    quant::base::data_types::TickData tick{};
+    tick.instrument = "IF2409";
+    tick.timestamp = std::chrono::system_clock::time_point(std::chrono::seconds(1700000000));
+    tick.last_price = 3456.2;
+    tick.volume = 123;
+    tick.bid_price[0] = 3456.0;
+    tick.bid_volume[4] = 7;
+    tick.ask_price[2] = 3457.4;
+    tick.pre_close_price = 3400.0;
+
+    BusTick record;
+    to_bus_tick(tick, record);
+    EXPECT_EQ(record.version, kBusTickVersion);
+    EXPECT_EQ(record.timestamp_ns, 1700000000LL * 1000000000LL);
+
+    quant::base::data_types::TickData back{};
+    from_bus_tick(record, back);
+    EXPECT_EQ(back.instrument, "IF2409");
+    EXPECT_EQ(back.timestamp, tick.timestamp);
+    EXPECT_DOUBLE_EQ(back.last_price, 3456.2);
+    EXPECT_EQ(back.volume, 123);
+    EXPECT_EQ(back.bid_volume[4], 7);
+    EXPECT_DOUBLE_EQ(back.ask_price[2], 3457.4);
+    EXPECT_DOUBLE_EQ(back.pre_close_price, 3400.0);
+
+    tick.instrument = std::string(100, 'x');
+    to_bus_tick(tick, record);
+    from_bus_tick(record, back);
+    EXPECT_EQ(back.instrument.size(), kMaxInstrument - 1);
+}
+
+// 性能测试：单条行情发布与读取开销
+TEST(ShmRingTest, PerformanceTest) {
+    std::string name = unique_name("perf");
+    auto publisher = TickBusPublisher::create(name, 1 << 20);
+    ASSERT_NE(publisher, nullptr);
+    auto reader = TickBusReader::open(name, TickBusReader::Start::kLatest);
+    ASSERT_NE(reader, nullptr);
+
+    quant::base::data_types::TickData tick{};
+    tick.instrument = "rb2410";
+    const int kIterations = 1000000;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < kIterations; ++i) {
+        tick.volume = i;
+        publisher->publish(tick);
+    }
+    auto mid = std::chrono::high_resolution_clock::now();
+    BusTick record;
+    int received = 0;
+    while (reader->next(record)) {
+        ++received;
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    EXPECT_EQ(static_cast<uint64_t>(received) + reader->lost(), static_cast<uint64_t>(kIterations));
+
+    auto publish_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(mid - start).count();
+    auto read_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(end - mid).count();
+    std::cout << "TickBus publish: " << static_cast<double>(publish_ns) / kIterations << " ns/op, "
+              << "read: " << static_cast<double>(read_ns) / kIterations << " ns/op" << std::endl;
+}
@@ -3,6 +3,7 @@
 #include <atomic>
 #include <chrono>
 #include <future>
+#include <mutex>
 #include <iostream>
 #include "base/common/thread_pool/thread_pool.h"
 
@@ -189,3 +190,235 @@ TEST(ThreadPoolTest, TaskCounting) {
     pool->wait_all();
     EXPECT_EQ(pool->pending_tasks(), 0);
 }
+
+namespace {
+
+// 阻塞唯一的工作线程，使后续提交的任务全部排队
+std::shared_ptr<std::promise<void>> block_worker(const std::shared_ptr<ThreadPool>& pool) {
+    auto gate = std::make_shared<std::promise<void>>();
+    std::shared_future<void> opened = gate->get_future().share();
+    std::promise<void> started;
+    auto running = started.get_future();
+    pool->submit_with(TaskOptions{TaskPriority::kCritical, std::chrono::steady_clock::time_point::max()},
+                      [opened, &started]() {
+                          started.set_value();
+                          opened.wait();
+                      });
+    running.wait();
+    return gate;
+}
+
+// 手动时钟：时刻只在测试推进时变化，老化与截止时刻的判定不受调度抖动与机器负载影响
+class ManualClock {
+public:
+    void attach(ThreadPool& pool) {
+        pool.set_clock([this]() { return now_ns_.load(); });
+    }
+
+    void advance(std::chrono::nanoseconds delta) {
+        now_ns_.fetch_add(delta.count());
+    }
+
+    // 当前手动时刻之后 delta 的截止时刻
+    std::chrono::steady_clock::time_point after(std::chrono::nanoseconds delta) const {
+        return std::chrono::steady_clock::time_point(std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+            std::chrono::nanoseconds(now_ns_.load() + delta.count())));
+    }
+
+private:
+    std::atomic<int64_t> now_ns_{std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count()};
+};
+
+}  // namespace
+
+// 优先级：高优先级通道先执行，同通道内先进先出
+TEST(ThreadPoolTest, PriorityLanes) {
+    auto pool = ThreadPool::create(1);
+    pool->set_aging_threshold(std::chrono::hours(1));
+    auto gate = block_worker(pool);
+
+    std::mutex order_mutex;
+    std::vector<int> order;
+    auto record = [&](int id) {
+        std::lock_guard<std::mutex> lock(order_mutex);
+        order.push_back(id);
+    };
+    const TaskPriority priorities[] = {TaskPriority::kBackground, TaskPriority::kNormal, TaskPriority::kHigh,
+                                       TaskPriority::kCritical,   TaskPriority::kBackground, TaskPriority::kCritical};
+    for (int i = 0; i < 6; ++i) {
+        TaskOptions options;
+        options.priority = priorities[i];
+        pool->submit_with(options, record, i);
+    }
+    EXPECT_EQ(pool->lane_stats(TaskPriority::kBackground).queued, 2u);
+
+    gate->set_value();
+    pool->wait_all();
+    EXPECT_EQ(order, (std::vector<int>{3, 5, 2, 1, 0, 4}));
+    EXPECT_EQ(pool->lane_stats(TaskPriority::kCritical).started, 3u);
+    EXPECT_EQ(pool->lane_stats(TaskPriority::kBackground).promoted, 0u);
+}
+
+// 老化：排队超过阈值的低优先级任务先于持续到达的高优先级任务执行
+TEST(ThreadPoolTest, AgingPreventsStarvation) {
+    ManualClock clock;
+    auto pool = ThreadPool::create(1);
+    clock.attach(*pool);
+    pool->set_aging_threshold(5ms);
+    auto gate = block_worker(pool);
+
+    std::atomic<int> high_before_background{0};
+    std::atomic<bool> background_done{false};
+    TaskOptions background;
+    background.priority = TaskPriority::kBackground;
+    auto done = pool->submit_with(background, [&]() { background_done = true; });
+    TaskOptions high;
+    high.priority = TaskPriority::kHigh;
+    for (int i = 0; i < 50; ++i) {
+        pool->submit_with(high, [&]() {
+            if (!background_done) {
+                high_before_background.fetch_add(1);
+            }
+            clock.advance(1ms);
+        });
+    }
+
+    clock.advance(10ms);
+    gate->set_value();
+    done.get();
+    pool->wait_all();
+    EXPECT_EQ(high_before_background.load(), 0);
+    EXPECT_EQ(pool->lane_stats(TaskPriority::kBackground).promoted, 1u);
+}
+
+// 老化积压：大量已超过老化阈值的后台任务不会整体越过关键任务，每个老化周期至多提前一个
+TEST(ThreadPoolTest, AgedBacklogDoesNotBlockCritical) {
+    ManualClock clock;
+    auto pool = ThreadPool::create(1);
+    clock.attach(*pool);
+    pool->set_aging_threshold(5ms);
+    auto gate = block_worker(pool);
+
+    TaskOptions background;
+    background.priority = TaskPriority::kBackground;
+    std::atomic<int> background_done{0};
+    const int kBacklog = 200;
+    for (int i = 0; i < kBacklog; ++i) {
+        pool->submit_with(background, [&]() {
+            clock.advance(1ms);
+            background_done.fetch_add(1);
+        });
+    }
+    // 整个积压都已超过老化阈值
+    clock.advance(20ms);
+
+    TaskOptions critical;
+    critical.priority = TaskPriority::kCritical;
+    std::atomic<int> done_before_critical{-1};
+    auto result = pool->submit_with(critical, [&]() { done_before_critical = background_done.load(); });
+    gate->set_value();
+    result.get();
+    // 恰好一个老化的后台任务先于关键任务执行，之后 1ms 内不再提前
+    EXPECT_EQ(done_before_critical.load(), 1);
+
+    pool->wait_all();
+    EXPECT_EQ(background_done.load(), kBacklog);
+    LaneStats stats = pool->lane_stats(TaskPriority::kBackground);
+    EXPECT_EQ(stats.started, static_cast<uint64_t>(kBacklog));
+    EXPECT_EQ(stats.promoted, 1u);
+}
+
+// 持续的高优先级负载下，老化任务按周期推进而不是被饿死
+TEST(ThreadPoolTest, AgingRateLimitedUnderSustainedLoad) {
+    ManualClock clock;
+    auto pool = ThreadPool::create(1);
+    clock.attach(*pool);
+    pool->set_aging_threshold(5ms);
+    auto gate = block_worker(pool);
+
+    TaskOptions background;
+    background.priority = TaskPriority::kBackground;
+    std::atomic<int> background_done{0};
+    for (int i = 0; i < 10; ++i) {
+        pool->submit_with(background, [&]() { background_done.fetch_add(1); });
+    }
+    TaskOptions high;
+    high.priority = TaskPriority::kHigh;
+    std::atomic<int> high_done{0};
+    std::atomic<int> background_at_half{-1};
+    const int kHigh = 60;
+    for (int i = 0; i < kHigh; ++i) {
+        pool->submit_with(high, [&]() {
+            if (high_done.fetch_add(1) + 1 == kHigh / 2) {
+                background_at_half = background_done.load();
+            }
+            clock.advance(1ms);
+        });
+    }
+    clock.advance(10ms);
+    gate->set_value();
+    pool->wait_all();
+
+    // 每个 5ms 老化周期提前一个后台任务，其余时间执行 5 个 1ms 的高优先级任务：
+    // 第 30 个高优先级任务开始时后台通道恰好推进了 6 个，远未跑完
+    EXPECT_EQ(background_at_half.load(), 6);
+    EXPECT_EQ(background_done.load(), 10);
+    EXPECT_EQ(pool->lane_stats(TaskPriority::kBackground).promoted, 10u);
+}
+
+// 截止时刻：出队时已过期的任务不执行，future 抛出 DeadlineExpired
+TEST(ThreadPoolTest, DeadlineExpiry) {
+    ManualClock clock;
+    auto pool = ThreadPool::create(1);
+    clock.attach(*pool);
+    auto gate = block_worker(pool);
+
+    std::atomic<int> executed{0};
+    TaskOptions soon;
+    soon.priority = TaskPriority::kHigh;
+    soon.deadline = clock.after(1ms);
+    auto expired = pool->submit_with(soon, [&]() { executed.fetch_add(1); return 1; });
+    TaskOptions later;
+    later.deadline = clock.after(std::chrono::hours(1));
+    auto on_time = pool->submit_with(later, [&]() { executed.fetch_add(1); return 2; });
+
+    clock.advance(5ms);
+    gate->set_value();
+    EXPECT_THROW(expired.get(), DeadlineExpired);
+    EXPECT_EQ(on_time.get(), 2);
+    pool->wait_all();
+    EXPECT_EQ(executed.load(), 1);
+    EXPECT_EQ(pool->pending_tasks(), 0u);
+
+    LaneStats high = pool->lane_stats(TaskPriority::kHigh);
+    EXPECT_EQ(high.submitted, 1u);
+    EXPECT_EQ(high.expired, 1u);
+    EXPECT_EQ(high.started, 0u);
+    LaneStats normal = pool->lane_stats(TaskPriority::kNormal);
+    EXPECT_EQ(normal.started, 1u);
+    EXPECT_GE(normal.wait_max_ns, 4000000u);
+    EXPECT_GE(normal.wait_p99_ns, normal.wait_p50_ns);
+}
+
+// 性能测试：关键通道在后台任务积压时的排队延迟
+TEST(ThreadPoolTest, PriorityPerformanceTest) {
+    auto pool = ThreadPool::create(2);
+    TaskOptions background;
+    background.priority = TaskPriority::kBackground;
+    TaskOptions critical;
+    critical.priority = TaskPriority::kCritical;
+    const int kIterations = 2000;
+    for (int i = 0; i < kIterations; ++i) {
+        pool->submit_with(background, []() { std::this_thread::sleep_for(std::chrono::microseconds(20)); });
+        if (i % 10 == 0) {
+            pool->submit_with(critical, []() {});
+        }
+    }
+    pool->wait_all();
+    LaneStats bg = pool->lane_stats(TaskPriority::kBackground);
+    LaneStats crit = pool->lane_stats(TaskPriority::kCritical);
+    std::cout << "ThreadPool lane wait p99: critical " << crit.wait_p99_ns << " ns, background " << bg.wait_p99_ns
+              << " ns (promoted " << bg.promoted << ")" << std::endl;
+    EXPECT_LT(crit.wait_p99_ns, bg.wait_p99_ns);
+}
@@ -0,0 +1,361 @@
+#include <gtest/gtest.h>
+#include <cfloat>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+#include "base/utils/tick_decoder/tick_decoder.h"
+
+using namespace quant::base::utils::tick_decoder;
+using quant::base::data_types::TickData;
+
+namespace {
+
+const char kTickerFrame[] =
+    R"({"e":"24hrTicker","E":1700000000123,"s":"BTCUSDT","p":"-94.99999800","P":"-95.960","w":"0.0029",)"
+    R"("x":"99.00000000","c":"4.00000200","Q":"10.5","b":"4.00000000","B":"7","a":"4.00000200","A":"11",)"
+    R"("o":"99.00000000","h":"100.00000000","l":"0.10000000","v":"8913.30000000","q":"15.30000000",)"
+    R"("O":0,"C":86400000,"F":0,"L":18150,"n":18151})";
+
+int64_t epoch_ms(const TickData& tick) {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(tick.timestamp.time_since_epoch()).count();
+}
+
+std::string format_number(std::mt19937_64& rng, double value) {
+    char buffer[64];
+    switch (rng() % 3) {
+        case 0:
+            std::snprintf(buffer, sizeof(buffer), "%.2f", value);
+            break;
+        case 1:
+            std::snprintf(buffer, sizeof(buffer), "%.17g", value);
+            break;
+        default:
+            std::snprintf(buffer, sizeof(buffer), "%.8e", value);
+            break;
+    }
+    return buffer;
+}
+
+std::string random_ws(std::mt19937_64& rng) {
+    static const char kWhitespace[] = {' ', '\n', '\t', '\r'};
+    std::string ws;
+    for (uint64_t i = rng() % 3; i > 0; --i) {
+        ws.push_back(kWhitespace[rng() % 4]);
+    }
+    return ws;
+}
+
+// 与模式无关的干扰值：长字符串（走 SIMD 路径）、转义引号、嵌套容器中的括号与引号
+std::string random_noise(std::mt19937_64& rng) {
+    switch (rng() % 5) {
+        case 0:
+            return R"("a fairly long string value with \"escaped quotes\" and {braces} [brackets]")";
+        case 1:
+            return R"({"nested":[1,2,{"deep":"}]\\"}],"x":null,"y":"{[\"]}"})";
+        case 2:
+            return "[" + std::to_string(rng() % 1000) + ",true,false,null,\"s\"]";
+        case 3:
+            return "-1.5e-3";
+        default:
+            return "\"\"";
+    }
+}
+
+}  // namespace
+
+// Binance 24hrTicker：只取模式字段，其余跳过
+TEST(TickDecoderTest, BinanceTicker) {
+    JsonTickDecoder decoder(JsonTickSchema::binance_ticker());
+    TickData tick{};
+    ASSERT_EQ(decoder.decode(kTickerFrame, sizeof(kTickerFrame) - 1, tick), DecodeStatus::kOk);
+    EXPECT_EQ(tick.instrument, "BTCUSDT");
+    EXPECT_EQ(epoch_ms(tick), 1700000000123LL);
+    EXPECT_DOUBLE_EQ(tick.last_price, 4.000002);
+    EXPECT_EQ(tick.volume, 8913);
+    EXPECT_DOUBLE_EQ(tick.open_price, 99.0);
+    EXPECT_DOUBLE_EQ(tick.high_price, 100.0);
+    EXPECT_DOUBLE_EQ(tick.low_price, 0.1);
+    EXPECT_DOUBLE_EQ(tick.pre_close_price, 99.0);
+    EXPECT_DOUBLE_EQ(tick.bid_price[0], 4.0);
+    EXPECT_EQ(tick.bid_volume[0], 7);
+    EXPECT_DOUBLE_EQ(tick.ask_price[0], 4.000002);
+    EXPECT_EQ(tick.ask_volume[0], 11);
+}
+
+// 组合流外层对象 + 深度档位：超过五档截断，不足五档清零，档位中多余元素跳过
+TEST(TickDecoderTest, EnvelopeAndDepthLevels) {
+    JsonTickSchema schema = JsonTickSchema::binance_depth();
+    schema.envelope = "data";
+    JsonTickDecoder decoder(schema);
+
+    TickData tick{};
+    tick.bid_price[4] = 123.0;
+    tick.last_price = 42.0;
+    std::string frame =
+        R"({"stream":"btcusdt@depth","data":{"e":"depthUpdate","E":1700000000000,"s":"BTCUSDT","U":1,"u":2,)"
+        R"("b":[["100.1","1"],["100.0","2",7],[99.9,3]],)"
+        R"("a":[["100.2","1"],["100.3","2"],["100.4","3"],["100.5","4"],["100.6","5"],["100.7","6"]]}})";
+    ASSERT_EQ(decoder.decode(frame, tick), DecodeStatus::kOk);
+    EXPECT_EQ(tick.instrument, "BTCUSDT");
+    EXPECT_DOUBLE_EQ(tick.bid_price[0], 100.1);
+    EXPECT_DOUBLE_EQ(tick.bid_price[1], 100.0);
+    EXPECT_DOUBLE_EQ(tick.bid_price[2], 99.9);
+    EXPECT_EQ(tick.bid_volume[2], 3);
+    EXPECT_DOUBLE_EQ(tick.bid_price[3], 0.0);
+    EXPECT_DOUBLE_EQ(tick.bid_price[4], 0.0);
+    EXPECT_DOUBLE_EQ(tick.ask_price[4], 100.6);
+    EXPECT_EQ(tick.ask_volume[4], 5);
+    EXPECT_DOUBLE_EQ(tick.last_price, 42.0);     // 模式外字段保持不变
+
+    // 外层的同名键不参与解码
+    TickData other{};
+    EXPECT_EQ(decoder.decode(std::string(R"({"s":"ETHUSDT","data":{"b":[]}})"), other), DecodeStatus::kMissingField);
+}
+
+// 语法错误与缺字段：有效帧的任意真前缀都不能解码成功
+TEST(TickDecoderTest, MalformedFrames) {
+    JsonTickDecoder decoder(JsonTickSchema::binance_ticker());
+    std::string frame(kTickerFrame);
+    TickData tick{};
+    for (size_t length = 0; length < frame.size(); ++length) {
+        EXPECT_EQ(decoder.decode(frame.data(), length, tick), DecodeStatus::kMalformed) << length;
+    }
+    EXPECT_EQ(decoder.decode(frame + "x", tick), DecodeStatus::kMalformed);
+    EXPECT_EQ(decoder.decode(std::string(R"({"s":"A","c":"1.2.3"})"), tick), DecodeStatus::kMalformed);
+    EXPECT_EQ(decoder.decode(std::string(R"({"s":"A","c":abc})"), tick), DecodeStatus::kMalformed);
+    EXPECT_EQ(decoder.decode(std::string(R"({"s":"A" "c":1})"), tick), DecodeStatus::kMalformed);
+    EXPECT_EQ(decoder.decode(std::string(R"({"c":"1.5"})"), tick), DecodeStatus::kMissingField);
+    EXPECT_EQ(decoder.decode(std::string(R"( {"s":"A","c":null,"v":1e3} )"), tick), DecodeStatus::kOk);
+    EXPECT_EQ(tick.volume, 1000);
+    EXPECT_STREQ(to_string(DecodeStatus::kMalformed), "malformed");
+}
+
+// 数字解析与 strtod 逐位一致（快速路径与回退路径）
+TEST(TickDecoderTest, ParseDecimalMatchesStrtod) {
+    std::mt19937_64 rng(20240601);
+    const char kDigits[] = "0123456789";
+    for (int i = 0; i < 200000; ++i) {
+        std::string text;
+        if (rng() % 4 == 0) {
+            text.push_back('-');
+        }
+        size_t integer_digits = 1 + rng() % (rng() % 8 == 0 ? 25 : 8);
+        for (size_t d = 0; d < integer_digits; ++d) {
+            text.push_back(kDigits[rng() % 10]);
+        }
+        if (rng() % 3 != 0) {
+            text.push_back('.');
+            size_t fraction_digits = 1 + rng() % (rng() % 8 == 0 ? 25 : 10);
+            for (size_t d = 0; d < fraction_digits; ++d) {
+                text.push_back(kDigits[rng() % 10]);
+            }
+        }
+        if (rng() % 5 == 0) {
+            text.push_back(rng() % 2 ? 'e' : 'E');
+            if (rng() % 2) {
+                text.push_back(rng() % 2 ? '-' : '+');
+            }
+            text += std::to_string(rng() % 330);
+        }
+        double parsed = 0.0;
+        const char* stop = parse_decimal(text.data(), text.data() + text.size(), parsed);
+        ASSERT_EQ(stop, text.data() + text.size()) << text;
+        double expected = std::strtod(text.c_str(), nullptr);
+        ASSERT_EQ(std::memcmp(&parsed, &expected, sizeof(double)), 0) << text;
+    }
+    double value = 0.0;
+    for (const char* bad : {"", "-", ".5", "1.", "1e", "1e+", "+1"}) {
+        EXPECT_EQ(parse_decimal(bad, bad + std::strlen(bad), value), nullptr) << bad;
+    }
+}
+
+// 随机生成：字段顺序、空白、数字格式、干扰字段随机，解码结果与生成值一致
+TEST(TickDecoderTest, FuzzGeneratedFrames) {
+    JsonTickDecoder decoder(JsonTickSchema::binance_ticker());
+    std::mt19937_64 rng(7);
+    std::uniform_real_distribution<double> price(0.0, 100000.0);
+    for (int i = 0; i < 20000; ++i) {
+        struct Field {
+            std::string key;
+            std::string text;
+        };
+        std::vector<Field> fields;
+        std::string instrument = "SYM" + std::to_string(rng() % 100000);
+        int64_t event_ms = 1600000000000LL + static_cast<int64_t>(rng() % 100000000000ULL);
+        std::string last = format_number(rng, price(rng));
+        std::string bid = format_number(rng, price(rng));
+        std::string volume = std::to_string(rng() % 1000000) + ".75";
+        fields.push_back({"s", "\"" + instrument + "\""});
+        fields.push_back({"E", std::to_string(event_ms)});
+        fields.push_back({"c", rng() % 2 ? "\"" + last + "\"" : last});
+        fields.push_back({"b", "\"" + bid + "\""});
+        fields.push_back({"v", "\"" + volume + "\""});
+        for (uint64_t n = rng() % 4; n > 0; --n) {
+            fields.push_back({"noise" + std::to_string(n), random_noise(rng)});
+        }
+        std::shuffle(fields.begin(), fields.end(), rng);
+
+        std::string frame = random_ws(rng) + "{";
+        for (size_t f = 0; f < fields.size(); ++f) {
+            if (f > 0) {
+                frame += "," + random_ws(rng);
+            }
+            frame += "\"" + fields[f].key + "\"" + random_ws(rng) + ":" + random_ws(rng) + fields[f].text +
+                     random_ws(rng);
+        }
+        frame += "}" + random_ws(rng);
+
+        TickData tick{};
+        ASSERT_EQ(decoder.decode(frame, tick), DecodeStatus::kOk) << frame;
+        ASSERT_EQ(tick.instrument, instrument);
+        ASSERT_EQ(epoch_ms(tick), event_ms);
+        ASSERT_EQ(tick.last_price, std::strtod(last.c_str(), nullptr)) << frame;
+        ASSERT_EQ(tick.bid_price[0], std::strtod(bid.c_str(), nullptr)) << frame;
+        ASSERT_EQ(tick.volume, std::strtoll(volume.c_str(), nullptr, 10));
+    }
+}
+
+// 变异模糊测试：对有效帧随机翻转/插入/删除字节，解码器只能返回错误码，不能崩溃或越界
+TEST(TickDecoderTest, FuzzMutatedFrames) {
+    JsonTickSchema schema = JsonTickSchema::binance_depth();
+    schema.envelope = "data";
+    JsonTickDecoder depth_decoder(schema);
+    JsonTickDecoder ticker_decoder(JsonTickSchema::binance_ticker());
+    const std::string seeds[] = {
+        kTickerFrame,
+        R"({"stream":"x","data":{"s":"BTCUSDT","E":1,"b":[["1.5","2"],["1.4","3"]],"a":[["1.6","1"]],)"
+        R"("n":{"k":"a long string with \"quotes\" and ]}[{ brackets"}}})",
+    };
+    const char kInteresting[] = "{}[]\",:\\-.eE0123456789 ntfa";
+    std::mt19937_64 rng(99);
+    int decoded = 0;
+    for (int i = 0; i < 100000; ++i) {
+        std::string frame = seeds[rng() % 2];
+        for (uint64_t m = 1 + rng() % 4; m > 0 && !frame.empty(); --m) {
+            size_t pos = rng() % frame.size();
+            switch (rng() % 4) {
+                case 0:
+                    frame[pos] = kInteresting[rng() % (sizeof(kInteresting) - 1)];
+                    break;
+                case 1:
+                    frame.insert(frame.begin() + static_cast<long>(pos),
+                                 kInteresting[rng() % (sizeof(kInteresting) - 1)]);
+                    break;
+                case 2:
+                    frame.erase(pos, 1 + rng() % 8);
+                    break;
+                default:
+                    frame.resize(pos);
+                    break;
+            }
+        }
+        // 拷贝到恰好大小的堆内存，越界读取在 ASan 下可被发现
+        std::vector<char> exact(frame.begin(), frame.end());
+        TickData tick{};
+        DecodeStatus a = ticker_decoder.decode(exact.data(), exact.size(), tick);
+        DecodeStatus b = depth_decoder.decode(exact.data(), exact.size(), tick);
+        decoded += (a == DecodeStatus::kOk) + (b == DecodeStatus::kOk);
+        ASSERT_LE(tick.instrument.size(), frame.size());
+    }
+    EXPECT_GT(decoded, 0);
+}
+
+// CTP 定长结构体：字段映射、无效价格、本地时间换算、长度与格式校验
+TEST(TickDecoderTest, CtpDepthMarketData) {
+    CtpDepthMarketData field;
+    std::memset(&field, 0, sizeof(field));
+    std::strcpy(field.TradingDay, "20240102");
+    std::strcpy(field.ActionDay, "20240102");
+    std::strcpy(field.InstrumentID, "rb2405");
+    std::strcpy(field.UpdateTime, "09:30:01");
+    field.UpdateMillisec = 500;
+    field.LastPrice = 3950.0;
+    field.Volume = 12345;
+    field.OpenInterest = 1.5e6;
+    field.OpenPrice = 3940.0;
+    field.HighestPrice = 3960.0;
+    field.LowestPrice = 3930.0;
+    field.PreClosePrice = 3945.0;
+    field.BidPrice1 = 3949.0;
+    field.BidVolume1 = 10;
+    field.AskPrice1 = 3951.0;
+    field.AskVolume1 = 20;
+    field.BidPrice2 = DBL_MAX;
+    field.AskPrice5 = 3955.0;
+    field.AskVolume5 = 50;
+
+    std::string frame(reinterpret_cast<const char*>(&field), sizeof(field));
+    CtpTickDecoder decoder;
+    TickData tick{};
+    ASSERT_EQ(decoder.decode(frame, tick), DecodeStatus::kOk);
+    EXPECT_EQ(tick.instrument, "rb2405");
+    EXPECT_EQ(epoch_ms(tick), 1704159001500LL);     // 2024-01-02 01:30:01.500 UTC
+    EXPECT_DOUBLE_EQ(tick.last_price, 3950.0);
+    EXPECT_EQ(tick.volume, 12345);
+    EXPECT_DOUBLE_EQ(tick.open_interest, 1.5e6);
+    EXPECT_DOUBLE_EQ(tick.bid_price[0], 3949.0);
+    EXPECT_EQ(tick.ask_volume[0], 20);
+    EXPECT_DOUBLE_EQ(tick.bid_price[1], 0.0);
+    EXPECT_DOUBLE_EQ(tick.ask_price[4], 3955.0);
+    EXPECT_EQ(tick.ask_volume[4], 50);
+    EXPECT_DOUBLE_EQ(tick.pre_close_price, 3945.0);
+
+    // 夜盘 ActionDay 为空时退回 TradingDay；偏移可配置
+    field.ActionDay[0] = '\0';
+    CtpTickDecoder::Options utc;
+    utc.utc_offset_seconds = 0;
+    ASSERT_EQ(CtpTickDecoder(utc).decode(field, tick), DecodeStatus::kOk);
+    EXPECT_EQ(epoch_ms(tick), 1704187801500LL);
+
+    EXPECT_EQ(decoder.decode(frame.data(), frame.size() - 1, tick), DecodeStatus::kBadSize);
+    std::strcpy(field.UpdateTime, "9:30:01");
+    EXPECT_EQ(decoder.decode(field, tick), DecodeStatus::kMalformed);
+    std::strcpy(field.UpdateTime, "09:30:01");
+    field.InstrumentID[0] = '\0';
+    EXPECT_EQ(decoder.decode(field, tick), DecodeStatus::kMissingField);
+
+    // 随机字节：只能返回错误码或成功，不能崩溃
+    std::mt19937_64 rng(3);
+    for (int i = 0; i < 10000; ++i) {
+        for (auto& byte : frame) {
+            byte = static_cast<char>(rng());
+        }
+        DecodeStatus status = decoder.decode(frame, tick);
+        EXPECT_TRUE(status == DecodeStatus::kOk || status == DecodeStatus::kMalformed ||
+                    status == DecodeStatus::kMissingField);
+    }
+}
+
+// 性能测试：单帧解码耗时
+TEST(TickDecoderTest, PerformanceTest) {
+    JsonTickDecoder json_decoder(JsonTickSchema::binance_ticker());
+    CtpTickDecoder ctp_decoder;
+    std::string json_frame(kTickerFrame);
+    CtpDepthMarketData field;
+    std::memset(&field, 0, sizeof(field));
+    std::strcpy(field.ActionDay, "20240102");
+    std::strcpy(field.InstrumentID, "rb2405");
+    std::strcpy(field.UpdateTime, "09:30:01");
+    std::string ctp_frame(reinterpret_cast<const char*>(&field), sizeof(field));
+
+    TickData tick{};
+    const int kIterations = 1000000;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < kIterations; ++i) {
+        json_decoder.decode(json_frame, tick);
+    }
+    auto mid = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < kIterations; ++i) {
+        ctp_decoder.decode(ctp_frame, tick);
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+
+    auto json_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(mid - start).count();
+    auto ctp_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(end - mid).count();
+    std::cout << "JsonTickDecoder: " << static_cast<double>(json_ns) / kIterations << " ns/op, "
+              << "CtpTickDecoder: " << static_cast<double>(ctp_ns) / kIterations << " ns/op" << std::endl;
+}
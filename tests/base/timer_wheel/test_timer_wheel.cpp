@@ -0,0 +1,220 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <future>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include "base/common/timer_wheel/timer_wheel.h"
+
+using namespace quant::base::common::timer_wheel;
+using namespace std::chrono_literals;
+using Clock = TimerWheel::Clock;
+
+// 单次定时器：不早于到期时刻触发，回调异常不影响后续定时器
+TEST(TimerWheelTest, FiresNotBeforeDeadline) {
+    TimerWheel wheel;
+    Clock::time_point start = Clock::now();
+    std::vector<int> fired;
+    wheel.schedule_at(start + 5ms, [&]() { fired.push_back(5); });
+    wheel.schedule_at(start + 2ms, [&]() { fired.push_back(2); });
+    wheel.schedule_at(start + 3ms, []() { throw std::runtime_error("callback failure"); });
+    EXPECT_EQ(wheel.schedule_after(1ms, nullptr), kInvalidTimer);
+
+    EXPECT_EQ(wheel.advance(start + 1ms), 0u);
+    EXPECT_EQ(wheel.advance(start + 4ms), 2u);
+    EXPECT_EQ(fired, (std::vector<int>{2}));
+    EXPECT_EQ(wheel.advance(start + 4900us), 0u);
+    EXPECT_EQ(wheel.advance(start + 6ms), 1u);
+    EXPECT_EQ(fired, (std::vector<int>{2, 5}));
+
+    TimerWheelStats stats = wheel.stats();
+    EXPECT_EQ(stats.scheduled, 3u);
+    EXPECT_EQ(stats.fired, 3u);
+    EXPECT_EQ(stats.pending, 0u);
+}
+
+// 取消：挂起中的定时器可取消一次；已触发或节点复用后的旧句柄返回 false
+TEST(TimerWheelTest, Cancel) {
+    TimerWheel wheel;
+    Clock::time_point start = Clock::now();
+    int fired = 0;
+    TimerId a = wheel.schedule_at(start + 10ms, [&]() { ++fired; });
+    TimerId b = wheel.schedule_at(start + 10ms, [&]() { ++fired; });
+    EXPECT_TRUE(wheel.cancel(a));
+    EXPECT_FALSE(wheel.cancel(a));
+    EXPECT_FALSE(wheel.cancel(kInvalidTimer));
+    EXPECT_FALSE(wheel.cancel(TimerId(1) << 40 | 999999));
+
+    // 复用 a 的节点：旧句柄不能取消新定时器
+    TimerId c = wheel.schedule_at(start + 10ms, [&]() { ++fired; });
+    EXPECT_NE(c, a);
+    EXPECT_FALSE(wheel.cancel(a));
+
+    EXPECT_EQ(wheel.advance(start + 20ms), 2u);
+    EXPECT_EQ(fired, 2);
+    EXPECT_FALSE(wheel.cancel(b));
+    EXPECT_EQ(wheel.stats().cancelled, 1u);
+}
+
+// 分层下沉：各层范围内及超出最高层范围（2^32 个刻度）的定时器都在到期刻度触发，不早也不晚
+TEST(TimerWheelTest, CascadeAcrossLevels) {
+    TimerWheel wheel;
+    Clock::time_point start = Clock::now();
+
+    const int64_t delays_ms[] = {1, 255, 256, 257, 65535, 65536, 70000, 16777216, 20000000,
+                                 4294967295LL, 4294967296LL, 10000000000LL};
+    size_t fired = 0;
+    for (int64_t delay : delays_ms) {
+        wheel.schedule_at(start + std::chrono::milliseconds(delay), [&fired]() { ++fired; });
+    }
+    // 逐个到期时刻推进：到期前一个刻度不触发，到期后（向上取整的刻度）触发
+    for (int64_t delay : delays_ms) {
+        size_t before = fired;
+        wheel.advance(start + std::chrono::milliseconds(delay - 1));
+        ASSERT_EQ(fired, before) << "delay " << delay;
+        wheel.advance(start + std::chrono::milliseconds(delay + 1) + 500us);
+        ASSERT_EQ(fired, before + 1) << "delay " << delay;
+    }
+    EXPECT_EQ(wheel.stats().pending, 0u);
+}
+
+// 周期定时器：固定频率，驱动滞后时跳过错过的周期；回调内可取消自身
+TEST(TimerWheelTest, Periodic) {
+    TimerWheel wheel;
+    Clock::time_point start = Clock::now();
+    int ticks = 0;
+    TimerId heartbeat = wheel.schedule_every(10ms, start + 10ms, [&]() { ++ticks; });
+    // 到期时刻向上取整到刻度，首次触发在 10ms 或 11ms 刻度
+    for (int ms = 1; ms <= 105; ++ms) {
+        wheel.advance(start + std::chrono::milliseconds(ms) + 500us);
+    }
+    EXPECT_EQ(ticks, 10);
+
+    // 一次推进 50ms：只触发一次，错过的周期被跳过
+    wheel.advance(start + 155ms + 500us);
+    EXPECT_EQ(ticks, 11);
+    wheel.advance(start + 161ms + 500us);
+    EXPECT_EQ(ticks, 12);
+    EXPECT_TRUE(wheel.cancel(heartbeat));
+    wheel.advance(start + 200ms + 500us);
+    EXPECT_EQ(ticks, 12);
+
+    int self_cancelling = 0;
+    TimerId id = kInvalidTimer;
+    id = wheel.schedule_every(1ms, [&]() {
+        if (++self_cancelling == 3) {
+            EXPECT_TRUE(wheel.cancel(id));
+        }
+    });
+    for (int ms = 201; ms <= 230; ++ms) {
+        wheel.advance(start + std::chrono::milliseconds(ms) + 500us);
+    }
+    EXPECT_EQ(self_cancelling, 3);
+    EXPECT_EQ(wheel.stats().pending, 0u);
+
+    // K 线收盘边界：严格晚于当前时刻，且不超过一个周期
+    Clock::time_point boundary = next_boundary(60s);
+    EXPECT_GT(boundary, Clock::now() - 1ms);
+    EXPECT_LE(boundary, Clock::now() + 60s);
+}
+
+// 驱动线程：到期回调投递到线程池的关键通道执行；多线程并发 schedule/cancel
+TEST(TimerWheelTest, DriverThreadAndPoolDispatch) {
+    using quant::base::common::thread_pool::TaskPriority;
+    using quant::base::common::thread_pool::ThreadPool;
+    auto pool = ThreadPool::create(2);
+    TimerWheelOptions options;
+    options.name = "timer_wheel_test";
+    TimerWheel wheel(options);
+    ASSERT_TRUE(wheel.start());
+    EXPECT_FALSE(wheel.start());
+
+    std::promise<std::thread::id> executed;
+    auto executed_on = executed.get_future();
+    Clock::time_point scheduled = Clock::now();
+    wheel.schedule_after(20ms, on_pool(pool, TaskPriority::kCritical, [&executed]() {
+        executed.set_value(std::this_thread::get_id());
+    }));
+    ASSERT_EQ(executed_on.wait_for(2s), std::future_status::ready);
+    EXPECT_GE(Clock::now() - scheduled, 20ms);
+    EXPECT_NE(executed_on.get(), std::this_thread::get_id());
+    EXPECT_EQ(pool->lane_stats(TaskPriority::kCritical).started, 1u);
+
+    std::atomic<int> fired{0};
+    std::vector<std::thread> producers;
+    for (int t = 0; t < 4; ++t) {
+        producers.emplace_back([&wheel, &fired, t]() {
+            std::mt19937 rng(t);
+            std::vector<TimerId> ids;
+            for (int i = 0; i < 5000; ++i) {
+                ids.push_back(wheel.schedule_after(std::chrono::microseconds(rng() % 20000),
+                                                   [&fired]() { fired.fetch_add(1); }));
+                if (i % 2 == 1) {
+                    wheel.cancel(ids[ids.size() - 2]);
+                }
+            }
+        });
+    }
+    for (auto& producer : producers) {
+        producer.join();
+    }
+    auto deadline = Clock::now() + 2s;
+    while (wheel.stats().pending > 0 && Clock::now() < deadline) {
+        std::this_thread::sleep_for(5ms);
+    }
+    wheel.stop();
+    TimerWheelStats stats = wheel.stats();
+    EXPECT_EQ(stats.pending, 0u);
+    EXPECT_EQ(static_cast<uint64_t>(fired.load()) + stats.cancelled + 1, stats.scheduled);
+    EXPECT_GE(fired.load(), 10000);
+    pool->stop(true);
+}
+
+// 大量挂起定时器：一百万个定时器，取消一半后全部触发
+TEST(TimerWheelTest, MillionsOutstanding) {
+    TimerWheel wheel;
+    Clock::time_point start = Clock::now();
+    const int kTimers = 1000000;
+    uint64_t fired = 0;
+    std::vector<TimerId> ids;
+    ids.reserve(kTimers);
+    for (int i = 0; i < kTimers; ++i) {
+        ids.push_back(wheel.schedule_at(start + std::chrono::milliseconds(1 + i % 600000), [&fired]() { ++fired; }));
+    }
+    EXPECT_EQ(wheel.stats().pending, static_cast<size_t>(kTimers));
+    for (int i = 0; i < kTimers; i += 2) {
+        ASSERT_TRUE(wheel.cancel(ids[i]));
+    }
+    wheel.advance(start + 601s);
+    EXPECT_EQ(fired, static_cast<uint64_t>(kTimers / 2));
+    EXPECT_EQ(wheel.stats().pending, 0u);
+}
+
+// 性能测试：schedule + cancel 与推进触发的单次开销
+TEST(TimerWheelTest, PerformanceTest) {
+    TimerWheel wheel;
+    Clock::time_point start = Clock::now();
+    const int kIterations = 1000000;
+    auto begin = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < kIterations; ++i) {
+        TimerId id = wheel.schedule_at(start + std::chrono::milliseconds(50 + i % 1000), []() {});
+        wheel.cancel(id);
+    }
+    auto mid = std::chrono::high_resolution_clock::now();
+    uint64_t fired = 0;
+    for (int i = 0; i < kIterations; ++i) {
+        wheel.schedule_at(start + std::chrono::milliseconds(1 + i % 1000), [&fired]() { ++fired; });
+    }
+    wheel.advance(start + 2s);
+    auto end = std::chrono::high_resolution_clock::now();
+    EXPECT_EQ(fired, static_cast<uint64_t>(kIterations));
+
+    auto cancel_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(mid - begin).count();
+    auto fire_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(end - mid).count();
+    std::cout << "TimerWheel schedule+cancel: " << static_cast<double>(cancel_ns) / kIterations << " ns/op, "
+              << "schedule+fire: " << static_cast<double>(fire_ns) / kIterations << " ns/op" << std::endl;
+}
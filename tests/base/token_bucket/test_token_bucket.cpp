@@ -0,0 +1,81 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <chrono>
+#include "base/common/token_bucket/token_bucket.h"
+
+using namespace quant::base::common::token_bucket;
+
+namespace {
+constexpr int64_t kSecond = 1000000000;
+}
+
+// 默认不限流
+TEST(TokenBucketTest, Unlimited) {
+    TokenBucket bucket;
+    EXPECT_TRUE(bucket.unlimited());
+    for (int i = 0; i < 1000; ++i) {
+        EXPECT_TRUE(bucket.try_acquire(0));
+    }
+}
+
+// 突发容量与按速率补充
+TEST(TokenBucketTest, BurstAndRefill) {
+    TokenBucket bucket(10.0, 5.0);   // 每秒 10 个，最多突发 5 个
+    int64_t now = kSecond;
+
+    for (int i = 0; i < 5; ++i) {
+        EXPECT_TRUE(bucket.try_acquire(now));
+    }
+    EXPECT_FALSE(bucket.try_acquire(now));                 // 桶已空
+    EXPECT_FALSE(bucket.try_acquire(now + kSecond / 20));  // 50ms 还不足一个令牌
+    EXPECT_TRUE(bucket.try_acquire(now + kSecond / 10));   // 100ms 补充一个
+    EXPECT_FALSE(bucket.try_acquire(now + kSecond / 10));
+
+    // 长时间空闲后最多恢复到桶容量
+    now += 10 * kSecond;
+    EXPECT_NEAR(bucket.available(now), 5.0, 1e-9);
+    EXPECT_TRUE(bucket.try_acquire(now, 5));
+    EXPECT_FALSE(bucket.try_acquire(now));
+}
+
+// 一次申请多个令牌：不足时不消耗
+TEST(TokenBucketTest, MultipleTokens) {
+    TokenBucket bucket(100.0, 10.0);
+    EXPECT_TRUE(bucket.try_acquire(kSecond, 8));
+    EXPECT_FALSE(bucket.try_acquire(kSecond, 3));
+    EXPECT_TRUE(bucket.try_acquire(kSecond, 2));
+}
+
+// 多线程并发申请：通过数不超过 突发容量 + 速率 x 时长
+TEST(TokenBucketTest, ConcurrentAcquire) {
+    const double kRate = 100000.0;
+    const double kBurst = 100.0;
+    const int kNumThreads = 8;
+    TokenBucket bucket(kRate, kBurst);
+    std::atomic<int64_t> granted(0);
+    std::atomic<bool> stop(false);
+    std::vector<std::thread> threads;
+
+    int64_t start = TokenBucket::now_ns();
+    for (int i = 0; i < kNumThreads; ++i) {
+        threads.emplace_back([&]() {
+            while (!stop.load(std::memory_order_relaxed)) {
+                if (bucket.try_acquire_now()) {
+                    granted.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+        });
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    stop = true;
+    for (auto& t : threads) {
+        t.join();
+    }
+    int64_t elapsed = TokenBucket::now_ns() - start;
+
+    double limit = kBurst + kRate * static_cast<double>(elapsed) / kSecond;
+    EXPECT_GT(granted.load(), 0);
+    EXPECT_LE(static_cast<double>(granted.load()), limit + 1);
+}
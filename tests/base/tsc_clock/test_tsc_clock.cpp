@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+#include "base/utils/tsc_clock/tsc_clock.h"
+#include "base/data_types/tick_data.h"
+
+using namespace quant::base::utils::tsc_clock;
+
+namespace {
+
+int64_t abs_diff(int64_t a, int64_t b) {
+    return a > b ? a - b : b - a;
+}
+
+} // namespace
+
+// 满足 chrono Clock 要求，time_point 可直接赋给 system_clock::time_point
+TEST(TscClockTest, ChronoCompatible) {
+    static_assert(std::is_same<TscClock::time_point, std::chrono::system_clock::time_point>::value,
+                  "TscClock::time_point must be a system_clock time_point");
+    static_assert(std::is_same<TscClock::duration, std::chrono::nanoseconds>::value, "nanosecond clock");
+
+    TscClock::calibrate();
+    quant::base::data_types::TickData tick{};
+    tick.timestamp = TscClock::now();
+    auto wall = std::chrono::system_clock::now();
+    EXPECT_LT(std::chrono::abs(wall - tick.timestamp), std::chrono::milliseconds(5));
+}
+
+// 标定后与 CLOCK_REALTIME 对齐，换算参数合理
+TEST(TscClockTest, CalibrationTracksRealtime) {
+    bool enabled = TscClock::calibrate();
+    EXPECT_EQ(enabled, TscClock::enabled());
+    EXPECT_GT(TscClock::ticks_per_ns(), 0.0);
+    if (!enabled) {
+        GTEST_SKIP() << "TSC is not invariant/stable on this host; clock_gettime fallback in use";
+    }
+
+    TscCalibration calibration = TscClock::calibration();
+    EXPECT_GT(calibration.mult, 0u);
+    for (int i = 0; i < 5; ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        int64_t fast = TscClock::now_ns();
+        int64_t real = TscClock::realtime_ns();
+        EXPECT_LT(abs_diff(fast, real), 1000000) << "TSC clock drifted more than 1ms";
+    }
+}
+
+// 换算：整数定点换算与 ticks_per_ns 一致，支持基准之前的读数
+TEST(TscClockTest, Conversion) {
+    TscCalibration calibration;
+    calibration.tsc_base = 1000000;
+    calibration.ns_base = 5000000000LL;
+    calibration.mult = uint64_t(1) << (TscCalibration::kShift - 1);   // 0.5 ns/tick (2 GHz)
+    calibration.enabled = 1;
+
+    EXPECT_EQ(TscClock::to_ns(calibration, 1000000), 5000000000LL);
+    EXPECT_EQ(TscClock::to_ns(calibration, 3000000), 5001000000LL);
+    EXPECT_EQ(TscClock::to_ns(calibration, 0), 4999500000LL);
+}
+
+// 多线程读取时单线程内时间不回退（含后台周期对齐）
+TEST(TscClockTest, MonotonicUnderRecalibration) {
+    TscClock::calibrate();
+    TscClock::start_recalibration(std::chrono::milliseconds(5));
+
+    std::atomic<uint64_t> backwards(0);
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 2; ++t) {
+        readers.emplace_back([&]() {
+            int64_t last = TscClock::now_ns();
+            auto until = std::chrono::steady_clock::now() + std::chrono::milliseconds(60);
+            while (std::chrono::steady_clock::now() < until) {
+                int64_t now = TscClock::now_ns();
+                if (now < last) {
+                    backwards.fetch_add(1, std::memory_order_relaxed);
+                }
+                last = now;
+            }
+        });
+    }
+    for (auto& reader : readers) {
+        reader.join();
+    }
+    TscClock::stop_recalibration();
+
+    // 回退路径（clock_gettime REALTIME）不保证单调，只检查 TSC 路径
+    if (TscClock::enabled()) {
+        EXPECT_EQ(backwards.load(), 0u);
+        EXPECT_LT(abs_diff(TscClock::now_ns(), TscClock::realtime_ns()), 1000000);
+    }
+}
+
+// 停用后退化为 clock_gettime，重新标定后恢复
+TEST(TscClockTest, FallbackWhenDisabled) {
+    TscClock::calibrate();
+    TscClock::disable();
+    EXPECT_FALSE(TscClock::enabled());
+    EXPECT_LT(abs_diff(TscClock::now_ns(), TscClock::realtime_ns()), 1000000);
+    TscClock::calibrate();
+}
+
+// 性能测试：now_ns() 与 system_clock::now() 对比
+TEST(TscClockTest, PerformanceTest) {
+    TscClock::calibrate();
+    const int kIterations = 2000000;
+    int64_t sink = 0;
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < kIterations; ++i) {
+        sink += TscClock::now_ns();
+    }
+    auto mid = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < kIterations; ++i) {
+        sink += std::chrono::system_clock::now().time_since_epoch().count();
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+
+    double tsc_ns = std::chrono::duration<double, std::nano>(mid - start).count() / kIterations;
+    double sys_ns = std::chrono::duration<double, std::nano>(end - mid).count() / kIterations;
+    EXPECT_NE(sink, 0);
+    std::cout << "TscClock::now_ns: " << tsc_ns << " ns/op (tsc " << (TscClock::enabled() ? "on" : "off")
+              << ", " << TscClock::ticks_per_ns() << " GHz), system_clock::now: " << sys_ns << " ns/op" << std::endl;
+}
@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include "core/account/account_snapshot.h"
+
+using namespace quant::core::account;
+
+// 开仓、加仓与平仓：均价与已实现盈亏
+TEST(AccountSnapshotTest, ApplyFill) {
+    AccountSnapshotBook book(1, 1);
+    BalanceSnapshot initial;
+    initial.balance = 100000.0;
+    initial.available = 100000.0;
+    ASSERT_TRUE(book.publish_balance(0, initial));
+
+    EXPECT_TRUE(book.apply_fill(0, 0, true, 100.0, 2, 10.0, 1.0, 1));
+    EXPECT_TRUE(book.apply_fill(0, 0, true, 103.0, 1, 10.0, 1.0, 2));
+    PositionSnapshot position;
+    ASSERT_TRUE(book.position(0, 0, position));
+    EXPECT_EQ(position.long_volume, 3);
+    EXPECT_DOUBLE_EQ(position.long_avg_price, 101.0);
+
+    // 卖出 4 手：平多 3 手（盈利 (105 - 101) x 3 x 10），再开空 1 手
+    EXPECT_TRUE(book.apply_fill(0, 0, false, 105.0, 4, 10.0, 2.0, 3));
+    ASSERT_TRUE(book.position(0, 0, position));
+    EXPECT_EQ(position.long_volume, 0);
+    EXPECT_EQ(position.short_volume, 1);
+    EXPECT_EQ(position.net(), -1);
+    EXPECT_DOUBLE_EQ(position.short_avg_price, 105.0);
+    EXPECT_EQ(position.update_ns, 3);
+
+    BalanceSnapshot balance;
+    ASSERT_TRUE(book.balance(0, balance));
+    EXPECT_DOUBLE_EQ(balance.realized_pnl, 120.0);
+    EXPECT_DOUBLE_EQ(balance.commission, 4.0);
+    EXPECT_DOUBLE_EQ(balance.balance, 100116.0);
+    EXPECT_EQ(book.balance_version(0), 4u);
+
+    EXPECT_FALSE(book.apply_fill(1, 0, true, 100.0, 1, 10.0, 0.0, 4));
+    EXPECT_FALSE(book.position(0, 1, position));
+}
+
+// 成交线程持续写入，读者线程并发读取：每个快照内部字段始终自洽
+TEST(AccountSnapshotTest, ConcurrentReadersSeeConsistentSnapshots) {
+    const int kNumReaders = 4;
+    const int kNumFills = 100000;
+    AccountSnapshotBook book(1, 1);
+    std::atomic<bool> done(false);
+    std::atomic<uint64_t> inconsistent(0);
+    std::vector<std::thread> readers;
+
+    for (int i = 0; i < kNumReaders; ++i) {
+        readers.emplace_back([&]() {
+            int64_t last_ns = 0;
+            while (!done.load(std::memory_order_acquire)) {
+                BalanceSnapshot balance;
+                PositionSnapshot position;
+                book.balance(0, balance);
+                book.position(0, 0, position);
+                // 资金：权益 = 已实现盈亏 - 手续费；持仓：买 1 卖 1 交替，最多 1 手多头，均价与时间戳对应
+                bool ok = balance.balance == balance.realized_pnl - balance.commission &&
+                          balance.available == balance.balance &&
+                          position.short_volume == 0 &&
+                          (position.long_volume == 0 || position.long_volume == 1) &&
+                          (position.long_volume == 0 ||
+                           position.long_avg_price == static_cast<double>(position.update_ns)) &&
+                          balance.update_ns >= last_ns;
+                if (!ok) {
+                    inconsistent.fetch_add(1, std::memory_order_relaxed);
+                }
+                last_ns = balance.update_ns;
+            }
+        });
+    }
+
+    for (int n = 1; n <= kNumFills; ++n) {
+        // 奇数次以价格 n 买入开仓，偶数次以价格 n 卖出平仓
+        book.apply_fill(0, 0, n % 2 == 1, static_cast<double>(n), 1, 1.0, 0.5, n);
+    }
+    done.store(true, std::memory_order_release);
+    for (auto& t : readers) {
+        t.join();
+    }
+
+    EXPECT_EQ(inconsistent.load(), 0u);
+    BalanceSnapshot balance;
+    book.balance(0, balance);
+    EXPECT_DOUBLE_EQ(balance.realized_pnl, kNumFills / 2);
+    EXPECT_DOUBLE_EQ(balance.commission, kNumFills * 0.5);
+}
@@ -0,0 +1,335 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <ctime>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "core/ems/adapter_shim.h"
+#include "core/ems/pipelined_execution_adapter.h"
+
+using namespace quant::core;
+using namespace quant::core::ems;
+
+namespace {
+
+// 只实现同步接口的适配器：每次调用模拟一次交易所往返，记录调用顺序与最大并发数
+class BlockingAdapter : public IExecutionAdapter {
+public:
+    explicit BlockingAdapter(std::chrono::microseconds round_trip) : round_trip_(round_trip) {}
+
+    bool connect() override { return true; }
+    void disconnect() override {}
+
+    ExecutionResult send_order(const oms::Order& order) override {
+        return call("send:" + order.instrument, "EX" + order.instrument);
+    }
+    ExecutionResult cancel_order(const std::string& order_id) override {
+        return call("cancel:" + order_id, order_id);
+    }
+    ExecutionResult modify_order(const oms::Order& order) override {
+        return call("modify:" + order.order_id, order.order_id);
+    }
+    std::vector<oms::Order> query_orders(const std::string& = "") override { return {oms::Order()}; }
+    std::vector<oms::Trade> query_trades(const std::string& = "") override { return {}; }
+    std::string id() const override { return "BLOCKING"; }
+    std::vector<std::string> supported_instruments() const override { return {"IF2406"}; }
+    void set_order_callback(OrderCallback) override {}
+    void set_trade_callback(TradeCallback) override {}
+
+    std::vector<std::string> calls() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return calls_;
+    }
+    int max_concurrency() const { return max_concurrency_.load(); }
+
+private:
+    ExecutionResult call(const std::string& what, const std::string& order_id) {
+        int now = concurrency_.fetch_add(1) + 1;
+        int seen = max_concurrency_.load();
+        while (now > seen && !max_concurrency_.compare_exchange_weak(seen, now)) {
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            calls_.push_back(what);
+        }
+        if (round_trip_.count() > 0) {
+            std::this_thread::sleep_for(round_trip_);
+        }
+        concurrency_.fetch_sub(1);
+        ExecutionResult result;
+        result.success = true;
+        result.order_id = order_id;
+        return result;
+    }
+
+    std::chrono::microseconds round_trip_;
+    std::mutex mutex_;
+    std::vector<std::string> calls_;
+    std::atomic<int> concurrency_{0};
+    std::atomic<int> max_concurrency_{0};
+};
+
+oms::Order make_order(const std::string& instrument, const std::string& order_id = "") {
+    oms::Order order;
+    order.instrument = instrument;
+    order.order_id = order_id;
+    return order;
+}
+
+// 轮询直到取回 expected 个完成通知或超时
+std::vector<OrderCompletion> drain(IAsyncExecutionAdapter& adapter, size_t expected) {
+    std::vector<OrderCompletion> out;
+    OrderCompletion buffer[16];
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (out.size() < expected && std::chrono::steady_clock::now() < deadline) {
+        size_t n = adapter.poll_completions(buffer, 16);
+        for (size_t i = 0; i < n; ++i) {
+            out.push_back(buffer[i]);
+        }
+        if (n == 0) {
+            std::this_thread::yield();
+        }
+    }
+    return out;
+}
+
+} // namespace
+
+// 同步适配器经 make_async_adapter 包装：在调用线程上执行，完成通知按提交顺序取回；
+// 已是异步接口的适配器原样返回
+TEST(ExecutionAdapterShimTest, SyncCompletionAdapter) {
+    auto inner = std::make_shared<BlockingAdapter>(std::chrono::microseconds(0));
+    std::shared_ptr<IAsyncExecutionAdapter> adapter = make_async_adapter(inner);
+    ASSERT_NE(adapter, nullptr);
+    EXPECT_NE(std::dynamic_pointer_cast<SyncCompletionAdapter>(adapter), nullptr);
+    EXPECT_EQ(make_async_adapter(adapter), adapter);
+    EXPECT_EQ(make_async_adapter(nullptr), nullptr);
+    EXPECT_EQ(adapter->id(), "BLOCKING");
+
+    oms::Order a = make_order("A");
+    oms::Order b = make_order("B");
+    OrderRequest requests[2] = {{1, &a}, {2, &b}};
+    EXPECT_EQ(adapter->send_orders(requests, 2), 2u);
+    EXPECT_TRUE(adapter->submit_cancel(3, "EXA"));
+    EXPECT_TRUE(adapter->submit_modify(4, make_order("B", "EXB")));
+    EXPECT_EQ(inner->calls(), (std::vector<std::string>{"send:A", "send:B", "cancel:EXA", "modify:EXB"}));
+
+    OrderCompletion out[8];
+    ASSERT_EQ(adapter->poll_completions(out, 8), 4u);
+    EXPECT_EQ(out[0].request_id, 1u);
+    EXPECT_EQ(out[0].result.order_id, "EXA");
+    EXPECT_EQ(out[2].type, OrderRequestType::kCancel);
+    EXPECT_EQ(out[3].type, OrderRequestType::kModify);
+    EXPECT_EQ(adapter->poll_completions(out, 8), 0u);
+
+    std::vector<oms::Order> orders;
+    EXPECT_EQ(adapter->query_orders_into("", orders), 1u);
+}
+
+// 管线化：多个发送线程让多个往返同时在途；同一订单的请求保持提交顺序；断开前处理完所有请求
+TEST(ExecutionAdapterShimTest, PipelinedOverlapsRoundTrips) {
+    const auto round_trip = std::chrono::milliseconds(10);
+    auto inner = std::make_shared<BlockingAdapter>(round_trip);
+    PipelinedExecutionAdapter adapter(inner, 4, 64);
+    ASSERT_TRUE(adapter.connect());
+    EXPECT_EQ(adapter.sender_count(), 4u);
+
+    std::vector<oms::Order> orders;
+    for (int i = 0; i < 16; ++i) {
+        orders.push_back(make_order(std::to_string(i), "OMS" + std::to_string(i)));
+    }
+    std::vector<OrderRequest> requests;
+    for (size_t i = 0; i < orders.size(); ++i) {
+        requests.push_back({i + 1, &orders[i]});
+    }
+    auto begin = std::chrono::steady_clock::now();
+    EXPECT_EQ(adapter.send_orders(requests.data(), requests.size()), requests.size());
+    std::vector<OrderCompletion> completions = drain(adapter, requests.size());
+    auto elapsed = std::chrono::steady_clock::now() - begin;
+    ASSERT_EQ(completions.size(), requests.size());
+    // 16 个 10ms 往返串行需要 160ms，4 个发送线程并发约 40ms
+    EXPECT_GT(inner->max_concurrency(), 1);
+    EXPECT_LT(elapsed, round_trip * 16);
+
+    // 同一订单的改单与撤单落在同一发送线程上，按提交顺序执行
+    for (uint64_t i = 0; i < 8; ++i) {
+        EXPECT_TRUE(adapter.submit_modify(100 + i, make_order("X", "ORDER7")));
+    }
+    EXPECT_TRUE(adapter.submit_cancel(200, "ORDER7"));
+    adapter.disconnect();
+    EXPECT_EQ(adapter.in_flight(), 0u);
+    completions = drain(adapter, 9);
+    ASSERT_EQ(completions.size(), 9u);
+    uint64_t previous = 0;
+    for (const auto& completion : completions) {
+        EXPECT_GT(completion.request_id, previous);
+        previous = completion.request_id;
+    }
+    EXPECT_EQ(completions.back().type, OrderRequestType::kCancel);
+    std::vector<std::string> calls = inner->calls();
+    EXPECT_EQ(calls.back(), "cancel:ORDER7");
+}
+
+// 同一订单的报单与其后的撤单按 OMS 订单号落在同一发送线程上：撤单总在报单往返完成之后执行
+TEST(ExecutionAdapterShimTest, PipelinedKeepsPerOrderOrder) {
+    auto inner = std::make_shared<BlockingAdapter>(std::chrono::milliseconds(2));
+    PipelinedExecutionAdapter adapter(inner, 4, 64);
+    ASSERT_TRUE(adapter.connect());
+
+    std::vector<oms::Order> orders;
+    for (int i = 0; i < 8; ++i) {
+        std::string id = "OMS" + std::to_string(i);
+        orders.push_back(make_order(id, id));
+    }
+    for (size_t i = 0; i < orders.size(); ++i) {
+        OrderRequest request{i + 1, &orders[i]};
+        ASSERT_EQ(adapter.send_orders(&request, 1), 1u);
+        ASSERT_TRUE(adapter.submit_cancel(100 + i, orders[i].order_id));
+    }
+    std::vector<OrderCompletion> completions = drain(adapter, orders.size() * 2);
+    ASSERT_EQ(completions.size(), orders.size() * 2);
+    adapter.disconnect();
+
+    std::vector<std::string> calls = inner->calls();
+    for (const auto& order : orders) {
+        auto send = std::find(calls.begin(), calls.end(), "send:" + order.order_id);
+        auto cancel = std::find(calls.begin(), calls.end(), "cancel:" + order.order_id);
+        ASSERT_NE(send, calls.end());
+        ASSERT_NE(cancel, calls.end());
+        EXPECT_LT(send, cancel) << order.order_id;
+    }
+}
+
+// 空闲的发送线程阻塞等待，不占用 CPU（4 个空转线程 200ms 内会消耗数百毫秒 CPU 时间）
+TEST(ExecutionAdapterShimTest, PipelinedIdleSendersBlock) {
+    auto inner = std::make_shared<BlockingAdapter>(std::chrono::microseconds(0));
+    PipelinedExecutionAdapter adapter(inner, 4, 64);
+    ASSERT_TRUE(adapter.connect());
+    std::clock_t cpu_begin = std::clock();
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    double cpu_ms = 1000.0 * static_cast<double>(std::clock() - cpu_begin) / CLOCKS_PER_SEC;
+    EXPECT_LT(cpu_ms, 100.0);
+
+    // 阻塞中的发送线程被新请求唤醒
+    oms::Order order = make_order("A", "OMS_IDLE");
+    OrderRequest request{1, &order};
+    ASSERT_EQ(adapter.send_orders(&request, 1), 1u);
+    EXPECT_EQ(drain(adapter, 1).size(), 1u);
+    adapter.disconnect();
+}
+
+// 完成环满时发送线程阻塞等待，OMS 取走通知后继续，不丢弃任何完成通知
+TEST(ExecutionAdapterShimTest, PipelinedBlocksOnFullCompletionRing) {
+    auto inner = std::make_shared<BlockingAdapter>(std::chrono::microseconds(0));
+    PipelinedExecutionAdapter adapter(inner, 2, 8);
+    ASSERT_TRUE(adapter.connect());
+    std::vector<oms::Order> orders;
+    for (int i = 0; i < 64; ++i) {
+        std::string id = "OMS" + std::to_string(i);
+        orders.push_back(make_order(id, id));
+    }
+    size_t submitted = 0;
+    std::vector<OrderCompletion> completions;
+    OrderCompletion buffer[4];
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (completions.size() < orders.size() && std::chrono::steady_clock::now() < deadline) {
+        // 先一直提交到提交环满（此时完成环已满、发送线程阻塞），再取走少量通知让其继续
+        size_t accepted = 0;
+        if (submitted < orders.size()) {
+            OrderRequest request{submitted + 1, &orders[submitted]};
+            accepted = adapter.send_orders(&request, 1);
+            submitted += accepted;
+        }
+        if (accepted == 0) {
+            size_t n = adapter.poll_completions(buffer, 4);
+            completions.insert(completions.end(), buffer, buffer + n);
+        }
+    }
+    adapter.disconnect();
+    EXPECT_EQ(completions.size(), orders.size());
+}
+
+// 提交环已满时 send_orders 返回已受理的数量，剩余部分由调用方重试
+TEST(ExecutionAdapterShimTest, PipelinedBackpressure) {
+    auto inner = std::make_shared<BlockingAdapter>(std::chrono::milliseconds(20));
+    PipelinedExecutionAdapter adapter(inner, 2, 8);
+    ASSERT_TRUE(adapter.connect());
+    // 发送线程各自卡在一次往返中，请求停留在提交环中
+    std::vector<oms::Order> orders(32, make_order("A"));
+    std::vector<OrderRequest> requests;
+    for (size_t i = 0; i < orders.size(); ++i) {
+        requests.push_back({i + 1, &orders[i]});
+    }
+    size_t accepted = adapter.send_orders(requests.data(), requests.size());
+    EXPECT_GT(accepted, 0u);
+    EXPECT_LT(accepted, requests.size());
+
+    std::vector<OrderCompletion> completions = drain(adapter, accepted);
+    EXPECT_EQ(completions.size(), accepted);
+    adapter.disconnect();
+}
+
+// 未连接（或已断开）时拒绝提交，请求不会滞留在提交环中
+TEST(ExecutionAdapterShimTest, PipelinedRejectsWhileDisconnected) {
+    auto inner = std::make_shared<BlockingAdapter>(std::chrono::microseconds(0));
+    PipelinedExecutionAdapter adapter(inner, 2, 8);
+    oms::Order order = make_order("A", "OMS_OFF");
+    OrderRequest request{1, &order};
+    EXPECT_EQ(adapter.send_orders(&request, 1), 0u);
+    EXPECT_FALSE(adapter.submit_cancel(2, "OMS_OFF"));
+    EXPECT_FALSE(adapter.submit_modify(3, order));
+    EXPECT_EQ(adapter.in_flight(), 0u);
+
+    ASSERT_TRUE(adapter.connect());
+    ASSERT_EQ(adapter.send_orders(&request, 1), 1u);
+    EXPECT_EQ(drain(adapter, 1).size(), 1u);
+    adapter.disconnect();
+    EXPECT_EQ(adapter.send_orders(&request, 1), 0u);
+    EXPECT_EQ(inner->calls().size(), 1u);
+}
+
+// 完成环满、发送线程阻塞时断开：disconnect() 不挂起，无法入环的完成通知计入 completions_dropped
+TEST(ExecutionAdapterShimTest, PipelinedDisconnectWithFullCompletionRing) {
+    auto inner = std::make_shared<BlockingAdapter>(std::chrono::microseconds(0));
+    PipelinedExecutionAdapter adapter(inner, 2, 8);
+    ASSERT_TRUE(adapter.connect());
+    std::vector<oms::Order> orders;
+    for (int i = 0; i < 16; ++i) {
+        std::string id = "OMS_FULL" + std::to_string(i);
+        orders.push_back(make_order(id, id));
+    }
+    size_t submitted = 0;
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (submitted < orders.size() && std::chrono::steady_clock::now() < deadline) {
+        OrderRequest request{submitted + 1, &orders[submitted]};
+        submitted += adapter.send_orders(&request, 1);
+    }
+    ASSERT_GT(submitted, 8u);    // 完成环（容量 8）已满，至少一个发送线程阻塞在入环上
+
+    adapter.disconnect();
+    OrderCompletion buffer[16];
+    size_t polled = adapter.poll_completions(buffer, 16);
+    EXPECT_EQ(polled, 8u);
+    EXPECT_EQ(polled + adapter.completions_dropped(), submitted);
+}
+
+// 性能测试：同步完成外壳的单笔提交 + 取回开销
+TEST(ExecutionAdapterShimTest, PerformanceTest) {
+    auto adapter = make_async_adapter(std::make_shared<BlockingAdapter>(std::chrono::microseconds(0)));
+    oms::Order order = make_order("A");
+    OrderCompletion out[1];
+    const int kIterations = 100000;
+    auto begin = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < kIterations; ++i) {
+        OrderRequest request{static_cast<uint64_t>(i), &order};
+        adapter->send_orders(&request, 1);
+        adapter->poll_completions(out, 1);
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count();
+    std::cout << "SyncCompletionAdapter send+poll: " << static_cast<double>(ns) / kIterations << " ns/op" << std::endl;
+}
@@ -0,0 +1,318 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <deque>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include "core/ems/smart_order_router.h"
+#include "plugins/execution_adapters/sim_exchange/sim_exchange_adapter.h"
+
+using namespace quant::core;
+using namespace quant::core::ems;
+
+namespace {
+
+// 由测试驱动的异步适配器：记录提交的报单与撤单，完成通知由测试逐条注入
+class FakeVenue : public IAsyncExecutionAdapter {
+public:
+    explicit FakeVenue(std::string id) : id_(std::move(id)) {}
+
+    bool connect() override { return true; }
+    void disconnect() override {}
+    ExecutionResult send_order(const oms::Order&) override { return ExecutionResult(); }
+    ExecutionResult cancel_order(const std::string&) override { return ExecutionResult(); }
+    ExecutionResult modify_order(const oms::Order&) override { return ExecutionResult(); }
+    std::vector<oms::Order> query_orders(const std::string& = "") override { return {}; }
+    std::vector<oms::Trade> query_trades(const std::string& = "") override { return {}; }
+    std::string id() const override { return id_; }
+    std::vector<std::string> supported_instruments() const override { return {"IF2406"}; }
+    void set_order_callback(OrderCallback) override {}
+    void set_trade_callback(TradeCallback) override {}
+
+    size_t send_orders(const OrderRequest* requests, size_t count) override {
+        for (size_t i = 0; i < count; ++i) {
+            sends.push_back(requests[i].request_id);
+        }
+        return count;
+    }
+    bool submit_cancel(uint64_t request_id, const std::string& order_id) override {
+        cancels.push_back(order_id);
+        cancel_requests.push_back(request_id);
+        return true;
+    }
+    bool submit_modify(uint64_t, const oms::Order&) override { return true; }
+    size_t poll_completions(OrderCompletion* out, size_t max) override {
+        size_t n = 0;
+        while (n < max && !pending_.empty()) {
+            out[n++] = pending_.front();
+            pending_.pop_front();
+        }
+        return n;
+    }
+
+    // 注入完成通知
+    void complete(uint64_t request_id, OrderRequestType type, bool success) {
+        OrderCompletion completion;
+        completion.request_id = request_id;
+        completion.type = type;
+        completion.result.success = success;
+        completion.result.order_id = id_ + "-" + std::to_string(request_id);
+        pending_.push_back(completion);
+    }
+
+    std::vector<uint64_t> sends;
+    std::vector<std::string> cancels;
+    std::vector<uint64_t> cancel_requests;
+
+private:
+    std::string id_;
+    std::deque<OrderCompletion> pending_;
+};
+
+oms::Order make_order(const std::string& order_id) {
+    oms::Order order;
+    order.order_id = order_id;
+    order.instrument = "IF2406";
+    order.price = 3500.0;
+    order.volume = 1;
+    return order;
+}
+
+constexpr int64_t kUs = 1000;
+constexpr int64_t kMs = 1000 * kUs;
+
+// 路由器 + 两个交易通道，ack_timeout 1ms，request_timeout 10ms，冷却 1s
+struct RouterFixture {
+    explicit RouterFixture(bool failover) {
+        RouterConfig config;
+        config.ack_timeout_us = 1000;
+        config.request_timeout_us = 10000;
+        config.cooldown_us = 1000000;
+        config.failover_unacked = failover;
+        router = std::make_unique<SmartOrderRouter>(config);
+        router->add_adapter(a);
+        router->add_adapter(b);
+    }
+
+    std::shared_ptr<FakeVenue> a = std::make_shared<FakeVenue>("A");
+    std::shared_ptr<FakeVenue> b = std::make_shared<FakeVenue>("B");
+    std::unique_ptr<SmartOrderRouter> router;
+    std::vector<RoutedCompletion> out;
+};
+
+} // namespace
+
+// 报单路由到 EWMA 最低的健康通道；慢通道的 RTT 超过未试探通道的假定 RTT 后流量转向后者
+TEST(SmartOrderRouterTest, RoutesToLowestLatency) {
+    RouterFixture f(false);
+    ASSERT_TRUE(f.router->route(1, make_order("OMS1"), 0));
+    ASSERT_EQ(f.a->sends, (std::vector<uint64_t>{1}));
+    f.a->complete(1, OrderRequestType::kSend, true);
+    EXPECT_EQ(f.router->poll(f.out, 5 * kMs), 1u);        // A 的 RTT 5ms，高于 B 的假定 RTT 1ms
+    EXPECT_EQ(f.out[0].adapter, 0u);
+    EXPECT_TRUE(f.out[0].completion.result.success);
+
+    ASSERT_TRUE(f.router->route(2, make_order("OMS2"), 5 * kMs));
+    EXPECT_EQ(f.b->sends, (std::vector<uint64_t>{2}));
+    EXPECT_FALSE(f.router->route(2, make_order("OMS2"), 5 * kMs));     // request_id 重复
+    oms::Order unknown = make_order("OMS3");
+    unknown.instrument = "cu2410";
+    EXPECT_FALSE(f.router->route(3, unknown, 5 * kMs));                // 没有通道能执行该合约
+}
+
+// 默认不转投：确认超时的通道被摘除，其上的请求留在原地，迟到的确认照常上报
+TEST(SmartOrderRouterTest, DegradeWithoutFailoverKeepsOrdersInPlace) {
+    RouterFixture f(false);
+    ASSERT_TRUE(f.router->route(1, make_order("OMS1"), 0));
+    EXPECT_EQ(f.router->poll(f.out, 2 * kMs), 0u);
+    EXPECT_FALSE(f.router->health()[0].healthy);
+    EXPECT_TRUE(f.a->cancels.empty());
+    EXPECT_TRUE(f.b->sends.empty());
+
+    ASSERT_TRUE(f.router->route(2, make_order("OMS2"), 2 * kMs));      // 新报单避开劣化通道
+    EXPECT_EQ(f.b->sends, (std::vector<uint64_t>{2}));
+
+    f.a->complete(1, OrderRequestType::kSend, true);
+    ASSERT_EQ(f.router->poll(f.out, 3 * kMs), 1u);
+    EXPECT_EQ(f.out[0].adapter, 0u);
+    EXPECT_EQ(f.out[0].completion.request_id, 1u);
+    EXPECT_EQ(f.router->health()[0].in_flight, 0u);
+}
+
+// 开启转投：先以原报单的 request_id 与 OMS 订单号在原通道撤单，撤单成功后才用同一 request_id 转投；
+// 原通道之后的残留报单通知被丢弃
+TEST(SmartOrderRouterTest, FailoverCancelsBeforeResubmitting) {
+    RouterFixture f(true);
+    ASSERT_TRUE(f.router->route(7, make_order("OMS7"), 0));
+    EXPECT_EQ(f.router->poll(f.out, 2 * kMs), 0u);
+    EXPECT_EQ(f.a->cancels, (std::vector<std::string>{"OMS7"}));
+    EXPECT_EQ(f.a->cancel_requests, (std::vector<uint64_t>{7}));
+    EXPECT_TRUE(f.b->sends.empty());                                 // 撤单结果返回前不转投
+
+    f.a->complete(7, OrderRequestType::kCancel, true);
+    EXPECT_EQ(f.router->poll(f.out, 3 * kMs), 0u);
+    EXPECT_EQ(f.b->sends, (std::vector<uint64_t>{7}));
+    EXPECT_EQ(f.router->health()[0].failovers, 1u);
+    EXPECT_EQ(f.router->health()[0].in_flight, 0u);
+    EXPECT_EQ(f.router->health()[1].in_flight, 1u);
+
+    f.a->complete(7, OrderRequestType::kSend, false);               // 原通道的残留通知
+    f.b->complete(7, OrderRequestType::kSend, true);
+    ASSERT_EQ(f.router->poll(f.out, 4 * kMs), 1u);
+    EXPECT_EQ(f.out[0].adapter, 1u);
+    EXPECT_TRUE(f.out[0].completion.result.success);
+}
+
+// 撤单失败：订单可能已在原通道上，不转投；原通道的确认照常上报
+TEST(SmartOrderRouterTest, FailedCancelKeepsOrderOnOriginalVenue) {
+    RouterFixture f(true);
+    ASSERT_TRUE(f.router->route(1, make_order("OMS1"), 0));
+    f.router->poll(f.out, 2 * kMs);
+    f.a->complete(1, OrderRequestType::kCancel, false);
+    EXPECT_EQ(f.router->poll(f.out, 3 * kMs), 0u);
+    EXPECT_TRUE(f.b->sends.empty());
+    EXPECT_EQ(f.router->health()[0].failovers_aborted, 1u);
+
+    f.a->complete(1, OrderRequestType::kSend, true);
+    ASSERT_EQ(f.router->poll(f.out, 4 * kMs), 1u);
+    EXPECT_EQ(f.out[0].adapter, 0u);
+    EXPECT_EQ(f.router->health()[0].in_flight, 0u);
+}
+
+// 撤单结果返回前原报单先被确认：确认上报、不转投，之后的撤单结果被吸收
+TEST(SmartOrderRouterTest, AckDuringFailoverCancelStopsFailover) {
+    RouterFixture f(true);
+    ASSERT_TRUE(f.router->route(1, make_order("OMS1"), 0));
+    f.router->poll(f.out, 2 * kMs);
+    f.a->complete(1, OrderRequestType::kSend, true);
+    ASSERT_EQ(f.router->poll(f.out, 3 * kMs), 1u);
+    EXPECT_EQ(f.out[0].adapter, 0u);
+
+    f.out.clear();
+    f.a->complete(1, OrderRequestType::kCancel, true);
+    EXPECT_EQ(f.router->poll(f.out, 4 * kMs), 0u);
+    EXPECT_TRUE(f.b->sends.empty());
+    EXPECT_EQ(f.router->health()[0].failovers_aborted, 1u);
+    EXPECT_EQ(f.router->health()[0].in_flight, 0u);
+}
+
+// 撤单成功但没有其他健康通道：上报失败的报单完成通知
+TEST(SmartOrderRouterTest, FailoverWithoutHealthyVenueFails) {
+    RouterConfig config;
+    config.ack_timeout_us = 1000;
+    config.failover_unacked = true;
+    SmartOrderRouter router(config);
+    auto venue = std::make_shared<FakeVenue>("ONLY");
+    router.add_adapter(venue);
+    std::vector<RoutedCompletion> out;
+
+    ASSERT_TRUE(router.route(1, make_order("OMS1"), 0));
+    router.poll(out, 2 * kMs);
+    venue->complete(1, OrderRequestType::kCancel, true);
+    ASSERT_EQ(router.poll(out, 3 * kMs), 1u);
+    EXPECT_EQ(out[0].completion.request_id, 1u);
+    EXPECT_EQ(out[0].completion.type, OrderRequestType::kSend);
+    EXPECT_FALSE(out[0].completion.result.success);
+    EXPECT_EQ(venue->sends.size(), 1u);
+}
+
+// 撤单失败后一直等不到确认：超过 request_timeout 上报失败并移除，迟到的确认被丢弃
+TEST(SmartOrderRouterTest, AwaitAckTimeoutFailsRequest) {
+    RouterFixture f(true);
+    ASSERT_TRUE(f.router->route(1, make_order("OMS1"), 0));
+    f.router->poll(f.out, 2 * kMs);
+    f.a->complete(1, OrderRequestType::kCancel, false);
+    EXPECT_EQ(f.router->poll(f.out, 3 * kMs), 0u);
+    EXPECT_EQ(f.router->poll(f.out, 10 * kMs), 0u);
+
+    ASSERT_EQ(f.router->poll(f.out, 11 * kMs), 1u);
+    EXPECT_EQ(f.out[0].adapter, 0u);
+    EXPECT_EQ(f.out[0].completion.request_id, 1u);
+    EXPECT_EQ(f.out[0].completion.type, OrderRequestType::kSend);
+    EXPECT_FALSE(f.out[0].completion.result.success);
+    EXPECT_EQ(f.router->health()[0].in_flight, 0u);
+    EXPECT_EQ(f.router->health()[0].timeouts, 1u);
+
+    f.a->complete(1, OrderRequestType::kSend, true);
+    EXPECT_EQ(f.router->poll(f.out, 12 * kMs), 0u);
+}
+
+// 不转投时劣化通道上的请求同样受 request_timeout 约束
+TEST(SmartOrderRouterTest, DeadVenueRequestTimesOut) {
+    RouterFixture f(false);
+    ASSERT_TRUE(f.router->route(1, make_order("OMS1"), 0));
+    EXPECT_EQ(f.router->poll(f.out, 2 * kMs), 0u);
+    EXPECT_FALSE(f.router->health()[0].healthy);
+    ASSERT_EQ(f.router->poll(f.out, 11 * kMs), 1u);
+    EXPECT_FALSE(f.out[0].completion.result.success);
+    EXPECT_EQ(f.router->health()[0].in_flight, 0u);
+}
+
+// 模拟交易所：劣化时的撤单经 request_id 定位尚未确认的报单并在交易所生效；
+// 出站延迟使确认先于撤单结果到达，因此不转投，订单已在原交易所撤销
+TEST(SmartOrderRouterTest, FailoverCancelReachesSimExchange) {
+    using quant::plugins::execution_adapters::sim_exchange::SimExchangeAdapter;
+    auto slow = std::make_shared<SimExchangeAdapter>(
+        std::unordered_map<std::string, std::string>{{"outbound_latency", "fixed:100000"}});
+    auto fast = std::make_shared<SimExchangeAdapter>(std::unordered_map<std::string, std::string>{});
+    ASSERT_TRUE(slow->connect());
+    ASSERT_TRUE(fast->connect());
+
+    RouterConfig config;
+    config.ack_timeout_us = 20000;
+    config.failover_unacked = true;
+    SmartOrderRouter router(config);
+    router.add_adapter(slow, {"IF2406"});
+    router.add_adapter(fast, {"IF2406"});
+
+    auto now = []() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    };
+    std::vector<RoutedCompletion> out;
+    ASSERT_TRUE(router.route(1, make_order("OMS1"), now()));
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    while (router.health()[0].in_flight > 0 && std::chrono::steady_clock::now() < deadline) {
+        router.poll(out, now());
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    AdapterHealth health = router.health()[0];
+    EXPECT_FALSE(health.healthy);
+    EXPECT_EQ(health.in_flight, 0u);
+    EXPECT_EQ(health.failovers_aborted, 1u);
+    ASSERT_EQ(out.size(), 1u);
+    EXPECT_EQ(out[0].adapter, 0u);
+    EXPECT_TRUE(out[0].completion.result.success);
+    EXPECT_EQ(out[0].completion.result.order_id, "SIM1");
+    EXPECT_EQ(slow->stats().requests, 2u);          // 报单 + 撤单
+    EXPECT_EQ(slow->stats().rejects, 0u);
+    EXPECT_EQ(slow->stats().resting_orders, 0u);
+    EXPECT_EQ(fast->stats().requests, 0u);
+    slow->disconnect();
+    fast->disconnect();
+}
+
+// 性能测试：route + 确认回收的单次开销
+TEST(SmartOrderRouterTest, PerformanceTest) {
+    SmartOrderRouter router;
+    auto venue = std::make_shared<FakeVenue>("PERF");
+    router.add_adapter(venue);
+    std::vector<RoutedCompletion> out;
+    oms::Order order = make_order("OMS");
+    const int kIterations = 100000;
+    auto begin = std::chrono::high_resolution_clock::now();
+    for (int i = 1; i <= kIterations; ++i) {
+        router.route(static_cast<uint64_t>(i), order, i * kUs);
+        venue->complete(static_cast<uint64_t>(i), OrderRequestType::kSend, true);
+        out.clear();
+        router.poll(out, i * kUs + 100);
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    EXPECT_EQ(router.health()[0].routed, static_cast<uint64_t>(kIterations));
+
+    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count();
+    std::cout << "SmartOrderRouter route+poll: " << static_cast<double>(ns) / kIterations << " ns/op" << std::endl;
+}
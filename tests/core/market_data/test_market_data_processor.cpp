@@ -0,0 +1,181 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <unistd.h>
+#include "core/market_data/market_data_processor.h"
+
+using namespace quant::core::market_data;
+using quant::base::common::checkpoint::CheckpointImage;
+using quant::base::common::checkpoint::CheckpointOptions;
+using quant::base::common::checkpoint::Checkpointer;
+using quant::base::utils::tick_bus::BusTick;
+using quant::base::utils::tick_bus::TickBusPublisher;
+using quant::base::utils::tick_bus::TickBusReader;
+using quant::base::utils::tick_decoder::CtpDepthMarketData;
+using quant::core::event_bus::EventBus;
+using quant::core::event_bus::TickEvent;
+
+namespace {
+
+const char kTickerFrame[] =
+    R"({"e":"24hrTicker","E":1700000000123,"s":"BTCUSDT","c":"4.00000200","b":"4.00000000","B":"7",)"
+    R"("a":"4.00000200","A":"11","o":"99.00000000","h":"100.00000000","l":"0.10000000","v":"8913.30000000"})";
+
+RawTickData make_raw(const std::string& data_source, const std::string& raw_data) {
+    RawTickData raw;
+    raw.data_source = data_source;
+    raw.raw_data = raw_data;
+    return raw;
+}
+
+std::string ctp_frame(const char* instrument, double last_price) {
+    CtpDepthMarketData field;
+    std::memset(&field, 0, sizeof(field));
+    std::strcpy(field.TradingDay, "20240102");
+    std::strcpy(field.ActionDay, "20240102");
+    std::strcpy(field.InstrumentID, instrument);
+    std::strcpy(field.UpdateTime, "09:30:01");
+    field.LastPrice = last_price;
+    field.Volume = 100;
+    return std::string(reinterpret_cast<const char*>(&field), sizeof(field));
+}
+
+// 事件总线为进程单例且不支持退订：只订阅一次，各用例取走自己发布的行情
+class PublishedTicks {
+public:
+    static PublishedTicks& instance() {
+        static PublishedTicks ticks;
+        return ticks;
+    }
+
+    std::vector<TickData> take() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::vector<TickData> out;
+        out.swap(ticks_);
+        return out;
+    }
+
+private:
+    PublishedTicks() {
+        EventBus::instance().subscribe<TickEvent>([this](const TickEvent& event) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            ticks_.push_back(event.tick);
+        });
+    }
+
+    std::mutex mutex_;
+    std::vector<TickData> ticks_;
+};
+
+} // namespace
+
+// 原始帧按数据源解码后发布到事件总线；解码失败的帧计数后丢弃
+TEST(MarketDataProcessorTest, DecodesRawTicksOntoEventBus) {
+    PublishedTicks& published = PublishedTicks::instance();
+    published.take();
+    auto decode_errors = quant::base::common::metrics::MetricsRegistry::instance().counter("market_data.decode_errors");
+    uint64_t errors_before = decode_errors.value();
+
+    MarketDataProcessor processor(EventBus::instance());
+    processor.process_raw_tick("Binance", make_raw("Binance", kTickerFrame));
+    processor.process_raw_tick("CTP", make_raw("CTP", ctp_frame("rb2405", 3950.0)));
+    processor.process_raw_tick("CTP", make_raw("CTP", "short frame"));
+    processor.process_raw_tick("Binance", make_raw("Binance", R"({"e":"24hrTicker","c":"1.0"})"));
+
+    std::vector<TickData> ticks = published.take();
+    ASSERT_EQ(ticks.size(), 2u);
+    EXPECT_EQ(ticks[0].instrument, "BTCUSDT");
+    EXPECT_DOUBLE_EQ(ticks[0].last_price, 4.000002);
+    EXPECT_DOUBLE_EQ(ticks[0].bid_price[0], 4.0);
+    EXPECT_EQ(ticks[0].ask_volume[0], 11);
+    EXPECT_EQ(ticks[1].instrument, "rb2405");
+    EXPECT_DOUBLE_EQ(ticks[1].last_price, 3950.0);
+    EXPECT_EQ(ticks[1].volume, 100);
+    EXPECT_EQ(decode_errors.value() - errors_before, 2u);
+}
+
+// 行情路径更新最新行情表；检查点采集在下一条行情到达时交接，恢复后与写入前一致
+TEST(MarketDataProcessorTest, LastTicksCheckpointRoundTrip) {
+    std::string path = "/tmp/qt_market_data_test_" + std::to_string(getpid()) + ".bin";
+    std::remove(path.c_str());
+    CheckpointOptions options;
+    options.path = path;
+    auto checkpointer = Checkpointer::create(options);
+    ASSERT_TRUE(checkpointer);
+
+    MarketDataProcessor processor(EventBus::instance());
+    ASSERT_TRUE(processor.register_checkpoints(*checkpointer, std::chrono::milliseconds(2000)));
+    processor.process_raw_tick("CTP", make_raw("CTP", ctp_frame("rb2405", 3950.0)));
+    processor.process_raw_tick("CTP", make_raw("CTP", ctp_frame("rb2405", 3951.0)));
+    processor.process_raw_tick("Binance", make_raw("Binance", kTickerFrame));
+
+    TickData tick{};
+    ASSERT_TRUE(processor.get_last_tick("CTP", "rb2405", tick));
+    EXPECT_DOUBLE_EQ(tick.last_price, 3951.0);
+    EXPECT_FALSE(processor.get_last_tick("Binance", "rb2405", tick));
+
+    // 检查点线程发出请求后阻塞，行情线程在下一条行情上交接快照
+    std::atomic<bool> done{false};
+    bool committed = false;
+    std::thread checkpoint([&]() {
+        committed = checkpointer->checkpoint_now();
+        done.store(true);
+    });
+    while (!done.load()) {
+        processor.process_raw_tick("CTP", make_raw("CTP", ctp_frame("rb2405", 3952.0)));
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    checkpoint.join();
+    ASSERT_TRUE(committed);
+    PublishedTicks::instance().take();
+
+    auto image = CheckpointImage::open(path);
+    ASSERT_TRUE(image);
+    MarketDataProcessor restored(EventBus::instance());
+    EXPECT_EQ(restored.restore_checkpoint(*image), 2u);
+    ASSERT_TRUE(restored.get_last_tick("CTP", "rb2405", tick));
+    EXPECT_DOUBLE_EQ(tick.last_price, 3952.0);
+    EXPECT_EQ(tick.volume, 100);
+    ASSERT_TRUE(restored.get_last_tick("Binance", "BTCUSDT", tick));
+    EXPECT_DOUBLE_EQ(tick.last_price, 4.000002);
+    EXPECT_EQ(tick.ask_volume[0], 11);
+    std::remove(path.c_str());
+}
+
+// 挂接行情总线后，解码成功的行情写入共享内存，进程外读者按发布顺序读到；解码失败的帧不写入
+TEST(MarketDataProcessorTest, PublishesDecodedTicksToTickBus) {
+    std::string name = "/qt_market_data_test_bus_" + std::to_string(getpid());
+    std::shared_ptr<TickBusPublisher> publisher = TickBusPublisher::create(name, 1024);
+    ASSERT_TRUE(publisher);
+    auto reader = TickBusReader::open(name, TickBusReader::Start::kOldest);
+    ASSERT_TRUE(reader);
+
+    MarketDataProcessor processor(EventBus::instance());
+    processor.process_raw_tick("CTP", make_raw("CTP", ctp_frame("rb2405", 3949.0)));   // 挂接前不写
+    processor.attach_tick_bus(publisher);
+    processor.process_raw_tick("CTP", make_raw("CTP", ctp_frame("rb2405", 3950.0)));
+    processor.process_raw_tick("CTP", make_raw("CTP", "short frame"));
+    processor.process_raw_tick("Binance", make_raw("Binance", kTickerFrame));
+    PublishedTicks::instance().take();
+
+    std::vector<TickData> ticks;
+    BusTick record{};
+    while (reader->next(record)) {
+        TickData tick{};
+        quant::base::utils::tick_bus::from_bus_tick(record, tick);
+        EXPECT_GT(record.publish_ns, 0);
+        ticks.push_back(tick);
+    }
+    ASSERT_EQ(ticks.size(), 2u);
+    EXPECT_EQ(ticks[0].instrument, "rb2405");
+    EXPECT_DOUBLE_EQ(ticks[0].last_price, 3950.0);
+    EXPECT_EQ(ticks[1].instrument, "BTCUSDT");
+    EXPECT_DOUBLE_EQ(ticks[1].last_price, 4.000002);
+    EXPECT_EQ(publisher->published(), 2u);
+    EXPECT_EQ(publisher->contended(), 0u);
+}
@@ -0,0 +1,105 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "core/oms/order_pool.h"
+
+using namespace quant::core::oms;
+
+// 创建、绑定交易所订单号，按两种编号查找到同一订单；释放后两种编号都失效
+TEST(OrderPoolTest, CreateBindFindRelease) {
+    OrderPool pool(4);
+    InternalOrderId id = kInvalidOrderId;
+    Order* order = pool.create(id);
+    ASSERT_NE(order, nullptr);
+    ASSERT_NE(id, kInvalidOrderId);
+    order->instrument = "IF2406";
+    order->volume = 2;
+    EXPECT_EQ(pool.size(), 1u);
+    EXPECT_EQ(pool.find(id), order);
+
+    EXPECT_TRUE(pool.bind_exchange_id(id, "EX-1001"));
+    EXPECT_FALSE(pool.bind_exchange_id(id, "EX-1002"));            // 每个订单只绑定一次
+    InternalOrderId found_id = kInvalidOrderId;
+    EXPECT_EQ(pool.find_by_exchange_id("EX-1001", &found_id), order);
+    EXPECT_EQ(found_id, id);
+    EXPECT_EQ(pool.find_by_exchange_id("EX-1001")->instrument, "IF2406");
+    EXPECT_EQ(pool.find_by_exchange_id("EX-1002"), nullptr);
+
+    // 交易所订单号不可重复，超长编号无法绑定
+    InternalOrderId other = kInvalidOrderId;
+    ASSERT_NE(pool.create(other), nullptr);
+    EXPECT_FALSE(pool.bind_exchange_id(other, "EX-1001"));
+    EXPECT_FALSE(pool.bind_exchange_id(other, std::string(ExchangeOrderId::kMaxLength + 1, 'x')));
+    EXPECT_TRUE(pool.bind_exchange_id(other, std::string(ExchangeOrderId::kMaxLength, 'x')));
+
+    EXPECT_TRUE(pool.release(id));
+    EXPECT_FALSE(pool.release(id));
+    EXPECT_EQ(pool.find(id), nullptr);
+    EXPECT_EQ(pool.find_by_exchange_id("EX-1001"), nullptr);
+    EXPECT_EQ(pool.size(), 1u);
+
+    // 释放后交易所订单号可被新订单绑定
+    InternalOrderId again = kInvalidOrderId;
+    ASSERT_NE(pool.create(again), nullptr);
+    EXPECT_TRUE(pool.bind_exchange_id(again, "EX-1001"));
+    EXPECT_EQ(pool.find_by_exchange_id("EX-1001", &found_id), pool.find(again));
+    EXPECT_EQ(found_id, again);
+}
+
+// 槽位复用后旧句柄失效：查找、绑定、释放都被拒绝，不会误操作新订单
+TEST(OrderPoolTest, StaleHandleRejectedAfterReuse) {
+    OrderPool pool(1);
+    InternalOrderId stale = kInvalidOrderId;
+    ASSERT_NE(pool.create(stale), nullptr);
+    InternalOrderId overflow = kInvalidOrderId;
+    EXPECT_EQ(pool.create(overflow), nullptr);                      // 池满
+    EXPECT_EQ(overflow, kInvalidOrderId);
+    ASSERT_TRUE(pool.release(stale));
+
+    InternalOrderId fresh = kInvalidOrderId;
+    Order* order = pool.create(fresh);
+    ASSERT_NE(order, nullptr);
+    EXPECT_NE(fresh, stale);
+    EXPECT_EQ(pool.find(stale), nullptr);
+    EXPECT_FALSE(pool.bind_exchange_id(stale, "EX-2001"));
+    EXPECT_FALSE(pool.release(stale));
+    EXPECT_EQ(pool.find(fresh), order);
+
+    EXPECT_TRUE(pool.bind_exchange_id(fresh, "EX-2001"));
+    InternalOrderId found_id = kInvalidOrderId;
+    EXPECT_EQ(pool.find_by_exchange_id("EX-2001", &found_id), order);
+    EXPECT_EQ(found_id, fresh);
+    EXPECT_EQ(pool.find(kInvalidOrderId), nullptr);
+}
+
+// 性能测试：创建 + 绑定 + 按交易所订单号查找 + 释放的单次开销
+TEST(OrderPoolTest, PerformanceTest) {
+    const int kOrders = 1024;
+    const int kRounds = 100;
+    OrderPool pool(kOrders);
+    std::vector<std::string> exchange_ids;
+    for (int i = 0; i < kOrders; ++i) {
+        exchange_ids.push_back("EX-" + std::to_string(i));
+    }
+    std::vector<InternalOrderId> ids(kOrders);
+
+    auto begin = std::chrono::high_resolution_clock::now();
+    for (int round = 0; round < kRounds; ++round) {
+        for (int i = 0; i < kOrders; ++i) {
+            ASSERT_NE(pool.create(ids[i]), nullptr);
+            ASSERT_TRUE(pool.bind_exchange_id(ids[i], exchange_ids[i]));
+        }
+        for (int i = 0; i < kOrders; ++i) {
+            ASSERT_NE(pool.find_by_exchange_id(exchange_ids[i]), nullptr);
+            ASSERT_TRUE(pool.release(ids[i]));
+        }
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    EXPECT_EQ(pool.size(), 0u);
+
+    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count();
+    std::cout << "OrderPool create+bind+find+release: "
+              << static_cast<double>(ns) / (kOrders * kRounds) << " ns/order" << std::endl;
+}
@@ -0,0 +1,193 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <chrono>
+#include <random>
+#include "core/risk/pre_trade_risk.h"
+
+using namespace quant::core::risk;
+
+namespace {
+
+InstrumentRule make_instrument_rule() {
+    InstrumentRule rule;
+    rule.multiplier = 10.0;
+    rule.tick_size = 1.0;
+    rule.max_order_volume = 100;
+    rule.max_order_notional = 1000000.0;
+    return rule;
+}
+
+RiskOrder make_order(uint32_t account, uint32_t instrument, bool is_buy, double price, int64_t volume) {
+    RiskOrder order;
+    order.account = account;
+    order.instrument = instrument;
+    order.is_buy = is_buy;
+    order.price = price;
+    order.volume = volume;
+    return order;
+}
+
+} // namespace
+
+// 单笔数量/金额与未配置合约
+TEST(PreTradeRiskTest, StatelessChecks) {
+    PreTradeRiskEngine engine(2, 2);
+    ASSERT_TRUE(engine.set_instrument_rule(0, make_instrument_rule()));
+
+    EXPECT_EQ(engine.check(make_order(0, 1, true, 100.0, 1)), RiskDecision::kUnknownInstrument);
+    EXPECT_EQ(engine.check(make_order(5, 0, true, 100.0, 1)), RiskDecision::kUnknownInstrument);
+    EXPECT_EQ(engine.check(make_order(0, 0, true, 100.0, 0)), RiskDecision::kOrderVolumeLimit);
+    EXPECT_EQ(engine.check(make_order(0, 0, true, 100.0, 101)), RiskDecision::kOrderVolumeLimit);
+    EXPECT_EQ(engine.check(make_order(0, 0, true, 2000.0, 100)), RiskDecision::kOrderNotionalLimit);
+    EXPECT_EQ(engine.rejected(RiskDecision::kUnknownInstrument), 2u);
+}
+
+// 持仓限额包含在途数量，成交与撤单后释放
+TEST(PreTradeRiskTest, PositionLimit) {
+    PreTradeRiskEngine engine(1, 1);
+    engine.set_instrument_rule(0, make_instrument_rule());
+    engine.set_position_limit(0, 0, 10, 5);
+
+    auto buy = make_order(0, 0, true, 100.0, 6);
+    EXPECT_EQ(engine.check(buy), RiskDecision::kAccepted);
+    EXPECT_EQ(engine.check(buy), RiskDecision::kPositionLimit);   // 6 + 6 > 10
+    EXPECT_EQ(engine.pending_volume(0, 0, true), 6);
+
+    engine.on_fill(buy, 4);
+    engine.on_order_closed(buy, 2);
+    EXPECT_EQ(engine.position(0, 0), 4);
+    EXPECT_EQ(engine.pending_volume(0, 0, true), 0);
+
+    // 多头 4 手时，空头敞口 = 卖量 - 4
+    EXPECT_EQ(engine.check(make_order(0, 0, false, 100.0, 9)), RiskDecision::kAccepted);
+    EXPECT_EQ(engine.check(make_order(0, 0, false, 100.0, 1)), RiskDecision::kPositionLimit);
+}
+
+// 账户在途金额限额
+TEST(PreTradeRiskTest, AccountNotionalLimit) {
+    PreTradeRiskEngine engine(1, 1);
+    engine.set_instrument_rule(0, make_instrument_rule());
+    AccountRule rule;
+    rule.max_outstanding_notional = 15000.0;
+    engine.set_account_rule(0, rule);
+
+    auto order = make_order(0, 0, true, 100.0, 10);     // 10000
+    EXPECT_EQ(engine.check(order), RiskDecision::kAccepted);
+    EXPECT_EQ(engine.check(order), RiskDecision::kAccountNotionalLimit);
+    EXPECT_DOUBLE_EQ(engine.outstanding_notional(0), 10000.0);
+    engine.on_order_closed(order, 10);
+    EXPECT_DOUBLE_EQ(engine.outstanding_notional(0), 0.0);
+    EXPECT_EQ(engine.check(order), RiskDecision::kAccepted);
+}
+
+// 报单频率限制
+TEST(PreTradeRiskTest, OrderRateLimit) {
+    PreTradeRiskEngine engine(1, 1);
+    engine.set_instrument_rule(0, make_instrument_rule());
+    AccountRule rule;
+    rule.orders_per_second = 10.0;
+    rule.order_burst = 3.0;
+    engine.set_account_rule(0, rule);
+
+    auto order = make_order(0, 0, true, 100.0, 1);
+    int64_t now = 1000000000;
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_EQ(engine.check(order, now), RiskDecision::kAccepted);
+    }
+    EXPECT_EQ(engine.check(order, now), RiskDecision::kOrderRateLimit);
+    EXPECT_EQ(engine.check(order, now + 100000000), RiskDecision::kAccepted);
+}
+
+// 自成交：买价不低于本方最低卖价即拒绝，卖单全部离场后恢复
+TEST(PreTradeRiskTest, SelfTradePrevention) {
+    PreTradeRiskEngine engine(2, 1);
+    engine.set_instrument_rule(0, make_instrument_rule());
+
+    auto ask = make_order(0, 0, false, 101.0, 1);
+    EXPECT_EQ(engine.check(ask), RiskDecision::kAccepted);
+    EXPECT_EQ(engine.check(make_order(0, 0, true, 100.0, 1)), RiskDecision::kAccepted);
+    EXPECT_EQ(engine.check(make_order(0, 0, true, 101.0, 1)), RiskDecision::kSelfTrade);
+    EXPECT_EQ(engine.check(make_order(1, 0, true, 101.0, 1)), RiskDecision::kAccepted);   // 其他账户不受影响
+    EXPECT_EQ(engine.check(make_order(0, 0, false, 100.0, 1)), RiskDecision::kSelfTrade);
+
+    engine.on_order_closed(ask, 1);
+    EXPECT_EQ(engine.check(make_order(0, 0, true, 101.0, 1)), RiskDecision::kAccepted);
+}
+
+// 多策略线程并发报单：任意时刻在途 + 持仓不突破限额，全部回报后计数归零
+TEST(PreTradeRiskTest, ConcurrentHammer) {
+    const int kNumThreads = 8;
+    const int kOrdersPerThread = 50000;
+    const int64_t kMaxLong = 50;
+    PreTradeRiskEngine engine(1, 4);
+    for (uint32_t i = 0; i < 4; ++i) {
+        engine.set_instrument_rule(i, make_instrument_rule());
+        engine.set_position_limit(0, i, kMaxLong, kMaxLong);
+    }
+
+    std::atomic<int64_t> accepted(0);
+    std::atomic<bool> violated(false);
+    std::atomic<int64_t> open_volume[4] = {};   // 已通过且未释放的数量（先释放计数再回报引擎）
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kNumThreads; ++t) {
+        threads.emplace_back([&, t]() {
+            std::mt19937 rng(t);
+            std::vector<RiskOrder> open;
+            for (int i = 0; i < kOrdersPerThread; ++i) {
+                auto order = make_order(0, rng() % 4, true, 100.0, 1 + rng() % 5);
+                if (engine.check(order) == RiskDecision::kAccepted) {
+                    accepted.fetch_add(1, std::memory_order_relaxed);
+                    open.push_back(order);
+                    if (open_volume[order.instrument].fetch_add(order.volume) + order.volume > kMaxLong) {
+                        violated = true;
+                    }
+                }
+                // 随机撤掉一部分在途订单，保持额度流转
+                if (!open.empty() && rng() % 2 == 0) {
+                    open_volume[open.back().instrument].fetch_sub(open.back().volume);
+                    engine.on_order_closed(open.back(), open.back().volume);
+                    open.pop_back();
+                }
+            }
+            for (const auto& order : open) {
+                open_volume[order.instrument].fetch_sub(order.volume);
+                engine.on_order_closed(order, order.volume);
+            }
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    EXPECT_FALSE(violated.load());
+    EXPECT_GT(accepted.load(), 0);
+    for (uint32_t i = 0; i < 4; ++i) {
+        EXPECT_EQ(engine.pending_volume(0, i, true), 0);
+        EXPECT_EQ(engine.position(0, i), 0);
+    }
+    EXPECT_DOUBLE_EQ(engine.outstanding_notional(0), 0.0);
+}
+
+// 性能测试
+TEST(PreTradeRiskTest, PerformanceTest) {
+    const int kNumOrders = 1000000;
+    PreTradeRiskEngine engine(4, 64);
+    for (uint32_t i = 0; i < 64; ++i) {
+        engine.set_instrument_rule(i, make_instrument_rule());
+    }
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < kNumOrders; ++i) {
+        auto order = make_order(i % 4, i % 64, true, 100.0, 1);
+        if (engine.check(order, i) == RiskDecision::kAccepted) {
+            engine.on_order_closed(order, 1);
+        }
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+
+    std::cout << "PreTradeRiskEngine Performance:" << std::endl;
+    std::cout << "  checked " << kNumOrders << " orders in " << elapsed << "ms" << std::endl;
+}
@@ -0,0 +1,205 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include "core/startup/startup_orchestrator.h"
+
+using namespace quant::core::startup;
+using quant::base::common::thread_pool::ThreadPool;
+
+namespace {
+
+// 记录组件完成顺序
+class Trace {
+public:
+    void record(const std::string& name) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        order_.push_back(name);
+    }
+    size_t position(const std::string& name) const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (size_t i = 0; i < order_.size(); ++i) {
+            if (order_[i] == name) {
+                return i;
+            }
+        }
+        return order_.size();
+    }
+    size_t size() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return order_.size();
+    }
+
+private:
+    mutable std::mutex mutex_;
+    std::vector<std::string> order_;
+};
+
+}  // namespace
+
+// 依赖顺序：被依赖的组件先完成
+TEST(StartupOrchestratorTest, RespectsDependencies) {
+    auto pool = ThreadPool::create(4);
+    StartupOrchestrator startup;
+    Trace trace;
+    auto stage = [&trace](const std::string& name) {
+        return [&trace, name]() {
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            trace.record(name);
+            return true;
+        };
+    };
+    // 依赖可以引用之后注册的组件
+    ASSERT_TRUE(startup.add("order_manager", stage("order_manager"),
+                            {"execution_manager", "risk_manager", "account_manager"}));
+    ASSERT_TRUE(startup.add("account_manager", stage("account_manager")));
+    ASSERT_TRUE(startup.add("risk_manager", stage("risk_manager"), {"account_manager"}));
+    ASSERT_TRUE(startup.add("execution_manager", stage("execution_manager")));
+    ASSERT_TRUE(startup.add("market_data", stage("market_data")));
+    EXPECT_FALSE(startup.add("account_manager", stage("duplicate")));
+
+    ASSERT_TRUE(startup.run(*pool)) << startup.error();
+    EXPECT_EQ(trace.size(), 5u);
+    EXPECT_LT(trace.position("account_manager"), trace.position("risk_manager"));
+    EXPECT_LT(trace.position("risk_manager"), trace.position("order_manager"));
+    EXPECT_LT(trace.position("execution_manager"), trace.position("order_manager"));
+    for (const auto& result : startup.results()) {
+        EXPECT_EQ(result.status, StageStatus::kSucceeded) << result.name;
+        EXPECT_GT(result.duration_ns, 0);
+    }
+    const StageResult* order = startup.result("order_manager");
+    const StageResult* risk = startup.result("risk_manager");
+    ASSERT_NE(order, nullptr);
+    ASSERT_NE(risk, nullptr);
+    EXPECT_GE(order->start_ns, risk->start_ns + risk->duration_ns);
+    EXPECT_EQ(startup.result("missing"), nullptr);
+
+    std::string report = startup.report();
+    EXPECT_NE(report.find("order_manager"), std::string::npos);
+    EXPECT_NE(report.find("ms wall"), std::string::npos);
+}
+
+// 互不依赖的组件并行初始化；同一互斥组内的组件不会同时执行
+TEST(StartupOrchestratorTest, ParallelAndExclusiveGroups) {
+    auto pool = ThreadPool::create(4);
+    StartupOrchestrator startup;
+    std::atomic<int> active{0};
+    std::atomic<int> peak{0};
+    std::atomic<int> group_active{0};
+    std::atomic<bool> group_overlap{false};
+
+    auto track_peak = [&]() {
+        int now = active.fetch_add(1) + 1;
+        int seen = peak.load();
+        while (now > seen && !peak.compare_exchange_weak(seen, now)) {
+        }
+    };
+    for (int i = 0; i < 4; ++i) {
+        startup.add("independent." + std::to_string(i), [&]() {
+            track_peak();
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            active.fetch_sub(1);
+            return true;
+        });
+    }
+    for (int i = 0; i < 3; ++i) {
+        startup.add("plugin." + std::to_string(i), [&]() {
+            if (group_active.fetch_add(1) != 0) {
+                group_overlap = true;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            group_active.fetch_sub(1);
+            return true;
+        }, {}, "processor");
+    }
+
+    ASSERT_TRUE(startup.run(*pool)) << startup.error();
+    EXPECT_FALSE(group_overlap.load());
+    EXPECT_GE(peak.load(), 2);      // 单核环境下休眠的组件同样重叠
+    EXPECT_LT(startup.total_ns(), startup.serial_ns());
+}
+
+// 快速失败：失败组件的下游被跳过，run() 返回 false 并给出首个错误
+TEST(StartupOrchestratorTest, FailureSkipsDependents) {
+    auto pool = ThreadPool::create(2);
+    StartupOrchestrator startup;
+    std::atomic<int> downstream_runs{0};
+    startup.add("config", []() { return true; });
+    startup.add("account_manager", []() -> bool { throw std::runtime_error("broker login rejected"); },
+                {"config"});
+    startup.add("risk_manager", [&]() { ++downstream_runs; return true; }, {"account_manager"});
+    startup.add("order_manager", [&]() { ++downstream_runs; return true; }, {"risk_manager"});
+
+    EXPECT_FALSE(startup.run(*pool));
+    EXPECT_EQ(downstream_runs.load(), 0);
+    EXPECT_NE(startup.error().find("account_manager"), std::string::npos);
+    EXPECT_NE(startup.error().find("broker login rejected"), std::string::npos);
+    EXPECT_EQ(startup.result("config")->status, StageStatus::kSucceeded);
+    EXPECT_EQ(startup.result("account_manager")->status, StageStatus::kFailed);
+    EXPECT_EQ(startup.result("risk_manager")->status, StageStatus::kSkipped);
+    EXPECT_EQ(startup.result("order_manager")->status, StageStatus::kSkipped);
+
+    StartupOrchestrator returns_false;
+    returns_false.add("market_data", []() { return false; });
+    EXPECT_FALSE(returns_false.run(*pool));
+    EXPECT_EQ(returns_false.result("market_data")->status, StageStatus::kFailed);
+}
+
+// 配置错误：未知依赖与依赖环在执行前被拒绝
+TEST(StartupOrchestratorTest, RejectsInvalidGraphs) {
+    auto pool = ThreadPool::create(1);
+    std::atomic<int> runs{0};
+
+    StartupOrchestrator unknown;
+    unknown.add("risk_manager", [&]() { ++runs; return true; }, {"account_manager"});
+    EXPECT_FALSE(unknown.run(*pool));
+    EXPECT_NE(unknown.error().find("unknown component account_manager"), std::string::npos);
+
+    StartupOrchestrator cycle;
+    cycle.add("a", [&]() { ++runs; return true; }, {"c"});
+    cycle.add("b", [&]() { ++runs; return true; }, {"a"});
+    cycle.add("c", [&]() { ++runs; return true; }, {"b"});
+    cycle.add("d", [&]() { ++runs; return true; });
+    EXPECT_FALSE(cycle.run(*pool));
+    EXPECT_NE(cycle.error().find("cycle"), std::string::npos);
+    EXPECT_EQ(runs.load(), 0);
+
+    // 单线程线程池也能完成整张依赖图
+    StartupOrchestrator chain;
+    for (int i = 0; i < 10; ++i) {
+        std::vector<std::string> deps;
+        if (i > 0) {
+            deps.push_back("stage." + std::to_string(i - 1));
+        }
+        chain.add("stage." + std::to_string(i), [&]() { ++runs; return true; }, deps, "shared");
+    }
+    EXPECT_TRUE(chain.run(*pool)) << chain.error();
+    EXPECT_EQ(runs.load(), 10);
+}
+
+// 性能测试：调度开销（大量空组件的扇出/扇入）
+TEST(StartupOrchestratorTest, PerformanceTest) {
+    auto pool = ThreadPool::create(4);
+    StartupOrchestrator startup;
+    const int kStages = 2000;
+    startup.add("root", []() { return true; });
+    std::vector<std::string> leaves;
+    for (int i = 0; i < kStages; ++i) {
+        leaves.push_back("leaf." + std::to_string(i));
+        startup.add(leaves.back(), []() { return true; }, {"root"});
+    }
+    startup.add("join", []() { return true; }, leaves);
+
+    auto start = std::chrono::high_resolution_clock::now();
+    ASSERT_TRUE(startup.run(*pool)) << startup.error();
+    auto end = std::chrono::high_resolution_clock::now();
+
+    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+    std::cout << "StartupOrchestrator schedule: " << static_cast<double>(ns) / (kStages + 2)
+              << " ns/stage" << std::endl;
+}
@@ -0,0 +1,132 @@
+#include <gtest/gtest.h>
+#include <memory>
+#include <string>
+#include <vector>
+#include "core/strategy/static_strategy.h"
+
+using namespace quant::core;
+using namespace quant::core::strategy;
+
+namespace {
+
+// 记录每次回调的 "策略编号:事件" 序列，所有策略共享同一份日志以检查分发顺序
+struct CallLog {
+    std::vector<std::string> calls;
+};
+
+// 只实现 on_tick，其余回调使用 StaticStrategy 的空实现
+template <int N>
+class TickOnlyStrategy : public StaticStrategy<TickOnlyStrategy<N>> {
+public:
+    explicit TickOnlyStrategy(CallLog* log = nullptr) : log_(log) {}
+
+    void on_tick(const market_data::TickData& tick) {
+        if (log_ != nullptr) {
+            log_->calls.push_back(std::to_string(N) + ":tick:" + tick.instrument);
+        }
+        // 每个行情发一个信号，检查信号出口绑定
+        this->send_signal(tick.instrument, tick.last_price, N + 1, true, true);
+    }
+
+private:
+    CallLog* log_;
+};
+
+// 实现全部回调
+class FullStrategy : public StaticStrategy<FullStrategy> {
+public:
+    explicit FullStrategy(CallLog* log = nullptr) : log_(log) {}
+
+    void on_tick(const market_data::TickData&) { record("tick"); }
+    void on_bar(const market_data::BarData&) { record("bar"); }
+    void on_order(const oms::Order& order) { record("order:" + order.order_id); }
+    void on_trade(const oms::Trade& trade) { record("trade:" + trade.trade_id); }
+
+private:
+    void record(const std::string& what) {
+        if (log_ != nullptr) {
+            log_->calls.push_back("full:" + what);
+        }
+    }
+
+    CallLog* log_;
+};
+
+using Strategies = TypeList<TickOnlyStrategy<0>, FullStrategy, TickOnlyStrategy<1>>;
+
+// 信号出口：记录 (合约, 数量)
+struct SignalLog {
+    std::vector<std::pair<std::string, int>> signals;
+};
+
+void record_signal(void* context, const std::string& instrument, double, int volume, bool, bool) {
+    static_cast<SignalLog*>(context)->signals.emplace_back(instrument, volume);
+}
+
+market_data::TickData make_tick(const std::string& instrument) {
+    market_data::TickData tick{};
+    tick.instrument = instrument;
+    tick.last_price = 100.0;
+    return tick;
+}
+
+StrategyConfig make_config(const std::string& id) {
+    StrategyConfig config;
+    config.id = id;
+    config.name = id;
+    return config;
+}
+
+} // namespace
+
+// 集合按声明顺序分发；未实现的回调走空实现；信号出口绑定到所有策略
+TEST(StaticStrategyTest, SetDispatchesInDeclarationOrder) {
+    CallLog log;
+    StaticStrategySet<Strategies> strategies(&log, &log, &log);
+    static_assert(StaticStrategySet<Strategies>::size() == 3, "three strategies");
+
+    strategies.on_tick(make_tick("rb2410"));
+    EXPECT_EQ(log.calls, (std::vector<std::string>{"0:tick:rb2410", "full:tick", "1:tick:rb2410"}));
+
+    log.calls.clear();
+    oms::Order order;
+    order.order_id = "O1";
+    oms::Trade trade;
+    trade.trade_id = "T1";
+    strategies.on_bar(market_data::BarData{});
+    strategies.on_order(order);
+    strategies.on_trade(trade);
+    EXPECT_EQ(log.calls, (std::vector<std::string>{"full:bar", "full:order:O1", "full:trade:T1"}));
+
+    // 未绑定信号出口时 send_signal 被忽略；绑定后每个策略的信号都送达
+    SignalLog signals;
+    strategies.bind_signal_sink(&record_signal, &signals);
+    strategies.on_tick(make_tick("cu2410"));
+    EXPECT_EQ(signals.signals, (std::vector<std::pair<std::string, int>>{{"cu2410", 1}, {"cu2410", 2}}));
+
+    // 按类型取实例
+    FullStrategy& full = strategies.get<FullStrategy>();
+    const auto& view = static_cast<const StaticStrategySet<Strategies>&>(strategies);
+    EXPECT_EQ(&view.get<FullStrategy>(), &full);
+}
+
+// 适配器：经 StrategyBase 的虚接口进入后在集合内部静态分发
+TEST(StaticStrategyTest, AdapterForwardsThroughStrategyBase) {
+    CallLog log;
+    auto adapter = std::make_shared<StaticStrategyAdapter<Strategies>>(make_config("static_set"), &log, &log, &log);
+    std::shared_ptr<StrategyBase> base = adapter;
+    EXPECT_EQ(base->id(), "static_set");
+
+    base->on_tick(make_tick("IF2406"));
+    oms::Order order;
+    order.order_id = "O2";
+    base->on_order(order);
+    oms::Trade trade;
+    trade.trade_id = "T2";
+    base->on_trade(trade);
+    base->on_bar(market_data::BarData{});
+    EXPECT_EQ(log.calls, (std::vector<std::string>{"0:tick:IF2406", "full:tick", "1:tick:IF2406",
+                                                   "full:order:O2", "full:trade:T2", "full:bar"}));
+    EXPECT_EQ(&adapter->strategies().get<FullStrategy>(),
+              &static_cast<StaticStrategyAdapter<Strategies>&>(*base).strategies().get<FullStrategy>());
+}
@@ -0,0 +1,253 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include "core/strategy/strategy_coroutine.h"
+#include "core/strategy/strategy_lane.h"
+
+using namespace quant::core;
+using namespace quant::core::strategy;
+using namespace std::chrono_literals;
+
+namespace {
+
+StrategyConfig make_config(const std::string& id) {
+    StrategyConfig config;
+    config.id = id;
+    config.name = id;
+    return config;
+}
+
+// 测试策略：协程流程中的每一步都记录下来，由测试按顺序喂入行情/回报
+class ScriptedStrategy : public CoroutineStrategy {
+public:
+    explicit ScriptedStrategy(const std::string& id) : CoroutineStrategy(make_config(id)) {
+        initialize(event_bus::EventBus::instance());
+    }
+
+    // 等行情 -> 发单等回报 -> 等成交（超时）-> 休眠
+    StrategyTask hedge(std::string instrument) {
+        auto tick = co_await next_tick(instrument);
+        price = tick.tick.last_price;
+        stage = 1;
+        auto ack = co_await send_order(instrument, price, 1, true, true, 50ms);
+        stage = ack.timed_out ? -1 : 2;
+        auto fill = co_await next_trade(instrument, 1ms);
+        trade_timed_out = fill.timed_out;
+        stage = 3;
+        co_await sleep_for(1ms);
+        stage = 4;
+    }
+
+    // 发单后记录关联到的订单号，再等待该订单的下一条回报
+    StrategyTask send_and_follow(std::string instrument, int volume, std::chrono::milliseconds timeout) {
+        auto ack = co_await send_order(instrument, 100.0, volume, true, true, timeout);
+        if (ack.timed_out) {
+            acks.push_back("timeout");
+            co_return;
+        }
+        acks.push_back(ack.order.order_id);
+        auto update = co_await wait_order(ack.order.order_id, 50ms);
+        updates.push_back(update.timed_out ? "timeout" : update.order.order_id);
+    }
+
+    StrategyTask wait_forever() {
+        while (true) {
+            co_await next_tick("never");
+        }
+    }
+
+    // 帧内局部对象析构时访问派生类成员：只有在派生类析构前销毁帧才安全
+    StrategyTask guarded_wait() {
+        struct Guard {
+            ScriptedStrategy* self;
+            ~Guard() { self->frames_destroyed.push_back(self->id()); }
+        } guard{this};
+        co_await next_tick("never");
+    }
+
+    StrategyTask ping_pong(std::string instrument) {
+        co_await next_tick(instrument);
+        ++resumed;
+    }
+
+    // 没有任何事件到达时，休眠与发单超时只能由时间轮驱动恢复
+    StrategyTask sleep_then_send(std::string instrument) {
+        co_await sleep_for(2ms);
+        resumed_on = std::this_thread::get_id();
+        auto ack = co_await send_order(instrument, 100.0, 1, true, true, 2ms);
+        trade_timed_out = ack.timed_out;
+        done.store(true, std::memory_order_release);
+    }
+
+    int stage = 0;
+    double price = 0.0;
+    bool trade_timed_out = false;
+    int resumed = 0;
+    std::vector<std::string> acks;
+    std::vector<std::string> updates;
+    std::thread::id resumed_on;
+    std::atomic<bool> done{false};
+    std::vector<std::string> frames_destroyed;
+    std::vector<std::pair<uint64_t, std::string>> abandoned;
+
+protected:
+    void process_abandoned_order(uint64_t request_id, const oms::Order& order) override {
+        abandoned.emplace_back(request_id, order.order_id);
+    }
+};
+
+market_data::TickData make_tick(const std::string& instrument, double price) {
+    market_data::TickData tick{};
+    tick.instrument = instrument;
+    tick.last_price = price;
+    return tick;
+}
+
+oms::Order make_order(const std::string& order_id, const std::string& instrument, int volume) {
+    oms::Order order;
+    order.order_id = order_id;
+    order.instrument = instrument;
+    order.price = 100.0;
+    order.volume = volume;
+    order.is_buy = true;
+    return order;
+}
+
+} // namespace
+
+// 行情、订单回报、成交超时与休眠依次恢复同一个协程
+TEST(StrategyCoroutineTest, ResumesOnStrategyEvents) {
+    ScriptedStrategy strategy("coro_flow");
+    strategy.hedge("rb2410");
+    strategy.wait_forever();
+
+    strategy.on_tick(make_tick("cu2410", 1.0));
+    EXPECT_EQ(strategy.stage, 0);
+    strategy.on_tick(make_tick("rb2410", 3500.0));
+    EXPECT_EQ(strategy.stage, 1);
+    EXPECT_DOUBLE_EQ(strategy.price, 3500.0);
+
+    oms::Order ack = make_order("O1", "rb2410", 1);
+    ack.price = 3500.0;
+    strategy.on_order(ack);
+    EXPECT_EQ(strategy.stage, 2);
+
+    std::this_thread::sleep_for(2ms);
+    strategy.poll_timers();
+    EXPECT_EQ(strategy.stage, 3);
+    EXPECT_TRUE(strategy.trade_timed_out);
+    std::this_thread::sleep_for(2ms);
+    strategy.poll_timers();
+    EXPECT_EQ(strategy.stage, 4);
+    strategy.stop();
+}
+
+// 订单回报按订单号关联：首次出现的订单号按发送顺序认领给同参数委托，已认领订单的后续回报
+// 只唤醒 wait_order(该订单号)，不会被新发出的同参数委托误认领；参数不符的订单不被认领
+TEST(StrategyCoroutineTest, SendOrderClaimsFirstReportOfNewOrder) {
+    ScriptedStrategy strategy("coro_correlate");
+    strategy.send_and_follow("IF2406", 1, 50ms);
+    strategy.send_and_follow("IF2406", 1, 50ms);
+
+    strategy.on_order(make_order("B", "IF2406", 1));
+    EXPECT_EQ(strategy.acks, (std::vector<std::string>{"B"}));
+    strategy.on_order(make_order("A", "IF2406", 1));
+    EXPECT_EQ(strategy.acks, (std::vector<std::string>{"B", "A"}));
+
+    strategy.send_and_follow("IF2406", 1, 50ms);            // 与 A 参数相同
+    strategy.on_order(make_order("A", "IF2406", 1));        // A 的成交回报
+    EXPECT_EQ(strategy.updates, (std::vector<std::string>{"A"}));
+    EXPECT_EQ(strategy.acks.size(), 2u);
+    oms::Order other = make_order("X", "IF2406", 2);        // 数量不同
+    strategy.on_order(other);
+    EXPECT_EQ(strategy.acks.size(), 2u);
+    strategy.on_order(make_order("C", "IF2406", 1));
+    EXPECT_EQ(strategy.acks, (std::vector<std::string>{"B", "A", "C"}));
+    strategy.stop();
+}
+
+// 超时放弃的委托：迟到的确认交给 process_abandoned_order，不会唤醒之后发出的同参数委托
+TEST(StrategyCoroutineTest, LateAckOfTimedOutSendIsAbsorbed) {
+    ScriptedStrategy strategy("coro_late");
+    strategy.send_and_follow("IF2406", 1, 20ms);            // 序号 1
+    std::this_thread::sleep_for(25ms);
+    strategy.poll_timers();
+    EXPECT_EQ(strategy.acks, (std::vector<std::string>{"timeout"}));
+
+    strategy.send_and_follow("IF2406", 1, 50ms);            // 序号 2
+    strategy.on_order(make_order("LATE", "IF2406", 1));
+    EXPECT_EQ(strategy.acks.size(), 1u);
+    ASSERT_EQ(strategy.abandoned.size(), 1u);
+    EXPECT_EQ(strategy.abandoned[0].first, 1u);
+    EXPECT_EQ(strategy.abandoned[0].second, "LATE");
+    strategy.on_order(make_order("NEXT", "IF2406", 1));
+    EXPECT_EQ(strategy.acks, (std::vector<std::string>{"timeout", "NEXT"}));
+    strategy.stop();
+}
+
+// stop() 销毁仍在等待的协程帧：帧内局部对象在派生类成员仍有效时析构，之后的事件不再恢复任何协程
+TEST(StrategyCoroutineTest, StopDestroysSuspendedFrames) {
+    ScriptedStrategy strategy("coro_stop");
+    strategy.guarded_wait();
+    strategy.guarded_wait();
+    strategy.send_and_follow("IF2406", 1, 50ms);
+    EXPECT_TRUE(strategy.frames_destroyed.empty());
+
+    strategy.stop();
+    EXPECT_EQ(strategy.frames_destroyed, (std::vector<std::string>{"coro_stop", "coro_stop"}));
+    EXPECT_EQ(strategy.status(), StrategyStatus::kStopped);
+    strategy.on_order(make_order("A", "IF2406", 1));
+    EXPECT_TRUE(strategy.acks.empty());
+}
+
+// 时间轮驱动：没有行情/回报时，休眠与发单超时也按时在策略所在执行通道上恢复
+TEST(StrategyCoroutineTest, TimerWheelDrivesTimersOnStrategyLane) {
+    LaneDispatcher dispatcher;
+    LaneConfig config;
+    config.name = "coro_lane";
+    size_t lane = dispatcher.add_lane(config);
+
+    quant::base::common::timer_wheel::TimerWheel wheel;
+    auto strategy = std::make_shared<ScriptedStrategy>("coro_wheel");
+    const StrategyBase* target = strategy.get();
+    strategy->attach_timer_wheel(wheel, [&dispatcher, target](std::function<void()> poll) {
+        return [&dispatcher, target, poll]() { dispatcher.post_callback(target, poll); };
+    });
+    strategy->sleep_then_send("rb2410");
+    ASSERT_TRUE(dispatcher.assign(strategy, lane));
+    ASSERT_TRUE(wheel.start());
+
+    auto give_up = std::chrono::steady_clock::now() + 5s;
+    while (!strategy->done.load(std::memory_order_acquire) && std::chrono::steady_clock::now() < give_up) {
+        std::this_thread::sleep_for(1ms);
+    }
+    wheel.stop();
+    dispatcher.stop_all();
+    strategy->stop();
+
+    ASSERT_TRUE(strategy->done.load(std::memory_order_acquire));
+    EXPECT_TRUE(strategy->trade_timed_out);
+    EXPECT_NE(strategy->resumed_on, std::this_thread::get_id());
+}
+
+// 性能测试：协程创建（帧从 FrameArena 分配）+ 挂起 + 恢复的单次开销
+TEST(StrategyCoroutineTest, PerformanceTest) {
+    ScriptedStrategy strategy("coro_perf");
+    market_data::TickData tick = make_tick("rb2410", 1.0);
+    const int kIterations = 100000;
+    auto begin = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < kIterations; ++i) {
+        strategy.ping_pong("rb2410");
+        strategy.on_tick(tick);
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    EXPECT_EQ(strategy.resumed, kIterations);
+
+    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count();
+    std::cout << "StrategyTask create+resume: " << static_cast<double>(ns) / kIterations << " ns/op" << std::endl;
+}
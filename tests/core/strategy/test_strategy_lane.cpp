@@ -0,0 +1,341 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "core/strategy/strategy_lane.h"
+
+using namespace quant::core;
+using namespace quant::core::strategy;
+
+namespace {
+
+// 记录收到的行情（按成交量编号）、订单与成交，以及执行回调的线程
+class RecordingStrategy : public StrategyBase {
+public:
+    explicit RecordingStrategy(const std::string& id) : StrategyBase(make_config(id)) {}
+
+    void on_tick(const market_data::TickData& tick) override {
+        while (block_.load()) {
+            std::this_thread::yield();
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        ticks_.push_back(tick.volume);
+        thread_ = std::this_thread::get_id();
+    }
+    void on_order(const oms::Order& order) override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        orders_.push_back(order.order_id);
+    }
+    void on_trade(const oms::Trade& trade) override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        trades_.push_back(trade.trade_id);
+    }
+
+    std::vector<int64_t> ticks() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return ticks_;
+    }
+    std::vector<std::string> orders() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return orders_;
+    }
+    std::vector<std::string> trades() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return trades_;
+    }
+    std::thread::id thread() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return thread_;
+    }
+
+    std::atomic<bool> block_{false};
+
+private:
+    static StrategyConfig make_config(const std::string& id) {
+        StrategyConfig config;
+        config.id = id;
+        config.name = id;
+        return config;
+    }
+
+    std::mutex mutex_;
+    std::vector<int64_t> ticks_;
+    std::vector<std::string> orders_;
+    std::vector<std::string> trades_;
+    std::thread::id thread_;
+};
+
+market_data::TickData make_tick(int64_t sequence) {
+    market_data::TickData tick{};
+    tick.instrument = "IF2406";
+    tick.volume = sequence;
+    return tick;
+}
+
+oms::Order make_order(const std::string& order_id) {
+    oms::Order order;
+    order.order_id = order_id;
+    return order;
+}
+
+LaneConfig make_lane(const std::string& name, size_t capacity = 1024) {
+    LaneConfig config;
+    config.name = name;
+    config.queue_capacity = capacity;
+    return config;
+}
+
+// 等待条件成立（最多 5 秒）
+template <typename Predicate>
+bool wait_until(Predicate predicate) {
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (!predicate()) {
+        if (std::chrono::steady_clock::now() > deadline) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+    return true;
+}
+
+} // namespace
+
+// 行情扇出到所有挂有策略的通道；订单/成交回报只投递到下单策略，且在其通道线程上执行
+TEST(StrategyLaneTest, RoutesOrdersAndTradesToOwner) {
+    LaneDispatcher dispatcher;
+    size_t lane0 = dispatcher.add_lane(make_lane("lane_test.0"));
+    size_t lane1 = dispatcher.add_lane(make_lane("lane_test.1"));
+    dispatcher.add_lane(make_lane("lane_test.idle"));
+    auto s1 = std::make_shared<RecordingStrategy>("s1");
+    auto s2 = std::make_shared<RecordingStrategy>("s2");
+    ASSERT_TRUE(dispatcher.assign(s1, lane0));
+    ASSERT_TRUE(dispatcher.assign(s2, lane1));
+    EXPECT_FALSE(dispatcher.assign(std::make_shared<RecordingStrategy>("s1"), lane1));   // ID 重复
+
+    dispatcher.dispatch_tick(make_tick(1));
+    EXPECT_TRUE(dispatcher.dispatch_order("s1", make_order("o1")));
+    EXPECT_TRUE(dispatcher.dispatch_order("s2", make_order("o2")));
+    oms::Trade trade;
+    trade.trade_id = "t1";
+    EXPECT_TRUE(dispatcher.dispatch_trade("s2", trade));
+    EXPECT_FALSE(dispatcher.dispatch_order("unknown", make_order("o3")));
+
+    ASSERT_TRUE(wait_until([&]() { return s1->orders().size() == 1 && s2->trades().size() == 1; }));
+    EXPECT_EQ(s1->orders(), (std::vector<std::string>{"o1"}));
+    EXPECT_EQ(s2->orders(), (std::vector<std::string>{"o2"}));
+    EXPECT_TRUE(s1->trades().empty());
+    ASSERT_TRUE(wait_until([&]() { return s1->ticks().size() == 1 && s2->ticks().size() == 1; }));
+    EXPECT_NE(s1->thread(), s2->thread());
+    EXPECT_NE(s1->thread(), std::this_thread::get_id());
+
+    // 空闲通道不接收行情
+    std::vector<LaneStats> stats = dispatcher.stats();
+    ASSERT_EQ(stats.size(), 3u);
+    EXPECT_EQ(stats[2].events_handled, 0u);
+    dispatcher.stop_all();
+}
+
+// 运行期迁移：迁移前后行情不丢、不重、保持顺序，迁移后的订单回报投递到新通道
+TEST(StrategyLaneTest, RebalanceIsGapFree) {
+    LaneDispatcher dispatcher;
+    size_t lane0 = dispatcher.add_lane(make_lane("lane_test.src", 1 << 16));
+    size_t lane1 = dispatcher.add_lane(make_lane("lane_test.dst", 1 << 16));
+    auto strategy = std::make_shared<RecordingStrategy>("mover");
+    ASSERT_TRUE(dispatcher.assign(strategy, lane0));
+
+    // 源通道阻塞在回调中时迁移无法完成：再次迁移、暂停或移除都被拒绝，接管后才可以
+    strategy->block_.store(true);
+    dispatcher.dispatch_tick(make_tick(0));
+    ASSERT_TRUE(dispatcher.rebalance(strategy, lane1));
+    EXPECT_FALSE(dispatcher.rebalance(strategy, lane0));
+    EXPECT_FALSE(dispatcher.remove(strategy));
+    std::future<void> quiesced;
+    EXPECT_FALSE(dispatcher.quiesce(strategy, quiesced));
+    strategy->block_.store(false);
+    ASSERT_TRUE(wait_until([&]() { return dispatcher.rebalance(strategy, lane0); }));
+
+    // 行情持续扇出期间反复迁移
+    const int64_t kTicks = 20000;
+    for (int64_t i = 1; i < kTicks; ++i) {
+        dispatcher.dispatch_tick(make_tick(i));
+        if (i % 5000 == 0) {
+            size_t to = (i / 5000) % 2 == 1 ? lane1 : lane0;
+            ASSERT_TRUE(wait_until([&]() { return dispatcher.rebalance(strategy, to); }));
+        }
+    }
+    EXPECT_TRUE(dispatcher.dispatch_order("mover", make_order("after")));
+    ASSERT_TRUE(wait_until([&]() { return strategy->orders().size() == 1; }));
+
+    std::vector<int64_t> ticks = strategy->ticks();
+    ASSERT_EQ(ticks.size(), static_cast<size_t>(kTicks));
+    for (int64_t i = 0; i < kTicks; ++i) {
+        ASSERT_EQ(ticks[i], i);
+    }
+    size_t lane = 0;
+    ASSERT_TRUE(dispatcher.lane_of(strategy.get(), lane));
+    EXPECT_EQ(lane, lane1);
+    dispatcher.stop_all();
+}
+
+// 入站环满：post() 不阻塞，不可丢弃的事件进入溢出队列并按顺序送达；溢出期间的行情被丢弃
+TEST(StrategyLaneTest, PostNeverBlocksWhenFull) {
+    LaneDispatcher dispatcher;
+    size_t lane = dispatcher.add_lane(make_lane("lane_test.full", 4));
+    auto strategy = std::make_shared<RecordingStrategy>("slow");
+    strategy->block_.store(true);
+    ASSERT_TRUE(dispatcher.assign(strategy, lane));
+
+    dispatcher.dispatch_tick(make_tick(0));             // 通道线程阻塞在这条行情上
+    ASSERT_TRUE(wait_until([&]() { return dispatcher.stats()[0].queue_depth == 0; }));
+    const int kOrders = 100;
+    auto begin = std::chrono::steady_clock::now();
+    for (int i = 0; i < kOrders; ++i) {
+        ASSERT_TRUE(dispatcher.dispatch_order("slow", make_order(std::to_string(i))));
+    }
+    dispatcher.dispatch_tick(make_tick(1));
+    EXPECT_LT(std::chrono::steady_clock::now() - begin, std::chrono::seconds(1));
+
+    LaneStats stats = dispatcher.stats()[0];
+    EXPECT_GT(stats.events_overflowed, 0u);
+    EXPECT_EQ(stats.ticks_dropped, 1u);
+
+    strategy->block_.store(false);
+    ASSERT_TRUE(wait_until([&]() { return strategy->orders().size() == static_cast<size_t>(kOrders); }));
+    std::vector<std::string> orders = strategy->orders();
+    for (int i = 0; i < kOrders; ++i) {
+        ASSERT_EQ(orders[i], std::to_string(i));
+    }
+    EXPECT_EQ(strategy->ticks(), (std::vector<int64_t>{0}));
+    dispatcher.stop_all();
+}
+
+// 迁移目标通道已停止：源通道交出策略后继续运行，不会卡在目标通道的入站环上
+TEST(StrategyLaneTest, DetachToStoppedLaneDoesNotBlock) {
+    StrategyLane source(make_lane("lane_test.source", 2));
+    StrategyLane target(make_lane("lane_test.stopped", 2));
+    source.start();
+    auto strategy = std::make_shared<RecordingStrategy>("handoff");
+
+    LaneEvent attach;
+    attach.type = LaneEvent::Type::kAttach;
+    attach.strategy = strategy;
+    source.post(std::move(attach));
+    for (int i = 0; i < 8; ++i) {           // 填满目标通道的入站环（目标通道未启动）
+        LaneEvent callback;
+        callback.type = LaneEvent::Type::kCallback;
+        callback.callback = []() {};
+        target.post(std::move(callback));
+    }
+    LaneEvent detach;
+    detach.type = LaneEvent::Type::kDetach;
+    detach.strategy = strategy;
+    detach.handoff_to = &target;
+    source.post(std::move(detach));
+    source.post_tick(make_tick(7));
+
+    ASSERT_TRUE(wait_until([&]() { return source.stats().strategy_count == 0 && source.stats().queue_depth == 0; }));
+    EXPECT_GT(target.stats().events_overflowed, 0u);
+    source.stop();
+
+    // 目标通道启动后接管策略
+    target.start();
+    ASSERT_TRUE(wait_until([&]() { return target.stats().strategy_count == 1; }));
+    target.stop();
+}
+
+// 定时器回调：按实例路由到所在通道；入站环满时丢弃并计数，不阻塞、不进入溢出队列
+TEST(StrategyLaneTest, CallbackDroppedWhenFull) {
+    LaneDispatcher dispatcher;
+    size_t lane = dispatcher.add_lane(make_lane("lane_test.callback", 4));
+    auto strategy = std::make_shared<RecordingStrategy>("timer");
+    auto outsider = std::make_shared<RecordingStrategy>("outsider");
+    strategy->block_.store(true);
+    ASSERT_TRUE(dispatcher.assign(strategy, lane));
+    EXPECT_FALSE(dispatcher.post_callback(outsider.get(), []() {}));
+
+    dispatcher.dispatch_tick(make_tick(0));             // 通道线程阻塞在这条行情上
+    ASSERT_TRUE(wait_until([&]() { return dispatcher.stats()[0].queue_depth == 0; }));
+    std::atomic<int> fired{0};
+    int accepted = 0;
+    for (int i = 0; i < 16; ++i) {
+        if (dispatcher.post_callback(strategy.get(), [&fired]() { fired.fetch_add(1); })) {
+            ++accepted;
+        }
+    }
+    LaneStats stats = dispatcher.stats()[0];
+    EXPECT_GT(accepted, 0);
+    EXPECT_EQ(stats.callbacks_dropped, static_cast<uint64_t>(16 - accepted));
+    EXPECT_EQ(stats.events_overflowed, 0u);
+
+    strategy->block_.store(false);
+    ASSERT_TRUE(wait_until([&]() { return fired.load() == accepted; }));
+    dispatcher.stop_all();
+}
+
+
+// 事件总线接入：总线上发布的行情扇出到通道，订单/成交回报按策略 ID 投递，回调都在通道线程上执行；
+// 调度器析构后到达的事件被忽略
+TEST(StrategyLaneTest, EventBusRoutesThroughLanes) {
+    auto& bus = event_bus::EventBus::instance();
+    auto dispatcher = std::make_shared<LaneDispatcher>();
+    subscribe_lanes(bus, dispatcher);
+    size_t lane = dispatcher->add_lane(make_lane("lane_test.bus"));
+    auto s1 = std::make_shared<RecordingStrategy>("bus_s1");
+    ASSERT_TRUE(dispatcher->assign(s1, lane));
+
+    std::promise<std::thread::id> lane_thread;
+    ASSERT_TRUE(dispatcher->post_callback(s1.get(), [&lane_thread]() {
+        lane_thread.set_value(std::this_thread::get_id());
+    }));
+    std::thread::id lane_id = lane_thread.get_future().get();
+    EXPECT_NE(lane_id, std::this_thread::get_id());
+
+    event_bus::TickEvent tick;
+    tick.tick = make_tick(7);
+    bus.publish(tick);
+    event_bus::OrderEvent order;
+    order.strategy_id = "bus_s1";
+    order.order = make_order("bus_o1");
+    bus.publish(order);
+    event_bus::TradeEvent trade;
+    trade.strategy_id = "bus_s1";
+    trade.trade.trade_id = "bus_t1";
+    bus.publish(trade);
+    order.strategy_id = "unknown";
+    bus.publish(order);
+
+    ASSERT_TRUE(wait_until([&]() { return s1->ticks().size() == 1 && s1->trades().size() == 1; }));
+    EXPECT_EQ(s1->ticks(), (std::vector<int64_t>{7}));
+    EXPECT_EQ(s1->orders(), (std::vector<std::string>{"bus_o1"}));
+    EXPECT_EQ(s1->thread(), lane_id);
+
+    dispatcher.reset();
+    bus.publish(tick);
+    EXPECT_EQ(s1->ticks().size(), 1u);
+}
+// 性能测试：单通道行情投递 + 分发的单次开销
+TEST(StrategyLaneTest, PerformanceTest) {
+    LaneDispatcher dispatcher;
+    size_t lane = dispatcher.add_lane(make_lane("lane_test.perf", 1 << 16));
+    auto strategy = std::make_shared<RecordingStrategy>("perf");
+    ASSERT_TRUE(dispatcher.assign(strategy, lane));
+
+    const int kIterations = 50000;
+    market_data::TickData tick = make_tick(0);
+    auto begin = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < kIterations; ++i) {
+        dispatcher.dispatch_tick(tick);
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    ASSERT_TRUE(wait_until([&]() { return dispatcher.stats()[0].queue_depth == 0; }));
+    dispatcher.stop_all();
+
+    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(end - begin).count();
+    std::cout << "LaneDispatcher dispatch_tick: " << static_cast<double>(ns) / kIterations << " ns/op" << std::endl;
+}
@@ -0,0 +1,167 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include "core/strategy/strategy_parameters.h"
+
+using namespace quant::core::strategy;
+using quant::base::common::rcu::RcuDomain;
+using quant::base::common::rcu::RcuReader;
+
+namespace {
+
+enum class OrderMode { kMarket, kLimit };
+
+}  // namespace
+
+// 注册、类型化读取与批量更新：解析失败整批不生效
+TEST(ParameterSetTest, RegisterApplyAndParse) {
+    ParameterSet parameters;
+    auto window = parameters.add_int("window", 20);
+    auto threshold = parameters.add_double("threshold", 0.5);
+    auto enabled = parameters.add_bool("enabled", true);
+    auto mode = parameters.add_enum<OrderMode>("mode", {{"market", OrderMode::kMarket}, {"limit", OrderMode::kLimit}},
+                                               OrderMode::kLimit);
+    EXPECT_THROW(parameters.add_int("window", 1), std::invalid_argument);
+    EXPECT_EQ(parameters.size(), 4u);
+
+    EXPECT_EQ(parameters.get(window), 20);
+    EXPECT_DOUBLE_EQ(parameters.get(threshold), 0.5);
+    EXPECT_TRUE(parameters.get(enabled));
+    EXPECT_EQ(parameters.get(mode), OrderMode::kLimit);
+
+    EXPECT_TRUE(parameters.apply({{"window", "30"}, {"mode", "market"}, {"unknown", "x"}}));
+    EXPECT_EQ(parameters.get(window), 30);
+    EXPECT_EQ(parameters.get(mode), OrderMode::kMarket);
+    EXPECT_EQ(parameters.get_string("mode"), "market");
+    EXPECT_EQ(parameters.copy_snapshot().version(), 1u);
+
+    std::string error;
+    EXPECT_FALSE(parameters.apply({{"window", "40"}, {"threshold", "abc"}}, &error));
+    EXPECT_NE(error.find("threshold"), std::string::npos);
+    EXPECT_EQ(parameters.get(window), 30);
+    EXPECT_FALSE(parameters.set("enabled", "maybe"));
+    EXPECT_TRUE(parameters.set("enabled", "false"));
+    EXPECT_FALSE(parameters.get(enabled));
+    EXPECT_EQ(parameters.copy_snapshot().version(), 2u);
+}
+
+// 数值解析拒绝空白、溢出与 nan/inf，失败时参数保持原值
+TEST(ParameterSetTest, RejectsMalformedNumbers) {
+    ParameterSet parameters;
+    auto window = parameters.add_int("window", 20);
+    auto threshold = parameters.add_double("threshold", 0.5);
+
+    for (const char* text : {" 30", "30 ", "\t30", "99999999999999999999", "-99999999999999999999", "3.0", "0x10"}) {
+        EXPECT_FALSE(parameters.set("window", text)) << text;
+    }
+    for (const char* text : {"nan", "NAN", "inf", "-infinity", "1e400", "-1e400", " 0.7", "0.7\n"}) {
+        EXPECT_FALSE(parameters.set("threshold", text)) << text;
+    }
+    EXPECT_EQ(parameters.get(window), 20);
+    EXPECT_DOUBLE_EQ(parameters.get(threshold), 0.5);
+    EXPECT_EQ(parameters.copy_snapshot().version(), 0u);
+
+    EXPECT_TRUE(parameters.set("window", "-9223372036854775807"));
+    EXPECT_EQ(parameters.get(window), -9223372036854775807LL);
+    EXPECT_TRUE(parameters.set("threshold", "1e-3"));
+    EXPECT_DOUBLE_EQ(parameters.get(threshold), 0.001);
+}
+
+// snapshot() 仅限在线读者；读者持有的旧快照在其静止前不会被回收
+TEST(ParameterSetTest, SnapshotRequiresOnlineReader) {
+    ParameterSet parameters;
+    auto window = parameters.add_int("window", 20);
+    EXPECT_THROW(parameters.snapshot(), std::logic_error);
+
+    RcuReader reader;
+    ASSERT_TRUE(reader.valid());
+    const ParameterSnapshot& held = parameters.snapshot();
+    ASSERT_TRUE(parameters.set("window", "25"));
+    EXPECT_EQ(held.get(window), 20);            // 旧快照仍然有效
+    EXPECT_GE(RcuDomain::instance().pending(), 1u);
+    EXPECT_EQ(parameters.snapshot().get(window), 25);
+
+    reader.offline();
+    EXPECT_THROW(parameters.snapshot(), std::logic_error);
+    EXPECT_EQ(parameters.get(window), 25);      // 离线时走加锁路径
+    reader.online();
+    reader.quiescent();
+    RcuDomain::instance().reclaim();
+}
+
+// 并发：通道式读者（RCU）与普通线程（加锁路径）在持续热更新下都只看到完整快照
+TEST(ParameterSetTest, ConcurrentReadersDuringUpdates) {
+    ParameterSet parameters;
+    auto a = parameters.add_int("a", 1);
+    auto b = parameters.add_int("b", 2);
+    std::atomic<bool> stop{false};
+    std::atomic<int> torn{0};
+    std::atomic<uint64_t> reads{0};
+
+    std::vector<std::thread> readers;
+    readers.emplace_back([&]() {
+        RcuReader reader;
+        while (!stop.load(std::memory_order_acquire)) {
+            const ParameterSnapshot& snapshot = parameters.snapshot();
+            if (snapshot.get(b) != snapshot.get(a) * 2) {
+                torn.fetch_add(1);
+            }
+            reads.fetch_add(1, std::memory_order_relaxed);
+            reader.quiescent();
+        }
+    });
+    for (int t = 0; t < 2; ++t) {
+        readers.emplace_back([&]() {
+            while (!stop.load(std::memory_order_acquire)) {
+                ParameterSnapshot snapshot = parameters.copy_snapshot();
+                if (snapshot.get(b) != snapshot.get(a) * 2) {
+                    torn.fetch_add(1);
+                }
+                int64_t value = parameters.get(a);
+                if (value < 1) {
+                    torn.fetch_add(1);
+                }
+                reads.fetch_add(1, std::memory_order_relaxed);
+            }
+        });
+    }
+
+    for (int64_t i = 2; i < 2000; ++i) {
+        ASSERT_TRUE(parameters.apply({{"a", std::to_string(i)}, {"b", std::to_string(i * 2)}}));
+        if (i % 100 == 0) {
+            std::this_thread::yield();
+        }
+    }
+    while (reads.load() < 1000) {
+        std::this_thread::yield();
+    }
+    stop.store(true, std::memory_order_release);
+    for (auto& reader : readers) {
+        reader.join();
+    }
+    EXPECT_EQ(torn.load(), 0);
+    EXPECT_EQ(parameters.get(a), 1999);
+    RcuDomain::instance().synchronize();
+}
+
+// 性能测试：在线读者的参数读取
+TEST(ParameterSetTest, PerformanceTest) {
+    ParameterSet parameters;
+    auto window = parameters.add_int("window", 20);
+    RcuReader reader;
+    const int kIterations = 10000000;
+    int64_t sum = 0;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < kIterations; ++i) {
+        sum += parameters.get(window);
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    EXPECT_EQ(sum, int64_t(20) * kIterations);
+    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+    std::cout << "ParameterSet get (RCU reader): " << static_cast<double>(ns) / kIterations << " ns/op" << std::endl;
+}
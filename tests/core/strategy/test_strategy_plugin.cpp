@@ -0,0 +1,248 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "core/strategy/strategy_plugin.h"
+
+using namespace quant::core;
+using namespace quant::core::strategy;
+
+namespace {
+
+StrategyConfig make_config(const std::string& id) {
+    StrategyConfig config;
+    config.id = id;
+    config.name = id;
+    return config;
+}
+
+// 进程内的策略替身：记录收到的行情（按成交量编号），状态为已处理的行情数；
+// on_save 在导出状态时（旧实例已暂停）执行，用于在暂停窗口内投递事件
+class SwappableStrategy : public StrategyBase {
+public:
+    SwappableStrategy(const std::string& id, bool accept_state) : StrategyBase(make_config(id)), accept_state_(accept_state) {}
+
+    void on_tick(const market_data::TickData& tick) override {
+        while (block_.load()) {
+            std::this_thread::yield();
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        ticks_.push_back(tick.volume);
+    }
+
+    std::string save_state() const override {
+        if (on_save) {
+            on_save();
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        return std::to_string(ticks_.size());
+    }
+
+    bool restore_state(const std::string& state) override {
+        restored_ = state;
+        return accept_state_;
+    }
+
+    std::vector<int64_t> ticks() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return ticks_;
+    }
+
+    const std::string& restored() const { return restored_; }
+
+    std::function<void()> on_save;
+    std::atomic<bool> block_{false};
+
+private:
+    bool accept_state_;
+    std::string restored_;
+    mutable std::mutex mutex_;
+    std::vector<int64_t> ticks_;
+};
+
+market_data::TickData make_tick(int64_t sequence) {
+    market_data::TickData tick{};
+    tick.instrument = "IF2406";
+    tick.volume = sequence;
+    return tick;
+}
+
+LaneConfig make_lane(const std::string& name) {
+    LaneConfig config;
+    config.name = name;
+    config.queue_capacity = 1024;
+    return config;
+}
+
+// 等待条件成立（最多 5 秒）
+template <typename Predicate>
+bool wait_until(Predicate predicate) {
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (!predicate()) {
+        if (std::chrono::steady_clock::now() > deadline) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+    return true;
+}
+
+} // namespace
+
+// 暂停窗口内到达的行情缓存后回放给新实例，新实例导入旧实例的状态并接管；旧实例不再收到事件
+TEST(StrategyPluginTest, SwapReplaysBufferedEventsToReplacement) {
+    LaneDispatcher dispatcher;
+    size_t lane = dispatcher.add_lane(make_lane("swap_test.0"));
+    auto old_instance = std::make_shared<SwappableStrategy>("swap", true);
+    auto new_instance = std::make_shared<SwappableStrategy>("swap", true);
+    ASSERT_TRUE(dispatcher.assign(old_instance, lane));
+
+    dispatcher.dispatch_tick(make_tick(1));
+    dispatcher.dispatch_tick(make_tick(2));
+    old_instance->on_save = [&dispatcher]() {
+        dispatcher.dispatch_tick(make_tick(3));
+        dispatcher.dispatch_tick(make_tick(4));
+    };
+
+    std::shared_ptr<StrategyBase> strategy = old_instance;
+    ReloadReport report = swap_strategy(dispatcher, strategy, new_instance);
+    ASSERT_TRUE(report.success) << report.error;
+    EXPECT_EQ(strategy, new_instance);
+    EXPECT_EQ(new_instance->restored(), "2");
+    EXPECT_EQ(new_instance->status(), StrategyStatus::kRunning);
+    EXPECT_EQ(old_instance->status(), StrategyStatus::kStopped);
+
+    dispatcher.dispatch_tick(make_tick(5));
+    ASSERT_TRUE(wait_until([&]() { return new_instance->ticks().size() == 3; }));
+    EXPECT_EQ(new_instance->ticks(), (std::vector<int64_t>{3, 4, 5}));
+    EXPECT_EQ(old_instance->ticks(), (std::vector<int64_t>{1, 2}));
+    size_t placed = 0;
+    EXPECT_TRUE(dispatcher.lane_of(new_instance.get(), placed));
+    EXPECT_FALSE(dispatcher.lane_of(old_instance.get(), placed));
+}
+
+// 按策略 ID 投递的回调（定时器）跟随热更新：暂停窗口内投递的随事件缓存并在新实例的通道上执行，
+// 之后投递的直接进入新实例的通道；按旧实例指针投递的被丢弃
+TEST(StrategyPluginTest, CallbackByIdFollowsSwap) {
+    LaneDispatcher dispatcher;
+    size_t lane = dispatcher.add_lane(make_lane("swap_test.callback"));
+    auto old_instance = std::make_shared<SwappableStrategy>("swap", true);
+    auto new_instance = std::make_shared<SwappableStrategy>("swap", true);
+    ASSERT_TRUE(dispatcher.assign(old_instance, lane));
+
+    std::mutex mutex;
+    std::vector<std::string> fired;
+    auto record = [&mutex, &fired](const std::string& name) {
+        return [&mutex, &fired, name]() {
+            std::lock_guard<std::mutex> lock(mutex);
+            fired.push_back(name);
+        };
+    };
+    auto fired_count = [&mutex, &fired]() {
+        std::lock_guard<std::mutex> lock(mutex);
+        return fired.size();
+    };
+    EXPECT_FALSE(dispatcher.post_callback(std::string("unknown"), record("unknown")));
+    ASSERT_TRUE(dispatcher.post_callback(std::string("swap"), record("before")));
+    ASSERT_TRUE(wait_until([&]() { return fired_count() == 1; }));
+    old_instance->on_save = [&dispatcher, &record]() {
+        dispatcher.post_callback(std::string("swap"), record("paused"));
+    };
+
+    std::shared_ptr<StrategyBase> strategy = old_instance;
+    ASSERT_TRUE(swap_strategy(dispatcher, strategy, new_instance).success);
+    EXPECT_FALSE(dispatcher.post_callback(old_instance.get(), record("stale")));
+    ASSERT_TRUE(dispatcher.post_callback(std::string("swap"), record("after")));
+    ASSERT_TRUE(wait_until([&]() { return fired_count() == 3; }));
+    std::lock_guard<std::mutex> lock(mutex);
+    EXPECT_EQ(fired, (std::vector<std::string>{"before", "paused", "after"}));
+}
+
+// 新实例拒绝状态：旧实例恢复运行并收到暂停期间缓存的行情，新实例被停止
+TEST(StrategyPluginTest, RejectedStateResumesOldInstance) {
+    LaneDispatcher dispatcher;
+    size_t lane = dispatcher.add_lane(make_lane("swap_test.1"));
+    auto old_instance = std::make_shared<SwappableStrategy>("swap_reject", true);
+    auto new_instance = std::make_shared<SwappableStrategy>("swap_reject", false);
+    ASSERT_TRUE(dispatcher.assign(old_instance, lane));
+    new_instance->initialize(event_bus::EventBus::instance());
+
+    dispatcher.dispatch_tick(make_tick(1));
+    old_instance->on_save = [&dispatcher]() { dispatcher.dispatch_tick(make_tick(2)); };
+
+    std::shared_ptr<StrategyBase> strategy = old_instance;
+    ReloadReport report = swap_strategy(dispatcher, strategy, new_instance);
+    EXPECT_FALSE(report.success);
+    EXPECT_EQ(strategy, old_instance);
+    EXPECT_EQ(new_instance->status(), StrategyStatus::kStopped);
+
+    dispatcher.dispatch_tick(make_tick(3));
+    ASSERT_TRUE(wait_until([&]() { return old_instance->ticks().size() == 3; }));
+    EXPECT_EQ(old_instance->ticks(), (std::vector<int64_t>{1, 2, 3}));
+    EXPECT_TRUE(new_instance->ticks().empty());
+}
+
+// 暂停失败（策略迁移尚未被目标通道接管）：已初始化的新实例被停止，旧实例不受影响
+TEST(StrategyPluginTest, FailedQuiesceStopsReplacement) {
+    LaneDispatcher dispatcher;
+    size_t lane0 = dispatcher.add_lane(make_lane("swap_test.2"));
+    size_t lane1 = dispatcher.add_lane(make_lane("swap_test.3"));
+    auto old_instance = std::make_shared<SwappableStrategy>("swap_busy", true);
+    auto blocker = std::make_shared<SwappableStrategy>("swap_blocker", true);
+    auto new_instance = std::make_shared<SwappableStrategy>("swap_busy", true);
+    ASSERT_TRUE(dispatcher.assign(old_instance, lane0));
+    ASSERT_TRUE(dispatcher.assign(blocker, lane1));
+    new_instance->initialize(event_bus::EventBus::instance());
+
+    // 目标通道卡在 blocker 的回调里，迁移的接管事件排在其后
+    blocker->block_.store(true);
+    dispatcher.dispatch_tick(make_tick(1));
+    ASSERT_TRUE(dispatcher.rebalance(old_instance, lane1));
+
+    std::shared_ptr<StrategyBase> strategy = old_instance;
+    ReloadReport report = swap_strategy(dispatcher, strategy, new_instance);
+    EXPECT_FALSE(report.success);
+    EXPECT_EQ(strategy, old_instance);
+    EXPECT_EQ(new_instance->status(), StrategyStatus::kStopped);
+
+    blocker->block_.store(false);
+    dispatcher.dispatch_tick(make_tick(2));
+    ASSERT_TRUE(wait_until([&]() { return old_instance->ticks().size() == 2; }));
+    EXPECT_EQ(old_instance->ticks(), (std::vector<int64_t>{1, 2}));
+    EXPECT_TRUE(new_instance->ticks().empty());
+}
+
+// 通道卡在旧实例的回调中、超时前未处理到暂停位置：放弃热更新，新实例被停止；
+// 通道恢复后旧实例照常收到行情
+TEST(StrategyPluginTest, QuiesceTimeoutAbortsSwap) {
+    LaneDispatcher dispatcher;
+    size_t lane = dispatcher.add_lane(make_lane("swap_test.4"));
+    auto old_instance = std::make_shared<SwappableStrategy>("swap_stuck", true);
+    auto new_instance = std::make_shared<SwappableStrategy>("swap_stuck", true);
+    ASSERT_TRUE(dispatcher.assign(old_instance, lane));
+    new_instance->initialize(event_bus::EventBus::instance());
+
+    old_instance->block_.store(true);
+    dispatcher.dispatch_tick(make_tick(1));
+
+    std::shared_ptr<StrategyBase> strategy = old_instance;
+    ReloadReport report = swap_strategy(dispatcher, strategy, new_instance, std::chrono::milliseconds(20));
+    EXPECT_FALSE(report.success);
+    EXPECT_EQ(strategy, old_instance);
+    EXPECT_EQ(new_instance->status(), StrategyStatus::kStopped);
+    EXPECT_NE(old_instance->status(), StrategyStatus::kStopped);
+
+    dispatcher.dispatch_tick(make_tick(2));
+    old_instance->block_.store(false);
+    dispatcher.dispatch_tick(make_tick(3));
+    ASSERT_TRUE(wait_until([&]() { return old_instance->ticks().size() == 3; }));
+    EXPECT_EQ(old_instance->ticks(), (std::vector<int64_t>{1, 2, 3}));
+    EXPECT_TRUE(new_instance->ticks().empty());
+    size_t placed = 0;
+    EXPECT_TRUE(dispatcher.lane_of(old_instance.get(), placed));
+}
@@ -0,0 +1,175 @@
+#include <gtest/gtest.h>
+#include <chrono>
+#include <random>
+#include <vector>
+#include "plugins/execution_adapters/sim_exchange/matching_engine.h"
+
+using namespace quant::plugins::execution_adapters::sim_exchange;
+
+// 挂单与最优价
+TEST(MatchingEngineTest, RestingOrders) {
+    EXPECT_THROW(OrderBook(100, 99, 16), std::invalid_argument);
+
+    OrderBook book(90, 110, 16);
+    std::vector<SimFill> fills;
+    EXPECT_EQ(book.best_bid(), OrderBook::kNoPrice);
+
+    EXPECT_EQ(book.submit(1, true, 99, 5, fills), SubmitStatus::kAccepted);
+    EXPECT_EQ(book.submit(2, true, 100, 3, fills), SubmitStatus::kAccepted);
+    EXPECT_EQ(book.submit(3, false, 102, 4, fills), SubmitStatus::kAccepted);
+    EXPECT_TRUE(fills.empty());
+    EXPECT_EQ(book.best_bid(), 100);
+    EXPECT_EQ(book.best_ask(), 102);
+    EXPECT_EQ(book.depth(99), 5);
+    EXPECT_EQ(book.order_count(), 3u);
+
+    EXPECT_EQ(book.submit(4, true, 120, 1, fills), SubmitStatus::kInvalidPrice);
+    EXPECT_EQ(book.submit(4, true, 100, 0, fills), SubmitStatus::kInvalidVolume);
+    EXPECT_EQ(book.submit(1, true, 100, 1, fills), SubmitStatus::kDuplicateId);
+}
+
+// 价格优先、时间优先与部分成交
+TEST(MatchingEngineTest, PriceTimePriority) {
+    OrderBook book(90, 110, 16);
+    std::vector<SimFill> fills;
+    book.submit(1, false, 101, 2, fills);
+    book.submit(2, false, 100, 3, fills);
+    book.submit(3, false, 100, 4, fills);
+
+    // 买 6 手：先成交最优价 100 上的 2 号单（3 手），再按时间顺序成交 3 号单（3 手，剩 1 手）
+    int64_t remaining = -1;
+    EXPECT_EQ(book.submit(10, true, 101, 6, fills, &remaining), SubmitStatus::kAccepted);
+    EXPECT_EQ(remaining, 0);
+    ASSERT_EQ(fills.size(), 2u);
+    EXPECT_EQ(fills[0].maker_id, 2u);
+    EXPECT_EQ(fills[0].volume, 3);
+    EXPECT_EQ(fills[0].maker_remaining, 0);
+    EXPECT_EQ(fills[1].maker_id, 3u);
+    EXPECT_EQ(fills[1].volume, 3);
+    EXPECT_EQ(fills[1].maker_remaining, 1);
+    EXPECT_EQ(fills[1].taker_remaining, 0);
+    EXPECT_EQ(book.best_ask(), 100);
+    EXPECT_EQ(book.depth(100), 1);
+
+    // 买 5 手 @101：成交 3 号单 1 手 @100、1 号单 2 手 @101，剩余 2 手挂在买方 101
+    fills.clear();
+    EXPECT_EQ(book.submit(11, true, 101, 5, fills, &remaining), SubmitStatus::kAccepted);
+    ASSERT_EQ(fills.size(), 2u);
+    EXPECT_EQ(fills[0].price, 100);
+    EXPECT_EQ(fills[1].price, 101);
+    EXPECT_EQ(remaining, 2);
+    EXPECT_EQ(book.best_ask(), OrderBook::kNoPrice);
+    EXPECT_EQ(book.best_bid(), 101);
+    EXPECT_EQ(book.order_count(), 1u);
+}
+
+// 撤单：最优价位清空后移动到下一个价位
+TEST(MatchingEngineTest, Cancel) {
+    OrderBook book(90, 110, 16);
+    std::vector<SimFill> fills;
+    book.submit(1, true, 100, 2, fills);
+    book.submit(2, true, 100, 3, fills);
+    book.submit(3, true, 95, 1, fills);
+
+    int64_t remaining = 0;
+    EXPECT_TRUE(book.cancel(1, &remaining));
+    EXPECT_EQ(remaining, 2);
+    EXPECT_FALSE(book.cancel(1));
+    EXPECT_EQ(book.best_bid(), 100);
+    EXPECT_TRUE(book.cancel(2));
+    EXPECT_EQ(book.best_bid(), 95);
+    EXPECT_TRUE(book.cancel(3));
+    EXPECT_EQ(book.best_bid(), OrderBook::kNoPrice);
+    EXPECT_EQ(book.order_count(), 0u);
+
+    // 撤单后订单号可以复用
+    EXPECT_EQ(book.submit(1, false, 105, 1, fills), SubmitStatus::kAccepted);
+    EXPECT_EQ(book.submit(4, true, 105, 1, fills), SubmitStatus::kAccepted);
+    EXPECT_EQ(book.order_count(), 0u);
+}
+
+// 挂单数上限：撮合照常进行，剩余部分被拒
+TEST(MatchingEngineTest, BookFull) {
+    OrderBook book(90, 110, 2);
+    std::vector<SimFill> fills;
+    EXPECT_EQ(book.submit(1, false, 100, 1, fills), SubmitStatus::kAccepted);
+    EXPECT_EQ(book.submit(2, false, 101, 1, fills), SubmitStatus::kAccepted);
+    EXPECT_EQ(book.submit(3, false, 102, 1, fills), SubmitStatus::kBookFull);
+    EXPECT_EQ(book.submit(4, true, 100, 2, fills), SubmitStatus::kAccepted);   // 吃掉 1 号单后挂单 1 手
+    EXPECT_EQ(fills.size(), 1u);
+    EXPECT_EQ(book.order_count(), 2u);
+}
+
+// 随机订单流守恒：成交量双方相等，剩余挂单量与价位深度一致，买卖价不交叉
+TEST(MatchingEngineTest, RandomizedConservation) {
+    OrderBook book(0, 200, 4096);
+    std::mt19937_64 rng(7);
+    std::vector<SimFill> fills;
+    std::vector<uint64_t> live;
+    int64_t submitted = 0;
+    int64_t cancelled = 0;
+    int64_t traded = 0;
+
+    for (uint64_t id = 1; id <= 50000; ++id) {
+        if (!live.empty() && rng() % 4 == 0) {
+            size_t k = rng() % live.size();
+            int64_t remaining = 0;
+            if (book.cancel(live[k], &remaining)) {
+                cancelled += remaining;
+            }
+            live[k] = live.back();
+            live.pop_back();
+            continue;
+        }
+        bool is_buy = rng() % 2 == 0;
+        int64_t price = 90 + static_cast<int64_t>(rng() % 21);
+        int64_t volume = 1 + static_cast<int64_t>(rng() % 10);
+        fills.clear();
+        int64_t remaining = 0;
+        if (book.submit(id, is_buy, price, volume, fills, &remaining) != SubmitStatus::kAccepted) {
+            continue;
+        }
+        submitted += volume;
+        for (const auto& fill : fills) {
+            traded += fill.volume;
+            EXPECT_TRUE(is_buy ? fill.price <= price : fill.price >= price);
+        }
+        if (remaining > 0) {
+            live.push_back(id);
+        }
+        if (book.best_bid() != OrderBook::kNoPrice && book.best_ask() != OrderBook::kNoPrice) {
+            ASSERT_LT(book.best_bid(), book.best_ask());
+        }
+    }
+
+    int64_t resting = 0;
+    for (int64_t price = 0; price <= 200; ++price) {
+        resting += book.depth(price);
+    }
+    // 每手成交消耗买卖双方各一手
+    EXPECT_EQ(submitted, resting + cancelled + 2 * traded);
+}
+
+// 性能测试
+TEST(MatchingEngineTest, PerformanceTest) {
+    const int kNumOrders = 1000000;
+    OrderBook book(0, 1000, 1 << 16);
+    std::mt19937_64 rng(1);
+    std::vector<SimFill> fills;
+    fills.reserve(64);
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 1; i <= kNumOrders; ++i) {
+        fills.clear();
+        bool is_buy = (rng() & 1) != 0;
+        int64_t price = 495 + static_cast<int64_t>(rng() % 11);
+        if (book.submit(i, is_buy, price, 1 + static_cast<int64_t>(rng() % 5), fills) == SubmitStatus::kBookFull) {
+            break;
+        }
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
+
+    std::cout << "OrderBook Performance:" << std::endl;
+    std::cout << "  matched " << kNumOrders << " orders in " << elapsed << "ms" << std::endl;
+}
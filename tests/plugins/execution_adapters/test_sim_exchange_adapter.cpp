@@ -0,0 +1,215 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <ctime>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "plugins/execution_adapters/sim_exchange/sim_exchange_adapter.h"
+
+using namespace quant::plugins::execution_adapters::sim_exchange;
+using quant::core::ems::OrderCompletion;
+using quant::core::ems::OrderRequest;
+using quant::core::ems::OrderRequestType;
+using quant::core::oms::Order;
+using quant::core::oms::Trade;
+
+namespace {
+
+std::unordered_map<std::string, std::string> sim_config(const std::string& outbound_latency = "none") {
+    return {{"tick_size", "1"}, {"min_price", "1"}, {"max_price", "1000"}, {"max_orders", "64"},
+            {"queue_capacity", "64"}, {"outbound_latency", outbound_latency}};
+}
+
+Order make_order(const std::string& order_id, bool is_buy, double price, int volume) {
+    Order order;
+    order.order_id = order_id;
+    order.instrument = "IF2406";
+    order.price = price;
+    order.volume = volume;
+    order.is_buy = is_buy;
+    return order;
+}
+
+bool wait_until(const std::function<bool()>& predicate,
+                std::chrono::milliseconds timeout = std::chrono::milliseconds(2000)) {
+    auto deadline = std::chrono::steady_clock::now() + timeout;
+    while (!predicate()) {
+        if (std::chrono::steady_clock::now() > deadline) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return true;
+}
+
+// 按回调顺序记录回报："order <id> <volume>" / "trade <id> <volume>"
+class EventLog {
+public:
+    void attach(SimExchangeAdapter& adapter) {
+        adapter.set_order_callback([this](const Order& order) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            events_.push_back("order " + order.order_id + " " + std::to_string(order.volume));
+        });
+        adapter.set_trade_callback([this](const Trade& trade) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            events_.push_back("trade " + trade.order_id + " " + std::to_string(trade.volume));
+        });
+    }
+
+    // 等到至少 count 条回报后取出并清空
+    std::vector<std::string> take(size_t count) {
+        wait_until([this, count]() {
+            std::lock_guard<std::mutex> lock(mutex_);
+            return events_.size() >= count;
+        });
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::vector<std::string> out;
+        out.swap(events_);
+        return out;
+    }
+
+private:
+    std::mutex mutex_;
+    std::vector<std::string> events_;
+};
+
+} // namespace
+
+// 确认、成交、被动方终态与拒单的回调顺序
+TEST(SimExchangeAdapterTest, AckFillAndRejectOrdering) {
+    SimExchangeAdapter adapter(sim_config());
+    EventLog log;
+    log.attach(adapter);
+    ASSERT_TRUE(adapter.connect());
+
+    // 卖 5 手挂单：确认剩余 5 手
+    auto maker = adapter.send_order(make_order("O1", false, 100, 5));
+    ASSERT_TRUE(maker.success);
+    EXPECT_EQ(maker.order_id, "SIM1");
+    EXPECT_EQ(log.take(1), (std::vector<std::string>{"order SIM1 5"}));
+
+    // 买 3 手：先成交（主动方、被动方），再确认主动方全部成交
+    EXPECT_EQ(adapter.send_order(make_order("O2", true, 100, 3)).order_id, "SIM2");
+    EXPECT_EQ(log.take(3), (std::vector<std::string>{"trade SIM2 3", "trade SIM1 3", "order SIM2 0"}));
+
+    // 买 2 手：吃完挂单，被动方回调终态，最后是主动方确认
+    EXPECT_EQ(adapter.send_order(make_order("O3", true, 100, 2)).order_id, "SIM3");
+    EXPECT_EQ(log.take(4), (std::vector<std::string>{"trade SIM3 2", "trade SIM1 2", "order SIM1 0",
+                                                     "order SIM3 0"}));
+
+    // 价格越界：拒单与全部成交可区分
+    EXPECT_EQ(adapter.send_order(make_order("O4", true, 5000, 1)).order_id, "SIM4");
+    const std::string rejected = "order SIM4 " + std::to_string(SimExchangeAdapter::kRejectedVolume);
+    EXPECT_EQ(log.take(1), (std::vector<std::string>{rejected}));
+
+    SimExchangeStats stats = adapter.stats();
+    EXPECT_EQ(stats.requests, 4u);
+    EXPECT_EQ(stats.rejects, 1u);
+    EXPECT_EQ(stats.fills, 2u);
+    EXPECT_EQ(stats.resting_orders, 0u);
+    adapter.disconnect();
+}
+
+// 撤单：挂单撤销后回调 volume 0；撤已结束的订单失败
+TEST(SimExchangeAdapterTest, CancelRestingOrder) {
+    SimExchangeAdapter adapter(sim_config());
+    EventLog log;
+    log.attach(adapter);
+    ASSERT_TRUE(adapter.connect());
+
+    auto resting = adapter.send_order(make_order("O1", true, 99, 4));
+    EXPECT_EQ(log.take(1), (std::vector<std::string>{"order SIM1 4"}));
+    EXPECT_EQ(adapter.stats().resting_orders, 1u);
+
+    EXPECT_TRUE(adapter.cancel_order(resting.order_id).success);
+    EXPECT_EQ(log.take(1), (std::vector<std::string>{"order SIM1 0"}));
+    EXPECT_EQ(adapter.stats().resting_orders, 0u);
+
+    // 非模拟交易所编号在提交时即被拒绝
+    EXPECT_FALSE(adapter.cancel_order("O1").success);
+    adapter.disconnect();
+}
+
+// 异步接口：完成通知携带请求号，拒单与撤单失败的 success 为 false
+TEST(SimExchangeAdapterTest, AsyncCompletions) {
+    SimExchangeAdapter adapter(sim_config("fixed:200"));
+    ASSERT_TRUE(adapter.connect());
+
+    Order orders[2] = {make_order("O1", false, 100, 2), make_order("O2", true, 5000, 1)};
+    OrderRequest requests[2];
+    requests[0].request_id = 11;
+    requests[0].order = &orders[0];
+    requests[1].request_id = 12;
+    requests[1].order = &orders[1];
+    ASSERT_EQ(adapter.send_orders(requests, 2), 2u);
+    ASSERT_TRUE(adapter.submit_cancel(13, "SIM1"));
+    ASSERT_TRUE(adapter.submit_cancel(14, "SIM1"));
+
+    std::vector<OrderCompletion> completions;
+    ASSERT_TRUE(wait_until([&]() {
+        OrderCompletion batch[4];
+        size_t n = adapter.poll_completions(batch, 4);
+        completions.insert(completions.end(), batch, batch + n);
+        return completions.size() >= 4;
+    }));
+    ASSERT_EQ(completions.size(), 4u);
+    EXPECT_EQ(completions[0].request_id, 11u);
+    EXPECT_TRUE(completions[0].result.success);
+    EXPECT_EQ(completions[0].result.order_id, "SIM1");
+    EXPECT_EQ(completions[1].request_id, 12u);
+    EXPECT_FALSE(completions[1].result.success);
+    EXPECT_EQ(completions[2].request_id, 13u);
+    EXPECT_EQ(completions[2].type, OrderRequestType::kCancel);
+    EXPECT_TRUE(completions[2].result.success);
+    EXPECT_EQ(completions[3].request_id, 14u);
+    EXPECT_FALSE(completions[3].result.success);
+    adapter.disconnect();
+}
+
+// 异步报单的完成通知取回前，可按 request_id 以调用方订单号撤单
+TEST(SimExchangeAdapterTest, CancelUnackedSendByRequestId) {
+    SimExchangeAdapter adapter(sim_config("fixed:50000"));
+    ASSERT_TRUE(adapter.connect());
+    Order order = make_order("O1", true, 99, 1);
+    OrderRequest request;
+    request.request_id = 21;
+    request.order = &order;
+    ASSERT_EQ(adapter.send_orders(&request, 1), 1u);
+    EXPECT_FALSE(adapter.submit_cancel(22, "O1"));        // 没有以该请求号提交的报单
+    ASSERT_TRUE(adapter.submit_cancel(21, "O1"));
+
+    std::vector<OrderCompletion> completions;
+    ASSERT_TRUE(wait_until([&]() {
+        OrderCompletion batch[2];
+        size_t n = adapter.poll_completions(batch, 2);
+        completions.insert(completions.end(), batch, batch + n);
+        return completions.size() >= 2;
+    }));
+    EXPECT_EQ(completions[0].type, OrderRequestType::kSend);
+    EXPECT_EQ(completions[1].type, OrderRequestType::kCancel);
+    EXPECT_TRUE(completions[1].result.success);
+    EXPECT_EQ(completions[1].result.order_id, "SIM1");
+    EXPECT_EQ(adapter.stats().resting_orders, 0u);
+    EXPECT_FALSE(adapter.submit_cancel(21, "O1"));        // 确认取回后需使用交易所订单号
+    adapter.disconnect();
+}
+
+// 撮合线程空闲时阻塞等待，不占用 CPU
+TEST(SimExchangeAdapterTest, IdleMatcherDoesNotSpin) {
+    SimExchangeAdapter adapter(sim_config());
+    std::atomic<int> acks{0};
+    adapter.set_order_callback([&acks](const Order&) { acks.fetch_add(1); });
+    ASSERT_TRUE(adapter.connect());
+    std::clock_t start = std::clock();
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    double cpu_ms = 1000.0 * static_cast<double>(std::clock() - start) / CLOCKS_PER_SEC;
+    EXPECT_LT(cpu_ms, 100.0);
+
+    // 阻塞期间新请求仍能及时唤醒撮合线程
+    adapter.send_order(make_order("O1", true, 99, 1));
+    EXPECT_TRUE(wait_until([&acks]() { return acks.load() == 1; }));
+    adapter.disconnect();
+}
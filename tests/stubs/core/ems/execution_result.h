@@ -0,0 +1,20 @@
+#pragma once
+
+// 测试替身：源码快照中缺少 core/ems/execution_result.h，只提供测试与被测代码用到的字段
+
+#include <string>
+
+namespace quant {
+namespace core {
+namespace ems {
+
+// 执行结果
+struct ExecutionResult {
+    bool success = false;
+    std::string order_id;
+    std::string message;
+};
+
+} // namespace ems
+} // namespace core
+} // namespace quant
@@ -0,0 +1,17 @@
+#pragma once
+
+// 测试替身：源码快照中缺少 core/event_bus/event.h，只提供事件基类
+
+namespace quant {
+namespace core {
+namespace event_bus {
+
+// 事件基类
+class Event {
+public:
+    virtual ~Event() = default;
+};
+
+} // namespace event_bus
+} // namespace core
+} // namespace quant
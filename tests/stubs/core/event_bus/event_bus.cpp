@@ -0,0 +1,15 @@
+// 测试替身：源码快照中缺少 core/event_bus/event_bus.cpp，只提供单例
+#include "core/event_bus/event_bus.h"
+
+namespace quant {
+namespace core {
+namespace event_bus {
+
+EventBus& EventBus::instance() {
+    static EventBus bus;
+    return bus;
+}
+
+} // namespace event_bus
+} // namespace core
+} // namespace quant
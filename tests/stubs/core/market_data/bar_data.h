@@ -0,0 +1,5 @@
+#pragma once
+
+// 测试替身：源码快照中缺少 core/market_data/bar_data.h，BarData 定义在 tick_data.h 替身中
+
+#include "tick_data.h"
@@ -0,0 +1,19 @@
+#pragma once
+
+// 测试替身：源码快照中缺少 core/market_data/data_source.h，MarketDataProcessor 只按指针持有数据源
+
+#include "raw_tick_data.h"
+
+namespace quant {
+namespace core {
+namespace market_data {
+
+// 数据源接口
+class IDataSource {
+public:
+    virtual ~IDataSource() = default;
+};
+
+} // namespace market_data
+} // namespace core
+} // namespace quant
@@ -0,0 +1,17 @@
+// 测试替身：源码快照中缺少 core/market_data/market_data_processor.cpp，提供行情路径之外的最小实现
+// （不加载数据源插件，generate_bars 不生成K线）
+#include "core/market_data/market_data_processor.h"
+
+namespace quant {
+namespace core {
+namespace market_data {
+
+MarketDataProcessor::MarketDataProcessor(core::event_bus::EventBus& event_bus) : event_bus_(event_bus) {}
+
+MarketDataProcessor::~MarketDataProcessor() = default;
+
+void MarketDataProcessor::generate_bars(const TickData&) {}
+
+} // namespace market_data
+} // namespace core
+} // namespace quant
@@ -0,0 +1,6 @@
+#pragma once
+
+// 测试替身：源码快照中缺少 core/market_data/raw_tick_data.h，原始行情结构沿用 base 的定义
+// （数据源插件以 "../../core/market_data/raw_tick_data.h" 引用，经 stubs/core/strategy 包含目录解析到此处）
+
+#include "tick_data.h"
@@ -0,0 +1,29 @@
+#pragma once
+
+// 测试替身：源码快照中缺少 core/market_data/tick_data.h，行情结构沿用 base 的标准化定义
+
+#include <string>
+#include <chrono>
+#include "data_types/tick_data.h"
+
+namespace quant {
+namespace core {
+namespace market_data {
+
+using TickData = base::data_types::TickData;
+using RawTickData = base::data_types::RawTickData;
+
+// K线数据
+struct BarData {
+    std::string instrument;
+    std::chrono::system_clock::time_point timestamp;
+    double open = 0.0;
+    double high = 0.0;
+    double low = 0.0;
+    double close = 0.0;
+    int64_t volume = 0;
+};
+
+} // namespace market_data
+} // namespace core
+} // namespace quant
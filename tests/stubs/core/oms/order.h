@@ -0,0 +1,24 @@
+#pragma once
+
+// 测试替身：源码快照中缺少 core/oms/order.h，只提供测试与被测代码用到的字段
+
+#include <string>
+#include <cstdint>
+
+namespace quant {
+namespace core {
+namespace oms {
+
+// 订单
+struct Order {
+    std::string order_id;
+    std::string instrument;
+    double price = 0.0;
+    int volume = 0;
+    bool is_buy = true;
+    bool is_open = true;
+};
+
+} // namespace oms
+} // namespace core
+} // namespace quant
@@ -0,0 +1,23 @@
+#pragma once
+
+// 测试替身：源码快照中缺少 core/oms/trade.h，只提供测试与被测代码用到的字段
+
+#include <string>
+
+namespace quant {
+namespace core {
+namespace oms {
+
+// 成交
+struct Trade {
+    std::string trade_id;
+    std::string order_id;
+    std::string instrument;
+    double price = 0.0;
+    int volume = 0;
+    bool is_buy = true;
+};
+
+} // namespace oms
+} // namespace core
+} // namespace quant
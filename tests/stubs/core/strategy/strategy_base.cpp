@@ -0,0 +1,59 @@
+// 测试替身：源码快照中缺少 core/strategy/strategy_base.cpp，提供 StrategyBase 的最小实现
+// （生命周期只记录状态，信号不经过 OMS）
+#include "core/strategy/strategy_base.h"
+
+namespace quant {
+namespace core {
+namespace strategy {
+
+StrategyBase::StrategyBase(const StrategyConfig& config)
+    : config_(config), status_(StrategyStatus::kCreated), event_bus_(nullptr) {}
+
+bool StrategyBase::initialize(event_bus::EventBus& event_bus) {
+    event_bus_ = &event_bus;
+    status_ = StrategyStatus::kInitialized;
+    return true;
+}
+
+void StrategyBase::start() {
+    status_ = StrategyStatus::kRunning;
+}
+
+void StrategyBase::pause() {
+    status_ = StrategyStatus::kPaused;
+}
+
+void StrategyBase::resume() {
+    status_ = StrategyStatus::kRunning;
+}
+
+void StrategyBase::stop() {
+    status_ = StrategyStatus::kStopped;
+}
+
+std::string StrategyBase::id() const {
+    return config_.id;
+}
+
+std::string StrategyBase::name() const {
+    return config_.name;
+}
+
+StrategyStatus StrategyBase::status() const {
+    return status_;
+}
+
+std::string StrategyBase::get_parameter(const std::string& key) const {
+    auto it = config_.parameters.find(key);
+    return it == config_.parameters.end() ? std::string() : it->second;
+}
+
+void StrategyBase::set_parameter(const std::string& key, const std::string& value) {
+    config_.parameters[key] = value;
+}
+
+void StrategyBase::route_signal(const std::string&, double, int, bool, bool) {}
+
+} // namespace strategy
+} // namespace core
+} // namespace quant
@@ -0,0 +1,21 @@
+#pragma once
+
+// 测试替身：源码快照中缺少 core/strategy/strategy_config.h，只提供测试用到的定义
+
+#include <string>
+#include <unordered_map>
+
+namespace quant {
+namespace core {
+namespace strategy {
+
+// 策略配置
+struct StrategyConfig {
+    std::string id;
+    std::string name;
+    std::unordered_map<std::string, std::string> parameters;
+};
+
+} // namespace strategy
+} // namespace core
+} // namespace quant
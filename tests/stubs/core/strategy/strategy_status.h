@@ -0,0 +1,20 @@
+#pragma once
+
+// 测试替身：源码快照中缺少 core/strategy/strategy_status.h，只提供测试用到的定义
+
+namespace quant {
+namespace core {
+namespace strategy {
+
+// 策略状态
+enum class StrategyStatus {
+    kCreated,
+    kInitialized,
+    kRunning,
+    kPaused,
+    kStopped,
+};
+
+} // namespace strategy
+} // namespace core
+} // namespace quant